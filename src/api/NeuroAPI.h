@@ -127,6 +127,30 @@ bool neurosync_receive_message(int* sender_id, int* receiver_id,
                               void** data, size_t* data_size,
                               NeuroSyncMessagePriority* priority, double* weight);
 
+// Виділити буфер повідомлення для надсилання без копіювання
+// Allocate a message buffer for zero-copy sending
+// Выделить буфер сообщения для отправки без копирования
+void* neurosync_alloc_message(size_t data_size);
+
+// Надіслати повідомлення без копіювання (data - з neurosync_alloc_message, власність переходить до шини)
+// Send message without copying (data comes from neurosync_alloc_message, ownership passes to the bus)
+// Отправить сообщение без копирования (data - из neurosync_alloc_message, владение переходит к шине)
+bool neurosync_send_message_zc(int sender_id, int receiver_id, 
+                               void* data, size_t data_size,
+                               NeuroSyncMessagePriority priority, double weight);
+
+// Отримати повідомлення без копіювання (data звільняється через neurosync_release_message)
+// Receive message without copying (data is freed with neurosync_release_message)
+// Получить сообщение без копирования (data освобождается через neurosync_release_message)
+bool neurosync_receive_message_zc(int* sender_id, int* receiver_id, 
+                                  const void** data, size_t* data_size,
+                                  NeuroSyncMessagePriority* priority, double* weight);
+
+// Звільнити буфер повідомлення
+// Release a message buffer
+// Освободить буфер сообщения
+void neurosync_release_message(const void* data);
+
 // Оновити вагу зв'язку
 // Update connection weight
 // Обновить вес связи
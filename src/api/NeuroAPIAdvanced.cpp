@@ -276,6 +276,81 @@ bool neurosync_receive_message(int* sender_id, int* receiver_id,
     return false; // Помилка / Error / Ошибка
 }
 
+// Перетворити пріоритет C API на пріоритет шини
+// Convert C API priority to bus priority
+// Преобразовать приоритет C API в приоритет шины
+static NeuroSync::Synapse::Priority::MessagePriority toBusPriority(NeuroSyncMessagePriority priority) {
+    switch (priority) {
+        case MESSAGE_PRIORITY_LOW:
+            return NeuroSync::Synapse::Priority::MessagePriority::LOW;
+        case MESSAGE_PRIORITY_HIGH:
+            return NeuroSync::Synapse::Priority::MessagePriority::HIGH;
+        case MESSAGE_PRIORITY_CRITICAL:
+            return NeuroSync::Synapse::Priority::MessagePriority::CRITICAL;
+        case MESSAGE_PRIORITY_NORMAL:
+        default:
+            return NeuroSync::Synapse::Priority::MessagePriority::NORMAL;
+    }
+}
+
+// Виділити буфер повідомлення для надсилання без копіювання
+// Allocate a message buffer for zero-copy sending
+// Выделить буфер сообщения для отправки без копирования
+void* neurosync_alloc_message(size_t data_size) {
+    return NeuroSync::Synapse::Priority::MessagePayload::allocate(data_size).detach();
+}
+
+// Надіслати повідомлення без копіювання
+// Send message without copying
+// Отправить сообщение без копирования
+bool neurosync_send_message_zc(int sender_id, int receiver_id, 
+                               void* data, size_t data_size,
+                               NeuroSyncMessagePriority priority, double weight) {
+    // Шина забирає посилання в будь-якому разі, навіть якщо надсилання не вдалося
+    // The bus takes the reference in any case, even if sending fails
+    // Шина забирает ссылку в любом случае, даже если отправка не удалась
+    NeuroSync::Synapse::Priority::MessagePayload payload = 
+        NeuroSync::Synapse::Priority::MessagePayload::adopt(data);
+    
+    if (synapseBus == nullptr || (payload && !payload.setSize(data_size))) {
+        return false;
+    }
+    
+    return synapseBus->sendMessage(sender_id, receiver_id, std::move(payload), 
+                                   toBusPriority(priority), static_cast<int>(weight));
+}
+
+// Отримати повідомлення без копіювання
+// Receive message without copying
+// Получить сообщение без копирования
+bool neurosync_receive_message_zc(int* sender_id, int* receiver_id, 
+                                  const void** data, size_t* data_size,
+                                  NeuroSyncMessagePriority* priority, double* weight) {
+    if (synapseBus == nullptr || !sender_id || !receiver_id || !data || !data_size || !priority || !weight) {
+        return false;
+    }
+    
+    NeuroSync::Synapse::Priority::MessagePayload payload;
+    NeuroSync::Synapse::Priority::MessagePriority msgPriority;
+    int msgWeight;
+    if (!synapseBus->receiveMessage(*sender_id, *receiver_id, payload, msgPriority, msgWeight)) {
+        return false;
+    }
+    
+    *data_size = payload.size();
+    *data = payload.detach();
+    *priority = static_cast<NeuroSyncMessagePriority>(msgPriority);
+    *weight = msgWeight;
+    return true;
+}
+
+// Звільнити буфер повідомлення
+// Release a message buffer
+// Освободить буфер сообщения
+void neurosync_release_message(const void* data) {
+    NeuroSync::Synapse::Priority::MessagePayload::releaseRaw(data);
+}
+
 // Оновити вагу зв'язку
 // Update connection weight
 // Обновить вес связи
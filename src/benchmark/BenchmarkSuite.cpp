@@ -63,15 +63,26 @@ namespace NeuroSync {
     // Run all performance tests
     // Запуск всех тестов производительности
     std::vector<BenchmarkResult> BenchmarkSuite::runAllBenchmarks() {
-        std::lock_guard<std::mutex> lock(benchmarkMutex);
-        std::vector<BenchmarkResult> results;
+        // Копіюємо імена під блокуванням: runBenchmark сам бере benchmarkMutex
+        // Copy names under the lock: runBenchmark takes benchmarkMutex itself
+        // Копируем имена под блокировкой: runBenchmark сам берет benchmarkMutex
+        std::vector<std::string> testNames;
+        size_t iterations;
+        {
+            std::lock_guard<std::mutex> lock(benchmarkMutex);
+            for (const auto& pair : benchmarkRegistry) {
+                testNames.push_back(pair.first);
+            }
+            iterations = config.defaultIterations;
+        }
         
-        for (const auto& pair : benchmarkRegistry) {
-            const std::string& testName = pair.first;
-            BenchmarkResult result = runBenchmark(testName, config.defaultIterations);
+        std::vector<BenchmarkResult> results;
+        for (const auto& testName : testNames) {
+            BenchmarkResult result = runBenchmark(testName, iterations);
             results.push_back(result);
         }
         
+        std::lock_guard<std::mutex> lock(benchmarkMutex);
         benchmarkResults = results;
         return results;
     }
@@ -16,10 +16,17 @@ namespace Core {
           schedulingAlgorithm(nullptr),
           currentAlgorithmType(SchedulingAlgorithmType::PRIORITY_BASED),
           running(false),
+          workerPool(nullptr),
+          maxConcurrentTasks(1),
+          runningTaskCount(0),
           totalExecutionTime(0),
           completedTaskCount(0),
           failedTaskCount(0),
-          cancelledTaskCount(0) {
+          cancelledTaskCount(0),
+          deadlineTaskCount(0),
+          deadlineMissCount(0),
+          rejectedTaskCount(0),
+          maxLateness(0) {
         // Конструктор расширенного планировщика
         // Constructor of advanced scheduler
         // Конструктор розширеного планувальника
@@ -38,12 +45,20 @@ namespace Core {
         }
     }
 
-    bool AdvancedScheduler::initialize(SchedulingAlgorithmType algorithmType) {
+    bool AdvancedScheduler::initialize(SchedulingAlgorithmType algorithmType, size_t maxConcurrentTasks) {
         // Инициализация расширенного планировщика
         // Initialize advanced scheduler
         // Ініціалізація розширеного планувальника
         
         try {
+            // Ограничение одновременно выполняемых задач = размер пула (EDF делит на него нагрузку)
+            // Concurrent task limit = pool size (EDF splits the load across it)
+            // Обмеження одночасно виконуваних завдань = розмір пулу (EDF ділить на нього навантаження)
+            if (maxConcurrentTasks == 0) {
+                maxConcurrentTasks = std::max<size_t>(1, std::thread::hardware_concurrency());
+            }
+            this->maxConcurrentTasks = maxConcurrentTasks;
+            
             // Создание алгоритма планирования
             // Create scheduling algorithm
             // Створення алгоритму планування
@@ -80,6 +95,11 @@ namespace Core {
             return; // Планировщик уже запущен / Scheduler is already running / Планувальник вже запущений
         }
         
+        // Создание пула потоков для задач
+        // Create the task thread pool
+        // Створення пулу потоків для завдань
+        workerPool = std::make_unique<ThreadPool>(maxConcurrentTasks);
+        
         running = true;
         
         // Запуск потока планировщика
@@ -114,15 +134,18 @@ namespace Core {
             schedulerThread.join();
         }
         
-        // Остановка всех выполняемых задач
-        // Stop all running tasks
-        // Зупинка всіх виконуваних завдань
-        for (auto& pair : runningTasks) {
-            if (pair.second.joinable()) {
-                pair.second.join();
-            }
+        // Ожидание уже запущенных задач: пул дорабатывает свою очередь и завершает потоки
+        // Wait for already started tasks: the pool drains its queue and joins its threads
+        // Очікування вже запущених завдань: пул допрацьовує свою чергу та завершує потоки
+        workerPool.reset();
+        
+        // Пробуждение ожидающих простоя
+        // Wake up idle waiters
+        // Пробудження тих, хто очікує простою
+        {
+            std::lock_guard<std::mutex> lock(schedulerMutex);
+            idleCondition.notify_all();
         }
-        runningTasks.clear();
     }
 
     int AdvancedScheduler::addTask(const std::string& name, Utils::TaskType type, int priority, int weight, void (*function)(), void* userData) {
@@ -130,24 +153,45 @@ namespace Core {
         // Add a task to the advanced scheduler
         // Додавання завдання до розширеного планувальника
         
+        return addTask(name, type, priority, weight, function, std::vector<int>(), userData);
+    }
+
+    int AdvancedScheduler::addTask(const std::string& name, Utils::TaskType type, int priority, int weight, void (*function)(),
+                                   const std::vector<int>& dependencies, void* userData) {
+        // Добавление задачи с зависимостями в расширенный планировщик
+        // Add a task with dependencies to the advanced scheduler
+        // Додавання завдання із залежностями до розширеного планувальника
+        
         if (!running || !schedulingAlgorithm) {
             return -1; // Планировщик не инициализирован или не запущен / Scheduler not initialized or not running / Планувальник не ініціалізовано або не запущено
         }
         
-        // Создание задачи через менеджер задач
-        // Create task through task manager
-        // Створення завдання через менеджер завдань
-        int taskId = taskManager->createTask(name, type, priority, weight, function, userData);
-        if (taskId <= 0) {
-            return -1; // Ошибка создания задачи / Error creating task / Помилка створення завдання
-        }
-        
-        // Добавление задачи в алгоритм планирования
-        // Add task to scheduling algorithm
-        // Додавання завдання до алгоритму планування
+        int taskId;
         {
             std::lock_guard<std::mutex> lock(schedulerMutex);
-            schedulingAlgorithm->addTask(taskId, priority);
+            
+            // Создание задачи и ее зависимостей через менеджер задач
+            // Create the task and its dependencies through the task manager
+            // Створення завдання та його залежностей через менеджер завдань
+            {
+                std::lock_guard<std::mutex> taskLock(taskMutex);
+                taskId = taskManager->createTask(name, type, priority, weight, function, userData);
+                if (taskId <= 0) {
+                    return -1; // Ошибка создания задачи / Error creating task / Помилка створення завдання
+                }
+                
+                for (int dependencyId : dependencies) {
+                    if (!taskManager->addTaskDependency(taskId, dependencyId)) {
+                        taskManager->deleteTask(taskId);
+                        return -1; // Неизвестная, неудачная или циклическая зависимость / Unknown, failed or cyclic dependency / Невідома, невдала або циклічна залежність
+                    }
+                }
+            }
+            
+            // Задача без незавершенных зависимостей сразу попадает в алгоритм планирования
+            // A task without unfinished dependencies goes straight into the scheduling algorithm
+            // Завдання без незавершених залежностей одразу потрапляє до алгоритму планування
+            releaseReadyTasks();
         }
         
         // Уведомление планировщика о новой задаче
@@ -158,6 +202,83 @@ namespace Core {
         return taskId;
     }
 
+    int AdvancedScheduler::addDeadlineTask(const std::string& name, Utils::TaskType type, int priority, long long relativeDeadline,
+                                           long long estimatedExecutionTime, void (*function)(), void* userData) {
+        // Добавление задачи с крайним сроком в расширенный планировщик
+        // Add a task with a deadline to the advanced scheduler
+        // Додавання завдання з крайнім строком до розширеного планувальника
+        
+        return addDeadlineTask(name, type, priority, relativeDeadline, estimatedExecutionTime, function,
+                               std::vector<int>(), userData);
+    }
+
+    int AdvancedScheduler::addDeadlineTask(const std::string& name, Utils::TaskType type, int priority, long long relativeDeadline,
+                                           long long estimatedExecutionTime, void (*function)(), const std::vector<int>& dependencies,
+                                           void* userData) {
+        // Добавление задачи с крайним сроком и зависимостями в расширенный планировщик
+        // Add a task with a deadline and dependencies to the advanced scheduler
+        // Додавання завдання з крайнім строком і залежностями до розширеного планувальника
+        
+        if (!running || !schedulingAlgorithm || relativeDeadline <= 0) {
+            return -1; // Планировщик не запущен или срок некорректен / Scheduler not running or invalid deadline / Планувальник не запущено або строк некоректний
+        }
+        
+        int taskId;
+        {
+            std::lock_guard<std::mutex> lock(schedulerMutex);
+            
+            long long now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+            long long deadline = now + relativeDeadline;
+            
+            // Контроль допуска: EDF отклоняет задачу, которая не успевает или срывает допущенные
+            // (включая выполняющиеся задачи и задачи, ждущие зависимостей)
+            // Admission control: EDF rejects a task that cannot make it or would break admitted ones
+            // (including running tasks and tasks waiting for dependencies)
+            // Контроль допуску: EDF відхиляє завдання, яке не встигає або зриває допущені
+            // (включно із завданнями, що виконуються, та завданнями, що чекають залежностей)
+            Algorithms::EarliestDeadlineFirstScheduling* edfAlgorithm = deadlineAlgorithm(schedulingAlgorithm.get());
+            if (edfAlgorithm && !edfAlgorithm->canAdmit(deadline, estimatedExecutionTime, now)) {
+                std::lock_guard<std::mutex> statsLock(statisticsMutex);
+                rejectedTaskCount++;
+                return -1;
+            }
+            
+            {
+                std::lock_guard<std::mutex> taskLock(taskMutex);
+                taskId = taskManager->createTask(name, type, priority, 1, function, userData);
+                if (taskId <= 0) {
+                    return -1; // Ошибка создания задачи / Error creating task / Помилка створення завдання
+                }
+                for (int dependencyId : dependencies) {
+                    if (!taskManager->addTaskDependency(taskId, dependencyId)) {
+                        taskManager->deleteTask(taskId);
+                        return -1; // Неизвестная, неудачная или циклическая зависимость / Unknown, failed or cyclic dependency / Невідома, невдала або циклічна залежність
+                    }
+                }
+                taskManager->updateTaskDeadline(taskId, deadline, estimatedExecutionTime);
+            }
+            {
+                std::lock_guard<std::mutex> statsLock(statisticsMutex);
+                deadlineTaskCount++;
+            }
+            
+            // Резерв держит оценку в допуске, пока задача ждет зависимостей; готовая задача
+            // сразу переходит из резерва в очередь
+            // The reservation keeps the estimate in admission while the task waits for dependencies;
+            // a ready task moves from the reservation into the queue right away
+            // Резерв тримає оцінку в допуску, поки завдання чекає залежностей; готове завдання
+            // одразу переходить з резерву до черги
+            if (edfAlgorithm) {
+                edfAlgorithm->reserveTask(taskId, deadline, estimatedExecutionTime);
+            }
+            releaseReadyTasks();
+        }
+        
+        schedulerCondition.notify_one();
+        return taskId;
+    }
+
     bool AdvancedScheduler::removeTask(int taskId) {
         // Удаление задачи из расширенного планировщика
         // Remove a task from the advanced scheduler
@@ -167,18 +288,37 @@ namespace Core {
             return false; // Планировщик не инициализирован или не запущен / Scheduler not initialized or not running / Планувальник не ініціалізовано або не запущено
         }
         
-        // Удаление задачи из алгоритма планирования
-        // Remove task from scheduling algorithm
-        // Видалення завдання з алгоритму планування
+        bool deleted;
+        std::vector<int> cancelledTasks;
         {
             std::lock_guard<std::mutex> lock(schedulerMutex);
+            
+            // Удаление задачи из алгоритма планирования
+            // Remove task from scheduling algorithm
+            // Видалення завдання з алгоритму планування
             schedulingAlgorithm->removeTask(taskId);
+            
+            // Удаление задачи из менеджера задач; если она не завершилась,
+            // ожидающие ее последователи отменяются, как при неудаче
+            // Remove task from task manager; if it has not finished,
+            // the successors waiting for it are cancelled, as on failure
+            // Видалення завдання з менеджера завдань; якщо воно не завершилося,
+            // наступники, що на нього чекають, скасовуються, як при невдачі
+            {
+                std::lock_guard<std::mutex> taskLock(taskMutex);
+                deleted = taskManager->deleteTask(taskId, &cancelledTasks);
+            }
+            for (int cancelledTaskId : cancelledTasks) {
+                schedulingAlgorithm->removeTask(cancelledTaskId);
+            }
+        }
+        
+        for (int cancelledTaskId : cancelledTasks) {
+            updateStatistics(cancelledTaskId, Utils::TaskStatus::CANCELLED, 0);
         }
         
-        // Удаление задачи из менеджера задач
-        // Remove task from task manager
-        // Видалення завдання з менеджера завдань
-        return taskManager->deleteTask(taskId);
+        schedulerCondition.notify_one();
+        return deleted;
     }
 
     bool AdvancedScheduler::updateTaskPriority(int taskId, int priority) {
@@ -193,7 +333,11 @@ namespace Core {
         // Обновление приоритета задачи в менеджере задач
         // Update task priority in task manager
         // Оновлення пріоритету завдання в менеджері завдань
-        bool success = taskManager->updateTaskPriority(taskId, priority);
+        bool success;
+        {
+            std::lock_guard<std::mutex> lock(taskMutex);
+            success = taskManager->updateTaskPriority(taskId, priority);
+        }
         if (!success) {
             return false;
         }
@@ -218,32 +362,25 @@ namespace Core {
             return false;
         }
         
-        Utils::Task* task = taskManager->getTask(taskId);
-        if (task == nullptr) {
-            return false;
+        {
+            std::lock_guard<std::mutex> lock(taskMutex);
+            Utils::Task* task = taskManager->getTask(taskId);
+            if (task == nullptr) {
+                return false;
+            }
+            
+            // Обновление веса задачи в менеджере задач
+            // Update task weight in task manager
+            // Оновлення ваги завдання в менеджері завдань
+            task->weight = weight;
         }
         
-        // Обновление веса задачи в менеджере задач
-        // Update task weight in task manager
-        // Оновлення ваги завдання в менеджері завдань
-        task->weight = weight;
-        
-        // Для алгоритма Weighted Fair Queuing обновляем вес
-        // For Weighted Fair Queuing algorithm, update weight
-        // Для алгоритму Weighted Fair Queuing оновлюємо вагу
-        if (currentAlgorithmType == SchedulingAlgorithmType::WEIGHTED_FAIR_QUEUING) {
-            // Приведение schedulingAlgorithm к типу WeightedFairQueuingScheduling
-            // Cast schedulingAlgorithm to WeightedFairQueuingScheduling type
-            // Приведення schedulingAlgorithm до типу WeightedFairQueuingScheduling
-            NeuroSync::Core::Algorithms::WeightedFairQueuingScheduling* wfqAlgorithm = 
-                dynamic_cast<NeuroSync::Core::Algorithms::WeightedFairQueuingScheduling*>(schedulingAlgorithm.get());
-            
-            if (wfqAlgorithm) {
-                // Обновление веса задачи в алгоритме WFQ
-                // Update task weight in WFQ algorithm
-                // Оновлення ваги завдання в алгоритмі WFQ
-                wfqAlgorithm->setTaskWeight(taskId, weight);
-            }
+        // Для алгоритмов Weighted Fair Queuing обновляем вес
+        // For Weighted Fair Queuing algorithms, update weight
+        // Для алгоритмів Weighted Fair Queuing оновлюємо вагу
+        {
+            std::lock_guard<std::mutex> lock(schedulerMutex);
+            setAlgorithmTaskWeight(*schedulingAlgorithm, taskId, weight);
         }
         
         return true;
@@ -254,6 +391,7 @@ namespace Core {
         // Get task status from advanced scheduler
         // Отримання статусу завдання з розширеного планувальника
         
+        std::lock_guard<std::mutex> lock(taskMutex);
         Utils::Task* task = taskManager->getTask(taskId);
         if (task != nullptr) {
             return task->status;
@@ -293,40 +431,50 @@ namespace Core {
             // Implementation of task transfer
             // Реалізація перенесення завдань
             if (taskManager && schedulingAlgorithm) {
-                // Получение всех задач из менеджера задач
-                // Get all tasks from task manager
-                // Отримання всіх завдань з менеджера завдань
-                const auto& tasks = taskManager->getAllTasks();
+                std::lock_guard<std::mutex> taskLock(taskMutex);
+                
+                // Получение ожидающих задач из менеджера задач
+                // Get pending tasks from task manager
+                // Отримання очікуючих завдань з менеджера завдань
+                std::vector<std::shared_ptr<Utils::Task>> tasks = taskManager->getTasksByStatus(Utils::TaskStatus::PENDING);
                 
-                // Добавление задач в новый алгоритм
-                // Add tasks to new algorithm
-                // Додавання завдань до нового алгоритму
+                // Добавление готовых задач в новый алгоритм (заблокированные ждут своих зависимостей;
+                // в EDF их сроки резервируются)
+                // Add ready tasks to new algorithm (blocked ones wait for their dependencies;
+                // EDF reserves their deadlines)
+                // Додавання готових завдань до нового алгоритму (заблоковані чекають своїх залежностей;
+                // в EDF їхні строки резервуються)
+                Algorithms::EarliestDeadlineFirstScheduling* edfAlgorithm = deadlineAlgorithm(newAlgorithm.get());
                 for (const auto& taskPtr : tasks) {
                     const Utils::Task* task = taskPtr.get();
-                    if (task && task->status == Utils::TaskStatus::PENDING) {
-                        newAlgorithm->addTask(task->id, task->priority);
+                    if (task && taskManager->isTaskReady(task->id)) {
+                        enqueueTask(*newAlgorithm, *task);
                         
-                        // Для алгоритма Weighted Fair Queuing также устанавливаем вес
-                        // For Weighted Fair Queuing algorithm, also set weight
-                        // Для алгоритму Weighted Fair Queuing також встановлюємо вагу
-                        if (algorithmType == SchedulingAlgorithmType::WEIGHTED_FAIR_QUEUING) {
-                            NeuroSync::Core::Algorithms::WeightedFairQueuingScheduling* wfqAlgorithm = 
-                                dynamic_cast<NeuroSync::Core::Algorithms::WeightedFairQueuingScheduling*>(newAlgorithm.get());
-                            
-                            if (wfqAlgorithm) {
-                                wfqAlgorithm->setTaskWeight(task->id, task->weight);
-                            }
-                        }
+                        // Для алгоритмов Weighted Fair Queuing также устанавливаем вес
+                        // For Weighted Fair Queuing algorithms, also set weight
+                        // Для алгоритмів Weighted Fair Queuing також встановлюємо вагу
+                        setAlgorithmTaskWeight(*newAlgorithm, task->id, task->weight);
+                    } else if (task && edfAlgorithm) {
+                        edfAlgorithm->reserveTask(task->id, task->deadline, task->estimatedExecutionTime);
+                    }
+                }
+                
+                // Выполняющиеся задачи занимают исполнителей и в новом алгоритме
+                // Running tasks occupy executors in the new algorithm as well
+                // Завдання, що виконуються, займають виконавців і в новому алгоритмі
+                if (edfAlgorithm) {
+                    for (const auto& taskPtr : taskManager->getTasksByStatus(Utils::TaskStatus::RUNNING)) {
+                        edfAlgorithm->startTask(taskPtr->id, taskPtr->estimatedExecutionTime, taskPtr->startTime);
                     }
                 }
             }
-        }
-        
-        // Замена алгоритма
-        // Replace algorithm
-        // Заміна алгоритму
-        {
-            std::lock_guard<std::mutex> lock(schedulerMutex);
+            
+            // Замена алгоритма в той же критической секции, чтобы задачи, начатые или завершенные
+            // между переносом и заменой, не разошлись с новым алгоритмом
+            // Replace the algorithm in the same critical section, so tasks started or finished
+            // between the transfer and the swap do not diverge from the new algorithm
+            // Заміна алгоритму в тій самій критичній секції, щоб завдання, розпочаті або завершені
+            // між перенесенням і заміною, не розійшлися з новим алгоритмом
             schedulingAlgorithm = std::move(newAlgorithm);
         }
         
@@ -348,6 +496,7 @@ namespace Core {
         // Отримання кількості завдань
         
         if (taskManager) {
+            std::lock_guard<std::mutex> lock(taskMutex);
             return taskManager->getTaskCount();
         }
         
@@ -360,7 +509,7 @@ namespace Core {
         // Отримання кількості виконуваних завдань
         
         std::lock_guard<std::mutex> lock(schedulerMutex);
-        return runningTasks.size();
+        return runningTaskCount;
     }
 
     size_t AdvancedScheduler::getPendingTaskCount() const {
@@ -376,6 +525,29 @@ namespace Core {
         return schedulingAlgorithm->getTaskCount();
     }
 
+    size_t AdvancedScheduler::getMaxConcurrentTasks() const {
+        // Получение ограничения на число одновременно выполняемых задач
+        // Get the limit on concurrently running tasks
+        // Отримання обмеження на кількість одночасно виконуваних завдань
+        
+        return maxConcurrentTasks;
+    }
+
+    void AdvancedScheduler::waitForAllTasks() {
+        // Ожидание простоя планировщика (уведомляется при завершении задач)
+        // Wait for the scheduler to become idle (notified on task completion)
+        // Очікування простою планувальника (сповіщається при завершенні завдань)
+        
+        if (!schedulingAlgorithm) {
+            return;
+        }
+        
+        std::unique_lock<std::mutex> lock(schedulerMutex);
+        idleCondition.wait(lock, [this]() {
+            return !running || (runningTaskCount == 0 && schedulingAlgorithm->isEmpty());
+        });
+    }
+
     AdvancedScheduler::SchedulerStatistics AdvancedScheduler::getStatistics() const {
         // Получение статистики планировщика
         // Get scheduler statistics
@@ -395,6 +567,10 @@ namespace Core {
             stats.failedTasks = failedTaskCount;
             stats.cancelledTasks = cancelledTaskCount;
             stats.totalExecutionTime = totalExecutionTime;
+            stats.deadlineTasks = deadlineTaskCount;
+            stats.deadlineMisses = deadlineMissCount;
+            stats.rejectedTasks = rejectedTaskCount;
+            stats.maxLateness = maxLateness;
             
             size_t totalCompleted = completedTaskCount + failedTaskCount + cancelledTaskCount;
             if (totalCompleted > 0) {
@@ -421,14 +597,13 @@ namespace Core {
             {
                 std::unique_lock<std::mutex> lock(schedulerMutex);
                 
-                // Ожидание задач, если очередь пуста
-                // Wait for tasks if queue is empty
-                // Очікування завдань, якщо черга порожня
-                if (schedulingAlgorithm->isEmpty()) {
-                    schedulerCondition.wait(lock, [this]() {
-                        return !running || !schedulingAlgorithm->isEmpty();
-                    });
-                }
+                // Ожидание задачи и свободного места в пуле; цикл будят addTask и завершение задач
+                // Wait for a task and a free pool slot; addTask and task completion wake the loop
+                // Очікування завдання та вільного місця в пулі; цикл будять addTask і завершення завдань
+                schedulerCondition.wait(lock, [this]() {
+                    return !running ||
+                           (runningTaskCount < maxConcurrentTasks && !schedulingAlgorithm->isEmpty());
+                });
                 
                 // Если планировщик остановлен, выходим из цикла
                 // If scheduler is stopped, exit loop
@@ -441,115 +616,177 @@ namespace Core {
                 // Select next task
                 // Вибір наступного завдання
                 taskId = schedulingAlgorithm->selectNextTask();
+                if (taskId <= 0) {
+                    continue;
+                }
+
+                // Задача выполняется до завершения, поэтому снимается с очереди алгоритма
+                // (Round Robin оставляет выбранную задачу в очереди до явного удаления)
+                // The task runs to completion, so it is taken off the algorithm's queue
+                // (Round Robin keeps a selected task queued until it is removed explicitly)
+                // Завдання виконується до завершення, тому знімається з черги алгоритму
+                // (Round Robin залишає вибране завдання в черзі до явного видалення)
+                schedulingAlgorithm->removeTask(taskId);
+                runningTaskCount++;
+                
+                // Обновление статуса задачи на RUNNING; EDF учитывает задачу как занимающую
+                // исполнителя до ее завершения
+                // Update task status to RUNNING; EDF counts the task as occupying an executor
+                // until it completes
+                // Оновлення статусу завдання на RUNNING; EDF враховує завдання як таке, що займає
+                // виконавця до його завершення
+                std::lock_guard<std::mutex> taskLock(taskMutex);
+                taskManager->updateTaskStatus(taskId, Utils::TaskStatus::RUNNING);
+                if (Algorithms::EarliestDeadlineFirstScheduling* edfAlgorithm = deadlineAlgorithm(schedulingAlgorithm.get())) {
+                    const Utils::Task* task = taskManager->getTask(taskId);
+                    edfAlgorithm->startTask(taskId, task->estimatedExecutionTime, task->startTime);
+                }
             }
             
-            // Если есть задача для выполнения
-            // If there is a task to execute
-            // Якщо є завдання для виконання
-            if (taskId > 0) {
-                // Обновление статуса задачи на RUNNING
-                // Update task status to RUNNING
-                // Оновлення статусу завдання на RUNNING
-                taskManager->updateTaskStatus(taskId, Utils::TaskStatus::RUNNING);
-                
-                // Запуск задачи в отдельном потоке
-                // Run task in separate thread
-                // Запуск завдання в окремому потоці
-                std::thread taskThread(&AdvancedScheduler::executeTask, this, taskId);
-                
-                // Добавление потока в карту выполняемых задач
-                // Add thread to map of running tasks
-                // Додавання потоку до карти виконуваних завдань
-                {
-                    std::lock_guard<std::mutex> lock(schedulerMutex);
-                    runningTasks[taskId] = std::move(taskThread);
+            // Передача задачи в пул потоков
+            // Hand the task over to the thread pool
+            // Передача завдання до пулу потоків
+            workerPool->enqueue([this, taskId]() { executeTask(taskId); });
+        }
+    }
+
+    void AdvancedScheduler::executeTask(int taskId) {
+        // Выполнение задачи в потоке пула
+        // Execute a task on a pool thread
+        // Виконання завдання в потоці пулу
+        
+        void (*function)() = nullptr;
+        long long deadline = 0;
+        bool found = false;
+        std::vector<int> cancelledTasks;
+        {
+            std::lock_guard<std::mutex> lock(taskMutex);
+            Utils::Task* task = taskManager->getTask(taskId);
+            if (task != nullptr) {
+                function = task->function;
+                deadline = task->deadline;
+                found = true;
+            }
+        }
+        
+        if (found) {
+            Utils::TaskStatus finalStatus = Utils::TaskStatus::COMPLETED;
+            long long startTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+            
+            try {
+                // Выполнение функции задачи
+                // Execute task function
+                // Виконання функції завдання
+                if (function) {
+                    function();
                 }
+            } catch (...) {
+                finalStatus = Utils::TaskStatus::FAILED;
             }
             
-            // Очистка завершенных потоков
-            // Clean up completed threads
-            // Очищення завершених потоків
+            long long endTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+            long long executionTime = endTime - startTime;
+            
+            // Обновление статуса задачи; неудача отменяет ожидающих ее последователей
+            // Update task status; a failure cancels the successors waiting for it
+            // Оновлення статусу завдання; невдача скасовує наступників, що на нього чекають
             {
-                std::lock_guard<std::mutex> lock(schedulerMutex);
-                auto it = runningTasks.begin();
-                while (it != runningTasks.end()) {
-                    if (!it->second.joinable() || 
-                        taskManager->getTask(it->first)->status != Utils::TaskStatus::RUNNING) {
-                        // Задача завершена, удаляем поток
-                        // Task completed, remove thread
-                        // Завдання завершено, видаляємо потік
-                        if (it->second.joinable()) {
-                            it->second.join();
-                        }
-                        it = runningTasks.erase(it);
-                    } else {
-                        ++it;
-                    }
-                }
+                std::lock_guard<std::mutex> lock(taskMutex);
+                taskManager->updateTaskStatus(taskId, finalStatus, &cancelledTasks);
+            }
+            
+            // Обновление статистики
+            // Update statistics
+            // Оновлення статистики
+            updateStatistics(taskId, finalStatus, executionTime);
+            for (int cancelledTaskId : cancelledTasks) {
+                updateStatistics(cancelledTaskId, Utils::TaskStatus::CANCELLED, 0);
             }
             
-            // Небольшая задержка для предотвращения излишней нагрузки на CPU
-            // Small delay to prevent excessive CPU load
-            // Невелика затримка для запобігання надмірному навантаженню на CPU
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            // Задача, завершившаяся после своего срока, считается пропуском срока
+            // A task that finished after its deadline counts as a deadline miss
+            // Завдання, що завершилося після свого строку, вважається пропуском строку
+            if (deadline > 0 && endTime > deadline) {
+                std::lock_guard<std::mutex> lock(statisticsMutex);
+                deadlineMissCount++;
+                maxLateness = std::max(maxLateness, endTime - deadline);
+            }
         }
         
-        // Ожидание завершения всех оставшихся потоков
-        // Wait for all remaining threads to complete
-        // Очікування завершення всіх решти потоків
-        {
-            std::lock_guard<std::mutex> lock(schedulerMutex);
-            for (auto& pair : runningTasks) {
-                if (pair.second.joinable()) {
-                    pair.second.join();
-                }
-            }
-            runningTasks.clear();
+        // Уведомление о завершении: освобождается место в пуле, а последователи,
+        // ставшие готовыми, попадают в очередь до проверки простоя
+        // Completion notification: a pool slot becomes free, and successors that
+        // became ready are queued before the idle check
+        // Сповіщення про завершення: звільняється місце в пулі, а наступники,
+        // що стали готовими, потрапляють до черги до перевірки простою
+        // Отмененные последователи снимаются с резерва EDF
+        // Cancelled successors are dropped from the EDF reservations
+        // Скасовані наступники знімаються з резерву EDF
+        std::lock_guard<std::mutex> lock(schedulerMutex);
+        if (Algorithms::EarliestDeadlineFirstScheduling* edfAlgorithm = deadlineAlgorithm(schedulingAlgorithm.get())) {
+            edfAlgorithm->finishTask(taskId);
+        }
+        for (int cancelledTaskId : cancelledTasks) {
+            schedulingAlgorithm->removeTask(cancelledTaskId);
+        }
+        releaseReadyTasks();
+        runningTaskCount--;
+        schedulerCondition.notify_one();
+        if (runningTaskCount == 0 && schedulingAlgorithm->isEmpty()) {
+            idleCondition.notify_all();
         }
     }
 
-    void AdvancedScheduler::executeTask(int taskId) {
-        // Выполнение задачи
-        // Execute a task
-        // Виконання завдання
-    
-        Utils::Task* task = taskManager->getTask(taskId);
-        if (task == nullptr) {
+    void AdvancedScheduler::releaseReadyTasks() {
+        // Перенос готовых задач в алгоритм планирования без опроса менеджера задач
+        // Move ready tasks into the scheduling algorithm without polling the task manager
+        // Перенесення готових завдань до алгоритму планування без опитування менеджера завдань
+        
+        std::lock_guard<std::mutex> taskLock(taskMutex);
+        readyTaskBuffer.clear();
+        if (taskManager->takeReadyTasks(readyTaskBuffer) == 0) {
             return;
         }
         
-        Utils::TaskStatus finalStatus = Utils::TaskStatus::COMPLETED;
-        long long startTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::high_resolution_clock::now().time_since_epoch()).count();
-        
-        try {
-            // Выполнение функции задачи
-            // Execute task function
-            // Виконання функції завдання
-            if (task->function) {
-                task->function();
+        for (int taskId : readyTaskBuffer) {
+            Utils::Task* task = taskManager->getTask(taskId);
+            if (task != nullptr) {
+                enqueueTask(*schedulingAlgorithm, *task);
             }
-        } catch (...) {
-            finalStatus = Utils::TaskStatus::FAILED;
         }
+    }
+
+    void AdvancedScheduler::enqueueTask(SchedulingAlgorithm& algorithm, const Utils::Task& task) {
+        // Постановка готовой задачи в алгоритм планирования
+        // Queue a ready task in the scheduling algorithm
+        // Постановка готового завдання до алгоритму планування
         
-        long long endTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::high_resolution_clock::now().time_since_epoch()).count();
-        long long executionTime = endTime - startTime;
-        
-        // Обновление статуса задачи
-        // Update task status
-        // Оновлення статусу завдання
-        taskManager->updateTaskStatus(taskId, finalStatus);
-        
-        // Обновление статистики
-        // Update statistics
-        // Оновлення статистики
-        updateStatistics(taskId, finalStatus, executionTime);
-        
-        // Удаление задачи из карты выполняемых задач будет выполнено в основном цикле
-        // Removing task from map of running tasks will be done in main loop
-        // Видалення завдання з карти виконуваних завдань буде виконано в основному циклі
+        Algorithms::EarliestDeadlineFirstScheduling* edfAlgorithm = deadlineAlgorithm(&algorithm);
+        if (edfAlgorithm) {
+            edfAlgorithm->addTask(task.id, task.priority, task.deadline, task.estimatedExecutionTime);
+        } else {
+            algorithm.addTask(task.id, task.priority);
+        }
+    }
+
+    Algorithms::EarliestDeadlineFirstScheduling* AdvancedScheduler::deadlineAlgorithm(SchedulingAlgorithm* algorithm) {
+        return dynamic_cast<Algorithms::EarliestDeadlineFirstScheduling*>(algorithm);
+    }
+
+    void AdvancedScheduler::setAlgorithmTaskWeight(SchedulingAlgorithm& algorithm, int taskId, int weight) {
+        // Передача веса задачи алгоритмам Weighted Fair Queuing; остальные алгоритмы вес не используют
+        // Pass the task weight to the Weighted Fair Queuing algorithms; the others do not use weights
+        // Передача ваги завдання алгоритмам Weighted Fair Queuing; решта алгоритмів вагу не використовує
+        
+        if (Algorithms::WeightedFairQueuingScheduling* wfqAlgorithm =
+                dynamic_cast<Algorithms::WeightedFairQueuingScheduling*>(&algorithm)) {
+            wfqAlgorithm->setTaskWeight(taskId, weight);
+        } else if (Algorithms::CalendarFairQueuingScheduling* calendarAlgorithm =
+                       dynamic_cast<Algorithms::CalendarFairQueuingScheduling*>(&algorithm)) {
+            calendarAlgorithm->setTaskWeight(taskId, weight);
+        }
     }
 
     void AdvancedScheduler::updateStatistics(int taskId, Utils::TaskStatus status, long long executionTime) {
@@ -588,6 +825,10 @@ namespace Core {
                 return std::make_unique<Algorithms::RoundRobinScheduling>();
             case SchedulingAlgorithmType::WEIGHTED_FAIR_QUEUING:
                 return std::make_unique<Algorithms::WeightedFairQueuingScheduling>();
+            case SchedulingAlgorithmType::CALENDAR_FAIR_QUEUING:
+                return std::make_unique<Algorithms::CalendarFairQueuingScheduling>();
+            case SchedulingAlgorithmType::EARLIEST_DEADLINE_FIRST:
+                return std::make_unique<Algorithms::EarliestDeadlineFirstScheduling>(maxConcurrentTasks);
             default:
                 return nullptr;
         }
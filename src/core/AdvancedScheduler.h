@@ -6,11 +6,13 @@
 #include "algorithms/PriorityBasedScheduling.h"
 #include "algorithms/RoundRobinScheduling.h"
 #include "algorithms/WeightedFairQueuingScheduling.h"
+#include "algorithms/EarliestDeadlineFirstScheduling.h"
+#include "algorithms/CalendarFairQueuingScheduling.h"
+#include "../threadpool/ThreadPool.h"
 #include <thread>
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
-#include <map>
 
 // AdvancedScheduler.h
 // Расширенный планировщик задач для NeuroSync OS Sparky
@@ -24,9 +26,11 @@ namespace Core {
     // Scheduling algorithm type
     // Тип алгоритму планування
     enum class SchedulingAlgorithmType {
-        PRIORITY_BASED,         // На основе приоритетов / Priority-based / На основі пріоритетів
-        ROUND_ROBIN,            // Round Robin / Round Robin / Round Robin
-        WEIGHTED_FAIR_QUEUING   // Weighted Fair Queuing / Weighted Fair Queuing / Weighted Fair Queuing
+        PRIORITY_BASED,          // На основе приоритетов / Priority-based / На основі пріоритетів
+        ROUND_ROBIN,             // Round Robin / Round Robin / Round Robin
+        WEIGHTED_FAIR_QUEUING,   // Weighted Fair Queuing / Weighted Fair Queuing / Weighted Fair Queuing
+        EARLIEST_DEADLINE_FIRST, // По ближайшему сроку / Earliest deadline first / За найближчим строком
+        CALENDAR_FAIR_QUEUING    // WFQ на календарной очереди / WFQ on a calendar queue / WFQ на календарній черзі
     };
 
     // Расширенный планировщик задач
@@ -37,10 +41,14 @@ namespace Core {
         AdvancedScheduler();
         ~AdvancedScheduler();
         
-        // Инициализация планировщика
-        // Initialize the scheduler
-        // Ініціалізація планувальника
-        bool initialize(SchedulingAlgorithmType algorithmType = SchedulingAlgorithmType::PRIORITY_BASED);
+        // Инициализация планировщика. Задачи выполняются на пуле из maxConcurrentTasks потоков
+        // (0 - по числу аппаратных потоков); больше задач одновременно не запускается.
+        // Initialize the scheduler. Tasks run on a pool of maxConcurrentTasks threads
+        // (0 - one per hardware thread); no more tasks than that run at the same time.
+        // Ініціалізація планувальника. Завдання виконуються на пулі з maxConcurrentTasks потоків
+        // (0 - за кількістю апаратних потоків); одночасно більше завдань не запускається.
+        bool initialize(SchedulingAlgorithmType algorithmType = SchedulingAlgorithmType::PRIORITY_BASED,
+                        size_t maxConcurrentTasks = 0);
         
         // Запуск планировщика
         // Start the scheduler
@@ -57,9 +65,43 @@ namespace Core {
         // Додавання завдання до планувальника
         int addTask(const std::string& name, Utils::TaskType type, int priority, int weight, void (*function)(), void* userData = nullptr);
         
-        // Удаление задачи из планировщика
-        // Remove a task from the scheduler
-        // Видалення завдання з планувальника
+        // Добавление задачи, которая ждет завершения задач dependencies. Задача попадает в очередь
+        // алгоритма, только когда все зависимости завершены; неудача зависимости отменяет ее.
+        // Add a task that waits for the dependencies tasks to complete. The task enters the
+        // algorithm's queue only once every dependency has completed; a failed dependency cancels it.
+        // Додавання завдання, яке чекає завершення завдань dependencies. Завдання потрапляє до черги
+        // алгоритму, лише коли всі залежності завершені; невдача залежності скасовує його.
+        int addTask(const std::string& name, Utils::TaskType type, int priority, int weight, void (*function)(),
+                    const std::vector<int>& dependencies, void* userData = nullptr);
+        
+        // Добавление задачи с крайним сроком через relativeDeadline мс и оценкой времени выполнения (мс).
+        // С алгоритмом EARLIEST_DEADLINE_FIRST задача проходит контроль допуска (отклоненная - -1);
+        // с другими алгоритмами срок только учитывается в счетчиках пропусков.
+        // Add a task due relativeDeadline ms from now with a run-time estimate (ms).
+        // With EARLIEST_DEADLINE_FIRST the task goes through admission control (a rejected one gives -1);
+        // with other algorithms the deadline only feeds the miss counters.
+        // Додавання завдання з крайнім строком через relativeDeadline мс та оцінкою часу виконання (мс).
+        // З алгоритмом EARLIEST_DEADLINE_FIRST завдання проходить контроль допуску (відхилене - -1);
+        // з іншими алгоритмами строк лише враховується в лічильниках пропусків.
+        int addDeadlineTask(const std::string& name, Utils::TaskType type, int priority, long long relativeDeadline,
+                            long long estimatedExecutionTime, void (*function)(), void* userData = nullptr);
+        
+        // Добавление задачи с крайним сроком, которая ждет завершения задач dependencies.
+        // Допуск проверяется сразу: пока задача ждет, ее оценка резервируется в EDF.
+        // Add a deadline task that waits for the dependencies tasks to complete.
+        // Admission is checked right away: while the task waits, its estimate is reserved in EDF.
+        // Додавання завдання з крайнім строком, яке чекає завершення завдань dependencies.
+        // Допуск перевіряється одразу: поки завдання чекає, його оцінка резервується в EDF.
+        int addDeadlineTask(const std::string& name, Utils::TaskType type, int priority, long long relativeDeadline,
+                            long long estimatedExecutionTime, void (*function)(), const std::vector<int>& dependencies,
+                            void* userData = nullptr);
+        
+        // Удаление задачи из планировщика; если она еще не завершилась, ожидающие ее
+        // последователи отменяются (и учитываются в статистике как отмененные)
+        // Remove a task from the scheduler; if it has not finished yet, the successors
+        // waiting for it are cancelled (and counted as cancelled in the statistics)
+        // Видалення завдання з планувальника; якщо воно ще не завершилося, наступники,
+        // що на нього чекають, скасовуються (і враховуються в статистиці як скасовані)
         bool removeTask(int taskId);
         
         // Обновление приоритета задачи
@@ -102,6 +144,16 @@ namespace Core {
         // Отримання кількості очікуючих завдань
         size_t getPendingTaskCount() const;
         
+        // Получение ограничения на число одновременно выполняемых задач
+        // Get the limit on concurrently running tasks
+        // Отримання обмеження на кількість одночасно виконуваних завдань
+        size_t getMaxConcurrentTasks() const;
+        
+        // Ожидание, пока не останется ни ожидающих, ни выполняемых задач
+        // Wait until there are neither pending nor running tasks
+        // Очікування, поки не залишиться ні очікуючих, ні виконуваних завдань
+        void waitForAllTasks();
+        
         // Получение статистики планировщика
         // Get scheduler statistics
         // Отримання статистики планувальника
@@ -114,6 +166,17 @@ namespace Core {
             size_t cancelledTasks;
             double averageExecutionTime;
             long long totalExecutionTime;
+            
+            // Задачи с крайним сроком: допущенные, завершенные после срока, отклоненные контролем допуска,
+            // и наибольшее опоздание (мс)
+            // Deadline tasks: admitted, finished after their deadline, rejected by admission control,
+            // and the largest lateness (ms)
+            // Завдання з крайнім строком: допущені, завершені після строку, відхилені контролем допуску,
+            // і найбільше запізнення (мс)
+            size_t deadlineTasks;
+            size_t deadlineMisses;
+            size_t rejectedTasks;
+            long long maxLateness;
         };
         
         SchedulerStatistics getStatistics() const;
@@ -144,20 +207,36 @@ namespace Core {
         // Потік планувальника
         std::thread schedulerThread;
         
+        // Пул потоков для выполнения задач и ограничение одновременных задач
+        // Thread pool for task execution and the concurrent task limit
+        // Пул потоків для виконання завдань та обмеження одночасних завдань
+        std::unique_ptr<ThreadPool> workerPool;
+        size_t maxConcurrentTasks;
+        
         // Мьютекс для синхронизации
         // Mutex for synchronization
         // М'ютекс для синхронізації
         mutable std::mutex schedulerMutex;
         
-        // Условная переменная для уведомлений
-        // Condition variable for notifications
-        // Умовна змінна для сповіщень
+        // Мьютекс менеджера задач (TaskManager не потокобезопасен)
+        // Task manager mutex (TaskManager is not thread-safe)
+        // М'ютекс менеджера завдань (TaskManager не потокобезпечний)
+        mutable std::mutex taskMutex;
+        
+        // Условная переменная для уведомлений (новая задача или завершение задачи)
+        // Condition variable for notifications (new task or task completion)
+        // Умовна змінна для сповіщень (нове завдання або завершення завдання)
         std::condition_variable schedulerCondition;
         
-        // Карта выполняемых задач
-        // Map of running tasks
-        // Карта виконуваних завдань
-        std::map<int, std::thread> runningTasks;
+        // Условная переменная ожидания простоя
+        // Condition variable for waiting on idle
+        // Умовна змінна очікування простою
+        std::condition_variable idleCondition;
+        
+        // Количество выполняемых задач (под schedulerMutex)
+        // Number of running tasks (under schedulerMutex)
+        // Кількість виконуваних завдань (під schedulerMutex)
+        size_t runningTaskCount;
         
         // Статистика выполнения задач
         // Task execution statistics
@@ -167,6 +246,35 @@ namespace Core {
         size_t completedTaskCount;
         size_t failedTaskCount;
         size_t cancelledTaskCount;
+        size_t deadlineTaskCount;
+        size_t deadlineMissCount;
+        size_t rejectedTaskCount;
+        long long maxLateness;
+        
+        // Готовые задачи, переданные менеджером задач (под schedulerMutex)
+        // Ready tasks handed over by the task manager (under schedulerMutex)
+        // Готові завдання, передані менеджером завдань (під schedulerMutex)
+        std::vector<int> readyTaskBuffer;
+        
+        // Перенос задач, ставших готовыми, в очередь алгоритма (вызывается под schedulerMutex)
+        // Move tasks that became ready into the algorithm's queue (called under schedulerMutex)
+        // Перенесення завдань, що стали готовими, до черги алгоритму (викликається під schedulerMutex)
+        void releaseReadyTasks();
+        
+        // Постановка готовой задачи в алгоритм (EDF получает срок и оценку задачи)
+        // Queue a ready task in the algorithm (EDF gets the task's deadline and estimate)
+        // Постановка готового завдання до алгоритму (EDF отримує строк і оцінку завдання)
+        static void enqueueTask(SchedulingAlgorithm& algorithm, const Utils::Task& task);
+        
+        // Алгоритм EDF, если он выбран (для допуска, резервов и учета выполняющихся задач)
+        // The EDF algorithm if it is selected (for admission, reservations and running task accounting)
+        // Алгоритм EDF, якщо його вибрано (для допуску, резервів та обліку завдань, що виконуються)
+        static Algorithms::EarliestDeadlineFirstScheduling* deadlineAlgorithm(SchedulingAlgorithm* algorithm);
+        
+        // Установка веса задачи в алгоритме Weighted Fair Queuing (если алгоритм его учитывает)
+        // Set a task's weight in a Weighted Fair Queuing algorithm (if the algorithm uses it)
+        // Встановлення ваги завдання в алгоритмі Weighted Fair Queuing (якщо алгоритм її враховує)
+        static void setAlgorithmTaskWeight(SchedulingAlgorithm& algorithm, int taskId, int weight);
         
         // Основной цикл планировщика
         // Main scheduler loop
@@ -1,6 +1,14 @@
 #include "Scheduler.h"
 #include <iostream>
 #include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 // Scheduler.cpp
 // Реалізація планувальника задач для NeuroSync OS Sparky
@@ -9,17 +17,135 @@
 
 namespace Core {
 
-    Scheduler::Scheduler() : running(false), stopping(false), taskIdCounter(0) {
+    namespace {
+        // Як часто потік таймерів вирівнює черги, поки в якійсь із них більше однієї задачі
+        // How often the timer thread evens out the queues while any of them holds more than one task
+        // Як часто потік таймерів вирівнює черги, поки в якійсь із них більше одного завдання
+        const std::chrono::milliseconds REBALANCE_INTERVAL(1);
+
+        const int MAX_NUMA_NODES = 64;
+
+        // Розбір списку ядер у форматі sysfs ("0-3,8,10-11")
+        // Parse a CPU list in sysfs format ("0-3,8,10-11")
+        // Розбір списку ядер у форматі sysfs ("0-3,8,10-11")
+        std::vector<int> parseCpuList(const std::string& list) {
+            std::vector<int> cpus;
+            std::stringstream stream(list);
+            std::string range;
+            while (std::getline(stream, range, ',')) {
+                if (range.empty()) {
+                    continue;
+                }
+                size_t dash = range.find('-');
+                int first = std::stoi(range.substr(0, dash));
+                int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+                for (int cpu = first; cpu <= last; ++cpu) {
+                    cpus.push_back(cpu);
+                }
+            }
+            return cpus;
+        }
+
+        // Доступні процесу ядра за вузлами NUMA (індекс - номер вузла в системі).
+        // Без sysfs усі ядра вважаються одним вузлом.
+        // CPUs available to the process by NUMA node (index is the system node number).
+        // Without sysfs all cores are treated as a single node.
+        // Доступні процесу ядра за вузлами NUMA (індекс - номер вузла в системі).
+        // Без sysfs усі ядра вважаються одним вузлом.
+        std::vector<std::vector<int>> detectCpusByNode() {
+            std::vector<std::vector<int>> cpusByNode;
+
+#ifdef __linux__
+            cpu_set_t allowed;
+            CPU_ZERO(&allowed);
+            bool haveMask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+            for (int node = 0; node < MAX_NUMA_NODES; ++node) {
+                std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+                if (!file) {
+                    continue;
+                }
+                std::string list;
+                std::getline(file, list);
+
+                std::vector<int> cpus;
+                try {
+                    for (int cpu : parseCpuList(list)) {
+                        if (!haveMask || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))) {
+                            cpus.push_back(cpu);
+                        }
+                    }
+                } catch (const std::exception&) {
+                    cpus.clear();
+                }
+
+                if (!cpus.empty()) {
+                    cpusByNode.resize(node + 1);
+                    cpusByNode[node] = cpus;
+                }
+            }
+#endif
+
+            if (cpusByNode.empty()) {
+                unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+                cpusByNode.resize(1);
+                for (unsigned int cpu = 0; cpu < cores; ++cpu) {
+                    cpusByNode[0].push_back(static_cast<int>(cpu));
+                }
+            }
+            return cpusByNode;
+        }
+
+        void pinCurrentThread(int cpu) {
+#ifdef __linux__
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+            (void)cpu;
+#endif
+        }
+    }
+
+    Scheduler::Scheduler(std::chrono::microseconds timerResolution, size_t workerCount, bool pinWorkers)
+        : placementCursor(0), pinWorkers(pinWorkers),
+          timerResolution(std::max<std::chrono::high_resolution_clock::duration>(timerResolution, std::chrono::microseconds(1))),
+          timerEpoch(std::chrono::high_resolution_clock::now()),
+          timerWakeRequested(false), timerIdle(false), running(false), stopping(false), activeAdders(0), taskIdCounter(0), tasksAdded(0), taskTimestamps(false) {
         // Ініціалізація планувальника
         // Initialize the scheduler
         // Ініціалізувати планувальник
+        std::vector<std::vector<int>> cpusByNode = detectCpusByNode();
+        std::vector<size_t> nodes;
+        for (size_t node = 0; node < cpusByNode.size(); ++node) {
+            if (!cpusByNode[node].empty()) {
+                nodes.push_back(node);
+            }
+        }
+
+        // Робочі потоки розподіляються між вузлами по черзі, всередині вузла - по ядрах
+        // Workers are spread across nodes in turn, and across cores within a node
+        // Робочі потоки розподіляються між вузлами по черзі, всередині вузла - по ядрах
+        workerCount = std::max<size_t>(1, workerCount);
+        shardsByNode.resize(cpusByNode.size());
+        for (size_t i = 0; i < workerCount; ++i) {
+            size_t node = nodes[i % nodes.size()];
+            const std::vector<int>& cpus = cpusByNode[node];
+
+            std::unique_ptr<Shard> shard(new Shard());
+            shard->statistics.numaNode = static_cast<int>(node);
+            shard->statistics.cpu = pinWorkers ? cpus[(i / nodes.size()) % cpus.size()] : -1;
+            shards.push_back(std::move(shard));
+            shardsByNode[node].push_back(i);
+        }
     }
 
     bool Scheduler::initialize() {
         // Ініціалізація планувальника
         // Initialize the scheduler
         // Ініціалізувати планувальник
-        std::lock_guard<std::mutex> lock(queueMutex);
+        std::lock_guard<std::mutex> lock(timerMutex);
         // Нічого спеціального не потрібно ініціалізувати
         // Nothing special needs to be initialized
         // Ничего специального не нужно инициализировать
@@ -34,203 +160,727 @@ namespace Core {
     }
 
     void Scheduler::start() {
-        // Запустити цикл планувальника
-        // Start the scheduler loop
-        // Запустити цикл планувальника
+        // Запустити робочі потоки планувальника
+        // Start the scheduler's worker threads
+        // Запустити робочі потоки планувальника
         if (!running.exchange(true)) {
-            schedulerThread = std::thread(&Scheduler::schedulerLoop, this);
+            stopping = false;
+            for (size_t i = 0; i < shards.size(); ++i) {
+                shards[i]->thread = std::thread(&Scheduler::workerLoop, this, i);
+            }
+            timerThread = std::thread(&Scheduler::timerLoop, this);
         }
     }
 
     void Scheduler::stop() {
-        // Зупинити цикл планувальника
-        // Stop the scheduler loop
-        // Зупинити цикл планувальника
+        // Зупинити робочі потоки планувальника
+        // Stop the scheduler's worker threads
+        // Зупинити робочі потоки планувальника
         if (running.exchange(false)) {
-            stopping = true;
-            condition.notify_all();
+            // Спершу зупиняється потік таймерів, щоб він не ставив задачі до черг потоків, що завершуються
+            // The timer thread stops first so it does not push tasks onto the queues of exiting workers
+            // Спершу зупиняється потік таймерів, щоб він не ставив завдання до черг потоків, що завершуються
+            wakeTimerThread();
+            if (timerThread.joinable()) {
+                timerThread.join();
+            }
             
-            if (schedulerThread.joinable()) {
-                schedulerThread.join();
+            stopping = true;
+            for (auto& shard : shards) {
+                {
+                    std::lock_guard<std::mutex> lock(shard->mutex);
+                }
+                shard->condition.notify_all();
+            }
+
+            for (auto& shard : shards) {
+                if (shard->thread.joinable()) {
+                    shard->thread.join();
+                }
+            }
+
+            // Додавання, що побачили running до зупинки, мають закінчитися до відкидання залишку:
+            // лічильник збільшується до перевірки running, а тут читається після її скидання (обидва seq_cst)
+            // Adds that saw running before the stop must finish before the rest is discarded:
+            // the counter is raised before the running check and read here after running was cleared (both seq_cst)
+            // Додавання, що побачили running до зупинки, мають закінчитися до відкидання залишку:
+            // лічильник збільшується до перевірки running, а тут читається після її скидання (обидва seq_cst)
+            while (activeAdders.load() != 0) {
+                std::this_thread::yield();
+            }
+
+            // Готові задачі виконуються до кінця, а відкладені, строк яких не настав, скасовуються
+            // (як і задачі, додані вже під час зупинки)
+            // Ready tasks are drained, while delayed tasks that are not due yet are cancelled
+            // (as are tasks added while stopping)
+            // Готові завдання виконуються до кінця, а відкладені, строк яких не настав, скасовуються
+            // (як і завдання, додані вже під час зупинки)
+            std::vector<Utils::Task> discardedTasks;
+            {
+                std::lock_guard<std::mutex> lock(timerMutex);
+                timerWheel.drain(discardedTasks);
+                timerHandles.clear();
+            }
+            for (auto& shard : shards) {
+                Utils::Task task;
+                while (shard->queue.tryPop(task)) {
+                    discardedTasks.push_back(std::move(task));
+                }
+                shard->load = 0;
+            }
+            if (!discardedTasks.empty()) {
+                std::lock_guard<std::mutex> lock(statsMutex);
+                statistics.tasksCancelled += discardedTasks.size();
+            }
+
+            // Обробники скасування дають власникам відкинутих задач (наприклад, співпрограмам,
+            // що чекають на планувальник) завершитися, а не зависнути назавжди
+            // Cancel handlers let the owners of discarded tasks (for example coroutines
+            // waiting on the scheduler) finish instead of hanging forever
+            // Обробники скасування дають власникам відкинутих завдань (наприклад, співпрограмам,
+            // що чекають на планувальник) завершитися, а не зависнути назавжди
+            for (Utils::Task& task : discardedTasks) {
+                if (task.onCancel) {
+                    task.onCancel();
+                }
             }
         }
     }
 
-    void Scheduler::addTask(std::function<void()> task, int priority) {
+    int Scheduler::addTask(std::function<void()> task, int priority, int numaNode) {
+        return addTask(std::move(task), std::function<void()>(), priority, numaNode);
+    }
+
+    int Scheduler::addTask(std::function<void()> task, std::function<void()> onCancel, int priority, int numaNode) {
         // Додати задачу до черги задач з відповідним пріоритетом
         // Add a task to the task queue with appropriate priority
         // Додати завдання до черги завдань з відповідним пріоритетом
+        activeAdders.fetch_add(1);
         if (!running) {
-            return;
+            activeAdders.fetch_sub(1, std::memory_order_release);
+            return -1;
         }
-        
+
         int taskId = generateTaskId();
-        Utils::Task newTask(taskId, task, priority);
-        
-        {
-            std::lock_guard<std::mutex> lock(queueMutex);
-            taskQueue.emplace(newTask);
-            statistics.tasksAdded++;
+        Utils::Task newTask(taskId, std::move(task), priority, numaNode);
+        newTask.onCancel = std::move(onCancel);
+        if (taskTimestamps.load(std::memory_order_relaxed)) {
+            newTask.creationTime = std::chrono::high_resolution_clock::now();
+            newTask.scheduledTime = newTask.creationTime;
         }
-        
-        condition.notify_one();
+        pushTask(selectShard(numaNode), std::move(newTask));
+        tasksAdded.fetch_add(1, std::memory_order_relaxed);
+        activeAdders.fetch_sub(1, std::memory_order_release);
+        return taskId;
+    }
+
+    int Scheduler::addDelayedTask(std::function<void()> task, std::chrono::milliseconds delay, int priority, int numaNode) {
+        return addDelayedTask(std::move(task), std::function<void()>(), delay, priority, numaNode);
     }
 
-    void Scheduler::addDelayedTask(std::function<void()> task, std::chrono::milliseconds delay, int priority) {
+    int Scheduler::addDelayedTask(std::function<void()> task, std::function<void()> onCancel, std::chrono::milliseconds delay,
+                                  int priority, int numaNode) {
         // Додати задачу з відкладеним виконанням
         // Add a task with delayed execution
         // Додати завдання з відкладеним виконанням
+        activeAdders.fetch_add(1);
         if (!running) {
-            return;
+            activeAdders.fetch_sub(1, std::memory_order_release);
+            return -1;
         }
-        
+
         int taskId = generateTaskId();
-        Utils::Task newTask(taskId, task, priority);
-        newTask.scheduledTime = std::chrono::high_resolution_clock::now() + delay;
-        
+        Utils::Task newTask(taskId, std::move(task), priority, numaNode);
+        newTask.onCancel = std::move(onCancel);
+        newTask.creationTime = std::chrono::high_resolution_clock::now();
+        newTask.scheduledTime = newTask.creationTime + delay;
+
+        // Строк округлюється вгору до кроку колеса, тому задача ніколи не спрацьовує раніше
+        // The due time is rounded up to a wheel tick, so the task never fires early
+        // Строк округлюється вгору до кроку колеса, тому завдання ніколи не спрацьовує раніше
+        bool earliest = false;
         {
-            std::lock_guard<std::mutex> lock(queueMutex);
-            taskQueue.emplace(newTask);
-            statistics.tasksAdded++;
+            std::lock_guard<std::mutex> lock(timerMutex);
+            uint64_t expiryTick = tickAtOrAfter(newTask.scheduledTime);
+            earliest = timerWheel.empty() || expiryTick < timerWheel.nextEventTick();
+            timerHandles[taskId] = timerWheel.insert(expiryTick, std::move(newTask));
+        }
+        tasksAdded.fetch_add(1, std::memory_order_relaxed);
+
+        // Потік таймерів перераховує строк очікування, лише якщо задача стала найближчою подією
+        // The timer thread recomputes its wait deadline only if the task became the nearest event
+        // Потік таймерів перераховує строк очікування, лише якщо завдання стало найближчою подією
+        if (earliest) {
+            wakeTimerThread();
         }
-        
-        condition.notify_one();
+        activeAdders.fetch_sub(1, std::memory_order_release);
+        return taskId;
+    }
+
+    bool Scheduler::cancelTask(int taskId) {
+        // Скасувати відкладену задачу
+        // Cancel a delayed task
+        // Скасувати відкладене завдання
+        Utils::Task cancelled;
+        {
+            std::lock_guard<std::mutex> lock(timerMutex);
+            auto it = timerHandles.find(taskId);
+            if (it == timerHandles.end()) {
+                return false;
+            }
+            timerWheel.cancel(it->second, &cancelled);
+            timerHandles.erase(it);
+        }
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            statistics.tasksCancelled++;
+        }
+        if (cancelled.onCancel) {
+            cancelled.onCancel();
+        }
+        return true;
+    }
+
+    void Scheduler::setTaskTimestamps(bool enabled) {
+        taskTimestamps.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool Scheduler::getTaskTimestamps() const {
+        return taskTimestamps.load(std::memory_order_relaxed);
     }
 
     size_t Scheduler::getTaskCount() const {
         // Отримати кількість задач у черзі
         // Get the number of tasks in the queue
         // Отримати кількість завдань у черзі
-        std::lock_guard<std::mutex> lock(queueMutex);
-        return taskQueue.size();
+        size_t count = 0;
+        {
+            std::lock_guard<std::mutex> lock(timerMutex);
+            count += timerWheel.size();
+        }
+        for (const auto& shard : shards) {
+            count += shard->queue.sizeApprox();
+        }
+        return count;
+    }
+
+    size_t Scheduler::getWorkerCount() const {
+        return shards.size();
+    }
+
+    size_t Scheduler::getNumaNodeCount() const {
+        return shardsByNode.size();
     }
 
     Scheduler::Statistics Scheduler::getStatistics() const {
         // Отримати статистику планувальника
         // Get scheduler statistics
         // Отримати статистику планувальника
-        std::lock_guard<std::mutex> lock(statsMutex);
-        return statistics;
+        Statistics result;
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            result = statistics;
+        }
+        result.tasksAdded = tasksAdded.load(std::memory_order_relaxed);
+
+        std::chrono::microseconds totalQueueLatency(0);
+        for (const auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            result.tasksCompleted += shard->statistics.tasksCompleted;
+            result.tasksFailed += shard->statistics.tasksFailed;
+            result.tasksStolen += shard->statistics.tasksStolen;
+            result.tasksRebalanced += shard->statistics.tasksRebalanced;
+            result.totalExecutionTime += shard->statistics.totalExecutionTime;
+            result.timestampedTasks += shard->statistics.timestampedTasks;
+            totalQueueLatency += shard->statistics.totalQueueLatency;
+        }
+
+        size_t totalCompleted = result.tasksCompleted + result.tasksFailed;
+        if (totalCompleted > 0) {
+            result.averageExecutionTime = static_cast<double>(result.totalExecutionTime.count()) / totalCompleted;
+        }
+        if (result.timestampedTasks > 0) {
+            result.averageQueueLatency = static_cast<double>(totalQueueLatency.count()) / result.timestampedTasks;
+        }
+        return result;
     }
 
-    void Scheduler::schedulerLoop() {
-        // Основний цикл планувальника
-        // Main scheduler loop
-        // Основний цикл планувальника
-        while (running || !taskQueue.empty()) {
-            Utils::Task currentTask(-1, nullptr, 0);
-            bool hasTask = false;
-            
-            {
-                std::unique_lock<std::mutex> lock(queueMutex);
-                
-                // Очікування задачі або сигналу зупинки
-                // Waiting for task or stop signal
-                // Очікування завдання або сигналу зупинки
-                condition.wait(lock, [this]() {
-                    return !running || stopping || !taskQueue.empty();
-                });
-                
-                // Перевірка чи є задачі для виконання
-                // Check if there are tasks to execute
-                // Перевірка чи є завдання для виконання
-                while (!taskQueue.empty()) {
-                    auto now = std::chrono::high_resolution_clock::now();
-                    const auto& topTask = taskQueue.top();
-                    
-                    // Якщо задача готова до виконання
-                    // If task is ready to execute
-                    // Якщо завдання готове до виконання
-                    if (topTask.scheduledTime <= now) {
-                        currentTask = topTask;
-                        taskQueue.pop();
-                        hasTask = true;
+    std::vector<Scheduler::WorkerStatistics> Scheduler::getWorkerStatistics() const {
+        // Отримати статистику кожного робочого потоку
+        // Get statistics of every worker
+        // Отримати статистику кожного робочого потоку
+        std::vector<WorkerStatistics> result;
+        result.reserve(shards.size());
+        for (const auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            result.push_back(shard->statistics);
+            result.back().queuedTasks = shard->queue.sizeApprox();
+        }
+        return result;
+    }
+
+    void Scheduler::workerLoop(size_t index) {
+        // Основний цикл робочого потоку
+        // Main worker loop
+        // Основний цикл робочого потоку
+        Shard& shard = *shards[index];
+        if (pinWorkers && shard.statistics.cpu >= 0) {
+            pinCurrentThread(shard.statistics.cpu);
+        }
+
+        while (true) {
+            // Виконання задачі
+            // Execute task
+            // Виконання завдання
+            Utils::Task currentTask;
+            if (popTask(index, currentTask)) {
+                if (currentTask.function) {
+                    executeTask(shard, currentTask);
+                }
+                shard.load.fetch_sub(1, std::memory_order_relaxed);
+                continue;
+            }
+
+            // Прапорець сну ставиться до повторної перевірки черги, а виробник перевіряє його після
+            // додавання (обидва кроки seq_cst), тому хоча б один з них бачить іншого і задача не губиться
+            // The sleep flag is set before the queue is checked again, and a producer checks it after
+            // pushing (both steps seq_cst), so at least one of them sees the other and no task is missed
+            // Прапорець сну ставиться до повторної перевірки черги, а виробник перевіряє його після
+            // додавання (обидва кроки seq_cst), тому хоча б один з них бачить іншого і завдання не губиться
+            std::unique_lock<std::mutex> lock(shard.mutex);
+            shard.sleeping.store(true);
+            if (!shard.queue.emptyApprox() || shard.wakeRequested) {
+                shard.sleeping.store(false, std::memory_order_relaxed);
+                shard.wakeRequested = false;
+                continue;
+            }
+
+            // Під час зупинки потік завершується, коли всі черги порожні
+            // While stopping, the worker exits once every queue is empty
+            // Під час зупинки потік завершується, коли всі черги порожні
+            if (stopping) {
+                shard.sleeping.store(false, std::memory_order_relaxed);
+                lock.unlock();
+                bool allEmpty = true;
+                for (const auto& other : shards) {
+                    if (!other->queue.emptyApprox()) {
+                        allEmpty = false;
                         break;
-                    } else {
-                        // Очікування до часу виконання задачі
-                        // Wait until task execution time
-                        // Очікування до часу виконання завдання
-                        condition.wait_until(lock, topTask.scheduledTime);
                     }
                 }
+                if (allEmpty) {
+                    break;
+                }
+                continue;
             }
-            
-            // Виконання задачі
-            // Execute task
-            // Виконання завдання
-            if (hasTask && currentTask.function) {
-                executeTask(currentTask);
+
+            // Очікування задачі або сигналу зупинки
+            // Waiting for a task or the stop signal
+            // Очікування завдання або сигналу зупинки
+            shard.condition.wait(lock);
+            shard.sleeping.store(false, std::memory_order_relaxed);
+            shard.wakeRequested = false;
+        }
+    }
+
+    void Scheduler::timerLoop() {
+        // Цикл потоку таймерів; він не виконує задач, тому довга задача не затримує ні відкладені
+        // задачі, ні вирівнювання черг
+        // Timer thread loop; it runs no tasks, so a long task delays neither the delayed tasks
+        // nor queue rebalancing
+        // Цикл потоку таймерів; він не виконує завдань, тому довге завдання не затримує ні відкладені
+        // завдання, ні вирівнювання черг
+        auto nextRebalance = std::chrono::high_resolution_clock::now() + REBALANCE_INTERVAL;
+        std::unique_lock<std::mutex> lock(timerMutex);
+        while (running) {
+            auto now = std::chrono::high_resolution_clock::now();
+            releaseDueTimers(now);
+            if (shards.size() > 1 && now >= nextRebalance) {
+                lock.unlock();
+                rebalanceShards();
+                lock.lock();
+                nextRebalance = now + REBALANCE_INTERVAL;
             }
-            
-            // Якщо планувальник зупиняється і немає задач
-            // If scheduler is stopping and no tasks
-            // Якщо планувальник зупиняється і немає завдань
-            if (stopping && taskQueue.empty()) {
-                break;
+
+            bool hasDeadline = !timerWheel.empty();
+            std::chrono::high_resolution_clock::time_point deadline;
+            if (hasDeadline) {
+                deadline = tickTime(timerWheel.nextEventTick());
+            }
+
+            // Вирівнювання потрібне, лише поки якась черга тримає задачі понад поточну. Прапорець сну
+            // без вирівнювання ставиться до перевірки черг, а виробник перевіряє його після збільшення
+            // навантаження (обидва кроки seq_cst), тому хоча б один з них бачить іншого
+            // Rebalancing is only needed while some queue holds tasks beyond the running one. The flag for
+            // sleeping without rebalancing is set before the queues are checked, and a producer checks it
+            // after raising the load (both steps seq_cst), so at least one of them sees the other
+            // Вирівнювання потрібне, лише поки якась черга тримає завдання понад поточне. Прапорець сну
+            // без вирівнювання ставиться до перевірки черг, а виробник перевіряє його після збільшення
+            // навантаження (обидва кроки seq_cst), тому хоча б один з них бачить іншого
+            timerIdle.store(true);
+            if (shards.size() > 1) {
+                for (const auto& shard : shards) {
+                    if (shard->load.load() > 1) {
+                        timerIdle.store(false, std::memory_order_relaxed);
+                        deadline = hasDeadline ? std::min(deadline, nextRebalance) : nextRebalance;
+                        hasDeadline = true;
+                        break;
+                    }
+                }
+            }
+
+            if (timerWakeRequested || !running) {
+                timerWakeRequested = false;
+                timerIdle.store(false, std::memory_order_relaxed);
+                continue;
+            }
+            bool idle = timerIdle.load(std::memory_order_relaxed);
+            if (hasDeadline) {
+                timerCondition.wait_until(lock, deadline);
+            } else {
+                timerCondition.wait(lock);
+            }
+            timerWakeRequested = false;
+            timerIdle.store(false, std::memory_order_relaxed);
+
+            // Після простою перше вирівнювання відкладається на інтервал, щоб спершу спрацювала крадіжка
+            // After idling the first rebalance is deferred by an interval so stealing gets the first go
+            // Після простою перше вирівнювання відкладається на інтервал, щоб спершу спрацювала крадіжка
+            if (idle) {
+                nextRebalance = std::chrono::high_resolution_clock::now() + REBALANCE_INTERVAL;
+            }
+        }
+        timerIdle.store(false, std::memory_order_relaxed);
+    }
+
+    void Scheduler::wakeTimerThread() {
+        // Розбудити потік таймерів (м'ютекс гарантує, що він уже чекає або ще не перевірив прапорець)
+        // Wake the timer thread (the mutex guarantees it either waits already or has not checked the flag yet)
+        // Розбудити потік таймерів (м'ютекс гарантує, що він уже чекає або ще не перевірив прапорець)
+        {
+            std::lock_guard<std::mutex> lock(timerMutex);
+            timerWakeRequested = true;
+        }
+        timerCondition.notify_one();
+    }
+
+    void Scheduler::releaseDueTimers(std::chrono::high_resolution_clock::time_point now) {
+        // Перемістити відкладені задачі, строк яких настав, до черг виконання (викликається під timerMutex)
+        // Move delayed tasks that came due into the run queues (called with timerMutex held)
+        // Перемістити відкладені завдання, строк яких настав, до черг виконання (викликається під timerMutex)
+        uint64_t nowTick = tickAtOrBefore(now);
+        if (timerWheel.nextEventTick() > nowTick) {
+            return;
+        }
+
+        dueTasks.clear();
+        if (timerWheel.advance(nowTick, dueTasks) == 0) {
+            return;
+        }
+
+        long long totalLatency = 0;
+        std::chrono::microseconds maxLatency(0);
+        for (Utils::Task& task : dueTasks) {
+            auto latency = std::chrono::duration_cast<std::chrono::microseconds>(now - task.scheduledTime);
+            totalLatency += latency.count();
+            maxLatency = std::max(maxLatency, latency);
+            timerHandles.erase(task.id);
+            pushTask(selectShard(task.numaNode), std::move(task));
+        }
+
+        // Оновлення статистики точності таймерів
+        // Update timer accuracy statistics
+        // Оновлення статистики точності таймерів
+        std::lock_guard<std::mutex> lock(statsMutex);
+        size_t fired = statistics.timersFired + dueTasks.size();
+        statistics.averageTimerLatency = (statistics.averageTimerLatency * statistics.timersFired + totalLatency) / fired;
+        statistics.timersFired = fired;
+        statistics.maxTimerLatency = std::max(statistics.maxTimerLatency, maxLatency);
+    }
+
+    size_t Scheduler::selectShard(int numaNode) {
+        // Найменш завантажена черга бажаного вузла або всіх вузлів
+        // The least loaded queue of the preferred node or of all nodes
+        // Найменш завантажена черга бажаного вузла або всіх вузлів
+        const std::vector<size_t>* candidates = nullptr;
+        if (numaNode >= 0 && static_cast<size_t>(numaNode) < shardsByNode.size() && !shardsByNode[numaNode].empty()) {
+            candidates = &shardsByNode[numaNode];
+        }
+
+        size_t count = candidates ? candidates->size() : shards.size();
+        if (count == 1) {
+            return candidates ? (*candidates)[0] : 0;
+        }
+
+        // Обхід починається з курсора, що зсувається, тож однаково завантажені черги заповнюються по колу
+        // The scan starts at a moving cursor, so equally loaded queues are filled round-robin
+        // Обхід починається з курсора, що зсувається, тож однаково завантажені черги заповнюються по колу
+        size_t start = placementCursor.fetch_add(1, std::memory_order_relaxed);
+        size_t best = 0;
+        size_t bestLoad = SIZE_MAX;
+        for (size_t k = 0; k < count; ++k) {
+            size_t index = candidates ? (*candidates)[(start + k) % count] : (start + k) % count;
+            size_t load = shards[index]->load.load(std::memory_order_relaxed);
+            if (load < bestLoad) {
+                best = index;
+                bestLoad = load;
+                if (load == 0) {
+                    break;
+                }
             }
         }
+        return best;
     }
 
-    void Scheduler::executeTask(const Utils::Task& task) {
+    void Scheduler::pushTask(size_t index, Utils::Task task) {
+        // Поставити задачу до черги робочого потоку
+        // Push a task onto a worker's queue
+        // Поставити завдання до черги робочого потоку
+        Shard& shard = *shards[index];
+        size_t load = shard.load.fetch_add(1) + 1;
+        shard.queue.push(priorityBand(task.priority), std::move(task));
+        if (shard.sleeping.load()) {
+            wakeShard(shard);
+        }
+
+        // Якщо потік цієї черги зайнятий, задачу може вкрасти вільний потік
+        // If this queue's worker is busy, an idle worker may steal the task
+        // Якщо потік цієї черги зайнятий, завдання може вкрасти вільний потік
+        if (load > 1 && shards.size() > 1) {
+            for (auto& other : shards) {
+                if (other->load.load(std::memory_order_relaxed) == 0 && other->sleeping.load()) {
+                    wakeShard(*other);
+                    break;
+                }
+            }
+
+            // Черга почала накопичувати задачі: потоку таймерів потрібен строк вирівнювання
+            // The queue started to build up: the timer thread needs a rebalance deadline
+            // Черга почала накопичувати завдання: потоку таймерів потрібен строк вирівнювання
+            if (timerIdle.load()) {
+                wakeTimerThread();
+            }
+        }
+    }
+
+    void Scheduler::wakeShard(Shard& shard) {
+        // Розбудити потік черги (м'ютекс гарантує, що він уже чекає або ще не перевірив чергу)
+        // Wake the queue's worker (the mutex guarantees it either waits already or has not checked the queue yet)
+        // Розбудити потік черги (м'ютекс гарантує, що він уже чекає або ще не перевірив чергу)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.wakeRequested = true;
+        }
+        shard.condition.notify_one();
+    }
+
+    size_t Scheduler::priorityBand(int priority) {
+        // Пріоритети поза 0..63 поділяють крайні смуги
+        // Priorities outside 0..63 share the edge bands
+        // Пріоритети поза 0..63 поділяють крайні смуги
+        if (priority <= 0) {
+            return 0;
+        }
+        return std::min(static_cast<size_t>(priority), TaskQueue::BANDS - 1);
+    }
+
+    bool Scheduler::popTask(size_t index, Utils::Task& task) {
+        // Взяти задачу з власної черги; якщо інша черга тримає задачу з вищим пріоритетом,
+        // потік краде її, щоб не допустити інверсії пріоритетів між чергами
+        // Take a task from the own queue; if another queue holds a higher-priority task,
+        // the worker steals it instead to avoid priority inversion across queues
+        // Взяти завдання з власної черги; якщо інша черга тримає завдання з вищим пріоритетом,
+        // потік краде його, щоб не допустити інверсії пріоритетів між чергами
+        Shard& shard = *shards[index];
+        if (shards.size() > 1) {
+            size_t ownBand = shard.queue.topBand();
+            for (size_t i = 0; i < shards.size(); ++i) {
+                if (i != index && shards[i]->queue.topBand() < ownBand) {
+                    if (stealTask(index, task)) {
+                        return true;
+                    }
+                    break;
+                }
+            }
+        }
+
+        return shard.queue.tryPop(task);
+    }
+
+    bool Scheduler::stealTask(size_t index, Utils::Task& task) {
+        // Вкрасти верхню задачу з черги з найвищим пріоритетом (при рівних - зі свого вузла)
+        // Steal the top task of the queue with the highest priority (on ties, from the own node)
+        // Вкрасти верхнє завдання з черги з найвищим пріоритетом (при рівних - зі свого вузла)
+        Shard& thief = *shards[index];
+        size_t victim = index;
+        size_t bestBand = TaskQueue::BANDS;
+        bool bestLocal = false;
+        for (size_t i = 0; i < shards.size(); ++i) {
+            if (i == index) {
+                continue;
+            }
+            size_t band = shards[i]->queue.topBand();
+            bool local = shards[i]->statistics.numaNode == thief.statistics.numaNode;
+            if (band < bestBand || (band == bestBand && band != TaskQueue::BANDS && local && !bestLocal)) {
+                victim = i;
+                bestBand = band;
+                bestLocal = local;
+            }
+        }
+
+        // Поки потік вибирав, верхня задача могла змінитися; крадіжка має сенс, лише якщо її смуга
+        // все ще краща за верхню смугу власної черги
+        // The top task may have changed while choosing; stealing only makes sense if its band still
+        // beats the top band of the own queue
+        // Поки потік вибирав, верхнє завдання могло змінитися; крадіжка має сенс, лише якщо його смуга
+        // все ще краща за верхню смугу власної черги
+        if (victim == index || bestBand >= thief.queue.topBand() || !shards[victim]->queue.tryPop(task)) {
+            return false;
+        }
+        shards[victim]->load.fetch_sub(1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(thief.mutex);
+            thief.load.fetch_add(1, std::memory_order_relaxed);
+            thief.statistics.tasksStolen++;
+        }
+        return true;
+    }
+
+    void Scheduler::rebalanceShards() {
+        // Вирівняти довжини черг: найдовша черга віддає половину різниці найкоротшій, починаючи
+        // з задач найвищого пріоритету. Між вузлами переносяться лише задачі без підказки вузла.
+        // Even out queue lengths: the longest queue hands half the difference to the shortest one, starting
+        // with the highest-priority tasks. Only tasks without a node hint move across nodes.
+        // Вирівняти довжини черг: найдовша черга віддає половину різниці найкоротшій, починаючи
+        // із завдань найвищого пріоритету. Між вузлами переносяться лише завдання без підказки вузла.
+        for (size_t pass = 0; pass < shards.size(); ++pass) {
+            size_t longest = 0;
+            size_t shortest = 0;
+            for (size_t i = 1; i < shards.size(); ++i) {
+                size_t load = shards[i]->load.load(std::memory_order_relaxed);
+                if (load > shards[longest]->load.load(std::memory_order_relaxed)) {
+                    longest = i;
+                }
+                if (load < shards[shortest]->load.load(std::memory_order_relaxed)) {
+                    shortest = i;
+                }
+            }
+            if (longest == shortest) {
+                return;
+            }
+
+            Shard& source = *shards[longest];
+            Shard& target = *shards[shortest];
+            size_t sourceLoad = source.load.load(std::memory_order_relaxed);
+            size_t targetLoad = target.load.load(std::memory_order_relaxed);
+            if (sourceLoad <= targetLoad + 1) {
+                return;
+            }
+
+            // Задачі знімаються з черги-джерела без блокування; закріплені за вузлом повертаються
+            // в кінець своєї смуги, а перегляд обмежено початковою довжиною черги
+            // Tasks are taken off the source queue without locking; node-pinned ones go back
+            // to the end of their band, and the scan is bounded by the initial queue length
+            // Завдання знімаються з черги-джерела без блокування; закріплені за вузлом повертаються
+            // в кінець своєї смуги, а перегляд обмежено початковою довжиною черги
+            size_t toMove = (sourceLoad - targetLoad) / 2;
+            bool crossNode = source.statistics.numaNode != target.statistics.numaNode;
+            std::vector<Utils::Task> pinned;
+            size_t moved = 0;
+            Utils::Task task;
+            for (size_t examined = 0; moved < toMove && examined < sourceLoad && source.queue.tryPop(task); ++examined) {
+                if (crossNode && task.numaNode >= 0) {
+                    pinned.push_back(std::move(task));
+                    continue;
+                }
+                source.load.fetch_sub(1, std::memory_order_relaxed);
+                target.load.fetch_add(1, std::memory_order_relaxed);
+                target.queue.push(priorityBand(task.priority), std::move(task));
+                moved++;
+            }
+            for (Utils::Task& pinnedTask : pinned) {
+                source.queue.push(priorityBand(pinnedTask.priority), std::move(pinnedTask));
+            }
+
+            if (moved == 0) {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(target.mutex);
+                target.statistics.tasksRebalanced += moved;
+            }
+            if (target.sleeping.load()) {
+                wakeShard(target);
+            }
+        }
+    }
+
+    uint64_t Scheduler::tickAtOrAfter(std::chrono::high_resolution_clock::time_point time) const {
+        // Перший тик, не раніший за time
+        // The first tick not earlier than time
+        // Перший тик, не раніший за time
+        if (time <= timerEpoch) {
+            return 0;
+        }
+        return static_cast<uint64_t>((time - timerEpoch + timerResolution - std::chrono::high_resolution_clock::duration(1)) / timerResolution);
+    }
+
+    uint64_t Scheduler::tickAtOrBefore(std::chrono::high_resolution_clock::time_point time) const {
+        // Останній тик, не пізніший за time
+        // The last tick not later than time
+        // Останній тик, не пізніший за time
+        if (time <= timerEpoch) {
+            return 0;
+        }
+        return static_cast<uint64_t>((time - timerEpoch) / timerResolution);
+    }
+
+    std::chrono::high_resolution_clock::time_point Scheduler::tickTime(uint64_t tick) const {
+        // Момент початку тику
+        // The moment a tick starts
+        // Момент початку тику
+        return timerEpoch + timerResolution * static_cast<long long>(tick);
+    }
+
+    void Scheduler::executeTask(Shard& shard, const Utils::Task& task) {
         // Виконати задачу
         // Execute task
         // Виконати завдання
         auto startTime = std::chrono::high_resolution_clock::now();
-        
+        bool succeeded = false;
+
         try {
-            if (task.function) {
-                task.function();
-                
-                // Оновлення статистики успішного виконання
-                // Update successful execution statistics
-                // Оновлення статистики успішного виконання
-                {
-                    std::lock_guard<std::mutex> lock(statsMutex);
-                    statistics.tasksCompleted++;
-                }
-            }
+            task.function();
+            succeeded = true;
         } catch (const std::exception& e) {
             // Обробка помилок виконання задачі
             // Handle task execution errors
             // Обробка помилок виконання завдання
             std::cerr << "Task " << task.id << " execution failed: " << e.what() << std::endl;
-            
-            // Оновлення статистики невдалого виконання
-            // Update failed execution statistics
-            // Оновлення статистики невдалого виконання
-            {
-                std::lock_guard<std::mutex> lock(statsMutex);
-                statistics.tasksFailed++;
-            }
         } catch (...) {
             // Обробка невідомих помилок
             // Handle unknown errors
             // Обробка невідомих помилок
             std::cerr << "Task " << task.id << " execution failed with unknown error" << std::endl;
-            
-            // Оновлення статистики невдалого виконання
-            // Update failed execution statistics
-            // Оновлення статистики невдалого виконання
-            {
-                std::lock_guard<std::mutex> lock(statsMutex);
-                statistics.tasksFailed++;
-            }
         }
-        
+
         auto endTime = std::chrono::high_resolution_clock::now();
         auto executionTime = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
-        
-        // Оновлення загального часу виконання
-        // Update total execution time
-        // Оновлення загального часу виконання
-        {
-            std::lock_guard<std::mutex> lock(statsMutex);
-            statistics.totalExecutionTime += executionTime;
-            
-            size_t totalCompleted = statistics.tasksCompleted + statistics.tasksFailed;
-            if (totalCompleted > 0) {
-                statistics.averageExecutionTime = static_cast<double>(statistics.totalExecutionTime.count()) / totalCompleted;
-            }
+
+        // Оновлення статистики робочого потоку
+        // Update the worker's statistics
+        // Оновлення статистики робочого потоку
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (succeeded) {
+            shard.statistics.tasksCompleted++;
+        } else {
+            shard.statistics.tasksFailed++;
+        }
+        shard.statistics.totalExecutionTime += executionTime;
+        if (task.hasTimestamps()) {
+            shard.statistics.timestampedTasks++;
+            shard.statistics.totalQueueLatency += std::max(std::chrono::microseconds(0),
+                std::chrono::duration_cast<std::chrono::microseconds>(startTime - task.scheduledTime));
         }
     }
 
@@ -241,4 +891,4 @@ namespace Core {
         return taskIdCounter.fetch_add(1);
     }
 
-}
\ No newline at end of file
+}
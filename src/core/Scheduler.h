@@ -1,7 +1,6 @@
 #ifndef SCHEDULER_H
 #define SCHEDULER_H
 
-#include <queue>
 #include <vector>
 #include <thread>
 #include <mutex>
@@ -9,6 +8,12 @@
 #include <functional>
 #include <atomic>
 #include <chrono>
+#include <unordered_map>
+#include <cstdint>
+#include <climits>
+#include <memory>
+#include "utils/TimerWheel.h"
+#include "utils/MultiLevelQueue.h"
 
 // Scheduler.h
 // Планувальник задач для NeuroSync OS Sparky
@@ -28,37 +33,60 @@ namespace Core {
             int id;
             std::function<void()> function;
             int priority;
+            int numaNode;       // Бажаний вузол NUMA або -1 / Preferred NUMA node or -1 / Бажаний вузол NUMA або -1
+            std::function<void()> onCancel;  // Викликається замість function, якщо задачу скасовано / Called instead of function if the task is cancelled / Викликається замість function, якщо завдання скасовано
+            
+            // Мітки часу необов'язкові: конструктор годинник не читає, а нульова мітка означає "не записано"
+            // Timestamps are optional: the constructor does not read the clock, and a zero stamp means "not recorded"
+            // Мітки часу необов'язкові: конструктор годинник не читає, а нульова мітка означає "не записано"
             std::chrono::high_resolution_clock::time_point creationTime;
             std::chrono::high_resolution_clock::time_point scheduledTime;
             
-            Task(int taskId, std::function<void()> func, int prio)
-                : id(taskId), function(std::move(func)), priority(prio),
-                  creationTime(std::chrono::high_resolution_clock::now()),
-                  scheduledTime(creationTime) {}
-        };
-        
-        // Компаратор для пріоритетної черги
-        // Comparator for priority queue
-        // Компаратор для пріоритетної черги
-        struct TaskComparator {
-            bool operator()(const Task& a, const Task& b) const {
-                // Вищий пріоритет має менше значення
-                // Higher priority has lower value
-                // Вищий пріоритет має менше значення
-                if (a.priority != b.priority) {
-                    return a.priority > b.priority;
-                }
-                // Якщо пріоритети однакові, то за часом створення
-                // If priorities are equal, then by creation time
-                // Якщо пріоритети однакові, то за часом створення
-                return a.creationTime > b.creationTime;
+            Task() : id(-1), priority(0), numaNode(-1) {}
+            
+            Task(int taskId, std::function<void()> func, int prio, int node = -1)
+                : id(taskId), function(std::move(func)), priority(prio), numaNode(node) {}
+            
+            bool hasTimestamps() const {
+                return scheduledTime != std::chrono::high_resolution_clock::time_point();
             }
         };
     }
     
+    // Планувальник з однією чергою виконання на кожен робочий потік.
+    // Задача з підказкою вузла NUMA ставиться до найменш завантаженої черги цього вузла, інша - до найменш
+    // завантаженої черги взагалі. Вільний потік краде задачу з найвищим пріоритетом (при рівних - на своєму вузлі),
+    // а окремий потік таймерів випускає відкладені задачі й періодично вирівнює довжини черг, тож жодна
+    // довга задача їх не затримує. З одним робочим потоком (за замовчуванням) поведінка
+    // відповідає одному виконавцю з пріоритетною чергою.
+    // Черги lock-free: пріоритети 0..63 мають окремі смуги, менші йдуть до смуги 0, більші - до смуги 63;
+    // усередині смуги порядок FIFO. Додавання задачі не бере м'ютексів, поки потік черги не спить.
+    // Scheduler with one run queue per worker thread.
+    // A task with a NUMA node hint goes to the least loaded queue on that node, any other task to the least
+    // loaded queue overall. An idle worker steals the highest-priority task (on ties, from its own node),
+    // and a separate timer thread releases delayed tasks and periodically evens out the queue lengths, so no
+    // long-running task holds them up. With one worker (the default) it behaves
+    // as a single executor with a priority queue.
+    // The queues are lock-free: priorities 0..63 get bands of their own, lower ones go to band 0 and higher
+    // ones to band 63; within a band the order is FIFO. Adding a task takes no mutex unless the queue's worker sleeps.
+    // Планувальник з однією чергою виконання на кожен робочий потік.
+    // Завдання з підказкою вузла NUMA ставиться до найменш завантаженої черги цього вузла, інше - до найменш
+    // завантаженої черги взагалі. Вільний потік краде завдання з найвищим пріоритетом (при рівних - на своєму вузлі),
+    // а окремий потік таймерів випускає відкладені завдання й періодично вирівнює довжини черг, тож жодне
+    // довге завдання їх не затримує. З одним робочим потоком (за замовчуванням) поведінка
+    // відповідає одному виконавцю з пріоритетною чергою.
+    // Черги lock-free: пріоритети 0..63 мають окремі смуги, менші йдуть до смуги 0, більші - до смуги 63;
+    // усередині смуги порядок FIFO. Додавання завдання не бере м'ютексів, поки потік черги не спить.
     class Scheduler {
     public:
-        Scheduler();
+        // Відкладені задачі зберігаються в колесі таймерів з кроком timerResolution;
+        // pinWorkers закріплює кожен робочий потік за окремим ядром (тільки Linux)
+        // Delayed tasks are kept in a timer wheel with a tick of timerResolution;
+        // pinWorkers pins every worker thread to its own core (Linux only)
+        // Відкладені завдання зберігаються в колесі таймерів з кроком timerResolution;
+        // pinWorkers закріплює кожен робочий потік за окремим ядром (тільки Linux)
+        explicit Scheduler(std::chrono::microseconds timerResolution = std::chrono::milliseconds(1),
+                           size_t workerCount = 1, bool pinWorkers = false);
         ~Scheduler();
         
         // Ініціалізація планувальника
@@ -76,73 +104,245 @@ namespace Core {
         // Зупинити планувальник
         void stop();
         
-        // Додати задачу до планувальника
-        // Add a task to the scheduler
-        // Додати завдання до планувальника
-        void addTask(std::function<void()> task, int priority = 0);
+        // Додати задачу до планувальника (повертає ID задачі або -1, якщо планувальник не запущено);
+        // numaNode - бажаний вузол NUMA або -1
+        // Add a task to the scheduler (returns the task ID or -1 if the scheduler is not running);
+        // numaNode is the preferred NUMA node or -1
+        // Додати завдання до планувальника (повертає ID завдання або -1, якщо планувальник не запущено);
+        // numaNode - бажаний вузол NUMA або -1
+        int addTask(std::function<void()> task, int priority = 0, int numaNode = -1);
         
-        // Додати задачу з відкладеним виконанням
-        // Add a task with delayed execution
-        // Додати завдання з відкладеним виконанням
-        void addDelayedTask(std::function<void()> task, std::chrono::milliseconds delay, int priority = 0);
+        // Додати задачу з відкладеним виконанням; задача не запускається раніше delay,
+        // але може запізнитися на один крок колеса
+        // Add a task with delayed execution; the task never runs before delay
+        // but may be up to one wheel tick late
+        // Додати завдання з відкладеним виконанням; завдання не запускається раніше delay,
+        // але може запізнитися на один крок колеса
+        int addDelayedTask(std::function<void()> task, std::chrono::milliseconds delay, int priority = 0, int numaNode = -1);
         
-        // Отримати кількість задач у черзі
-        // Get the number of tasks in the queue
-        // Отримати кількість завдань у черзі
+        // Варіанти з обробником скасування: onCancel викликається один раз замість task, якщо задачу
+        // скасовано через cancelTask() або відкинуто під час stop(). Під час зупинки обробники викликаються
+        // в потоці, що викликав stop(), після завершення робочих потоків і без утримання м'ютексів.
+        // Variants with a cancel handler: onCancel runs once instead of task if the task is
+        // cancelled through cancelTask() or discarded by stop(). While stopping, the handlers run
+        // on the thread that called stop(), after the workers have exited and with no mutex held.
+        // Варіанти з обробником скасування: onCancel викликається один раз замість task, якщо завдання
+        // скасовано через cancelTask() або відкинуто під час stop(). Під час зупинки обробники викликаються
+        // в потоці, що викликав stop(), після завершення робочих потоків і без утримання м'ютексів.
+        int addTask(std::function<void()> task, std::function<void()> onCancel, int priority, int numaNode = -1);
+        int addDelayedTask(std::function<void()> task, std::function<void()> onCancel, std::chrono::milliseconds delay,
+                           int priority = 0, int numaNode = -1);
+        
+        // Скасувати відкладену задачу, яка ще не потрапила до черги виконання
+        // Cancel a delayed task that has not reached the run queue yet
+        // Скасувати відкладене завдання, яке ще не потрапило до черги виконання
+        bool cancelTask(int taskId);
+        
+        // Записувати мітки часу нових задач (вимкнено за замовчуванням, щоб додавання не читало годинник);
+        // з ними статистика містить затримку в черзі. Відкладені задачі мають мітки завжди.
+        // Record timestamps of new tasks (off by default so adding a task does not read the clock);
+        // with them the statistics include the queue latency. Delayed tasks always have timestamps.
+        // Записувати мітки часу нових завдань (вимкнено за замовчуванням, щоб додавання не читало годинник);
+        // з ними статистика містить затримку в черзі. Відкладені завдання мають мітки завжди.
+        void setTaskTimestamps(bool enabled);
+        bool getTaskTimestamps() const;
+        
+        // Отримати кількість задач у черзі (разом з відкладеними)
+        // Get the number of tasks in the queue (including delayed ones)
+        // Отримати кількість завдань у черзі (разом з відкладеними)
         size_t getTaskCount() const;
         
-        // Отримати статистику планувальника
-        // Get scheduler statistics
-        // Отримати статистику планувальника
+        // Кількість робочих потоків і вузлів NUMA
+        // Number of worker threads and NUMA nodes
+        // Кількість робочих потоків і вузлів NUMA
+        size_t getWorkerCount() const;
+        size_t getNumaNodeCount() const;
+        
+        // Отримати статистику планувальника (сума за всіма робочими потоками)
+        // Get scheduler statistics (aggregated over all workers)
+        // Отримати статистику планувальника (сума за всіма робочими потоками)
         struct Statistics {
             size_t tasksAdded;
             size_t tasksCompleted;
             size_t tasksFailed;
+            size_t tasksCancelled;
             std::chrono::milliseconds totalExecutionTime;
             double averageExecutionTime;
             
-            Statistics() : tasksAdded(0), tasksCompleted(0), tasksFailed(0), 
-                          totalExecutionTime(0), averageExecutionTime(0.0) {}
+            // Точність таймерів: запізнення переміщення відкладеної задачі до черги відносно її строку
+            // Timer accuracy: how late a delayed task reached the run queue relative to its due time
+            // Точність таймерів: запізнення переміщення відкладеного завдання до черги відносно його строку
+            size_t timersFired;
+            double averageTimerLatency;              // мкс / us / мкс
+            std::chrono::microseconds maxTimerLatency;
+            
+            // Переміщення між чергами робочих потоків
+            // Moves between worker queues
+            // Переміщення між чергами робочих потоків
+            size_t tasksStolen;
+            size_t tasksRebalanced;
+            
+            // Затримка від запланованого моменту до початку виконання (лише задачі з мітками часу)
+            // Latency from the scheduled moment to the start of execution (timestamped tasks only)
+            // Затримка від запланованого моменту до початку виконання (лише завдання з мітками часу)
+            size_t timestampedTasks;
+            double averageQueueLatency;              // мкс / us / мкс
+            
+            Statistics() : tasksAdded(0), tasksCompleted(0), tasksFailed(0), tasksCancelled(0),
+                          totalExecutionTime(0), averageExecutionTime(0.0),
+                          timersFired(0), averageTimerLatency(0.0), maxTimerLatency(0),
+                          tasksStolen(0), tasksRebalanced(0), timestampedTasks(0), averageQueueLatency(0.0) {}
         };
         
         Statistics getStatistics() const;
         
+        // Статистика окремого робочого потоку
+        // Statistics of a single worker thread
+        // Статистика окремого робочого потоку
+        struct WorkerStatistics {
+            int cpu;                                 // Ядро або -1 без закріплення / Core or -1 when not pinned / Ядро або -1 без закріплення
+            int numaNode;
+            size_t queuedTasks;
+            size_t tasksCompleted;
+            size_t tasksFailed;
+            size_t tasksStolen;                      // Вкрадено цим потоком / Stolen by this worker / Вкрадено цим потоком
+            size_t tasksRebalanced;                  // Отримано під час вирівнювання / Received by rebalancing / Отримано під час вирівнювання
+            std::chrono::milliseconds totalExecutionTime;
+            size_t timestampedTasks;
+            std::chrono::microseconds totalQueueLatency;
+            
+            WorkerStatistics() : cpu(-1), numaNode(0), queuedTasks(0), tasksCompleted(0), tasksFailed(0),
+                                 tasksStolen(0), tasksRebalanced(0), totalExecutionTime(0),
+                                 timestampedTasks(0), totalQueueLatency(0) {}
+        };
+        
+        std::vector<WorkerStatistics> getWorkerStatistics() const;
+        
     private:
-        // Основний цикл планувальника
-        // Main scheduler loop
-        // Основний цикл планувальника
-        void schedulerLoop();
+        typedef NeuroSync::Core::Utils::MultiLevelQueue<Utils::Task> TaskQueue;
+        
+        // Черга робочого потоку; м'ютекс і змінна умови потрібні лише для сну потоку та статистики
+        // A worker's run queue; the mutex and condition variable are only for the worker's sleep and statistics
+        // Черга робочого потоку; м'ютекс і змінна умови потрібні лише для сну потоку та статистики
+        struct Shard {
+            std::thread thread;
+            mutable std::mutex mutex;
+            std::condition_variable condition;
+            TaskQueue queue;
+            bool wakeRequested;
+            
+            // Потік збирається заснути або спить; виробник будить його лише тоді
+            // The worker is about to sleep or sleeps; a producer wakes it only then
+            // Потік збирається заснути або спить; виробник будить його лише тоді
+            std::atomic<bool> sleeping;
+            
+            // Задачі в черзі плюс поточна задача; читається без блокування під час розміщення
+            // Queued tasks plus the running one; read without locking for placement
+            // Завдання в черзі плюс поточне; читається без блокування під час розміщення
+            std::atomic<size_t> load;
+            
+            WorkerStatistics statistics;             // Під mutex / Under mutex / Під mutex
+            
+            Shard() : wakeRequested(false), sleeping(false), load(0) {}
+        };
+        
+        // Смуга черги для пріоритету
+        // Queue band for a priority
+        // Смуга черги для пріоритету
+        static size_t priorityBand(int priority);
+        
+        // Цикл робочого потоку
+        // Worker loop
+        // Цикл робочого потоку
+        void workerLoop(size_t index);
+        
+        // Цикл потоку таймерів: спить до найближчої події колеса або до наступного вирівнювання
+        // Timer thread loop: sleeps until the nearest wheel event or the next rebalance
+        // Цикл потоку таймерів: спить до найближчої події колеса або до наступного вирівнювання
+        void timerLoop();
+        
+        // Розбудити потік таймерів (колесо змінилося або черга почала накопичувати задачі)
+        // Wake the timer thread (the wheel changed or a queue started to build up)
+        // Розбудити потік таймерів (колесо змінилося або черга почала накопичувати завдання)
+        void wakeTimerThread();
+        
+        // Перемістити відкладені задачі, строк яких настав, до черг виконання однією партією
+        // Move delayed tasks that came due into the run queues as one batch
+        // Перемістити відкладені завдання, строк яких настав, до черг виконання однією партією
+        void releaseDueTimers(std::chrono::high_resolution_clock::time_point now);
+        
+        // Вибрати чергу для нової задачі та поставити її туди
+        // Pick a queue for a new task and push it there
+        // Вибрати чергу для нового завдання та поставити його туди
+        size_t selectShard(int numaNode);
+        void pushTask(size_t index, Utils::Task task);
+        
+        // Розбудити потік черги, якщо він спить
+        // Wake the queue's worker if it sleeps
+        // Розбудити потік черги, якщо він спить
+        void wakeShard(Shard& shard);
+        
+        // Взяти задачу з власної черги або вкрасти з чужої
+        // Take a task from the own queue or steal one from another queue
+        // Взяти завдання з власної черги або вкрасти з чужої
+        bool popTask(size_t index, Utils::Task& task);
+        bool stealTask(size_t index, Utils::Task& task);
+        
+        // Вирівняти довжини черг між робочими потоками
+        // Even out queue lengths between workers
+        // Вирівняти довжини черг між робочими потоками
+        void rebalanceShards();
+        
+        // Переведення часу в тики колеса та назад
+        // Converting time to wheel ticks and back
+        // Переведення часу в тики колеса та назад
+        uint64_t tickAtOrAfter(std::chrono::high_resolution_clock::time_point time) const;
+        uint64_t tickAtOrBefore(std::chrono::high_resolution_clock::time_point time) const;
+        std::chrono::high_resolution_clock::time_point tickTime(uint64_t tick) const;
         
         // Виконати задачу
         // Execute task
         // Виконати завдання
-        void executeTask(const Utils::Task& task);
+        void executeTask(Shard& shard, const Utils::Task& task);
         
         // Генерувати унікальний ID для задачі
         // Generate unique ID for task
         // Згенерувати унікальний ID для завдання
         int generateTaskId();
         
-        // Черга задач
-        // Task queue
-        // Черга завдань
-        std::priority_queue<Utils::Task, std::vector<Utils::Task>, Utils::TaskComparator> taskQueue;
+        // Черги робочих потоків та їх розподіл за вузлами NUMA
+        // Worker queues and their split across NUMA nodes
+        // Черги робочих потоків та їх розподіл за вузлами NUMA
+        std::vector<std::unique_ptr<Shard>> shards;
+        std::vector<std::vector<size_t>> shardsByNode;
+        std::atomic<size_t> placementCursor;
+        bool pinWorkers;
         
-        // Потік планувальника
-        // Scheduler thread
-        // Потік планувальника
-        std::thread schedulerThread;
+        // Колесо таймерів відкладених задач, дескриптори за ID та буфер партії, що настала (під timerMutex)
+        // Timer wheel of delayed tasks, handles by ID and the buffer of the due batch (under timerMutex)
+        // Колесо таймерів відкладених завдань, дескриптори за ID та буфер партії, що настала (під timerMutex)
+        NeuroSync::Core::Utils::TimerWheel<Utils::Task> timerWheel;
+        std::unordered_map<int, uint32_t> timerHandles;
+        std::vector<Utils::Task> dueTasks;
+        std::chrono::high_resolution_clock::duration timerResolution;
+        std::chrono::high_resolution_clock::time_point timerEpoch;
         
-        // М'ютекс для синхронізації
-        // Mutex for synchronization
-        // М'ютекс для синхронізації
-        mutable std::mutex queueMutex;
-        mutable std::mutex statsMutex;
+        // Потік таймерів і його сон (під timerMutex); timerIdle - він спить без строку вирівнювання,
+        // і виробник, чия черга почала накопичувати задачі, має його розбудити
+        // Timer thread and its sleep (under timerMutex); timerIdle - it sleeps without a rebalance deadline,
+        // and a producer whose queue started to build up has to wake it
+        // Потік таймерів і його сон (під timerMutex); timerIdle - він спить без строку вирівнювання,
+        // і виробник, чия черга почала накопичувати завдання, має його розбудити
+        std::thread timerThread;
+        std::condition_variable timerCondition;
+        bool timerWakeRequested;
+        std::atomic<bool> timerIdle;
         
-        // Змінна умови для сповіщення
-        // Condition variable for notification
-        // Змінна умови для сповіщення
-        std::condition_variable condition;
+        // М'ютекс для синхронізації; порядок блокування: timerMutex, потім м'ютекси черг за зростанням індексу
+        // Mutex for synchronization; lock order: timerMutex, then queue mutexes in increasing index
+        // М'ютекс для синхронізації; порядок блокування: timerMutex, потім м'ютекси черг за зростанням індексу
+        mutable std::mutex timerMutex;
+        mutable std::mutex statsMutex;
         
         // Атомарні прапорці
         // Atomic flags
@@ -150,10 +350,20 @@ namespace Core {
         std::atomic<bool> running;
         std::atomic<bool> stopping;
         
-        // Лічильники
-        // Counters
-        // Лічильники
+        // Додавання, що пройшли перевірку running, але ще не поставили задачу; stop() чекає на них
+        // перед тим, як відкинути залишок, тож жодна задача не потрапляє до черги після зупинки
+        // Adds that passed the running check but have not placed their task yet; stop() waits for them
+        // before discarding what is left, so no task lands in a queue after the scheduler has stopped
+        // Додавання, що пройшли перевірку running, але ще не поставили завдання; stop() чекає на них
+        // перед тим, як відкинути залишок, тож жодне завдання не потрапляє до черги після зупинки
+        std::atomic<int> activeAdders;
+        
+        // Лічильники; додані задачі рахуються атомарно, щоб додавання не брало statsMutex
+        // Counters; added tasks are counted atomically so adding a task does not take statsMutex
+        // Лічильники; додані завдання рахуються атомарно, щоб додавання не брало statsMutex
         std::atomic<int> taskIdCounter;
+        std::atomic<size_t> tasksAdded;
+        std::atomic<bool> taskTimestamps;
         Statistics statistics;
     };
 }
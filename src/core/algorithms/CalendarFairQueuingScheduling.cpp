@@ -0,0 +1,301 @@
+#include "CalendarFairQueuingScheduling.h"
+#include <algorithm>
+
+// CalendarFairQueuingScheduling.cpp
+// Реализация Weighted Fair Queuing на календарной очереди
+// Implementation of Weighted Fair Queuing on a calendar queue
+// Реалізація Weighted Fair Queuing на календарній черзі
+
+namespace NeuroSync {
+namespace Core {
+namespace Algorithms {
+
+    namespace {
+        // Индекс младшего установленного бита (mask != 0)
+        // Index of the lowest set bit (mask != 0)
+        // Індекс молодшого встановленого біта (mask != 0)
+        inline size_t lowestSetBit(uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctzll(mask));
+#else
+            size_t index = 0;
+            while ((mask & 1) == 0) {
+                mask >>= 1;
+                index++;
+            }
+            return index;
+#endif
+        }
+    }
+
+    CalendarFairQueuingScheduling::CalendarFairQueuingScheduling()
+        : bucketHeads(BUCKET_COUNT, NO_NODE), bucketTails(BUCKET_COUNT, NO_NODE),
+          systemVirtualTime(0), initialized(false) {
+        // Конструктор алгоритма планирования на календарной очереди
+        // Constructor of the calendar queue scheduling algorithm
+        // Конструктор алгоритму планування на календарній черзі
+        std::fill(occupied, occupied + BITMAP_WORDS, 0);
+        std::fill(occupiedSummary, occupiedSummary + SUMMARY_WORDS, 0);
+    }
+
+    CalendarFairQueuingScheduling::~CalendarFairQueuingScheduling() {
+        // Деструктор алгоритма планирования на календарной очереди
+        // Destructor of the calendar queue scheduling algorithm
+        // Деструктор алгоритму планування на календарній черзі
+    }
+
+    void CalendarFairQueuingScheduling::initialize() {
+        // Инициализация алгоритма планирования на календарной очереди
+        // Initialize the calendar queue scheduling algorithm
+        // Ініціалізація алгоритму планування на календарній черзі
+
+        // Очистка существующих данных
+        // Clear existing data
+        // Очищення існуючих даних
+        nodes.clear();
+        freeNodes.clear();
+        nodeById.clear();
+        std::fill(bucketHeads.begin(), bucketHeads.end(), NO_NODE);
+        std::fill(bucketTails.begin(), bucketTails.end(), NO_NODE);
+        std::fill(occupied, occupied + BITMAP_WORDS, 0);
+        std::fill(occupiedSummary, occupiedSummary + SUMMARY_WORDS, 0);
+        systemVirtualTime = 0;
+
+        initialized = true;
+    }
+
+    int CalendarFairQueuingScheduling::selectNextTask() {
+        // Выбор первой задачи из ближайшей непустой корзины (наименьшее время завершения, FIFO при равенстве)
+        // Select the first task of the nearest non-empty bucket (smallest finish time, FIFO on ties)
+        // Вибір першого завдання з найближчого непорожнього кошика (найменший час завершення, FIFO при рівності)
+
+        if (!initialized || nodeById.empty()) {
+            return -1; // Нет доступных задач / No available tasks / Немає доступних завдань
+        }
+
+        uint32_t node = bucketHeads[firstOccupiedBucket()];
+        int taskId = nodes[node].taskId;
+
+        // Обновление виртуального времени системы
+        // Update system virtual time
+        // Оновлення віртуального часу системи
+        systemVirtualTime = nodes[node].virtualFinishTime;
+
+        unlink(node);
+        freeNodes.push_back(node);
+        nodeById.erase(taskId);
+        return taskId;
+    }
+
+    void CalendarFairQueuingScheduling::addTask(int taskId, int priority) {
+        // Добавление задачи в календарь
+        // Add a task to the calendar
+        // Додавання завдання до календаря
+
+        if (!initialized) {
+            return;
+        }
+
+        auto inserted = nodeById.emplace(taskId, 0);
+        if (!inserted.second) {
+            return; // Задача уже существует / Task already exists / Завдання вже існує
+        }
+
+        uint32_t node = allocateNode();
+        inserted.first->second = node;
+        nodes[node].taskId = taskId;
+        nodes[node].priority = priority;
+        nodes[node].weight = DEFAULT_WEIGHT;
+        link(node, systemVirtualTime + serviceTime(DEFAULT_WEIGHT));
+    }
+
+    void CalendarFairQueuingScheduling::removeTask(int taskId) {
+        // Удаление задачи из календаря
+        // Remove a task from the calendar
+        // Видалення завдання з календаря
+
+        if (!initialized) {
+            return;
+        }
+
+        auto it = nodeById.find(taskId);
+        if (it == nodeById.end()) {
+            return;
+        }
+        unlink(it->second);
+        freeNodes.push_back(it->second);
+        nodeById.erase(it);
+    }
+
+    void CalendarFairQueuingScheduling::updateTaskPriority(int taskId, int newPriority) {
+        // Обновление приоритета задачи
+        // Update task priority
+        // Оновлення пріоритету завдання
+
+        if (!initialized) {
+            return;
+        }
+
+        auto it = nodeById.find(taskId);
+        if (it != nodeById.end()) {
+            // Как и при повторном добавлении: конец очереди и виртуальное время от текущего момента
+            // As with re-adding: the back of the queue and a virtual finish time from the current moment
+            // Як і при повторному додаванні: кінець черги та віртуальний час від поточного моменту
+            uint32_t node = it->second;
+            nodes[node].priority = newPriority;
+            unlink(node);
+            link(node, systemVirtualTime + serviceTime(nodes[node].weight));
+        }
+    }
+
+    int CalendarFairQueuingScheduling::getTaskCount() const {
+        // Получение количества задач в очереди
+        // Get the number of tasks in the queue
+        // Отримання кількості завдань у черзі
+
+        return static_cast<int>(nodeById.size());
+    }
+
+    bool CalendarFairQueuingScheduling::isEmpty() const {
+        // Проверка, пуста ли очередь
+        // Check if the queue is empty
+        // Перевірка, чи черга порожня
+
+        return nodeById.empty();
+    }
+
+    void CalendarFairQueuingScheduling::setTaskWeight(int taskId, int weight) {
+        // Установка веса задачи: перенос в корзину нового времени завершения
+        // Set task weight: move the task to the bucket of its new finish time
+        // Встановлення ваги завдання: перенесення до кошика нового часу завершення
+
+        if (!initialized) {
+            return;
+        }
+
+        auto it = nodeById.find(taskId);
+        if (it != nodeById.end()) {
+            uint32_t node = it->second;
+            nodes[node].weight = weight;
+            unlink(node);
+            link(node, systemVirtualTime + serviceTime(weight));
+        }
+    }
+
+    uint64_t CalendarFairQueuingScheduling::getVirtualTime() const {
+        return systemVirtualTime;
+    }
+
+    uint32_t CalendarFairQueuingScheduling::allocateNode() {
+        // Узел из списка свободных или новый узел пула
+        // A node from the free list or a new pool node
+        // Вузол зі списку вільних або новий вузол пулу
+
+        if (!freeNodes.empty()) {
+            uint32_t node = freeNodes.back();
+            freeNodes.pop_back();
+            return node;
+        }
+        nodes.push_back(Node());
+        return static_cast<uint32_t>(nodes.size() - 1);
+    }
+
+    void CalendarFairQueuingScheduling::link(uint32_t node, uint64_t virtualFinishTime) {
+        // Добавление узла в конец корзины его времени завершения
+        // Append the node to the bucket of its finish time
+        // Додавання вузла в кінець кошика його часу завершення
+
+        size_t bucket = virtualFinishTime % BUCKET_COUNT;
+        Node& entry = nodes[node];
+        entry.virtualFinishTime = virtualFinishTime;
+        entry.bucket = static_cast<uint32_t>(bucket);
+        entry.next = NO_NODE;
+        entry.prev = bucketTails[bucket];
+
+        if (entry.prev != NO_NODE) {
+            nodes[entry.prev].next = node;
+        } else {
+            bucketHeads[bucket] = node;
+            occupied[bucket / 64] |= uint64_t(1) << (bucket % 64);
+            occupiedSummary[bucket / 64 / 64] |= uint64_t(1) << (bucket / 64 % 64);
+        }
+        bucketTails[bucket] = node;
+    }
+
+    void CalendarFairQueuingScheduling::unlink(uint32_t node) {
+        // Удаление узла из его корзины
+        // Remove the node from its bucket
+        // Видалення вузла з його кошика
+
+        const Node& entry = nodes[node];
+        size_t bucket = entry.bucket;
+
+        if (entry.prev != NO_NODE) {
+            nodes[entry.prev].next = entry.next;
+        } else {
+            bucketHeads[bucket] = entry.next;
+        }
+        if (entry.next != NO_NODE) {
+            nodes[entry.next].prev = entry.prev;
+        } else {
+            bucketTails[bucket] = entry.prev;
+        }
+
+        if (bucketHeads[bucket] == NO_NODE) {
+            occupied[bucket / 64] &= ~(uint64_t(1) << (bucket % 64));
+            if (occupied[bucket / 64] == 0) {
+                occupiedSummary[bucket / 64 / 64] &= ~(uint64_t(1) << (bucket / 64 % 64));
+            }
+        }
+    }
+
+    size_t CalendarFairQueuingScheduling::firstOccupiedBucket() const {
+        // Поиск первой непустой корзины по кольцу, начиная с корзины текущего виртуального времени.
+        // Все задачи лежат не дальше одного окна от нее, поэтому первая найденная - самая ранняя.
+        // Find the first non-empty bucket around the ring starting at the current virtual time's bucket.
+        // Every task lies within one window of it, so the first one found is the earliest.
+        // Пошук першого непорожнього кошика по кільцю, починаючи з кошика поточного віртуального часу.
+        // Усі завдання лежать не далі одного вікна від нього, тому перший знайдений - найраніший.
+
+        size_t start = systemVirtualTime % BUCKET_COUNT;
+        size_t word = start / 64;
+
+        uint64_t mask = occupied[word] & (~uint64_t(0) << (start % 64));
+        if (mask != 0) {
+            return word * 64 + lowestSetBit(mask);
+        }
+
+        // Следующее непустое слово карты по сводке: сначала после слова start, затем с начала кольца
+        // The next non-empty bitmap word from the summary: first after start's word, then from the ring's start
+        // Наступне непорожнє слово карти за зведенням: спочатку після слова start, потім з початку кільця
+        for (size_t pass = 0; pass < 2; ++pass) {
+            size_t from = pass == 0 ? word + 1 : 0;
+            for (size_t summaryWord = from / 64; summaryWord < SUMMARY_WORDS; ++summaryWord) {
+                uint64_t summaryMask = occupiedSummary[summaryWord];
+                if (summaryWord == from / 64) {
+                    summaryMask &= from % 64 == 0 ? ~uint64_t(0) : ~uint64_t(0) << (from % 64);
+                }
+                if (summaryMask != 0) {
+                    size_t index = summaryWord * 64 + lowestSetBit(summaryMask);
+                    return index * 64 + lowestSetBit(occupied[index]);
+                }
+            }
+        }
+        return start; // Недостижимо при непустой очереди / Unreachable with a non-empty queue / Недосяжно при непорожній черзі
+    }
+
+    uint64_t CalendarFairQueuingScheduling::serviceTime(int weight) {
+        // Виртуальное время обслуживания, округленное до ближайшего целого; вес не меньше 1,
+        // время не меньше 1 единицы
+        // Virtual service time rounded to the nearest integer; the weight is at least 1
+        // and the time at least 1 unit
+        // Віртуальний час обслуговування, округлений до найближчого цілого; вага не менша за 1,
+        // час не менший за 1 одиницю
+
+        uint64_t clampedWeight = static_cast<uint64_t>(std::max(weight, 1));
+        return std::max<uint64_t>(1, (2 * VIRTUAL_TIME_SCALE + clampedWeight) / (2 * clampedWeight));
+    }
+
+} // namespace Algorithms
+} // namespace Core
+} // namespace NeuroSync
@@ -0,0 +1,161 @@
+#ifndef CALENDAR_FAIR_QUEUING_SCHEDULING_H
+#define CALENDAR_FAIR_QUEUING_SCHEDULING_H
+
+#include "../interfaces/SchedulingAlgorithm.h"
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+// CalendarFairQueuingScheduling.h
+// Алгоритм Weighted Fair Queuing на календарной очереди с целочисленным виртуальным временем
+// Weighted Fair Queuing on a calendar queue with integer virtual time
+// Алгоритм Weighted Fair Queuing на календарній черзі з цілочисельним віртуальним часом
+
+namespace NeuroSync {
+namespace Core {
+namespace Algorithms {
+
+    // Weighted Fair Queuing с постоянным временем операций.
+    // Виртуальное время целочисленное: обслуживание задачи с весом w стоит VIRTUAL_TIME_SCALE / w единиц,
+    // поэтому все время завершения в очереди лежат в окне [V, V + VIRTUAL_TIME_SCALE] от виртуального времени V.
+    // Окно покрывается кольцом корзин по одной единице виртуального времени с двухуровневой битовой картой
+    // занятости: вставка, удаление и смена веса - O(1), выбор - поиск первого занятого бита в двух словах сводки
+    // и одном слове корзин. Задачи одной корзины имеют равное время и обслуживаются FIFO, поэтому порядок
+    // совпадает с WeightedFairQueuingScheduling с точностью до округления VIRTUAL_TIME_SCALE / w до целого.
+    // Weighted Fair Queuing with constant-time operations.
+    // Virtual time is an integer: serving a task with weight w costs VIRTUAL_TIME_SCALE / w units,
+    // so every queued finish time lies in the window [V, V + VIRTUAL_TIME_SCALE] of the virtual time V.
+    // The window is covered by a ring of one-unit buckets with a two-level occupancy bitmap: insertion,
+    // removal and weight changes are O(1), selection is a first-set-bit search over two summary words
+    // and one bucket word. Tasks in a bucket have equal times and are served FIFO, so the order matches
+    // WeightedFairQueuingScheduling up to rounding VIRTUAL_TIME_SCALE / w to an integer.
+    // Weighted Fair Queuing з постійним часом операцій.
+    // Віртуальний час цілочисельний: обслуговування завдання з вагою w коштує VIRTUAL_TIME_SCALE / w одиниць,
+    // тому всі часи завершення в черзі лежать у вікні [V, V + VIRTUAL_TIME_SCALE] від віртуального часу V.
+    // Вікно покривається кільцем кошиків по одній одиниці віртуального часу з дворівневою бітовою картою
+    // зайнятості: вставка, видалення та зміна ваги - O(1), вибір - пошук першого зайнятого біта у двох словах
+    // зведення та одному слові кошиків. Завдання одного кошика мають рівний час і обслуговуються FIFO, тому порядок
+    // збігається з WeightedFairQueuingScheduling з точністю до округлення VIRTUAL_TIME_SCALE / w до цілого.
+    class CalendarFairQueuingScheduling : public SchedulingAlgorithm {
+    public:
+        CalendarFairQueuingScheduling();
+        ~CalendarFairQueuingScheduling() override;
+
+        // Инициализация алгоритма
+        // Initialize the algorithm
+        // Ініціалізація алгоритму
+        void initialize() override;
+
+        // Выбор следующей задачи для выполнения
+        // Select the next task to execute
+        // Вибір наступного завдання для виконання
+        int selectNextTask() override;
+
+        // Добавление задачи в очередь
+        // Add a task to the queue
+        // Додавання завдання до черги
+        void addTask(int taskId, int priority) override;
+
+        // Удаление задачи из очереди
+        // Remove a task from the queue
+        // Видалення завдання з черги
+        void removeTask(int taskId) override;
+
+        // Обновление приоритета задачи
+        // Update task priority
+        // Оновлення пріоритету завдання
+        void updateTaskPriority(int taskId, int newPriority) override;
+
+        // Получение количества задач в очереди
+        // Get the number of tasks in the queue
+        // Отримання кількості завдань у черзі
+        int getTaskCount() const override;
+
+        // Проверка, пуста ли очередь
+        // Check if the queue is empty
+        // Перевірка, чи черга порожня
+        bool isEmpty() const override;
+
+        // Установка веса задачи
+        // Set task weight
+        // Встановлення ваги завдання
+        void setTaskWeight(int taskId, int weight);
+
+        // Текущее виртуальное время (единиц VIRTUAL_TIME_SCALE на обслуживание с весом 1)
+        // Current virtual time (VIRTUAL_TIME_SCALE units per service at weight 1)
+        // Поточний віртуальний час (одиниць VIRTUAL_TIME_SCALE на обслуговування з вагою 1)
+        uint64_t getVirtualTime() const;
+
+        // Виртуальное время обслуживания с весом 1. Округление дает задаче с весом w
+        // относительную ошибку доли до w / (2 * VIRTUAL_TIME_SCALE); веса больше него неразличимы.
+        // Virtual service time at weight 1. Rounding gives a task with weight w a relative
+        // share error of up to w / (2 * VIRTUAL_TIME_SCALE); weights above it are indistinguishable.
+        // Віртуальний час обслуговування з вагою 1. Округлення дає завданню з вагою w
+        // відносну помилку частки до w / (2 * VIRTUAL_TIME_SCALE); ваги, більші за нього, нерозрізненні.
+        static constexpr uint64_t VIRTUAL_TIME_SCALE = 4096;
+
+    private:
+        // Кольцо вдвое шире окна, чтобы корзина V и корзина V + VIRTUAL_TIME_SCALE не совпадали
+        // The ring is twice the window so the buckets of V and V + VIRTUAL_TIME_SCALE never coincide
+        // Кільце вдвічі ширше за вікно, щоб кошики V та V + VIRTUAL_TIME_SCALE не збігалися
+        static constexpr size_t BUCKET_COUNT = 2 * VIRTUAL_TIME_SCALE;
+        static constexpr size_t BITMAP_WORDS = BUCKET_COUNT / 64;
+        static constexpr size_t SUMMARY_WORDS = BITMAP_WORDS / 64;
+        static constexpr uint32_t NO_NODE = UINT32_MAX;
+
+        // Задача в корзине (узел двусвязного списка в пуле)
+        // A task in a bucket (a doubly linked list node in the pool)
+        // Завдання в кошику (вузол двозв'язного списку в пулі)
+        struct Node {
+            int taskId;
+            int priority;
+            int weight;
+            uint64_t virtualFinishTime;
+            uint32_t bucket;
+            uint32_t prev;
+            uint32_t next;
+        };
+
+        uint32_t allocateNode();
+        void link(uint32_t node, uint64_t virtualFinishTime);
+        void unlink(uint32_t node);
+        size_t firstOccupiedBucket() const;
+        static uint64_t serviceTime(int weight);
+
+        // Пул узлов, свободные узлы и индекс ID задачи -> узел
+        // Node pool, free nodes and the task ID -> node index
+        // Пул вузлів, вільні вузли та індекс ID завдання -> вузол
+        std::vector<Node> nodes;
+        std::vector<uint32_t> freeNodes;
+        std::unordered_map<int, uint32_t> nodeById;
+
+        // Головы и хвосты корзин, битовая карта непустых корзин и сводка непустых слов карты
+        // Bucket heads and tails, the bitmap of non-empty buckets and the summary of non-empty bitmap words
+        // Голови та хвости кошиків, бітова карта непорожніх кошиків і зведення непорожніх слів карти
+        std::vector<uint32_t> bucketHeads;
+        std::vector<uint32_t> bucketTails;
+        uint64_t occupied[BITMAP_WORDS];
+        uint64_t occupiedSummary[SUMMARY_WORDS];
+
+        // Виртуальное время системы
+        // System virtual time
+        // Віртуальний час системи
+        uint64_t systemVirtualTime;
+
+        // Флаг инициализации
+        // Initialization flag
+        // Прапор ініціалізації
+        bool initialized;
+
+        // Вес по умолчанию
+        // Default weight
+        // Вага за замовчуванням
+        static const int DEFAULT_WEIGHT = 1;
+    };
+
+} // namespace Algorithms
+} // namespace Core
+} // namespace NeuroSync
+
+#endif // CALENDAR_FAIR_QUEUING_SCHEDULING_H
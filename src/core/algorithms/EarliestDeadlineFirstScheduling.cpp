@@ -0,0 +1,282 @@
+#include "EarliestDeadlineFirstScheduling.h"
+#include <algorithm>
+
+// EarliestDeadlineFirstScheduling.cpp
+// Реализация алгоритма планирования по ближайшему крайнему сроку (EDF)
+// Implementation of earliest-deadline-first (EDF) scheduling algorithm
+// Реалізація алгоритму планування за найближчим крайнім строком (EDF)
+
+namespace NeuroSync {
+namespace Core {
+namespace Algorithms {
+
+    EarliestDeadlineFirstScheduling::EarliestDeadlineFirstScheduling(size_t processorCount)
+        : processorCount(std::max<size_t>(1, processorCount)), timestampCounter(0), initialized(false) {
+        // Конструктор алгоритма планирования EDF
+        // Constructor of EDF scheduling algorithm
+        // Конструктор алгоритму планування EDF
+    }
+
+    EarliestDeadlineFirstScheduling::~EarliestDeadlineFirstScheduling() {
+        // Деструктор алгоритма планирования EDF
+        // Destructor of EDF scheduling algorithm
+        // Деструктор алгоритму планування EDF
+    }
+
+    void EarliestDeadlineFirstScheduling::initialize() {
+        // Инициализация алгоритма планирования EDF
+        // Initialize EDF scheduling algorithm
+        // Ініціалізація алгоритму планування EDF
+
+        // Очистка существующих данных
+        // Clear existing data
+        // Очищення існуючих даних
+        taskQueue.clear();
+        deadlineTasks.clear();
+        reservedTasks.clear();
+        runningTasks.clear();
+        timestampCounter = 0;
+
+        initialized = true;
+    }
+
+    int EarliestDeadlineFirstScheduling::selectNextTask() {
+        // Выбор задачи с ближайшим сроком (или самой приоритетной задачи без срока)
+        // Select the task with the earliest deadline (or the highest-priority task without one)
+        // Вибір завдання з найближчим строком (або найпріоритетнішого завдання без строку)
+
+        if (!initialized || taskQueue.empty()) {
+            return -1; // Нет доступных задач / No available tasks / Немає доступних завдань
+        }
+
+        const DeadlineTask& top = taskQueue.top();
+        if (top.deadline > 0) {
+            deadlineTasks.erase(AdmittedTask{top.deadline, top.taskId, top.estimatedExecutionTime});
+        }
+        return taskQueue.pop();
+    }
+
+    void EarliestDeadlineFirstScheduling::addTask(int taskId, int priority) {
+        // Добавление задачи без крайнего срока
+        // Add a task without a deadline
+        // Додавання завдання без крайнього строку
+
+        addTask(taskId, priority, 0, 0);
+    }
+
+    void EarliestDeadlineFirstScheduling::addTask(int taskId, int priority, long long deadline, long long estimatedExecutionTime) {
+        // Добавление задачи в очередь
+        // Add a task to the queue
+        // Додавання завдання до черги
+
+        if (!initialized) {
+            return;
+        }
+
+        // Проверка, существует ли задача с таким ID
+        // Check if a task with this ID already exists
+        // Перевірка, чи існує завдання з таким ID
+        if (taskQueue.contains(taskId)) {
+            return; // Задача уже существует / Task already exists / Завдання вже існує
+        }
+
+        DeadlineTask newTask;
+        newTask.taskId = taskId;
+        newTask.priority = priority;
+        newTask.deadline = std::max(0LL, deadline);
+        newTask.estimatedExecutionTime = std::max(0LL, estimatedExecutionTime);
+        newTask.timestamp = timestampCounter++;
+
+        // Зарезервированная задача уже учтена в допуске со своим сроком и оценкой
+        // A reserved task is already counted in admission with its deadline and estimate
+        // Зарезервоване завдання вже враховане в допуску зі своїм строком та оцінкою
+        auto reserved = reservedTasks.find(taskId);
+        if (reserved != reservedTasks.end()) {
+            deadlineTasks.erase(reserved->second);
+            reservedTasks.erase(reserved);
+        }
+
+        taskQueue.push(taskId, newTask);
+        if (newTask.deadline > 0) {
+            deadlineTasks.insert(AdmittedTask{newTask.deadline, taskId, newTask.estimatedExecutionTime});
+        }
+    }
+
+    void EarliestDeadlineFirstScheduling::removeTask(int taskId) {
+        // Удаление задачи из очереди
+        // Remove a task from the queue
+        // Видалення завдання з черги
+
+        if (!initialized) {
+            return;
+        }
+
+        const DeadlineTask* task = taskQueue.find(taskId);
+        if (task == nullptr) {
+            auto reserved = reservedTasks.find(taskId);
+            if (reserved != reservedTasks.end()) {
+                deadlineTasks.erase(reserved->second);
+                reservedTasks.erase(reserved);
+            }
+            return;
+        }
+        if (task->deadline > 0) {
+            deadlineTasks.erase(AdmittedTask{task->deadline, taskId, task->estimatedExecutionTime});
+        }
+        taskQueue.erase(taskId);
+    }
+
+    void EarliestDeadlineFirstScheduling::updateTaskPriority(int taskId, int newPriority) {
+        // Обновление приоритета задачи; срок задачи не меняется
+        // Update task priority; the task's deadline does not change
+        // Оновлення пріоритету завдання; строк завдання не змінюється
+
+        if (!initialized) {
+            return;
+        }
+
+        const DeadlineTask* task = taskQueue.find(taskId);
+        if (task != nullptr) {
+            DeadlineTask updated = *task;
+            updated.priority = newPriority;
+            updated.timestamp = timestampCounter++;
+            taskQueue.update(taskId, updated);
+        }
+    }
+
+    int EarliestDeadlineFirstScheduling::getTaskCount() const {
+        // Получение количества задач в очереди
+        // Get the number of tasks in the queue
+        // Отримання кількості завдань у черзі
+
+        return static_cast<int>(taskQueue.size());
+    }
+
+    bool EarliestDeadlineFirstScheduling::isEmpty() const {
+        // Проверка, пуста ли очередь
+        // Check if the queue is empty
+        // Перевірка, чи черга порожня
+
+        return taskQueue.empty();
+    }
+
+    bool EarliestDeadlineFirstScheduling::canAdmit(long long deadline, long long estimatedExecutionTime, long long now) const {
+        // Проверка допуска: проход по задачам в порядке сроков с накоплением нагрузки
+        // Admission check: walk the tasks in deadline order accumulating the load
+        // Перевірка допуску: прохід по завданнях у порядку строків з накопиченням навантаження
+
+        if (!initialized) {
+            return false;
+        }
+        if (deadline <= 0) {
+            return true; // Задача без срока / Task without a deadline / Завдання без строку
+        }
+
+        // Исполнители освобождаются, когда выполняющиеся на них задачи исчерпают оценку;
+        // задачи сверх числа исполнителей добавляют свой остаток к нагрузке
+        // Executors become free once the tasks running on them use up their estimate;
+        // tasks beyond the executor count add their remainder to the load
+        // Виконавці звільняються, коли завдання, що на них виконуються, вичерпають оцінку;
+        // завдання понад кількість виконавців додають свій залишок до навантаження
+        std::vector<long long> offsets;
+        offsets.reserve(runningTasks.size() + processorCount);
+        for (const auto& entry : runningTasks) {
+            const RunningTask& running = entry.second;
+            offsets.push_back(std::max(0LL, running.startTime + running.estimatedExecutionTime - now));
+        }
+        offsets.resize(std::max(offsets.size(), processorCount), 0);
+        std::sort(offsets.begin(), offsets.end());
+        long long demand = 0;
+        for (size_t i = processorCount; i < offsets.size(); ++i) {
+            demand += offsets[i];
+        }
+        offsets.resize(processorCount);
+
+        estimatedExecutionTime = std::max(0LL, estimatedExecutionTime);
+        bool placed = false;
+
+        for (const AdmittedTask& entry : deadlineTasks) {
+            // Новая задача встает перед первой задачей с более поздним сроком
+            // The new task goes before the first task with a later deadline
+            // Нове завдання стає перед першим завданням з пізнішим строком
+            if (!placed && deadline < entry.deadline) {
+                demand += estimatedExecutionTime;
+                if (now + finishTime(offsets, demand) > deadline) {
+                    return false;
+                }
+                placed = true;
+            }
+
+            demand += entry.estimatedExecutionTime;
+
+            // Допущенная задача, которая успевала без новой, должна успевать и с ней
+            // An admitted task that made it without the new one must still make it
+            // Допущене завдання, яке встигало без нового, має встигати і з ним
+            if (placed && now + finishTime(offsets, demand) > entry.deadline &&
+                now + finishTime(offsets, demand - estimatedExecutionTime) <= entry.deadline) {
+                return false;
+            }
+        }
+
+        if (!placed) {
+            demand += estimatedExecutionTime;
+            if (now + finishTime(offsets, demand) > deadline) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    double EarliestDeadlineFirstScheduling::finishTime(const std::vector<long long>& offsets, long long demand) {
+        // Заполнение исполнителей по мере освобождения: первые k исполнителей к моменту t выполняют
+        // k*t - (сумма их offsets); ответ - первое k, при котором t не позже освобождения следующего
+        // Filling executors as they become free: by time t the first k executors complete
+        // k*t - (sum of their offsets); the answer is the first k whose t is no later than the next release
+        // Заповнення виконавців у міру звільнення: перші k виконавців до моменту t виконують
+        // k*t - (сума їхніх offsets); відповідь - перше k, за якого t не пізніше звільнення наступного
+        double released = 0.0;
+        for (size_t k = 1; k <= offsets.size(); ++k) {
+            released += static_cast<double>(offsets[k - 1]);
+            double time = (static_cast<double>(demand) + released) / static_cast<double>(k);
+            if (k == offsets.size() || time <= static_cast<double>(offsets[k])) {
+                return time;
+            }
+        }
+        return static_cast<double>(demand);
+    }
+
+    void EarliestDeadlineFirstScheduling::reserveTask(int taskId, long long deadline, long long estimatedExecutionTime) {
+        // Резерв задачи со сроком, ждущей зависимостей
+        // Reserve a deadline task that waits for its dependencies
+        // Резерв завдання зі строком, що чекає залежностей
+
+        if (!initialized || deadline <= 0 || taskQueue.contains(taskId) || reservedTasks.count(taskId) > 0) {
+            return;
+        }
+        AdmittedTask reserved{deadline, taskId, std::max(0LL, estimatedExecutionTime)};
+        reservedTasks.emplace(taskId, reserved);
+        deadlineTasks.insert(reserved);
+    }
+
+    void EarliestDeadlineFirstScheduling::startTask(int taskId, long long estimatedExecutionTime, long long startTime) {
+        // Задача занимает исполнителя до finishTask
+        // The task occupies an executor until finishTask
+        // Завдання займає виконавця до finishTask
+
+        if (!initialized) {
+            return;
+        }
+        runningTasks[taskId] = RunningTask{std::max(0LL, estimatedExecutionTime), startTime};
+    }
+
+    void EarliestDeadlineFirstScheduling::finishTask(int taskId) {
+        runningTasks.erase(taskId);
+    }
+
+    size_t EarliestDeadlineFirstScheduling::getProcessorCount() const {
+        return processorCount;
+    }
+
+} // namespace Algorithms
+} // namespace Core
+} // namespace NeuroSync
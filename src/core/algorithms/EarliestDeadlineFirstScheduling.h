@@ -0,0 +1,209 @@
+#ifndef EARLIEST_DEADLINE_FIRST_SCHEDULING_H
+#define EARLIEST_DEADLINE_FIRST_SCHEDULING_H
+
+#include "../interfaces/SchedulingAlgorithm.h"
+#include "IndexedDaryHeap.h"
+#include <set>
+#include <unordered_map>
+#include <vector>
+#include <cstddef>
+
+// EarliestDeadlineFirstScheduling.h
+// Алгоритм планирования по ближайшему крайнему сроку (EDF)
+// Earliest-deadline-first (EDF) scheduling algorithm
+// Алгоритм планування за найближчим крайнім строком (EDF)
+
+namespace NeuroSync {
+namespace Core {
+namespace Algorithms {
+
+    // Структура для представления задачи в алгоритме EDF.
+    // Время задается в миллисекундах; deadline == 0 означает задачу без крайнего срока.
+    // Structure to represent a task in the EDF algorithm.
+    // Times are in milliseconds; deadline == 0 marks a task without a deadline.
+    // Структура для представлення завдання в алгоритмі EDF.
+    // Час задається в мілісекундах; deadline == 0 означає завдання без крайнього строку.
+    struct DeadlineTask {
+        int taskId;
+        int priority;
+        long long deadline;                // Абсолютный крайний срок / Absolute deadline / Абсолютний крайній строк
+        long long estimatedExecutionTime;  // Оценка времени выполнения / Run-time estimate / Оцінка часу виконання
+        long long timestamp;               // Для обеспечения стабильности сортировки / For stable sorting / Для забезпечення стабільності сортування
+
+        // Оператор сравнения для очереди с приоритетом: задачи со сроком идут раньше задач без срока
+        // и упорядочены по сроку; задачи без срока упорядочены как в PriorityTask
+        // Comparison operator for the priority queue: tasks with a deadline go before tasks without one
+        // and are ordered by deadline; tasks without a deadline are ordered as in PriorityTask
+        // Оператор порівняння для черги з пріоритетом: завдання зі строком ідуть раніше завдань без строку
+        // і впорядковані за строком; завдання без строку впорядковані як у PriorityTask
+        bool operator<(const DeadlineTask& other) const {
+            bool hasDeadline = deadline > 0;
+            bool otherHasDeadline = other.deadline > 0;
+            if (hasDeadline != otherHasDeadline) {
+                return !hasDeadline;
+            }
+            if (hasDeadline && deadline != other.deadline) {
+                return deadline > other.deadline; // Ближайший срок первый / Earliest deadline first / Найближчий строк перший
+            }
+            if (priority == other.priority) {
+                return timestamp > other.timestamp; // FIFO для задач с одинаковым приоритетом / FIFO for tasks with the same priority / FIFO для завдань з однаковим пріоритетом
+            }
+            return priority < other.priority;
+        }
+    };
+
+    // Алгоритм планирования EDF с контролем допуска.
+    // Задача со сроком допускается, только если после ее добавления все задачи со сроком в очереди
+    // успевают завершиться: для каждой задачи сумма оценок задач с не более поздним сроком,
+    // распределенная по исполнителям с момента их освобождения, укладывается в время до ее срока.
+    // Исполнитель занят выполняющейся задачей до конца ее оценки (оценка минус прошедшее время).
+    // Задачи без срока выполняются после задач со сроком в порядке приоритетов.
+    // EDF scheduling algorithm with admission control.
+    // A task with a deadline is admitted only if every queued deadline task can still finish once it is added:
+    // for each task, the estimates of the tasks with a deadline no later than its own, spread across
+    // the executors from the moment each becomes free, fit in the time left until its deadline.
+    // An executor is busy with a running task until its estimate runs out (estimate minus elapsed time).
+    // Tasks without a deadline run after the deadline tasks in priority order.
+    // Алгоритм планування EDF з контролем допуску.
+    // Завдання зі строком допускається, лише якщо після його додавання всі завдання зі строком у черзі
+    // встигають завершитися: для кожного завдання сума оцінок завдань з не пізнішим строком,
+    // розподілена по виконавцях з моменту їх звільнення, вкладається в час до його строку.
+    // Виконавець зайнятий завданням, що виконується, до кінця його оцінки (оцінка мінус час, що минув).
+    // Завдання без строку виконуються після завдань зі строком у порядку пріоритетів.
+    class EarliestDeadlineFirstScheduling : public SchedulingAlgorithm {
+    public:
+        explicit EarliestDeadlineFirstScheduling(size_t processorCount = 1);
+        ~EarliestDeadlineFirstScheduling() override;
+
+        // Инициализация алгоритма
+        // Initialize the algorithm
+        // Ініціалізація алгоритму
+        void initialize() override;
+
+        // Выбор следующей задачи для выполнения
+        // Select the next task to execute
+        // Вибір наступного завдання для виконання
+        int selectNextTask() override;
+
+        // Добавление задачи без крайнего срока
+        // Add a task without a deadline
+        // Додавання завдання без крайнього строку
+        void addTask(int taskId, int priority) override;
+
+        // Добавление задачи с крайним сроком (без проверки допуска, см. canAdmit)
+        // Add a task with a deadline (without the admission check, see canAdmit)
+        // Додавання завдання з крайнім строком (без перевірки допуску, див. canAdmit)
+        void addTask(int taskId, int priority, long long deadline, long long estimatedExecutionTime);
+
+        // Удаление задачи из очереди
+        // Remove a task from the queue
+        // Видалення завдання з черги
+        void removeTask(int taskId) override;
+
+        // Обновление приоритета задачи
+        // Update task priority
+        // Оновлення пріоритету завдання
+        void updateTaskPriority(int taskId, int newPriority) override;
+
+        // Получение количества задач в очереди
+        // Get the number of tasks in the queue
+        // Отримання кількості завдань у черзі
+        int getTaskCount() const override;
+
+        // Проверка, пуста ли очередь
+        // Check if the queue is empty
+        // Перевірка, чи черга порожня
+        bool isEmpty() const override;
+
+        // Проверка допуска задачи со сроком deadline и оценкой estimatedExecutionTime в момент now.
+        // Отклоняет задачу, которая сама не успевает или делает неуспевающей уже допущенную.
+        // Check admission of a task with the given deadline and estimate at time now.
+        // Rejects a task that cannot finish itself or that would make an admitted task miss.
+        // Перевірка допуску завдання зі строком deadline та оцінкою estimatedExecutionTime у момент now.
+        // Відхиляє завдання, яке саме не встигає або робить неуспішним уже допущене.
+        bool canAdmit(long long deadline, long long estimatedExecutionTime, long long now) const;
+
+        // Резерв допущенной задачи со сроком, которая ждет зависимостей: учитывается в допуске,
+        // пока не попадет в очередь через addTask или не будет снята через removeTask
+        // Reservation of an admitted deadline task that waits for its dependencies: it counts in admission
+        // until it is queued by addTask or dropped by removeTask
+        // Резерв допущеного завдання зі строком, що чекає залежностей: враховується в допуску,
+        // доки не потрапить до черги через addTask або не буде знятий через removeTask
+        void reserveTask(int taskId, long long deadline, long long estimatedExecutionTime);
+
+        // Начало и завершение выполнения выбранной задачи; до завершения она занимает исполнителя
+        // Start and completion of a selected task; until completion it occupies an executor
+        // Початок і завершення виконання вибраного завдання; до завершення воно займає виконавця
+        void startTask(int taskId, long long estimatedExecutionTime, long long startTime);
+        void finishTask(int taskId);
+
+        // Число исполнителей, на которое делится нагрузка при проверке допуска
+        // Number of executors the load is split across in the admission check
+        // Кількість виконавців, на яку ділиться навантаження під час перевірки допуску
+        size_t getProcessorCount() const;
+
+    private:
+        // Задача со сроком в порядке сроков для проверки допуска
+        // A deadline task in deadline order for the admission check
+        // Завдання зі строком у порядку строків для перевірки допуску
+        struct AdmittedTask {
+            long long deadline;
+            int taskId;
+            long long estimatedExecutionTime;
+
+            bool operator<(const AdmittedTask& other) const {
+                if (deadline != other.deadline) {
+                    return deadline < other.deadline;
+                }
+                return taskId < other.taskId;
+            }
+        };
+
+        // Выполняющаяся задача
+        // A running task
+        // Завдання, що виконується
+        struct RunningTask {
+            long long estimatedExecutionTime;
+            long long startTime;
+        };
+
+        // Момент, когда исполнители с временами освобождения offsets (по возрастанию, от now)
+        // выполнят нагрузку demand
+        // The moment executors with release times offsets (ascending, from now) complete the load demand
+        // Момент, коли виконавці з часами звільнення offsets (за зростанням, від now) виконають навантаження demand
+        static double finishTime(const std::vector<long long>& offsets, long long demand);
+
+        // Индексированная очередь задач по сроку и приоритету
+        // Indexed task queue by deadline and priority
+        // Індексована черга завдань за строком і пріоритетом
+        IndexedDaryHeap<DeadlineTask> taskQueue;
+
+        // Задачи со сроком, упорядоченные по сроку
+        // Deadline tasks ordered by deadline
+        // Завдання зі строком, упорядковані за строком
+        std::set<AdmittedTask> deadlineTasks;
+
+        // Зарезервированные задачи, ждущие зависимостей, и выполняющиеся задачи
+        // Reserved tasks waiting for dependencies and running tasks
+        // Зарезервовані завдання, що чекають залежностей, і завдання, що виконуються
+        std::unordered_map<int, AdmittedTask> reservedTasks;
+        std::unordered_map<int, RunningTask> runningTasks;
+
+        size_t processorCount;
+
+        // Счетчик времени для обеспечения стабильности сортировки
+        // Time counter for stable sorting
+        // Лічильник часу для забезпечення стабільності сортування
+        long long timestampCounter;
+
+        // Флаг инициализации
+        // Initialization flag
+        // Прапор ініціалізації
+        bool initialized;
+    };
+
+} // namespace Algorithms
+} // namespace Core
+} // namespace NeuroSync
+
+#endif // EARLIEST_DEADLINE_FIRST_SCHEDULING_H
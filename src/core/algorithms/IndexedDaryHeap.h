@@ -0,0 +1,222 @@
+#ifndef INDEXED_DARY_HEAP_H
+#define INDEXED_DARY_HEAP_H
+
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+// IndexedDaryHeap.h
+// Индексированная d-арная куча задач для алгоритмов планирования
+// Indexed d-ary heap of tasks for scheduling algorithms
+// Індексована d-арна купа завдань для алгоритмів планування
+
+namespace NeuroSync {
+namespace Core {
+namespace Algorithms {
+
+    // Индексированная d-арная куча, адресуемая по ID задачи.
+    // Порядок такой же, как у std::priority_queue: на вершине элемент, для которого
+    // Compare(top, other) ложно для всех остальных. Каждая задача получает плотный слот
+    // при вставке; позиция слота в куче хранится в векторе, поэтому изменение ключа
+    // и удаление по ID стоят O(log_d n) с одним хеш-поиском на операцию, а не на каждый обмен.
+    // Indexed d-ary heap addressed by task ID.
+    // Ordering matches std::priority_queue: the top is the element for which
+    // Compare(top, other) is false for every other element. Every task gets a dense slot
+    // on insertion; the slot's heap position is kept in a vector, so key changes
+    // and erase-by-ID cost O(log_d n) with one hash lookup per operation rather than per swap.
+    // Індексована d-арна купа, що адресується за ID завдання.
+    // Порядок такий самий, як у std::priority_queue: на вершині елемент, для якого
+    // Compare(top, other) хибне для всіх інших. Кожне завдання отримує щільний слот
+    // при вставці; позиція слота в купі зберігається у векторі, тому зміна ключа
+    // та видалення за ID коштують O(log_d n) з одним хеш-пошуком на операцію, а не на кожен обмін.
+    template<typename T, typename Compare = std::less<T>, size_t Arity = 4>
+    class IndexedDaryHeap {
+        static_assert(Arity >= 2, "IndexedDaryHeap arity must be at least 2");
+
+    public:
+        explicit IndexedDaryHeap(const Compare& compare = Compare()) : compare(compare) {}
+
+        // Вставка задачи (false, если ID уже есть)
+        // Insert a task (false if the ID is already present)
+        // Вставка завдання (false, якщо ID вже є)
+        bool push(int taskId, const T& value) {
+            auto inserted = slotById.emplace(taskId, 0);
+            if (!inserted.second) {
+                return false;
+            }
+
+            uint32_t slot;
+            if (!freeSlots.empty()) {
+                slot = freeSlots.back();
+                freeSlots.pop_back();
+            } else {
+                slot = static_cast<uint32_t>(positions.size());
+                positions.push_back(NO_POSITION);
+            }
+            inserted.first->second = slot;
+
+            heap.push_back(Node{value, taskId, slot});
+            positions[slot] = static_cast<uint32_t>(heap.size() - 1);
+            siftUp(heap.size() - 1);
+            return true;
+        }
+
+        bool contains(int taskId) const {
+            return slotById.find(taskId) != slotById.end();
+        }
+
+        // Значение задачи или nullptr
+        // Task value or nullptr
+        // Значення завдання або nullptr
+        const T* find(int taskId) const {
+            auto it = slotById.find(taskId);
+            return it == slotById.end() ? nullptr : &heap[positions[it->second]].value;
+        }
+
+        // Замена значения задачи с восстановлением порядка (уменьшение или увеличение ключа)
+        // Replace a task's value and restore order (decrease-key or increase-key)
+        // Заміна значення завдання з відновленням порядку (зменшення або збільшення ключа)
+        bool update(int taskId, const T& value) {
+            auto it = slotById.find(taskId);
+            if (it == slotById.end()) {
+                return false;
+            }
+            size_t index = positions[it->second];
+            heap[index].value = value;
+            siftUp(index);
+            siftDown(positions[it->second]);
+            return true;
+        }
+
+        // Удаление задачи по ID
+        // Erase a task by ID
+        // Видалення завдання за ID
+        bool erase(int taskId) {
+            auto it = slotById.find(taskId);
+            if (it == slotById.end()) {
+                return false;
+            }
+            uint32_t slot = it->second;
+            slotById.erase(it);
+            removeAt(positions[slot]);
+            return true;
+        }
+
+        // Вершина кучи (куча не должна быть пустой)
+        // Heap top (the heap must not be empty)
+        // Вершина купи (купа не повинна бути порожньою)
+        int topId() const { return heap.front().taskId; }
+        const T& top() const { return heap.front().value; }
+
+        // Извлечение вершины; возвращает ID задачи
+        // Pop the top; returns the task ID
+        // Вилучення вершини; повертає ID завдання
+        int pop() {
+            int taskId = heap.front().taskId;
+            slotById.erase(taskId);
+            removeAt(0);
+            return taskId;
+        }
+
+        size_t size() const { return heap.size(); }
+        bool empty() const { return heap.empty(); }
+
+        void clear() {
+            heap.clear();
+            positions.clear();
+            freeSlots.clear();
+            slotById.clear();
+        }
+
+    private:
+        static constexpr uint32_t NO_POSITION = UINT32_MAX;
+
+        struct Node {
+            T value;
+            int taskId;
+            uint32_t slot;
+        };
+
+        // Должен ли a стоять в куче выше b
+        // Whether a must sit above b in the heap
+        // Чи має a стояти в купі вище за b
+        bool above(const Node& a, const Node& b) const {
+            return compare(b.value, a.value);
+        }
+
+        void removeAt(size_t index) {
+            uint32_t slot = heap[index].slot;
+            positions[slot] = NO_POSITION;
+            freeSlots.push_back(slot);
+
+            size_t lastIndex = heap.size() - 1;
+            if (index != lastIndex) {
+                heap[index] = std::move(heap[lastIndex]);
+                positions[heap[index].slot] = static_cast<uint32_t>(index);
+            }
+            heap.pop_back();
+
+            if (index < heap.size()) {
+                uint32_t movedSlot = heap[index].slot;
+                siftUp(index);
+                siftDown(positions[movedSlot]);
+            }
+        }
+
+        void siftUp(size_t index) {
+            if (index == 0) {
+                return;
+            }
+            Node node = std::move(heap[index]);
+            while (index > 0) {
+                size_t parent = (index - 1) / Arity;
+                if (!above(node, heap[parent])) {
+                    break;
+                }
+                heap[index] = std::move(heap[parent]);
+                positions[heap[index].slot] = static_cast<uint32_t>(index);
+                index = parent;
+            }
+            heap[index] = std::move(node);
+            positions[heap[index].slot] = static_cast<uint32_t>(index);
+        }
+
+        void siftDown(size_t index) {
+            Node node = std::move(heap[index]);
+            for (;;) {
+                size_t firstChild = index * Arity + 1;
+                if (firstChild >= heap.size()) {
+                    break;
+                }
+                size_t lastChild = firstChild + Arity < heap.size() ? firstChild + Arity : heap.size();
+                size_t best = firstChild;
+                for (size_t child = firstChild + 1; child < lastChild; ++child) {
+                    if (above(heap[child], heap[best])) {
+                        best = child;
+                    }
+                }
+                if (!above(heap[best], node)) {
+                    break;
+                }
+                heap[index] = std::move(heap[best]);
+                positions[heap[index].slot] = static_cast<uint32_t>(index);
+                index = best;
+            }
+            heap[index] = std::move(node);
+            positions[heap[index].slot] = static_cast<uint32_t>(index);
+        }
+
+        std::vector<Node> heap;
+        std::vector<uint32_t> positions;
+        std::vector<uint32_t> freeSlots;
+        std::unordered_map<int, uint32_t> slotById;
+        Compare compare;
+    };
+
+} // namespace Algorithms
+} // namespace Core
+} // namespace NeuroSync
+
+#endif // INDEXED_DARY_HEAP_H
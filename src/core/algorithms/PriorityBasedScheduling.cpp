@@ -32,10 +32,7 @@ namespace Algorithms {
         // Очистка существующих данных
         // Clear existing data
         // Очищення існуючих даних
-        while (!taskQueue.empty()) {
-            taskQueue.pop();
-        }
-        taskMap.clear();
+        taskQueue.clear();
         timestampCounter = 0;
         
         initialized = true;
@@ -50,15 +47,7 @@ namespace Algorithms {
             return -1; // Нет доступных задач / No available tasks / Немає доступних завдань
         }
         
-        PriorityTask nextTask = taskQueue.top();
-        taskQueue.pop();
-        
-        // Удаление задачи из карты
-        // Remove task from map
-        // Видалення завдання з карти
-        taskMap.erase(nextTask.taskId);
-        
-        return nextTask.taskId;
+        return taskQueue.pop();
     }
 
     void PriorityBasedScheduling::addTask(int taskId, int priority) {
@@ -73,7 +62,7 @@ namespace Algorithms {
         // Проверка, существует ли задача с таким ID
         // Check if a task with this ID already exists
         // Перевірка, чи існує завдання з таким ID
-        if (taskMap.find(taskId) != taskMap.end()) {
+        if (taskQueue.contains(taskId)) {
             return; // Задача уже существует / Task already exists / Завдання вже існує
         }
         
@@ -85,11 +74,10 @@ namespace Algorithms {
         newTask.priority = priority;
         newTask.timestamp = timestampCounter++;
         
-        // Добавление задачи в очередь и карту
-        // Add task to queue and map
-        // Додавання завдання до черги та карти
-        taskQueue.push(newTask);
-        taskMap[taskId] = newTask;
+        // Добавление задачи в очередь
+        // Add task to queue
+        // Додавання завдання до черги
+        taskQueue.push(taskId, newTask);
     }
 
     void PriorityBasedScheduling::removeTask(int taskId) {
@@ -101,40 +89,10 @@ namespace Algorithms {
             return;
         }
         
-        // Поиск задачи в карте
-        // Find task in map
-        // Пошук завдання в карті
-        auto it = taskMap.find(taskId);
-        if (it != taskMap.end()) {
-            // Удаление задачи из карты
-            // Remove task from map
-            // Видалення завдання з карти
-            taskMap.erase(it);
-            
-            // Перестройка очереди без удаленной задачи
-            // Rebuild queue without the removed task
-            // Перебудова черги без видаленого завдання
-            std::priority_queue<PriorityTask> newQueue;
-            std::vector<PriorityTask> tempTasks;
-            
-            // Извлечение всех задач из очереди
-            // Extract all tasks from queue
-            // Вилучення всіх завдань з черги
-            while (!taskQueue.empty()) {
-                PriorityTask task = taskQueue.top();
-                taskQueue.pop();
-                if (task.taskId != taskId) {
-                    tempTasks.push_back(task);
-                }
-            }
-            
-            // Повторная вставка задач в очередь
-            // Re-insert tasks into queue
-            // Повторне вставлення завдань до черги
-            for (const auto& task : tempTasks) {
-                taskQueue.push(task);
-            }
-        }
+        // Удаление по позиции в куче без перестройки очереди
+        // Erase by heap position without rebuilding the queue
+        // Видалення за позицією в купі без перебудови черги
+        taskQueue.erase(taskId);
     }
 
     void PriorityBasedScheduling::updateTaskPriority(int taskId, int newPriority) {
@@ -146,20 +104,15 @@ namespace Algorithms {
             return;
         }
         
-        // Поиск задачи в карте
-        // Find task in map
-        // Пошук завдання в карті
-        auto it = taskMap.find(taskId);
-        if (it != taskMap.end()) {
-            // Удаление старой задачи
-            // Remove old task
-            // Видалення старого завдання
-            removeTask(taskId);
-            
-            // Добавление задачи с новым приоритетом
-            // Add task with new priority
-            // Додавання завдання з новим пріоритетом
-            addTask(taskId, newPriority);
+        const PriorityTask* task = taskQueue.find(taskId);
+        if (task != nullptr) {
+            // Смена ключа на месте; новая метка времени ставит задачу в конец своего уровня, как при повторном добавлении
+            // Change the key in place; a new timestamp puts the task at the back of its level, as re-adding did
+            // Зміна ключа на місці; нова мітка часу ставить завдання в кінець свого рівня, як при повторному додаванні
+            PriorityTask updated = *task;
+            updated.priority = newPriority;
+            updated.timestamp = timestampCounter++;
+            taskQueue.update(taskId, updated);
         }
     }
 
@@ -168,7 +121,7 @@ namespace Algorithms {
         // Get the number of tasks in the queue
         // Отримання кількості завдань у черзі
         
-        return static_cast<int>(taskMap.size());
+        return static_cast<int>(taskQueue.size());
     }
 
     bool PriorityBasedScheduling::isEmpty() const {
@@ -176,7 +129,7 @@ namespace Algorithms {
         // Check if the queue is empty
         // Перевірка, чи черга порожня
         
-        return taskMap.empty();
+        return taskQueue.empty();
     }
 
 } // namespace Algorithms
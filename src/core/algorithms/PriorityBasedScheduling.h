@@ -2,9 +2,7 @@
 #define PRIORITY_BASED_SCHEDULING_H
 
 #include "../interfaces/SchedulingAlgorithm.h"
-#include <queue>
-#include <vector>
-#include <map>
+#include "IndexedDaryHeap.h"
 
 // PriorityBasedScheduling.h
 // Алгоритм планирования на основе приоритетов
@@ -78,15 +76,10 @@ namespace Algorithms {
         bool isEmpty() const override;
         
     private:
-        // Очередь с приоритетом для задач
-        // Priority queue for tasks
-        // Черга з пріоритетом для завдань
-        std::priority_queue<PriorityTask> taskQueue;
-        
-        // Карта для отслеживания задач по ID
-        // Map to track tasks by ID
-        // Карта для відстеження завдань за ID
-        std::map<int, PriorityTask> taskMap;
+        // Индексированная очередь с приоритетом: удаление и смена приоритета за O(log n)
+        // Indexed priority queue: removal and priority changes in O(log n)
+        // Індексована черга з пріоритетом: видалення та зміна пріоритету за O(log n)
+        IndexedDaryHeap<PriorityTask> taskQueue;
         
         // Счетчик времени для обеспечения стабильности сортировки
         // Time counter for stable sorting
@@ -1,5 +1,4 @@
 #include "RoundRobinScheduling.h"
-#include <algorithm>
 
 // RoundRobinScheduling.cpp
 // Реализация алгоритма планирования Round Robin
@@ -11,7 +10,7 @@ namespace Core {
 namespace Algorithms {
 
     RoundRobinScheduling::RoundRobinScheduling(int defaultTimeQuantum)
-        : defaultTimeQuantum(defaultTimeQuantum), currentTaskIndex(0), initialized(false) {
+        : defaultTimeQuantum(defaultTimeQuantum), sequenceCounter(0), initialized(false) {
         // Конструктор алгоритма планирования Round Robin
         // Constructor of Round Robin scheduling algorithm
         // Конструктор алгоритму планування Round Robin
@@ -32,8 +31,7 @@ namespace Algorithms {
         // Clear existing data
         // Очищення існуючих даних
         taskQueue.clear();
-        taskMap.clear();
-        currentTaskIndex = 0;
+        sequenceCounter = 0;
         
         initialized = true;
     }
@@ -47,39 +45,24 @@ namespace Algorithms {
             return -1; // Нет доступных задач / No available tasks / Немає доступних завдань
         }
         
-        // Если индекс вышел за границы, сбросить его
-        // If index is out of bounds, reset it
-        // Якщо індекс вийшов за межі, скинути його
-        if (currentTaskIndex >= taskQueue.size()) {
-            currentTaskIndex = 0;
-        }
-        
         // Получение текущей задачи
         // Get current task
         // Отримання поточного завдання
-        RoundRobinTask currentTask = taskQueue[currentTaskIndex];
+        int taskId = taskQueue.topId();
+        RoundRobinTask currentTask = taskQueue.top();
         
         // Уменьшение оставшегося времени
         // Decrease remaining time
         // Зменшення залишкового часу
         currentTask.remainingTime -= 1;
         
-        // Обновление задачи в очереди
-        // Update task in queue
-        // Оновлення завдання в черзі
-        taskQueue[currentTaskIndex] = currentTask;
-        
-        // Обновление задачи в карте
-        // Update task in map
-        // Оновлення завдання в карті
-        taskMap[currentTask.taskId] = currentTask;
+        // Переход к следующей задаче: текущая уходит в конец круга
+        // Move to next task: the current one goes to the back of the rotation
+        // Перехід до наступного завдання: поточне йде в кінець кола
+        currentTask.sequence = sequenceCounter++;
+        taskQueue.update(taskId, currentTask);
         
-        // Переход к следующей задаче
-        // Move to next task
-        // Перехід до наступного завдання
-        currentTaskIndex = (currentTaskIndex + 1) % taskQueue.size();
-        
-        return currentTask.taskId;
+        return taskId;
     }
 
     void RoundRobinScheduling::addTask(int taskId, int priority) {
@@ -94,7 +77,7 @@ namespace Algorithms {
         // Проверка, существует ли задача с таким ID
         // Check if a task with this ID already exists
         // Перевірка, чи існує завдання з таким ID
-        if (taskMap.find(taskId) != taskMap.end()) {
+        if (taskQueue.contains(taskId)) {
             return; // Задача уже существует / Task already exists / Завдання вже існує
         }
         
@@ -106,12 +89,12 @@ namespace Algorithms {
         newTask.priority = priority;
         newTask.timeQuantum = defaultTimeQuantum;
         newTask.remainingTime = defaultTimeQuantum;
+        newTask.sequence = sequenceCounter++;
         
-        // Добавление задачи в очередь и карту
-        // Add task to queue and map
-        // Додавання завдання до черги та карти
-        taskQueue.push_back(newTask);
-        taskMap[taskId] = newTask;
+        // Добавление задачи в конец круга
+        // Add task to the back of the rotation
+        // Додавання завдання в кінець кола
+        taskQueue.push(taskId, newTask);
     }
 
     void RoundRobinScheduling::removeTask(int taskId) {
@@ -123,47 +106,10 @@ namespace Algorithms {
             return;
         }
         
-        // Поиск задачи в карте
-        // Find task in map
-        // Пошук завдання в карті
-        auto it = taskMap.find(taskId);
-        if (it != taskMap.end()) {
-            // Удаление задачи из карты
-            // Remove task from map
-            // Видалення завдання з карти
-            taskMap.erase(it);
-            
-            // Поиск и удаление задачи из очереди
-            // Find and remove task from queue
-            // Пошук та видалення завдання з черги
-            auto queueIt = std::find_if(taskQueue.begin(), taskQueue.end(),
-                [taskId](const RoundRobinTask& task) {
-                    return task.taskId == taskId;
-                });
-            
-            if (queueIt != taskQueue.end()) {
-                // Сохранение индекса для корректировки currentTaskIndex
-                // Save index for currentTaskIndex adjustment
-                // Збереження індексу для коригування currentTaskIndex
-                size_t removedIndex = std::distance(taskQueue.begin(), queueIt);
-                
-                // Удаление задачи из очереди
-                // Remove task from queue
-                // Видалення завдання з черги
-                taskQueue.erase(queueIt);
-                
-                // Корректировка индекса текущей задачи
-                // Adjust current task index
-                // Коригування індексу поточного завдання
-                if (currentTaskIndex > removedIndex) {
-                    currentTaskIndex--;
-                } else if (currentTaskIndex == removedIndex && !taskQueue.empty()) {
-                    currentTaskIndex = currentTaskIndex % taskQueue.size();
-                } else if (taskQueue.empty()) {
-                    currentTaskIndex = 0;
-                }
-            }
-        }
+        // Удаление по позиции в куче; порядок остальных задач в круге не меняется
+        // Erase by heap position; the rotation order of the other tasks is unchanged
+        // Видалення за позицією в купі; порядок інших завдань у колі не змінюється
+        taskQueue.erase(taskId);
     }
 
     void RoundRobinScheduling::updateTaskPriority(int taskId, int newPriority) {
@@ -175,28 +121,14 @@ namespace Algorithms {
             return;
         }
         
-        // Поиск задачи в карте
-        // Find task in map
-        // Пошук завдання в карті
-        auto it = taskMap.find(taskId);
-        if (it != taskMap.end()) {
-            // Обновление приоритета задачи
-            // Update task priority
-            // Оновлення пріоритету завдання
-            RoundRobinTask& task = it->second;
-            task.priority = newPriority;
-            
-            // Поиск и обновление задачи в очереди
-            // Find and update task in queue
-            // Пошук та оновлення завдання в черзі
-            auto queueIt = std::find_if(taskQueue.begin(), taskQueue.end(),
-                [taskId](const RoundRobinTask& task) {
-                    return task.taskId == taskId;
-                });
-            
-            if (queueIt != taskQueue.end()) {
-                queueIt->priority = newPriority;
-            }
+        const RoundRobinTask* task = taskQueue.find(taskId);
+        if (task != nullptr) {
+            // Обновление приоритета задачи; место в круге сохраняется
+            // Update task priority; the place in the rotation is kept
+            // Оновлення пріоритету завдання; місце в колі зберігається
+            RoundRobinTask updated = *task;
+            updated.priority = newPriority;
+            taskQueue.update(taskId, updated);
         }
     }
 
@@ -205,7 +137,7 @@ namespace Algorithms {
         // Get the number of tasks in the queue
         // Отримання кількості завдань у черзі
         
-        return static_cast<int>(taskMap.size());
+        return static_cast<int>(taskQueue.size());
     }
 
     bool RoundRobinScheduling::isEmpty() const {
@@ -213,7 +145,7 @@ namespace Algorithms {
         // Check if the queue is empty
         // Перевірка, чи черга порожня
         
-        return taskMap.empty();
+        return taskQueue.empty();
     }
 
     void RoundRobinScheduling::setDefaultTimeQuantum(int quantum) {
@@ -2,8 +2,8 @@
 #define ROUND_ROBIN_SCHEDULING_H
 
 #include "../interfaces/SchedulingAlgorithm.h"
-#include <deque>
-#include <map>
+#include "IndexedDaryHeap.h"
+#include <cstddef>
 
 // RoundRobinScheduling.h
 // Алгоритм планирования Round Robin
@@ -22,6 +22,16 @@ namespace Algorithms {
         int priority;
         int timeQuantum; // Квант времени для задачи / Time quantum for the task / Квант часу для завдання
         int remainingTime; // Оставшееся время выполнения / Remaining execution time / Залишковий час виконання
+        long long sequence; // Место в обходе по кругу / Place in the rotation / Місце в обході по колу
+    };
+
+    // Порядок обхода: первой идет задача с наименьшим номером в круге
+    // Rotation order: the task with the smallest rotation number comes first
+    // Порядок обходу: першим іде завдання з найменшим номером у колі
+    struct RoundRobinOrder {
+        bool operator()(const RoundRobinTask& a, const RoundRobinTask& b) const {
+            return a.sequence > b.sequence;
+        }
     };
 
     // Алгоритм планирования Round Robin
@@ -73,25 +83,23 @@ namespace Algorithms {
         void setDefaultTimeQuantum(int quantum);
         
     private:
-        // Циклическая очередь для задач
-        // Circular queue for tasks
-        // Циклічна черга для завдань
-        std::deque<RoundRobinTask> taskQueue;
-        
-        // Карта для отслеживания задач по ID
-        // Map to track tasks by ID
-        // Карта для відстеження завдань за ID
-        std::map<int, RoundRobinTask> taskMap;
+        // Циклическая очередь как индексированная куча по номеру в круге: выбранная задача
+        // получает новый номер и уходит в конец, а удаление по ID стоит O(log n) вместо линейного поиска
+        // Circular queue as an indexed heap on the rotation number: the selected task
+        // gets a new number and moves to the back, and erase-by-ID costs O(log n) instead of a linear search
+        // Циклічна черга як індексована купа за номером у колі: вибране завдання
+        // отримує новий номер і йде в кінець, а видалення за ID коштує O(log n) замість лінійного пошуку
+        IndexedDaryHeap<RoundRobinTask, RoundRobinOrder> taskQueue;
         
         // Квант времени по умолчанию
         // Default time quantum
         // Квант часу за замовчуванням
         int defaultTimeQuantum;
         
-        // Индекс текущей задачи
-        // Current task index
-        // Індекс поточного завдання
-        size_t currentTaskIndex;
+        // Следующий номер в круге
+        // Next rotation number
+        // Наступний номер у колі
+        long long sequenceCounter;
         
         // Флаг инициализации
         // Initialization flag
@@ -32,10 +32,7 @@ namespace Algorithms {
         // Очистка существующих данных
         // Clear existing data
         // Очищення існуючих даних
-        while (!taskQueue.empty()) {
-            taskQueue.pop();
-        }
-        taskMap.clear();
+        taskQueue.clear();
         systemVirtualTime = 0.0;
         timestampCounter = 0;
         
@@ -51,20 +48,12 @@ namespace Algorithms {
             return -1; // Нет доступных задач / No available tasks / Немає доступних завдань
         }
         
-        WFQTask nextTask = taskQueue.top();
-        taskQueue.pop();
-        
         // Обновление виртуального времени системы
         // Update system virtual time
         // Оновлення віртуального часу системи
-        systemVirtualTime = nextTask.virtualFinishTime;
-        
-        // Удаление задачи из карты
-        // Remove task from map
-        // Видалення завдання з карти
-        taskMap.erase(nextTask.taskId);
+        systemVirtualTime = taskQueue.top().virtualFinishTime;
         
-        return nextTask.taskId;
+        return taskQueue.pop();
     }
 
     void WeightedFairQueuingScheduling::addTask(int taskId, int priority) {
@@ -79,7 +68,7 @@ namespace Algorithms {
         // Проверка, существует ли задача с таким ID
         // Check if a task with this ID already exists
         // Перевірка, чи існує завдання з таким ID
-        if (taskMap.find(taskId) != taskMap.end()) {
+        if (taskQueue.contains(taskId)) {
             return; // Задача уже существует / Task already exists / Завдання вже існує
         }
         
@@ -98,11 +87,10 @@ namespace Algorithms {
         double serviceTime = 1.0 / newTask.weight; // Время обслуживания / Service time / Час обслуговування
         newTask.virtualFinishTime = systemVirtualTime + serviceTime;
         
-        // Добавление задачи в очередь и карту
-        // Add task to queue and map
-        // Додавання завдання до черги та карти
-        taskQueue.push(newTask);
-        taskMap[taskId] = newTask;
+        // Добавление задачи в очередь
+        // Add task to queue
+        // Додавання завдання до черги
+        taskQueue.push(taskId, newTask);
     }
 
     void WeightedFairQueuingScheduling::removeTask(int taskId) {
@@ -114,45 +102,10 @@ namespace Algorithms {
             return;
         }
         
-        // Поиск задачи в карте
-        // Find task in map
-        // Пошук завдання в карті
-        auto it = taskMap.find(taskId);
-        if (it != taskMap.end()) {
-            // Удаление задачи из карты
-            // Remove task from map
-            // Видалення завдання з карти
-            taskMap.erase(it);
-            
-            // Перестройка очереди без удаленной задачи
-            // Rebuild queue without the removed task
-            // Перебудова черги без видаленого завдання
-            std::priority_queue<WFQTask> newQueue;
-            std::vector<WFQTask> tempTasks;
-            
-            // Извлечение всех задач из очереди
-            // Extract all tasks from queue
-            // Вилучення всіх завдань з черги
-            while (!taskQueue.empty()) {
-                WFQTask task = taskQueue.top();
-                taskQueue.pop();
-                if (task.taskId != taskId) {
-                    tempTasks.push_back(task);
-                }
-            }
-            
-            // Повторная вставка задач в очередь
-            // Re-insert tasks into queue
-            // Повторне вставлення завдань до черги
-            for (const auto& task : tempTasks) {
-                newQueue.push(task);
-            }
-            
-            // Замена старой очереди новой
-            // Replace old queue with new queue
-            // Заміна старої черги новою
-            taskQueue = newQueue;
-        }
+        // Удаление по позиции в куче без перестройки очереди
+        // Erase by heap position without rebuilding the queue
+        // Видалення за позицією в купі без перебудови черги
+        taskQueue.erase(taskId);
     }
 
     void WeightedFairQueuingScheduling::updateTaskPriority(int taskId, int newPriority) {
@@ -164,20 +117,16 @@ namespace Algorithms {
             return;
         }
         
-        // Поиск задачи в карте
-        // Find task in map
-        // Пошук завдання в карті
-        auto it = taskMap.find(taskId);
-        if (it != taskMap.end()) {
-            // Удаление старой задачи
-            // Remove old task
-            // Видалення старого завдання
-            removeTask(taskId);
-            
-            // Добавление задачи с новым приоритетом
-            // Add task with new priority
-            // Додавання завдання з новим пріоритетом
-            addTask(taskId, newPriority);
+        const WFQTask* task = taskQueue.find(taskId);
+        if (task != nullptr) {
+            // Как и при повторном добавлении: новая метка времени и виртуальное время от текущего момента
+            // As with re-adding: a new timestamp and a virtual finish time from the current moment
+            // Як і при повторному додаванні: нова мітка часу та віртуальний час від поточного моменту
+            WFQTask updated = *task;
+            updated.priority = newPriority;
+            updated.timestamp = timestampCounter++;
+            updated.virtualFinishTime = systemVirtualTime + 1.0 / updated.weight;
+            taskQueue.update(taskId, updated);
         }
     }
 
@@ -186,7 +135,7 @@ namespace Algorithms {
         // Get the number of tasks in the queue
         // Отримання кількості завдань у черзі
         
-        return static_cast<int>(taskMap.size());
+        return static_cast<int>(taskQueue.size());
     }
 
     bool WeightedFairQueuingScheduling::isEmpty() const {
@@ -194,7 +143,7 @@ namespace Algorithms {
         // Check if the queue is empty
         // Перевірка, чи черга порожня
         
-        return taskMap.empty();
+        return taskQueue.empty();
     }
 
     void WeightedFairQueuingScheduling::setTaskWeight(int taskId, int weight) {
@@ -206,30 +155,20 @@ namespace Algorithms {
             return;
         }
         
-        // Поиск задачи в карте
-        // Find task in map
-        // Пошук завдання в карті
-        auto it = taskMap.find(taskId);
-        if (it != taskMap.end()) {
+        const WFQTask* task = taskQueue.find(taskId);
+        if (task != nullptr) {
             // Обновление веса задачи
             // Update task weight
             // Оновлення ваги завдання
-            WFQTask& task = it->second;
-            int oldWeight = task.weight;
-            task.weight = weight;
-            
-            // Пересчет виртуального времени завершения
-            // Recalculate virtual finish time
-            // Перерахунок віртуального часу завершення
-            double serviceTime = 1.0 / task.weight;
-            task.virtualFinishTime = systemVirtualTime + serviceTime;
+            WFQTask updated = *task;
+            updated.weight = weight;
             
-            // Удаление и повторное добавление задачи для пересортировки
-            // Remove and re-add task for resorting
-            // Видалення та повторне додавання завдання для пересортування
-            removeTask(taskId);
-            taskQueue.push(task);
-            taskMap[taskId] = task;
+            // Пересчет виртуального времени завершения и перестановка в куче
+            // Recalculate virtual finish time and reposition in the heap
+            // Перерахунок віртуального часу завершення та переміщення в купі
+            double serviceTime = 1.0 / updated.weight;
+            updated.virtualFinishTime = systemVirtualTime + serviceTime;
+            taskQueue.update(taskId, updated);
         }
     }
 
@@ -2,9 +2,7 @@
 #define WEIGHTED_FAIR_QUEUING_SCHEDULING_H
 
 #include "../interfaces/SchedulingAlgorithm.h"
-#include <queue>
-#include <map>
-#include <vector>
+#include "IndexedDaryHeap.h"
 
 // WeightedFairQueuingScheduling.h
 // Алгоритм планирования Weighted Fair Queuing
@@ -85,15 +83,10 @@ namespace Algorithms {
         void setTaskWeight(int taskId, int weight);
         
     private:
-        // Очередь с приоритетом для задач WFQ
-        // Priority queue for WFQ tasks
-        // Черга з пріоритетом для завдань WFQ
-        std::priority_queue<WFQTask> taskQueue;
-        
-        // Карта для отслеживания задач по ID
-        // Map to track tasks by ID
-        // Карта для відстеження завдань за ID
-        std::map<int, WFQTask> taskMap;
+        // Индексированная очередь задач WFQ по виртуальному времени завершения
+        // Indexed queue of WFQ tasks by virtual finish time
+        // Індексована черга завдань WFQ за віртуальним часом завершення
+        IndexedDaryHeap<WFQTask> taskQueue;
         
         // Виртуальное время системы
         // System virtual time
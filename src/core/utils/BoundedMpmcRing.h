@@ -0,0 +1,159 @@
+#ifndef BOUNDED_MPMC_RING_H
+#define BOUNDED_MPMC_RING_H
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// BoundedMpmcRing.h
+// Ограниченное lock-free кольцо с несколькими производителями и потребителями
+// Bounded lock-free multi-producer multi-consumer ring
+// Обмежене lock-free кільце з кількома виробниками та споживачами
+
+namespace NeuroSync {
+namespace Core {
+namespace Utils {
+
+    // Размер строки кэша для выравнивания горячих счетчиков
+    // Cache line size used to align hot counters
+    // Розмір рядка кешу для вирівнювання гарячих лічильників
+    constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // Ограниченное кольцо MPMC (схема Вьюкова с номерами последовательности в ячейках).
+    // Каждая ячейка несет собственный номер последовательности, поэтому производители и
+    // потребители синхронизируются только через CAS позиции и release/acquire ячейки.
+    // Bounded MPMC ring (Vyukov's scheme with per-cell sequence numbers).
+    // Each cell carries its own sequence number, so producers and consumers only
+    // synchronize through a CAS on the position and release/acquire on the cell.
+    // Обмежене кільце MPMC (схема В'юкова з номерами послідовності в комірках).
+    // Кожна комірка має власний номер послідовності, тому виробники та споживачі
+    // синхронізуються лише через CAS позиції та release/acquire комірки.
+    template<typename T>
+    class BoundedMpmcRing {
+    public:
+        // Конструктор (емкость округляется вверх до степени двойки)
+        // Constructor (capacity is rounded up to a power of two)
+        // Конструктор (ємність округлюється вгору до степеня двійки)
+        explicit BoundedMpmcRing(size_t requestedCapacity)
+            : mask(roundUpToPowerOfTwo(requestedCapacity) - 1),
+              cells(new Cell[mask + 1]),
+              enqueuePosition(0),
+              dequeuePosition(0) {
+            for (size_t i = 0; i <= mask; ++i) {
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        BoundedMpmcRing(const BoundedMpmcRing&) = delete;
+        BoundedMpmcRing& operator=(const BoundedMpmcRing&) = delete;
+
+        // Попытка добавить элемент (false, если кольцо заполнено)
+        // Try to push an element (false if the ring is full)
+        // Спроба додати елемент (false, якщо кільце заповнене)
+        template<typename U>
+        bool tryPush(U&& value) {
+            Cell* cell;
+            size_t position = enqueuePosition.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &cells[position & mask];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                if (difference == 0) {
+                    if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (difference < 0) {
+                    return false;
+                } else {
+                    position = enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->value = std::forward<U>(value);
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Попытка извлечь элемент (false, если кольцо пусто)
+        // Try to pop an element (false if the ring is empty)
+        // Спроба вилучити елемент (false, якщо кільце порожнє)
+        bool tryPop(T& value) {
+            Cell* cell;
+            size_t position = dequeuePosition.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &cells[position & mask];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+                if (difference == 0) {
+                    if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (difference < 0) {
+                    return false;
+                } else {
+                    position = dequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            value = std::move(cell->value);
+            cell->sequence.store(position + mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Приблизительное количество элементов (точно только в состоянии покоя)
+        // Approximate number of elements (exact only when quiescent)
+        // Приблизна кількість елементів (точна лише у стані спокою)
+        size_t sizeApprox() const {
+            size_t tail = dequeuePosition.load(std::memory_order_acquire);
+            size_t head = enqueuePosition.load(std::memory_order_acquire);
+            return head > tail ? head - tail : 0;
+        }
+
+        // Проверка, пусто ли кольцо
+        // Check if the ring is empty
+        // Перевірка, чи кільце порожнє
+        bool emptyApprox() const {
+            return sizeApprox() == 0;
+        }
+
+        // Получение емкости кольца
+        // Get ring capacity
+        // Отримання ємності кільця
+        size_t capacity() const {
+            return mask + 1;
+        }
+
+    private:
+        // Ячейка кольца
+        // Ring cell
+        // Комірка кільця
+        struct Cell {
+            std::atomic<size_t> sequence;
+            T value;
+        };
+
+        static size_t roundUpToPowerOfTwo(size_t value) {
+            size_t result = 2;
+            while (result < value) {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        const size_t mask;
+        std::unique_ptr<Cell[]> cells;
+
+        // Позиции производителей и потребителей на разных строках кэша
+        // Producer and consumer positions on separate cache lines
+        // Позиції виробників і споживачів на різних рядках кешу
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePosition;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePosition;
+    };
+
+} // namespace Utils
+} // namespace Core
+} // namespace NeuroSync
+
+#endif // BOUNDED_MPMC_RING_H
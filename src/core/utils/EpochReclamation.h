@@ -0,0 +1,147 @@
+#ifndef EPOCH_RECLAMATION_H
+#define EPOCH_RECLAMATION_H
+
+#include "BoundedMpmcRing.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// EpochReclamation.h
+// Освобождение памяти по эпохам для читателей без блокировок (RCU)
+// Epoch-based memory reclamation for lock-free readers (RCU)
+// Звільнення пам'яті за епохами для читачів без блокувань (RCU)
+
+namespace NeuroSync {
+namespace Core {
+namespace Utils {
+
+    // Домен эпох. Читатель на время чтения публикует в своем слоте текущую эпоху;
+    // писатель, снявший объект с публикации, получает метку advance() и освобождает объект,
+    // когда isQuiescent(метка) - то есть ни один активный читатель не вошел в эпоху <= метки.
+    // Все операции со слотами и эпохой seq_cst (опубликованный указатель тоже читается и
+    // снимается с seq_cst), поэтому читатель, вошедший после advance(), видит уже новый указатель.
+    // Epoch domain. For the duration of a read, a reader publishes the current epoch in its slot;
+    // a writer that unpublished an object takes a tag from advance() and frees the object
+    // once isQuiescent(tag) - i.e. no active reader entered at an epoch <= tag.
+    // All slot and epoch operations are seq_cst (the published pointer is also loaded and
+    // unpublished with seq_cst), so a reader entering after advance() already sees the new pointer.
+    // Домен епох. Читач на час читання публікує у своєму слоті поточну епоху;
+    // письменник, що зняв об'єкт з публікації, отримує мітку advance() і звільняє об'єкт,
+    // коли isQuiescent(мітка) - тобто жоден активний читач не увійшов в епоху <= мітки.
+    // Усі операції зі слотами та епохою seq_cst (опублікований вказівник теж читається і
+    // знімається з seq_cst), тому читач, що увійшов після advance(), бачить уже новий вказівник.
+    class EpochDomain {
+        struct Slot;
+
+    public:
+        // Максимальное число потоков-читателей со своим слотом
+        // Maximum number of reader threads with their own slot
+        // Максимальна кількість потоків-читачів із власним слотом
+        static constexpr size_t MAX_READERS = 256;
+
+        // Глобальный домен (никогда не уничтожается, чтобы пережить thread_local слоты)
+        // Global domain (never destroyed so it outlives thread_local slots)
+        // Глобальний домен (ніколи не знищується, щоб пережити thread_local слоти)
+        static EpochDomain& instance() {
+            static EpochDomain* domain = new EpochDomain();
+            return *domain;
+        }
+
+        // Критическая секция читателя. Если слотов не хватило, active() == false
+        // и вызывающий должен перейти на путь с блокировкой.
+        // Reader critical section. If no slot was available, active() == false
+        // and the caller must fall back to the locking path.
+        // Критична секція читача. Якщо слотів не вистачило, active() == false
+        // і викликач має перейти на шлях із блокуванням.
+        class ReadGuard {
+        public:
+            ReadGuard() : slot(instance().threadSlot()), outermost(false) {
+                if (slot && slot->epoch.load(std::memory_order_relaxed) == 0) {
+                    outermost = true;
+                    slot->epoch.store(instance().globalEpoch.load());
+                }
+            }
+
+            ~ReadGuard() {
+                if (outermost) {
+                    slot->epoch.store(0, std::memory_order_release);
+                }
+            }
+
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+
+            bool active() const { return slot != nullptr; }
+
+        private:
+            Slot* slot;
+            bool outermost;
+        };
+
+        // Сдвиг эпохи; возвращает метку для объекта, только что снятого с публикации
+        // Advance the epoch; returns the tag for an object that was just unpublished
+        // Зсув епохи; повертає мітку для об'єкта, щойно знятого з публікації
+        uint64_t advance() {
+            return globalEpoch.fetch_add(1);
+        }
+
+        // Можно ли освободить объект с данной меткой
+        // Whether an object with the given tag can be freed
+        // Чи можна звільнити об'єкт із цією міткою
+        bool isQuiescent(uint64_t tag) const {
+            for (const Slot& slot : slots) {
+                uint64_t epoch = slot.epoch.load();
+                if (epoch != 0 && epoch <= tag) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        struct alignas(CACHE_LINE_SIZE) Slot {
+            std::atomic<uint64_t> epoch{0};
+            std::atomic<bool> owned{false};
+        };
+
+        // Владение слотом потока; слот освобождается при завершении потока
+        // Thread slot ownership; the slot is released when the thread exits
+        // Володіння слотом потоку; слот звільняється при завершенні потоку
+        struct SlotOwner {
+            Slot* slot = nullptr;
+            bool claimed = false;
+
+            ~SlotOwner() {
+                if (slot) {
+                    slot->owned.store(false, std::memory_order_release);
+                }
+            }
+        };
+
+        EpochDomain() : globalEpoch(1) {}
+
+        Slot* threadSlot() {
+            thread_local SlotOwner owner;
+            if (!owner.claimed) {
+                owner.claimed = true;
+                for (Slot& slot : slots) {
+                    bool expected = false;
+                    if (!slot.owned.load(std::memory_order_relaxed) &&
+                        slot.owned.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                        owner.slot = &slot;
+                        break;
+                    }
+                }
+            }
+            return owner.slot;
+        }
+
+        std::atomic<uint64_t> globalEpoch;
+        Slot slots[MAX_READERS];
+    };
+
+} // namespace Utils
+} // namespace Core
+} // namespace NeuroSync
+
+#endif // EPOCH_RECLAMATION_H
@@ -0,0 +1,236 @@
+#ifndef MULTI_LEVEL_QUEUE_H
+#define MULTI_LEVEL_QUEUE_H
+
+#include "BoundedMpmcRing.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+// MultiLevelQueue.h
+// Многоуровневая lock-free очередь: кольцо MPMC на каждую полосу приоритета и битовая карта непустых полос
+// Multi-level lock-free queue: one MPMC ring per priority band and a bitmap of non-empty bands
+// Багаторівнева lock-free черга: кільце MPMC на кожну смугу пріоритету та бітова карта непорожніх смуг
+
+namespace NeuroSync {
+namespace Core {
+namespace Utils {
+
+    // Многоуровневая очередь с BANDS полосами (0 - наивысший приоритет).
+    // Каждая полоса - ограниченное кольцо MPMC, создаваемое при первом добавлении; бит полосы в
+    // bandBits выставляется после добавления, поэтому извлечение находит лучшую непустую полосу одной
+    // инструкцией и не блокирует производителей. Внутри полосы порядок FIFO.
+    // Если кольцо полосы заполнено, элементы уходят в список переполнения полосы под мьютексом,
+    // и пока он не опустеет, новые элементы полосы тоже идут туда - так FIFO сохраняется, а
+    // очередь остается неограниченной. Блокировка нужна только в этом режиме.
+    // Multi-level queue with BANDS bands (0 is the highest priority).
+    // Every band is a bounded MPMC ring created on the first push; the band's bit in bandBits is set
+    // after the push, so a pop finds the best non-empty band with one instruction and never blocks
+    // producers. Within a band the order is FIFO.
+    // When a band's ring is full, elements go to the band's overflow list under a mutex,
+    // and until it drains, new elements of the band go there too - this keeps FIFO order while
+    // the queue stays unbounded. Locking is only needed in this mode.
+    // Багаторівнева черга з BANDS смугами (0 - найвищий пріоритет).
+    // Кожна смуга - обмежене кільце MPMC, що створюється при першому додаванні; біт смуги в
+    // bandBits виставляється після додавання, тому вилучення знаходить найкращу непорожню смугу однією
+    // інструкцією і не блокує виробників. Усередині смуги порядок FIFO.
+    // Якщо кільце смуги заповнене, елементи йдуть до списку переповнення смуги під м'ютексом,
+    // і поки він не спорожніє, нові елементи смуги теж ідуть туди - так FIFO зберігається, а
+    // черга залишається необмеженою. Блокування потрібне лише в цьому режимі.
+    template<typename T>
+    class MultiLevelQueue {
+    public:
+        // Количество полос (по одному биту в 64-битной карте)
+        // Number of bands (one bit each in a 64-bit map)
+        // Кількість смуг (по одному біту в 64-бітній карті)
+        static constexpr size_t BANDS = 64;
+
+        // Конструктор (емкость кольца одной полосы округляется вверх до степени двойки)
+        // Constructor (the capacity of one band's ring is rounded up to a power of two)
+        // Конструктор (ємність кільця однієї смуги округлюється вгору до степеня двійки)
+        explicit MultiLevelQueue(size_t bandCapacity = 1024)
+            : bandCapacity(bandCapacity), bandBits(0), overflowBits(0), overflowCount(0) {
+            for (auto& ring : rings) {
+                ring.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        ~MultiLevelQueue() {
+            for (auto& ring : rings) {
+                delete ring.load(std::memory_order_relaxed);
+            }
+        }
+
+        MultiLevelQueue(const MultiLevelQueue&) = delete;
+        MultiLevelQueue& operator=(const MultiLevelQueue&) = delete;
+
+        // Добавление элемента в полосу band (band >= BANDS попадает в последнюю полосу)
+        // Push an element into band (band >= BANDS goes to the last band)
+        // Додавання елемента до смуги band (band >= BANDS потрапляє до останньої смуги)
+        template<typename U>
+        void push(size_t band, U&& value) {
+            if (band >= BANDS) {
+                band = BANDS - 1;
+            }
+            uint64_t bit = uint64_t(1) << band;
+            if ((overflowBits.load(std::memory_order_acquire) & bit) != 0 ||
+                !ringFor(band).tryPush(std::forward<U>(value))) {
+                std::lock_guard<std::mutex> lock(overflowMutex);
+                overflow[band].push_back(std::forward<U>(value));
+                overflowBits.fetch_or(bit);
+                overflowCount.fetch_add(1, std::memory_order_relaxed);
+            }
+            bandBits.fetch_or(bit);
+        }
+
+        // Извлечение элемента из лучшей непустой полосы (false, если очередь пуста)
+        // Pop an element from the best non-empty band (false if the queue is empty)
+        // Вилучення елемента з найкращої непорожньої смуги (false, якщо черга порожня)
+        bool tryPop(T& value) {
+            uint64_t bits = bandBits.load();
+            while (bits != 0) {
+                size_t band = lowestBand(bits);
+                if (tryPopBand(band, value)) {
+                    return true;
+                }
+
+                // Полоса выглядит пустой: бит снимается, затем полоса проверяется еще раз, потому что
+                // производитель мог добавить элемент между неудачным извлечением и снятием бита.
+                // Если элемент есть (или производитель еще дописывает ячейку), бит возвращается и
+                // извлечение повторяется, чтобы элемент не остался без бита.
+                // The band looks empty: its bit is cleared, then the band is checked again, because
+                // a producer may have pushed between the failed pop and the clear.
+                // If an element is there (or a producer is still filling its cell), the bit is restored
+                // and the pop is retried so the element is not left without a bit.
+                // Смуга виглядає порожньою: біт знімається, потім смуга перевіряється ще раз, бо
+                // виробник міг додати елемент між невдалим вилученням і зняттям біта.
+                // Якщо елемент є (або виробник ще дописує комірку), біт повертається і
+                // вилучення повторюється, щоб елемент не лишився без біта.
+                uint64_t bit = uint64_t(1) << band;
+                bandBits.fetch_and(~bit);
+                if (!bandEmpty(band)) {
+                    bandBits.fetch_or(bit);
+                    std::this_thread::yield();
+                }
+                bits = bandBits.load();
+            }
+            return false;
+        }
+
+        // Лучшая непустая полоса или BANDS для пустой очереди (без блокировки, приблизительно)
+        // The best non-empty band or BANDS for an empty queue (lock-free, approximate)
+        // Найкраща непорожня смуга або BANDS для порожньої черги (без блокування, приблизно)
+        size_t topBand() const {
+            uint64_t bits = bandBits.load();
+            return bits == 0 ? BANDS : lowestBand(bits);
+        }
+
+        // Проверка, пуста ли очередь (бит непустой полосы выставлен всегда, кроме короткого окна повторной проверки)
+        // Check if the queue is empty (a non-empty band's bit is always set, except for the short recheck window)
+        // Перевірка, чи черга порожня (біт непорожньої смуги виставлений завжди, окрім короткого вікна повторної перевірки)
+        bool emptyApprox() const {
+            return bandBits.load() == 0;
+        }
+
+        // Приблизительное количество элементов (точно только в состоянии покоя)
+        // Approximate number of elements (exact only when quiescent)
+        // Приблизна кількість елементів (точна лише у стані спокою)
+        size_t sizeApprox() const {
+            size_t count = overflowCount.load(std::memory_order_relaxed);
+            for (const auto& ring : rings) {
+                const Ring* current = ring.load(std::memory_order_acquire);
+                if (current) {
+                    count += current->sizeApprox();
+                }
+            }
+            return count;
+        }
+
+    private:
+        typedef BoundedMpmcRing<T> Ring;
+
+        static size_t lowestBand(uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctzll(bits));
+#else
+            size_t band = 0;
+            while ((bits & 1) == 0) {
+                bits >>= 1;
+                ++band;
+            }
+            return band;
+#endif
+        }
+
+        // Кольцо полосы; создается при первом обращении, проигравший гонку удаляет свою копию
+        // The band's ring; created on first use, the loser of the race deletes its copy
+        // Кільце смуги; створюється при першому зверненні, той, хто програв гонку, видаляє свою копію
+        Ring& ringFor(size_t band) {
+            Ring* ring = rings[band].load(std::memory_order_acquire);
+            if (ring) {
+                return *ring;
+            }
+            Ring* created = new Ring(bandCapacity);
+            if (rings[band].compare_exchange_strong(ring, created, std::memory_order_acq_rel)) {
+                return *created;
+            }
+            delete created;
+            return *ring;
+        }
+
+        // Извлечение из полосы: сначала кольцо (его элементы старше), затем список переполнения
+        // Pop from a band: the ring first (its elements are older), then the overflow list
+        // Вилучення зі смуги: спершу кільце (його елементи старші), потім список переповнення
+        bool tryPopBand(size_t band, T& value) {
+            Ring* ring = rings[band].load(std::memory_order_acquire);
+            if (ring && ring->tryPop(value)) {
+                return true;
+            }
+            uint64_t bit = uint64_t(1) << band;
+            if ((overflowBits.load(std::memory_order_acquire) & bit) == 0) {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(overflowMutex);
+            std::deque<T>& list = overflow[band];
+            if (list.empty()) {
+                return false;
+            }
+            value = std::move(list.front());
+            list.pop_front();
+            overflowCount.fetch_sub(1, std::memory_order_relaxed);
+            if (list.empty()) {
+                overflowBits.fetch_and(~bit);
+            }
+            return true;
+        }
+
+        bool bandEmpty(size_t band) const {
+            const Ring* ring = rings[band].load(std::memory_order_acquire);
+            return (!ring || ring->emptyApprox()) && (overflowBits.load() & (uint64_t(1) << band)) == 0;
+        }
+
+        const size_t bandCapacity;
+        std::atomic<Ring*> rings[BANDS];
+
+        // Карта непустых полос - единственная точка, которую касаются все производители и потребители
+        // Map of non-empty bands - the only spot every producer and consumer touches
+        // Карта непорожніх смуг - єдине місце, якого торкаються всі виробники та споживачі
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> bandBits;
+
+        // Переполнение: полосы со списками, сами списки и их суммарная длина
+        // Overflow: bands with lists, the lists themselves and their total length
+        // Переповнення: смуги зі списками, самі списки та їхня сумарна довжина
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> overflowBits;
+        std::atomic<size_t> overflowCount;
+        std::mutex overflowMutex;
+        std::deque<T> overflow[BANDS];
+    };
+
+} // namespace Utils
+} // namespace Core
+} // namespace NeuroSync
+
+#endif // MULTI_LEVEL_QUEUE_H
@@ -16,6 +16,7 @@ namespace Utils {
         // Конструктор менеджера задач
         // Constructor of task manager
         // Конструктор менеджера завдань
+        clearAllTasks();
     }
 
     TaskManager::~TaskManager() {
@@ -44,39 +45,110 @@ namespace Utils {
         task->startTime = 0;
         task->endTime = 0;
         task->executionTime = 0;
+        task->deadline = 0;
+        task->estimatedExecutionTime = 0;
         task->function = function;
         task->userData = userData;
         
-        // Добавление задачи в вектор
-        // Add task to vector
-        // Додавання завдання до вектора
+        // Выделение узла (повторно используется узел удаленной задачи)
+        // Allocate a node (a deleted task's node is reused)
+        // Виділення вузла (повторно використовується вузол видаленого завдання)
+        uint32_t node;
+        if (!freeNodes.empty()) {
+            node = freeNodes.back();
+            freeNodes.pop_back();
+        } else {
+            node = static_cast<uint32_t>(nodes.size());
+            nodes.emplace_back();
+        }
+        
+        TaskNode& entry = nodes[node];
+        entry.task = task;
+        entry.denseIndex = tasks.size();
+        entry.inReadyList = false;
+        entry.handedOut = false;
+        entry.unmetDependencies = 0;
+        entry.successors.clear();
+        
+        // Добавление задачи в вектор, индекс и списки; без зависимостей она сразу готова
+        // Add task to the vector, the index and the lists; with no dependencies it is ready at once
+        // Додавання завдання до вектора, індексу та списків; без залежностей воно одразу готове
         tasks.push_back(task);
+        nodeById[task->id] = node;
+        linkNode(statusList(TaskStatus::PENDING), STATUS_LIST, node);
+        linkNode(typeList(type), TYPE_LIST, node);
+        linkNode(readyList, READY_LIST, node);
+        entry.inReadyList = true;
         
         return task->id;
     }
 
-    bool TaskManager::deleteTask(int taskId) {
+    bool TaskManager::deleteTask(int taskId, std::vector<int>* cancelledTasks) {
         // Удаление задачи
         // Delete a task
         // Видалення завдання
         
-        // Поиск задачи по ID
-        // Find task by ID
-        // Пошук завдання за ID
-        auto it = std::find_if(tasks.begin(), tasks.end(),
-            [taskId](const std::shared_ptr<Task>& task) {
-                return task->id == taskId;
-            });
-        
-        if (it != tasks.end()) {
-            // Удаление задачи из вектора
-            // Remove task from vector
-            // Видалення завдання з вектора
-            tasks.erase(it);
-            return true;
+        uint32_t node = findNode(taskId);
+        if (node == NO_NODE) {
+            return false; // Задача не найдена / Task not found / Завдання не знайдено
         }
         
-        return false; // Задача не найдена / Task not found / Завдання не знайдено
+        TaskNode& entry = nodes[node];
+        Task* task = entry.task.get();
+        
+        // Снятие ребер от предшественников
+        // Drop edges from predecessors
+        // Зняття ребер від попередників
+        for (int dependencyId : task->dependencies) {
+            uint32_t dependency = findNode(dependencyId);
+            if (dependency != NO_NODE) {
+                std::vector<int>& successors = nodes[dependency].successors;
+                successors.erase(std::find(successors.begin(), successors.end(), taskId));
+            }
+        }
+        
+        // Последователи незавершенной задачи никогда не дождутся ее, поэтому отменяются;
+        // у неудачной или отмененной задачи они уже отменены
+        // Successors of an unfinished task will never see it complete, so they are cancelled;
+        // for a failed or cancelled task they already are
+        // Наступники незавершеного завдання ніколи його не дочекаються, тому скасовуються;
+        // у невдалого або скасованого завдання вони вже скасовані
+        if (task->status == TaskStatus::PENDING || task->status == TaskStatus::RUNNING) {
+            cancelDependents(node, cancelledTasks);
+        }
+        
+        // Снятие ребер к последователям
+        // Drop edges to successors
+        // Зняття ребер до наступників
+        std::vector<int> successors;
+        successors.swap(entry.successors);
+        for (int successorId : successors) {
+            std::vector<int>& dependencies = nodes[findNode(successorId)].task->dependencies;
+            dependencies.erase(std::find(dependencies.begin(), dependencies.end(), taskId));
+        }
+        
+        // Удаление из списков, индекса и плотного вектора (на место встает последняя задача)
+        // Remove from the lists, the index and the dense vector (the last task takes its place)
+        // Видалення зі списків, індексу та щільного вектора (на місце стає останнє завдання)
+        TaskNode& removed = nodes[node];
+        unlinkNode(statusList(task->status), STATUS_LIST, node);
+        unlinkNode(typeList(task->type), TYPE_LIST, node);
+        if (removed.inReadyList) {
+            unlinkNode(readyList, READY_LIST, node);
+            removed.inReadyList = false;
+        }
+        
+        size_t index = removed.denseIndex;
+        if (index + 1 != tasks.size()) {
+            tasks[index] = std::move(tasks.back());
+            nodes[findNode(tasks[index]->id)].denseIndex = index;
+        }
+        tasks.pop_back();
+        
+        nodeById.erase(taskId);
+        removed.task.reset();
+        freeNodes.push_back(node);
+        return true;
     }
 
     Task* TaskManager::getTask(int taskId) {
@@ -84,54 +156,62 @@ namespace Utils {
         // Get task by ID
         // Отримання завдання за ID
         
-        // Поиск задачи по ID
-        // Find task by ID
-        // Пошук завдання за ID
-        auto it = std::find_if(tasks.begin(), tasks.end(),
-            [taskId](const std::shared_ptr<Task>& task) {
-                return task->id == taskId;
-            });
-        
-        if (it != tasks.end()) {
-            return it->get();
+        uint32_t node = findNode(taskId);
+        if (node != NO_NODE) {
+            return nodes[node].task.get();
         }
         
         return nullptr; // Задача не найдена / Task not found / Завдання не знайдено
     }
 
-    bool TaskManager::updateTaskStatus(int taskId, TaskStatus status) {
+    bool TaskManager::updateTaskStatus(int taskId, TaskStatus status, std::vector<int>* cancelledTasks) {
         // Обновление статуса задачи
         // Update task status
         // Оновлення статусу завдання
         
-        Task* task = getTask(taskId);
-        if (task != nullptr) {
-            // Обновление времени в зависимости от статуса
-            // Update time based on status
-            // Оновлення часу залежно від статусу
-            long long currentTime = getCurrentTimeMillis();
-            
-            switch (status) {
-                case TaskStatus::RUNNING:
-                    task->startTime = currentTime;
-                    break;
-                case TaskStatus::COMPLETED:
-                case TaskStatus::FAILED:
-                case TaskStatus::CANCELLED:
-                    task->endTime = currentTime;
-                    if (task->startTime > 0) {
-                        task->executionTime = task->endTime - task->startTime;
-                    }
-                    break;
-                default:
-                    break;
+        uint32_t node = findNode(taskId);
+        if (node == NO_NODE) {
+            return false; // Задача не найдена / Task not found / Завдання не знайдено
+        }
+        
+        Task* task = nodes[node].task.get();
+        
+        // Обновление времени в зависимости от статуса
+        // Update time based on status
+        // Оновлення часу залежно від статусу
+        long long currentTime = getCurrentTimeMillis();
+        
+        switch (status) {
+            case TaskStatus::RUNNING:
+                task->startTime = currentTime;
+                break;
+            case TaskStatus::COMPLETED:
+            case TaskStatus::FAILED:
+            case TaskStatus::CANCELLED:
+                task->endTime = currentTime;
+                if (task->startTime > 0) {
+                    task->executionTime = task->endTime - task->startTime;
+                }
+                break;
+            default:
+                break;
+        }
+        
+        TaskStatus oldStatus = task->status;
+        setStatus(node, status);
+        
+        // Распространение по графу зависимостей
+        // Propagation through the dependency graph
+        // Поширення графом залежностей
+        if (status == TaskStatus::COMPLETED && oldStatus != TaskStatus::COMPLETED) {
+            for (int successorId : nodes[node].successors) {
+                releaseDependency(findNode(successorId));
             }
-            
-            task->status = status;
-            return true;
+        } else if (status == TaskStatus::FAILED || status == TaskStatus::CANCELLED) {
+            cancelDependents(node, cancelledTasks);
         }
         
-        return false; // Задача не найдена / Task not found / Завдання не знайдено
+        return true;
     }
 
     bool TaskManager::updateTaskPriority(int taskId, int priority) {
@@ -162,27 +242,72 @@ namespace Utils {
         return false; // Задача не найдена / Task not found / Завдання не знайдено
     }
 
+    bool TaskManager::updateTaskDeadline(int taskId, long long deadline, long long estimatedExecutionTime) {
+        // Обновление крайнего срока и оценки времени выполнения
+        // Update the deadline and the run-time estimate
+        // Оновлення крайнього строку та оцінки часу виконання
+        
+        Task* task = getTask(taskId);
+        if (task != nullptr) {
+            task->deadline = deadline;
+            task->estimatedExecutionTime = estimatedExecutionTime;
+            return true;
+        }
+        
+        return false; // Задача не найдена / Task not found / Завдання не знайдено
+    }
+
     bool TaskManager::addTaskDependency(int taskId, int dependencyId) {
         // Добавление зависимости задачи
         // Add task dependency
         // Додавання залежності завдання
         
-        Task* task = getTask(taskId);
-        if (task != nullptr) {
-            // Проверка, существует ли зависимость
-            // Check if dependency exists
-            // Перевірка, чи існує залежність
-            auto it = std::find(task->dependencies.begin(), task->dependencies.end(), dependencyId);
-            if (it == task->dependencies.end()) {
-                // Добавление зависимости
-                // Add dependency
-                // Додавання залежності
-                task->dependencies.push_back(dependencyId);
-                return true;
+        uint32_t node = findNode(taskId);
+        uint32_t dependency = findNode(dependencyId);
+        if (node == NO_NODE || dependency == NO_NODE || taskId == dependencyId) {
+            return false; // Задача не найдена / Task not found / Завдання не знайдено
+        }
+        
+        // Зависимость можно добавить только ожидающей задаче, которая еще не выдана планировщику
+        // A dependency can only be added to a pending task that has not been handed to the scheduler
+        // Залежність можна додати лише завданню, що очікує і ще не видане планувальнику
+        Task* task = nodes[node].task.get();
+        if (task->status != TaskStatus::PENDING || nodes[node].handedOut) {
+            return false;
+        }
+        
+        // Неудачный предшественник никогда не завершится
+        // A failed predecessor will never complete
+        // Невдалий попередник ніколи не завершиться
+        TaskStatus dependencyStatus = nodes[dependency].task->status;
+        if (dependencyStatus == TaskStatus::FAILED || dependencyStatus == TaskStatus::CANCELLED) {
+            return false;
+        }
+        
+        // Проверка, существует ли зависимость, и отказ от ребер, замыкающих цикл
+        // Check if the dependency exists and refuse edges that would close a cycle
+        // Перевірка, чи існує залежність, і відмова від ребер, що замикають цикл
+        auto it = std::find(task->dependencies.begin(), task->dependencies.end(), dependencyId);
+        if (it != task->dependencies.end() || reachable(taskId, dependencyId)) {
+            return false;
+        }
+        
+        // Добавление ребра
+        // Add the edge
+        // Додавання ребра
+        task->dependencies.push_back(dependencyId);
+        nodes[dependency].successors.push_back(taskId);
+        
+        if (dependencyStatus != TaskStatus::COMPLETED) {
+            TaskNode& entry = nodes[node];
+            entry.unmetDependencies++;
+            if (entry.inReadyList) {
+                unlinkNode(readyList, READY_LIST, node);
+                entry.inReadyList = false;
             }
         }
         
-        return false; // Задача не найдена / Task not found / Завдання не знайдено
+        return true;
     }
 
     bool TaskManager::removeTaskDependency(int taskId, int dependencyId) {
@@ -190,17 +315,26 @@ namespace Utils {
         // Remove task dependency
         // Видалення залежності завдання
         
-        Task* task = getTask(taskId);
-        if (task != nullptr) {
+        uint32_t node = findNode(taskId);
+        if (node != NO_NODE) {
             // Поиск зависимости
             // Find dependency
             // Пошук залежності
+            Task* task = nodes[node].task.get();
             auto it = std::find(task->dependencies.begin(), task->dependencies.end(), dependencyId);
             if (it != task->dependencies.end()) {
-                // Удаление зависимости
-                // Remove dependency
-                // Видалення залежності
+                // Удаление зависимости с обеих сторон ребра
+                // Remove dependency on both sides of the edge
+                // Видалення залежності з обох боків ребра
                 task->dependencies.erase(it);
+        
+                uint32_t dependency = findNode(dependencyId);
+                std::vector<int>& successors = nodes[dependency].successors;
+                successors.erase(std::find(successors.begin(), successors.end(), taskId));
+        
+                if (nodes[dependency].task->status != TaskStatus::COMPLETED) {
+                    releaseDependency(node);
+                }
                 return true;
             }
         }
@@ -208,6 +342,49 @@ namespace Utils {
         return false; // Задача не найдена или зависимость не существует / Task not found or dependency doesn't exist / Завдання не знайдено або залежність не існує
     }
 
+    bool TaskManager::isTaskReady(int taskId) const {
+        // Проверка готовности задачи
+        // Check whether a task is ready
+        // Перевірка готовності завдання
+        
+        uint32_t node = findNode(taskId);
+        return node != NO_NODE &&
+               nodes[node].task->status == TaskStatus::PENDING &&
+               nodes[node].unmetDependencies == 0;
+    }
+
+    size_t TaskManager::getUnmetDependencyCount(int taskId) const {
+        // Количество незавершенных предшественников
+        // Number of unfinished predecessors
+        // Кількість незавершених попередників
+        
+        uint32_t node = findNode(taskId);
+        return node == NO_NODE ? 0 : nodes[node].unmetDependencies;
+    }
+
+    size_t TaskManager::takeReadyTasks(std::vector<int>& readyTasks) {
+        // Выдача готовых задач
+        // Hand out ready tasks
+        // Видача готових завдань
+        
+        size_t taken = 0;
+        uint32_t node = readyList.head;
+        while (node != NO_NODE) {
+            TaskNode& entry = nodes[node];
+            uint32_t next = entry.links[READY_LIST].next;
+            readyTasks.push_back(entry.task->id);
+            entry.inReadyList = false;
+            entry.handedOut = true;
+            node = next;
+            taken++;
+        }
+        
+        readyList.head = NO_NODE;
+        readyList.tail = NO_NODE;
+        readyList.size = 0;
+        return taken;
+    }
+
     const std::vector<std::shared_ptr<Task>>& TaskManager::getAllTasks() const {
         // Получение всех задач
         // Get all tasks
@@ -221,15 +398,7 @@ namespace Utils {
         // Get tasks by type
         // Отримання завдань за типом
         
-        std::vector<std::shared_ptr<Task>> result;
-        
-        for (const auto& task : tasks) {
-            if (task->type == type) {
-                result.push_back(task);
-            }
-        }
-        
-        return result;
+        return collectList(typeLists[static_cast<size_t>(type)], TYPE_LIST);
     }
 
     std::vector<std::shared_ptr<Task>> TaskManager::getTasksByStatus(TaskStatus status) const {
@@ -237,15 +406,7 @@ namespace Utils {
         // Get tasks by status
         // Отримання завдань за статусом
         
-        std::vector<std::shared_ptr<Task>> result;
-        
-        for (const auto& task : tasks) {
-            if (task->status == status) {
-                result.push_back(task);
-            }
-        }
-        
-        return result;
+        return collectList(statusLists[static_cast<size_t>(status)], STATUS_LIST);
     }
 
     size_t TaskManager::getTaskCount() const {
@@ -256,15 +417,168 @@ namespace Utils {
         return tasks.size();
     }
 
+    size_t TaskManager::getTaskCountByStatus(TaskStatus status) const {
+        // Получение количества задач с данным статусом
+        // Get the number of tasks with the given status
+        // Отримання кількості завдань із даним статусом
+        
+        return statusLists[static_cast<size_t>(status)].size;
+    }
+
     void TaskManager::clearAllTasks() {
         // Очистка всех задач
         // Clear all tasks
         // Очищення всіх завдань
         
         tasks.clear();
+        nodes.clear();
+        freeNodes.clear();
+        nodeById.clear();
+        
+        for (TaskList& list : statusLists) {
+            list = TaskList{NO_NODE, NO_NODE, 0};
+        }
+        for (TaskList& list : typeLists) {
+            list = TaskList{NO_NODE, NO_NODE, 0};
+        }
+        readyList = TaskList{NO_NODE, NO_NODE, 0};
+        
         taskIdCounter = 1;
     }
 
+    uint32_t TaskManager::findNode(int taskId) const {
+        auto it = nodeById.find(taskId);
+        return it == nodeById.end() ? NO_NODE : it->second;
+    }
+
+    void TaskManager::linkNode(TaskList& list, ListKind kind, uint32_t node) {
+        // Добавление узла в конец списка
+        // Append a node to the list
+        // Додавання вузла в кінець списку
+        ListLinks& links = nodes[node].links[kind];
+        links.prev = list.tail;
+        links.next = NO_NODE;
+        if (list.tail != NO_NODE) {
+            nodes[list.tail].links[kind].next = node;
+        } else {
+            list.head = node;
+        }
+        list.tail = node;
+        list.size++;
+    }
+
+    void TaskManager::unlinkNode(TaskList& list, ListKind kind, uint32_t node) {
+        // Исключение узла из списка
+        // Unlink a node from the list
+        // Виключення вузла зі списку
+        ListLinks& links = nodes[node].links[kind];
+        if (links.prev != NO_NODE) {
+            nodes[links.prev].links[kind].next = links.next;
+        } else {
+            list.head = links.next;
+        }
+        if (links.next != NO_NODE) {
+            nodes[links.next].links[kind].prev = links.prev;
+        } else {
+            list.tail = links.prev;
+        }
+        links.prev = NO_NODE;
+        links.next = NO_NODE;
+        list.size--;
+    }
+
+    TaskManager::TaskList& TaskManager::statusList(TaskStatus status) {
+        return statusLists[static_cast<size_t>(status)];
+    }
+
+    TaskManager::TaskList& TaskManager::typeList(TaskType type) {
+        return typeLists[static_cast<size_t>(type)];
+    }
+
+    std::vector<std::shared_ptr<Task>> TaskManager::collectList(const TaskList& list, ListKind kind) const {
+        std::vector<std::shared_ptr<Task>> result;
+        result.reserve(list.size);
+        for (uint32_t node = list.head; node != NO_NODE; node = nodes[node].links[kind].next) {
+            result.push_back(nodes[node].task);
+        }
+        return result;
+    }
+
+    void TaskManager::setStatus(uint32_t node, TaskStatus status) {
+        Task* task = nodes[node].task.get();
+        if (task->status != status) {
+            unlinkNode(statusList(task->status), STATUS_LIST, node);
+            linkNode(statusList(status), STATUS_LIST, node);
+            task->status = status;
+        }
+        if (status != TaskStatus::PENDING && nodes[node].inReadyList) {
+            unlinkNode(readyList, READY_LIST, node);
+            nodes[node].inReadyList = false;
+        }
+    }
+
+    void TaskManager::releaseDependency(uint32_t node) {
+        TaskNode& entry = nodes[node];
+        if (entry.unmetDependencies == 0) {
+            return;
+        }
+        entry.unmetDependencies--;
+        if (entry.unmetDependencies == 0 && entry.task->status == TaskStatus::PENDING &&
+            !entry.handedOut && !entry.inReadyList) {
+            linkNode(readyList, READY_LIST, node);
+            entry.inReadyList = true;
+        }
+    }
+
+    void TaskManager::cancelDependents(uint32_t node, std::vector<int>* cancelledTasks) {
+        // Заблокированные последователи никогда не станут готовыми, поэтому отменяются
+        // вместе со своими последователями (обход в ширину без рекурсии)
+        // Blocked successors can never become ready, so they are cancelled
+        // together with their own successors (breadth-first, no recursion)
+        // Заблоковані наступники ніколи не стануть готовими, тому скасовуються
+        // разом зі своїми наступниками (обхід у ширину без рекурсії)
+        std::vector<uint32_t> pending(1, node);
+        long long currentTime = getCurrentTimeMillis();
+        
+        for (size_t i = 0; i < pending.size(); ++i) {
+            for (int successorId : nodes[pending[i]].successors) {
+                uint32_t successor = findNode(successorId);
+                Task* task = nodes[successor].task.get();
+                if (task->status != TaskStatus::PENDING || nodes[successor].unmetDependencies == 0) {
+                    continue;
+                }
+                task->endTime = currentTime;
+                setStatus(successor, TaskStatus::CANCELLED);
+                if (cancelledTasks != nullptr) {
+                    cancelledTasks->push_back(successorId);
+                }
+                pending.push_back(successor);
+            }
+        }
+    }
+
+    bool TaskManager::reachable(int source, int target) const {
+        std::vector<uint32_t> stack(1, findNode(source));
+        std::vector<bool> visited(nodes.size(), false);
+        
+        while (!stack.empty()) {
+            uint32_t node = stack.back();
+            stack.pop_back();
+            for (int successorId : nodes[node].successors) {
+                if (successorId == target) {
+                    return true;
+                }
+                uint32_t successor = findNode(successorId);
+                if (!visited[successor]) {
+                    visited[successor] = true;
+                    stack.push_back(successor);
+                }
+            }
+        }
+        
+        return false;
+    }
+
     long long TaskManager::getCurrentTimeMillis() const {
         // Получение времени в миллисекундах
         // Get time in milliseconds
@@ -278,4 +592,4 @@ namespace Utils {
 
 } // namespace Utils
 } // namespace Core
-} // namespace NeuroSync
\ No newline at end of file
+} // namespace NeuroSync
@@ -4,6 +4,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
+#include <cstdint>
 
 // TaskManager.h
 // Менеджер задач для планировщика
@@ -50,38 +52,61 @@ namespace Utils {
         long long startTime;             // Время начала выполнения / Start time / Час початку виконання
         long long endTime;               // Время завершения / End time / Час завершення
         long long executionTime;         // Время выполнения / Execution time / Час виконання
-        std::vector<int> dependencies;   // Зависимости задачи / Task dependencies / Залежності завдання
+        long long deadline;              // Абсолютный крайний срок, 0 - без срока / Absolute deadline, 0 - none / Абсолютний крайній строк, 0 - без строку
+        long long estimatedExecutionTime; // Оценка времени выполнения / Run-time estimate / Оцінка часу виконання
+        std::vector<int> dependencies;   // Зависимости задачи (предшественники) / Task dependencies (predecessors) / Залежності завдання (попередники)
         void (*function)();              // Функция для выполнения / Function to execute / Функція для виконання
         void* userData;                  // Пользовательские данные / User data / Користувацькі дані
     };
 
-    // Менеджер задач для планировщика
-    // Task manager for scheduler
-    // Менеджер завдань для планувальника
+    // Менеджер задач для планировщика.
+    // Задачи адресуются через хеш-индекс ID -> узел; узлы связаны в интрусивные списки
+    // по статусу и по типу, поэтому выборки по статусу/типу не просматривают все задачи.
+    // Зависимости образуют ациклический граф: у каждой задачи есть счетчик незавершенных
+    // предшественников, и задача становится готовой, когда он падает до нуля.
+    // Готовые задачи забираются через takeReadyTasks().
+    // Task manager for scheduler.
+    // Tasks are addressed through an ID -> node hash index; nodes are linked into intrusive
+    // lists by status and by type, so status/type queries do not scan every task.
+    // Dependencies form an acyclic graph: each task counts its unfinished predecessors
+    // and becomes ready when the count drops to zero.
+    // Ready tasks are collected with takeReadyTasks().
+    // Менеджер завдань для планувальника.
+    // Завдання адресуються через хеш-індекс ID -> вузол; вузли зв'язані в інтрузивні списки
+    // за статусом і за типом, тому вибірки за статусом/типом не переглядають усі завдання.
+    // Залежності утворюють ациклічний граф: кожне завдання має лічильник незавершених
+    // попередників і стає готовим, коли він падає до нуля.
+    // Готові завдання забираються через takeReadyTasks().
     class TaskManager {
     public:
         TaskManager();
         ~TaskManager();
         
-        // Создание новой задачи
-        // Create a new task
-        // Створення нового завдання
+        // Создание новой задачи (сразу готова, пока не добавлены зависимости)
+        // Create a new task (ready at once until dependencies are added)
+        // Створення нового завдання (одразу готове, доки не додано залежності)
         int createTask(const std::string& name, TaskType type, int priority, int weight, void (*function)(), void* userData = nullptr);
         
-        // Удаление задачи
-        // Delete a task
-        // Видалення завдання
-        bool deleteTask(int taskId);
+        // Удаление задачи. Незавершенная (ожидающая или выполняющаяся) задача уже не завершится,
+        // поэтому ее заблокированные последователи отменяются, как при CANCELLED, и добавляются в cancelledTasks
+        // Delete a task. An unfinished (pending or running) task will never complete,
+        // so its blocked successors are cancelled as with CANCELLED and appended to cancelledTasks
+        // Видалення завдання. Незавершене (очікуюче або виконуване) завдання вже не завершиться,
+        // тому його заблоковані наступники скасовуються, як при CANCELLED, і додаються до cancelledTasks
+        bool deleteTask(int taskId, std::vector<int>* cancelledTasks = nullptr);
         
         // Получение задачи по ID
         // Get task by ID
         // Отримання завдання за ID
         Task* getTask(int taskId);
         
-        // Обновление статуса задачи
-        // Update task status
-        // Оновлення статусу завдання
-        bool updateTaskStatus(int taskId, TaskStatus status);
+        // Обновление статуса задачи. COMPLETED освобождает последователей; FAILED и CANCELLED
+        // отменяют заблокированных последователей (их ID добавляются в cancelledTasks)
+        // Update task status. COMPLETED releases successors; FAILED and CANCELLED
+        // cancel blocked successors (their IDs are appended to cancelledTasks)
+        // Оновлення статусу завдання. COMPLETED звільняє наступників; FAILED і CANCELLED
+        // скасовують заблокованих наступників (їхні ID додаються до cancelledTasks)
+        bool updateTaskStatus(int taskId, TaskStatus status, std::vector<int>* cancelledTasks = nullptr);
         
         // Обновление приоритета задачи
         // Update task priority
@@ -93,9 +118,17 @@ namespace Utils {
         // Оновлення ваги завдання
         bool updateTaskWeight(int taskId, int weight);
         
-        // Добавление зависимости задачи
-        // Add task dependency
-        // Додавання залежності завдання
+        // Установка крайнего срока (мс, в той же шкале, что creationTime) и оценки времени выполнения (мс)
+        // Set the deadline (ms, on the same scale as creationTime) and the run-time estimate (ms)
+        // Встановлення крайнього строку (мс, у тій самій шкалі, що creationTime) та оцінки часу виконання (мс)
+        bool updateTaskDeadline(int taskId, long long deadline, long long estimatedExecutionTime);
+        
+        // Добавление зависимости: taskId ждет завершения dependencyId.
+        // Отклоняется для циклов, неудачных предшественников и уже выданных задач.
+        // Add a dependency: taskId waits for dependencyId to complete.
+        // Rejected for cycles, failed predecessors and tasks already handed out.
+        // Додавання залежності: taskId чекає завершення dependencyId.
+        // Відхиляється для циклів, невдалих попередників і вже виданих завдань.
         bool addTaskDependency(int taskId, int dependencyId);
         
         // Удаление зависимости задачи
@@ -103,9 +136,27 @@ namespace Utils {
         // Видалення залежності завдання
         bool removeTaskDependency(int taskId, int dependencyId);
         
-        // Получение всех задач
-        // Get all tasks
-        // Отримання всіх завдань
+        // Готова ли задача: ожидает и все предшественники завершены
+        // Whether a task is ready: pending with every predecessor completed
+        // Чи готове завдання: очікує і всі попередники завершені
+        bool isTaskReady(int taskId) const;
+        
+        // Количество незавершенных предшественников задачи
+        // Number of unfinished predecessors of a task
+        // Кількість незавершених попередників завдання
+        size_t getUnmetDependencyCount(int taskId) const;
+        
+        // Забрать задачи, ставшие готовыми с прошлого вызова (в порядке готовности).
+        // Забранная задача считается выданной и больше не получает зависимостей.
+        // Take the tasks that became ready since the last call (in readiness order).
+        // A taken task counts as handed out and accepts no more dependencies.
+        // Забрати завдання, що стали готовими з минулого виклику (у порядку готовності).
+        // Забране завдання вважається виданим і більше не отримує залежностей.
+        size_t takeReadyTasks(std::vector<int>& readyTasks);
+        
+        // Получение всех задач (в произвольном порядке)
+        // Get all tasks (in no particular order)
+        // Отримання всіх завдань (у довільному порядку)
         const std::vector<std::shared_ptr<Task>>& getAllTasks() const;
         
         // Получение задач по типу
@@ -123,22 +174,113 @@ namespace Utils {
         // Отримання кількості завдань
         size_t getTaskCount() const;
         
+        // Количество задач с данным статусом за O(1)
+        // Number of tasks with the given status in O(1)
+        // Кількість завдань із даним статусом за O(1)
+        size_t getTaskCountByStatus(TaskStatus status) const;
+        
         // Очистка всех задач
         // Clear all tasks
         // Очищення всіх завдань
         void clearAllTasks();
         
     private:
-        // Вектор задач
-        // Vector of tasks
-        // Вектор завдань
+        static constexpr uint32_t NO_NODE = UINT32_MAX;
+        static constexpr size_t STATUS_COUNT = 5;
+        static constexpr size_t TYPE_COUNT = 5;
+        
+        // Виды интрусивных списков, в которых состоит узел
+        // Kinds of intrusive lists a node belongs to
+        // Види інтрузивних списків, у яких перебуває вузол
+        enum ListKind {
+            STATUS_LIST = 0,
+            TYPE_LIST = 1,
+            READY_LIST = 2,
+            LIST_KIND_COUNT = 3
+        };
+        
+        struct ListLinks {
+            uint32_t prev;
+            uint32_t next;
+        };
+        
+        struct TaskList {
+            uint32_t head;
+            uint32_t tail;
+            size_t size;
+        };
+        
+        // Узел задачи: сама задача, ее место в плотном векторе, связи списков и ребра графа
+        // Task node: the task itself, its place in the dense vector, list links and graph edges
+        // Вузол завдання: саме завдання, його місце в щільному векторі, зв'язки списків і ребра графа
+        struct TaskNode {
+            std::shared_ptr<Task> task;
+            size_t denseIndex;
+            ListLinks links[LIST_KIND_COUNT];
+            bool inReadyList;
+            bool handedOut;
+            size_t unmetDependencies;
+            std::vector<int> successors;
+        };
+        
+        // Плотный вектор задач для getAllTasks()
+        // Dense task vector for getAllTasks()
+        // Щільний вектор завдань для getAllTasks()
         std::vector<std::shared_ptr<Task>> tasks;
         
+        // Узлы задач, свободные узлы и индекс ID -> узел
+        // Task nodes, free nodes and the ID -> node index
+        // Вузли завдань, вільні вузли та індекс ID -> вузол
+        std::vector<TaskNode> nodes;
+        std::vector<uint32_t> freeNodes;
+        std::unordered_map<int, uint32_t> nodeById;
+        
+        // Списки по статусу, по типу и список готовых задач
+        // Lists by status, by type and the ready list
+        // Списки за статусом, за типом і список готових завдань
+        TaskList statusLists[STATUS_COUNT];
+        TaskList typeLists[TYPE_COUNT];
+        TaskList readyList;
+        
         // Счетчик ID задач
         // Task ID counter
         // Лічильник ID завдань
         int taskIdCounter;
         
+        // Поиск узла задачи по ID (NO_NODE, если не найдена)
+        // Find a task node by ID (NO_NODE if not found)
+        // Пошук вузла завдання за ID (NO_NODE, якщо не знайдено)
+        uint32_t findNode(int taskId) const;
+        
+        // Операции с интрусивными списками
+        // Intrusive list operations
+        // Операції з інтрузивними списками
+        void linkNode(TaskList& list, ListKind kind, uint32_t node);
+        void unlinkNode(TaskList& list, ListKind kind, uint32_t node);
+        TaskList& statusList(TaskStatus status);
+        TaskList& typeList(TaskType type);
+        std::vector<std::shared_ptr<Task>> collectList(const TaskList& list, ListKind kind) const;
+        
+        // Смена статуса с перестановкой между списками
+        // Status change with relinking between lists
+        // Зміна статусу з переміщенням між списками
+        void setStatus(uint32_t node, TaskStatus status);
+        
+        // Снятие одного незавершенного предшественника; задача может стать готовой
+        // Drop one unfinished predecessor; the task may become ready
+        // Зняття одного незавершеного попередника; завдання може стати готовим
+        void releaseDependency(uint32_t node);
+        
+        // Отмена заблокированных последователей неудачной задачи (транзитивно)
+        // Cancel blocked successors of a failed task (transitively)
+        // Скасування заблокованих наступників невдалого завдання (транзитивно)
+        void cancelDependents(uint32_t node, std::vector<int>* cancelledTasks);
+        
+        // Достижим ли target из source по ребрам к последователям
+        // Whether target is reachable from source along successor edges
+        // Чи досяжний target із source по ребрах до наступників
+        bool reachable(int source, int target) const;
+        
         // Получение времени в миллисекундах
         // Get time in milliseconds
         // Отримання часу в мілісекундах
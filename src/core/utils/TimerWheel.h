@@ -0,0 +1,361 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// TimerWheel.h
+// Иерархическое хешированное колесо таймеров
+// Hierarchical hashed timer wheel
+// Ієрархічне хешоване колесо таймерів
+
+namespace NeuroSync {
+namespace Core {
+namespace Utils {
+
+    // Иерархическое колесо таймеров на LEVELS уровней по 64 слота.
+    // Время измеряется в тиках; слот уровня k покрывает 64^k тиков. Запись хранится в пуле узлов
+    // и связана в интрузивный список своего слота, поэтому вставка и отмена стоят O(1).
+    // При переходе через границу уровня k слот этого уровня раскладывается на нижние уровни.
+    // Для каждого уровня хранится битовая маска непустых слотов, так что advance() перескакивает
+    // пустые участки, а nextEventTick() находит ближайшее событие без обхода слотов.
+    // Hierarchical timer wheel with LEVELS levels of 64 slots.
+    // Time is measured in ticks; a level-k slot covers 64^k ticks. An entry lives in a node pool
+    // and is linked into its slot's intrusive list, so insertion and cancellation cost O(1).
+    // Crossing a level-k boundary cascades that level's slot down to the lower levels.
+    // Each level keeps a bitmask of non-empty slots, so advance() skips empty stretches
+    // and nextEventTick() finds the nearest event without walking the slots.
+    // Ієрархічне колесо таймерів на LEVELS рівнів по 64 слоти.
+    // Час вимірюється в тиках; слот рівня k покриває 64^k тиків. Запис зберігається в пулі вузлів
+    // і зв'язаний в інтрузивний список свого слота, тому вставка та скасування коштують O(1).
+    // При переході через межу рівня k слот цього рівня розкладається на нижчі рівні.
+    // Для кожного рівня зберігається бітова маска непорожніх слотів, тож advance() перескакує
+    // порожні ділянки, а nextEventTick() знаходить найближчу подію без обходу слотів.
+    template<typename T>
+    class TimerWheel {
+    public:
+        static constexpr uint32_t INVALID_HANDLE = UINT32_MAX;
+
+        TimerWheel() : currentTick(0), entryCount(0) {
+            for (size_t level = 0; level < LEVELS; ++level) {
+                occupied[level] = 0;
+                for (size_t slot = 0; slot < SLOTS; ++slot) {
+                    heads[level][slot] = NO_NODE;
+                }
+            }
+            dueHead = NO_NODE;
+        }
+
+        // Вставка записи со сроком expiryTick; возвращает дескриптор для cancel().
+        // Срок, который уже наступил, выдается при следующем advance().
+        // Insert an entry due at expiryTick; returns a handle for cancel().
+        // An expiry that has already passed is returned by the next advance().
+        // Вставка запису зі строком expiryTick; повертає дескриптор для cancel().
+        // Строк, що вже настав, видається при наступному advance().
+        uint32_t insert(uint64_t expiryTick, T value) {
+            uint32_t node;
+            if (!freeNodes.empty()) {
+                node = freeNodes.back();
+                freeNodes.pop_back();
+            } else {
+                node = static_cast<uint32_t>(nodes.size());
+                nodes.emplace_back();
+            }
+
+            nodes[node].value = std::move(value);
+            nodes[node].expiryTick = expiryTick;
+            nodes[node].live = true;
+            place(node);
+            entryCount++;
+            return node;
+        }
+
+        // Отмена записи по дескриптору (false, если запись уже выдана или отменена);
+        // если cancelled задан, значение записи перемещается в него
+        // Cancel an entry by handle (false if it was already returned or cancelled);
+        // if cancelled is given, the entry's value is moved into it
+        // Скасування запису за дескриптором (false, якщо запис уже видано або скасовано);
+        // якщо cancelled задано, значення запису переміщується до нього
+        bool cancel(uint32_t handle, T* cancelled = nullptr) {
+            if (handle >= nodes.size() || !nodes[handle].live) {
+                return false;
+            }
+            if (cancelled) {
+                *cancelled = std::move(nodes[handle].value);
+            }
+            unlink(handle);
+            release(handle);
+            return true;
+        }
+
+        // Значение записи по дескриптору
+        // Entry value by handle
+        // Значення запису за дескриптором
+        const T& get(uint32_t handle) const { return nodes[handle].value; }
+
+        // Продвижение времени до tick: все наступившие записи добавляются в due в порядке наступления срока
+        // Advance time to tick: every entry that came due is appended to due in expiry order
+        // Просування часу до tick: усі записи, строк яких настав, додаються до due у порядку настання строку
+        size_t advance(uint64_t tick, std::vector<T>& due) {
+            size_t released = drainList(dueHead, due);
+
+            while (currentTick < tick) {
+                if (entryCount == 0) {
+                    currentTick = tick;
+                    break;
+                }
+
+                uint64_t eventTick = nextEventTick();
+                if (eventTick > tick) {
+                    currentTick = tick;
+                    break;
+                }
+                currentTick = eventTick;
+
+                // Раскладка старших уровней, чьи границы совпали с текущим тиком
+                // Cascade the higher levels whose boundaries match the current tick
+                // Розкладання старших рівнів, чиї межі збіглися з поточним тиком
+                for (size_t level = LEVELS - 1; level > 0; --level) {
+                    if ((currentTick & ((uint64_t(1) << (SLOT_BITS * level)) - 1)) == 0) {
+                        cascade(level, slotIndex(currentTick, level));
+                    }
+                }
+
+                // Раскладка может поставить записи с текущим сроком в список наступивших
+                // Cascading may put entries expiring now onto the due list
+                // Розкладання може поставити записи з поточним строком до списку тих, що настали
+                released += drainList(dueHead, due);
+                size_t slot = slotIndex(currentTick, 0);
+                released += drainList(heads[0][slot], due);
+                occupied[0] &= ~(uint64_t(1) << slot);
+            }
+
+            return released;
+        }
+
+        // Ближайший тик, на котором колесу нужно внимание: срок записи нижнего уровня
+        // или граница раскладки старшего уровня (UINT64_MAX, если записей нет)
+        // The nearest tick that needs the wheel's attention: a bottom-level expiry
+        // or a higher-level cascade boundary (UINT64_MAX if there are no entries)
+        // Найближчий тик, на якому колесу потрібна увага: строк запису нижнього рівня
+        // або межа розкладання старшого рівня (UINT64_MAX, якщо записів немає)
+        uint64_t nextEventTick() const {
+            if (entryCount == 0) {
+                return UINT64_MAX;
+            }
+            if (dueHead != NO_NODE) {
+                return currentTick;
+            }
+
+            uint64_t best = UINT64_MAX;
+            for (size_t level = 0; level < LEVELS; ++level) {
+                if (occupied[level] == 0) {
+                    continue;
+                }
+                // Ближайший непустой слот после текущего (текущий слот уровня - через полный оборот)
+                // The nearest non-empty slot after the current one (the level's current slot - after a full turn)
+                // Найближчий непорожній слот після поточного (поточний слот рівня - через повний оберт)
+                uint64_t block = currentTick >> (SLOT_BITS * level);
+                size_t current = static_cast<size_t>(block & SLOT_MASK);
+                size_t distance = distanceToNextSlot(occupied[level], current);
+                uint64_t eventTick = (block + distance) << (SLOT_BITS * level);
+                if (eventTick < best) {
+                    best = eventTick;
+                }
+            }
+            return best;
+        }
+
+        uint64_t now() const { return currentTick; }
+        size_t size() const { return entryCount; }
+        bool empty() const { return entryCount == 0; }
+
+        // Извлечение всех живых записей в out (в порядке пула, не по сроку) и очистка колеса
+        // Move every live entry into out (in pool order, not by expiry) and clear the wheel
+        // Вилучення всіх живих записів до out (у порядку пулу, не за строком) та очищення колеса
+        size_t drain(std::vector<T>& out) {
+            size_t drained = entryCount;
+            for (Node& node : nodes) {
+                if (node.live) {
+                    out.push_back(std::move(node.value));
+                }
+            }
+            clear();
+            return drained;
+        }
+
+        void clear() {
+            nodes.clear();
+            freeNodes.clear();
+            for (size_t level = 0; level < LEVELS; ++level) {
+                occupied[level] = 0;
+                for (size_t slot = 0; slot < SLOTS; ++slot) {
+                    heads[level][slot] = NO_NODE;
+                }
+            }
+            dueHead = NO_NODE;
+            entryCount = 0;
+        }
+
+    private:
+        static constexpr size_t SLOT_BITS = 6;
+        static constexpr size_t SLOTS = size_t(1) << SLOT_BITS;
+        static constexpr uint64_t SLOT_MASK = SLOTS - 1;
+        static constexpr size_t LEVELS = 4;
+        static constexpr uint32_t NO_NODE = UINT32_MAX;
+
+        // Узел записи; prev/next связывают его в список слота, а (level, slot) указывают список
+        // An entry node; prev/next link it into its slot's list, and (level, slot) name that list
+        // Вузол запису; prev/next зв'язують його в список слота, а (level, slot) вказують список
+        struct Node {
+            T value;
+            uint64_t expiryTick;
+            uint32_t prev;
+            uint32_t next;
+            uint8_t level;
+            uint8_t slot;
+            bool due;
+            bool live;
+        };
+
+        static size_t slotIndex(uint64_t tick, size_t level) {
+            return static_cast<size_t>((tick >> (SLOT_BITS * level)) & SLOT_MASK);
+        }
+
+        // Расстояние (1..64) от текущего слота до ближайшего непустого по кругу
+        // Distance (1..64) from the current slot to the nearest non-empty one around the circle
+        // Відстань (1..64) від поточного слота до найближчого непорожнього по колу
+        static size_t distanceToNextSlot(uint64_t mask, size_t current) {
+            uint64_t rotated = current + 1 < SLOTS
+                ? (mask >> (current + 1)) | (mask << (SLOTS - current - 1))
+                : mask;
+            size_t distance = 0;
+            while ((rotated & 1) == 0) {
+                rotated >>= 1;
+                distance++;
+            }
+            return distance + 1;
+        }
+
+        // Размещение узла по его сроку относительно текущего тика
+        // Place a node by its expiry relative to the current tick
+        // Розміщення вузла за його строком відносно поточного тику
+        void place(uint32_t node) {
+            Node& entry = nodes[node];
+            if (entry.expiryTick <= currentTick) {
+                entry.due = true;
+                pushBack(dueHead, node);
+                return;
+            }
+
+            entry.due = false;
+            uint64_t delta = entry.expiryTick - currentTick;
+            size_t level = 0;
+            while (level + 1 < LEVELS && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+                level++;
+            }
+
+            // Срок дальше последнего уровня: запись ставится в самый дальний слот
+            // и перераскладывается, когда до него дойдет очередь
+            // An expiry beyond the last level: the entry goes to the farthest slot
+            // and is placed again when that slot comes up
+            // Строк далі останнього рівня: запис ставиться в найдальший слот
+            // і перерозкладається, коли до нього дійде черга
+            uint64_t placementTick = entry.expiryTick;
+            uint64_t range = uint64_t(1) << (SLOT_BITS * LEVELS);
+            if (delta >= range) {
+                placementTick = currentTick + range - 1;
+            }
+
+            size_t slot = slotIndex(placementTick, level);
+            entry.level = static_cast<uint8_t>(level);
+            entry.slot = static_cast<uint8_t>(slot);
+            pushBack(heads[level][slot], node);
+            occupied[level] |= uint64_t(1) << slot;
+        }
+
+        void cascade(size_t level, size_t slot) {
+            uint32_t node = heads[level][slot];
+            heads[level][slot] = NO_NODE;
+            occupied[level] &= ~(uint64_t(1) << slot);
+            while (node != NO_NODE) {
+                uint32_t next = nodes[node].next;
+                place(node);
+                node = next;
+            }
+        }
+
+        size_t drainList(uint32_t& head, std::vector<T>& due) {
+            size_t released = 0;
+            uint32_t node = head;
+            head = NO_NODE;
+            while (node != NO_NODE) {
+                uint32_t next = nodes[node].next;
+                due.push_back(std::move(nodes[node].value));
+                release(node);
+                node = next;
+                released++;
+            }
+            return released;
+        }
+
+        // Список слота хранится с головой; prev головы указывает на хвост
+        // A slot list is kept by its head; the head's prev points at the tail
+        // Список слота зберігається з головою; prev голови вказує на хвіст
+        void pushBack(uint32_t& head, uint32_t node) {
+            nodes[node].next = NO_NODE;
+            if (head == NO_NODE) {
+                nodes[node].prev = node;
+                head = node;
+                return;
+            }
+            uint32_t tail = nodes[head].prev;
+            nodes[tail].next = node;
+            nodes[node].prev = tail;
+            nodes[head].prev = node;
+        }
+
+        void unlink(uint32_t node) {
+            Node& entry = nodes[node];
+            uint32_t& head = entry.due ? dueHead : heads[entry.level][entry.slot];
+            if (head == node) {
+                head = entry.next;
+                if (head != NO_NODE) {
+                    nodes[head].prev = entry.prev;
+                }
+            } else {
+                nodes[entry.prev].next = entry.next;
+                if (entry.next != NO_NODE) {
+                    nodes[entry.next].prev = entry.prev;
+                } else {
+                    nodes[head].prev = entry.prev;
+                }
+            }
+            if (!entry.due && head == NO_NODE) {
+                occupied[entry.level] &= ~(uint64_t(1) << entry.slot);
+            }
+        }
+
+        void release(uint32_t node) {
+            nodes[node].value = T();
+            nodes[node].live = false;
+            freeNodes.push_back(node);
+            entryCount--;
+        }
+
+        std::vector<Node> nodes;
+        std::vector<uint32_t> freeNodes;
+        uint32_t heads[LEVELS][SLOTS];
+        uint64_t occupied[LEVELS];
+        uint32_t dueHead;
+        uint64_t currentTick;
+        size_t entryCount;
+    };
+
+} // namespace Utils
+} // namespace Core
+} // namespace NeuroSync
+
+#endif // TIMER_WHEEL_H
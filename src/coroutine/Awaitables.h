@@ -0,0 +1,144 @@
+#ifndef NEUROSYNC_COROUTINE_AWAITABLES_H
+#define NEUROSYNC_COROUTINE_AWAITABLES_H
+
+#include "Task.h"
+#include "../threadpool/ThreadPool.h"
+#include "../core/Scheduler.h"
+#include <chrono>
+#include <coroutine>
+#include <iostream>
+#include <stdexcept>
+
+// Awaitables.h
+// Очікувані об'єкти для ThreadPool, Core::Scheduler та таймерів
+// Awaitables for ThreadPool, Core::Scheduler and timers
+// Ожидаемые объекты для ThreadPool, Core::Scheduler и таймеров
+
+namespace NeuroSync {
+namespace Coroutine {
+
+    // Перехід співпрограми на робочий потік пулу: до відновлення вона не займає жодного потоку
+    // Move the coroutine onto a pool worker: it occupies no thread until it is resumed
+    // Переход сопрограммы на рабочий поток пула: до возобновления она не занимает ни одного потока
+    class ThreadPoolAwaiter {
+    public:
+        explicit ThreadPoolAwaiter(ThreadPool& pool) noexcept : pool(pool) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            // post не виділяє пам'ять у купі для дескриптора (TaskFunction зберігає його на місці)
+            // post does not heap-allocate for the handle (TaskFunction stores it in place)
+            // post не выделяет память в куче для дескриптора (TaskFunction хранит его на месте)
+            pool.post([handle]() { handle.resume(); });
+        }
+
+        void await_resume() const noexcept {}
+
+    private:
+        ThreadPool& pool;
+    };
+
+    // Перехід співпрограми на робітника Core::Scheduler з пріоритетом.
+    // Якщо планувальник зупиняється раніше, ніж продовження виконано (таймер ще не спрацював
+    // або задачу відкинуто), stop() відновлює співпрограму у своєму потоці, і co_await кидає виняток.
+    // Move the coroutine onto a Core::Scheduler worker with a priority.
+    // If the scheduler stops before the continuation runs (the timer has not fired yet
+    // or the task was discarded), stop() resumes the coroutine on its own thread and co_await throws.
+    // Переход сопрограммы на рабочего Core::Scheduler с приоритетом.
+    // Если планировщик останавливается раньше, чем продолжение выполнено (таймер еще не сработал
+    // или задача отброшена), stop() возобновляет сопрограмму в своем потоке, и co_await бросает исключение.
+    class SchedulerAwaiter {
+    public:
+        SchedulerAwaiter(::Core::Scheduler& scheduler, int priority, std::chrono::milliseconds delay) noexcept
+            : scheduler(scheduler), priority(priority), delay(delay), cancelled(false) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            // Очікувач живе в кадрі співпрограми до її відновлення, тож обробник може писати в нього
+            // The awaiter lives in the coroutine frame until it is resumed, so the handler may write to it
+            // Ожидатель живет в кадре сопрограммы до ее возобновления, так что обработчик может писать в него
+            auto onCancel = [this, handle]() {
+                cancelled = true;
+                handle.resume();
+            };
+            int taskId = delay.count() > 0
+                ? scheduler.addDelayedTask([handle]() { handle.resume(); }, onCancel, delay, priority)
+                : scheduler.addTask([handle]() { handle.resume(); }, onCancel, priority);
+            if (taskId < 0) {
+                throw std::runtime_error("co_await on stopped Scheduler");
+            }
+        }
+
+        void await_resume() const {
+            if (cancelled) {
+                throw std::runtime_error("Scheduler stopped before the coroutine was resumed");
+            }
+        }
+
+    private:
+        ::Core::Scheduler& scheduler;
+        int priority;
+        std::chrono::milliseconds delay;
+        bool cancelled;
+    };
+
+    // co_await schedule(pool) - продовжити на робочому потоці пулу
+    // co_await schedule(pool) - continue on a pool worker thread
+    // co_await schedule(pool) - продолжить на рабочем потоке пула
+    inline ThreadPoolAwaiter schedule(ThreadPool& pool) noexcept {
+        return ThreadPoolAwaiter(pool);
+    }
+
+    // co_await schedule(scheduler, priority) - продовжити на робітнику планувальника
+    // co_await schedule(scheduler, priority) - continue on a scheduler worker
+    // co_await schedule(scheduler, priority) - продолжить на рабочем планировщика
+    inline SchedulerAwaiter schedule(::Core::Scheduler& scheduler, int priority = 0) noexcept {
+        return SchedulerAwaiter(scheduler, priority, std::chrono::milliseconds(0));
+    }
+
+    // co_await sleepFor(scheduler, delay) - таймер на колесі таймерів планувальника; поки він іде,
+    // співпрограма не займає потоку, а по спрацюванню продовжується на робітнику планувальника
+    // co_await sleepFor(scheduler, delay) - a timer on the scheduler's timer wheel; while it runs
+    // the coroutine occupies no thread, and when it fires it continues on a scheduler worker
+    // co_await sleepFor(scheduler, delay) - таймер на колесе таймеров планировщика; пока он идет,
+    // сопрограмма не занимает потока, а по срабатыванию продолжается на рабочем планировщика
+    inline SchedulerAwaiter sleepFor(::Core::Scheduler& scheduler, std::chrono::milliseconds delay, int priority = 0) noexcept {
+        return SchedulerAwaiter(scheduler, priority, delay);
+    }
+
+    namespace Detail {
+
+        template<typename Executor>
+        DetachedTask runDetached(Executor& executor, Task<void> task) {
+            try {
+                co_await schedule(executor);
+                co_await task;
+            } catch (const std::exception& e) {
+                std::cerr << "Exception in coroutine task: " << e.what() << std::endl;
+            } catch (...) {
+                std::cerr << "Exception in coroutine task" << std::endl;
+            }
+        }
+
+    } // namespace Detail
+
+    // Запуск завдання без очікування результату на ThreadPool або Core::Scheduler.
+    // Кадр звільняється по завершенні; винятки лише записуються в журнал, як у ThreadPool::post.
+    // Виконавець має пережити всі запущені на ньому співпрограми.
+    // Start a task on a ThreadPool or Core::Scheduler without awaiting its result.
+    // The frame is freed on completion; exceptions are only logged, as in ThreadPool::post.
+    // The executor must outlive every coroutine started on it.
+    // Запуск задачи без ожидания результата на ThreadPool или Core::Scheduler.
+    // Кадр освобождается по завершении; исключения только записываются в журнал, как в ThreadPool::post.
+    // Исполнитель должен пережить все запущенные на нем сопрограммы.
+    template<typename Executor>
+    void spawn(Executor& executor, Task<void> task) {
+        Detail::runDetached(executor, std::move(task));
+    }
+
+} // namespace Coroutine
+} // namespace NeuroSync
+
+#endif // NEUROSYNC_COROUTINE_AWAITABLES_H
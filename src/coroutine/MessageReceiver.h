@@ -0,0 +1,163 @@
+#ifndef NEUROSYNC_COROUTINE_MESSAGE_RECEIVER_H
+#define NEUROSYNC_COROUTINE_MESSAGE_RECEIVER_H
+
+#include "Awaitables.h"
+#include "../synapse/SynapseBus.h"
+#include <coroutine>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+// MessageReceiver.h
+// Очікування повідомлень SynapseBus у співпрограмах
+// Awaiting SynapseBus messages in coroutines
+// Ожидание сообщений SynapseBus в сопрограммах
+
+namespace NeuroSync {
+namespace Coroutine {
+
+    // Приймач повідомлень шини для співпрограм.
+    // Встановлює себе callback'ом шини і розкладає повідомлення по скриньках отримувачів;
+    // co_await receive(receiverId) повертає наступне повідомлення отримувача, а якщо скринька порожня,
+    // співпрограма призупиняється без потоку до надходження повідомлення. Відновлення відбувається
+    // на resumePool (якщо він заданий) або прямо на робочому потоці шини.
+    // Приймач створюється до SynapseBus::start() і знищується після SynapseBus::stop(),
+    // бо шина викликає callback без синхронізації з його заміною.
+    // Bus message receiver for coroutines.
+    // Installs itself as the bus callback and sorts messages into per-receiver mailboxes;
+    // co_await receive(receiverId) returns the receiver's next message, and if the mailbox is empty
+    // the coroutine suspends without a thread until a message arrives. It is resumed
+    // on resumePool (when given) or directly on the bus worker thread.
+    // The receiver is created before SynapseBus::start() and destroyed after SynapseBus::stop(),
+    // since the bus invokes the callback without synchronizing with its replacement.
+    // Приемник сообщений шины для сопрограмм.
+    // Устанавливает себя callback'ом шины и раскладывает сообщения по ящикам получателей;
+    // co_await receive(receiverId) возвращает следующее сообщение получателя, а если ящик пуст,
+    // сопрограмма приостанавливается без потока до поступления сообщения. Возобновление происходит
+    // на resumePool (если он задан) или прямо на рабочем потоке шины.
+    // Приемник создается до SynapseBus::start() и уничтожается после SynapseBus::stop(),
+    // так как шина вызывает callback без синхронизации с его заменой.
+    class MessageReceiver {
+    public:
+        typedef NeuroSync::Synapse::Priority::PriorityMessage Message;
+
+        explicit MessageReceiver(Synapse::SynapseBus& bus, ThreadPool* resumePool = nullptr)
+            : bus(bus), resumePool(resumePool) {
+            bus.setMessageCallback([this](const Message& message) { deliver(message); });
+        }
+
+        ~MessageReceiver() {
+            bus.setMessageCallback(nullptr);
+        }
+
+        MessageReceiver(const MessageReceiver&) = delete;
+        MessageReceiver& operator=(const MessageReceiver&) = delete;
+
+        // Очікування наступного повідомлення для receiverId
+        // Await the next message for receiverId
+        // Ожидание следующего сообщения для receiverId
+        class ReceiveAwaiter {
+        public:
+            ReceiveAwaiter(MessageReceiver& receiver, int receiverId) noexcept
+                : receiver(receiver), receiverId(receiverId) {}
+
+            bool await_ready() const noexcept { return false; }
+
+            bool await_suspend(std::coroutine_handle<> handle) {
+                return receiver.wait(*this, handle);
+            }
+
+            Message await_resume() { return std::move(*message); }
+
+        private:
+            friend class MessageReceiver;
+
+            MessageReceiver& receiver;
+            int receiverId;
+            std::coroutine_handle<> handle;
+            std::optional<Message> message;
+        };
+
+        ReceiveAwaiter receive(int receiverId) noexcept {
+            return ReceiveAwaiter(*this, receiverId);
+        }
+
+        // Кількість повідомлень у скриньках, яких ще ніхто не очікує
+        // Number of mailbox messages nobody is awaiting yet
+        // Количество сообщений в ящиках, которых еще никто не ожидает
+        size_t getPendingMessageCount() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return pendingMessages;
+        }
+
+    private:
+        // Скринька отримувача: повідомлення без очікувачів або очікувачі без повідомлень
+        // Receiver mailbox: messages without awaiters or awaiters without messages
+        // Ящик получателя: сообщения без ожидающих или ожидающие без сообщений
+        struct Mailbox {
+            std::deque<Message> messages;
+            std::deque<ReceiveAwaiter*> waiters;
+        };
+
+        // Реєстрація очікувача; false - повідомлення вже є і співпрограма не призупиняється
+        // Register an awaiter; false - a message is already there and the coroutine does not suspend
+        // Регистрация ожидающего; false - сообщение уже есть и сопрограмма не приостанавливается
+        bool wait(ReceiveAwaiter& awaiter, std::coroutine_handle<> handle) {
+            std::lock_guard<std::mutex> lock(mutex);
+            Mailbox& mailbox = mailboxes[awaiter.receiverId];
+            if (!mailbox.messages.empty()) {
+                awaiter.message.emplace(std::move(mailbox.messages.front()));
+                mailbox.messages.pop_front();
+                pendingMessages--;
+                if (mailbox.messages.empty()) {
+                    mailboxes.erase(awaiter.receiverId);
+                }
+                return false;
+            }
+            awaiter.handle = handle;
+            mailbox.waiters.push_back(&awaiter);
+            return true;
+        }
+
+        // Callback шини: передача повідомлення очікувачу або в скриньку
+        // Bus callback: hand the message to an awaiter or to the mailbox
+        // Callback шины: передача сообщения ожидающему или в ящик
+        void deliver(const Message& message) {
+            std::coroutine_handle<> handle;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                Mailbox& mailbox = mailboxes[message.receiverId];
+                if (mailbox.waiters.empty()) {
+                    mailbox.messages.push_back(message);
+                    pendingMessages++;
+                    return;
+                }
+                ReceiveAwaiter* awaiter = mailbox.waiters.front();
+                mailbox.waiters.pop_front();
+                if (mailbox.waiters.empty()) {
+                    mailboxes.erase(message.receiverId);
+                }
+                awaiter->message.emplace(message);
+                handle = awaiter->handle;
+            }
+
+            if (resumePool != nullptr) {
+                resumePool->post([handle]() { handle.resume(); });
+            } else {
+                handle.resume();
+            }
+        }
+
+        Synapse::SynapseBus& bus;
+        ThreadPool* resumePool;
+
+        mutable std::mutex mutex;
+        std::unordered_map<int, Mailbox> mailboxes;
+        size_t pendingMessages = 0;
+    };
+
+} // namespace Coroutine
+} // namespace NeuroSync
+
+#endif // NEUROSYNC_COROUTINE_MESSAGE_RECEIVER_H
@@ -0,0 +1,260 @@
+#ifndef NEUROSYNC_COROUTINE_TASK_H
+#define NEUROSYNC_COROUTINE_TASK_H
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <type_traits>
+#include <mutex>
+#include <condition_variable>
+
+// Task.h
+// Співпрограмне завдання Task<T> для NeuroSync OS Sparky (C++20)
+// Coroutine task Task<T> for NeuroSync OS Sparky (C++20)
+// Сопрограммная задача Task<T> для NeuroSync OS Sparky (C++20)
+
+namespace NeuroSync {
+namespace Coroutine {
+
+    template<typename T = void>
+    class Task;
+
+    namespace Detail {
+
+        // Завершення завдання передає керування тому, хто його очікує (симетрична передача,
+        // тому ланцюжки co_await не ростуть на стеку)
+        // Task completion transfers control to its awaiter (symmetric transfer,
+        // so co_await chains do not grow the stack)
+        // Завершение задачи передает управление ожидающему (симметричная передача,
+        // поэтому цепочки co_await не растут на стеке)
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+                std::coroutine_handle<> continuation = handle.promise().continuation;
+                return continuation ? continuation : std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        // Спільна частина обіцянки: продовження та виняток
+        // Common promise part: continuation and exception
+        // Общая часть обещания: продолжение и исключение
+        struct PromiseBase {
+            std::coroutine_handle<> continuation;
+            std::exception_ptr exception;
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+            void unhandled_exception() noexcept { exception = std::current_exception(); }
+        };
+
+        template<typename T>
+        struct Promise : PromiseBase {
+            std::optional<T> value;
+
+            Task<T> get_return_object() noexcept;
+
+            template<typename U>
+            void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+
+            T result() {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+                return std::move(*value);
+            }
+        };
+
+        template<>
+        struct Promise<void> : PromiseBase {
+            Task<void> get_return_object() noexcept;
+
+            void return_void() const noexcept {}
+
+            void result() {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+        };
+
+        // Співпрограма без власника, що стартує одразу й звільняє свій кадр по завершенні
+        // (основа spawn та syncWait)
+        // An ownerless coroutine that starts immediately and frees its frame on completion
+        // (the basis of spawn and syncWait)
+        // Сопрограмма без владельца, которая стартует сразу и освобождает свой кадр по завершении
+        // (основа spawn и syncWait)
+        struct DetachedTask {
+            struct promise_type {
+                DetachedTask get_return_object() const noexcept { return {}; }
+                std::suspend_never initial_suspend() const noexcept { return {}; }
+                std::suspend_never final_suspend() const noexcept { return {}; }
+                void return_void() const noexcept {}
+                void unhandled_exception() const noexcept { std::terminate(); }
+            };
+        };
+
+        // Подія для блокуючого очікування з потоку, що не є співпрограмою
+        // Event for blocking waits from a non-coroutine thread
+        // Событие для блокирующего ожидания из потока, не являющегося сопрограммой
+        class SyncEvent {
+        public:
+            void set() {
+                // Сповіщення під м'ютексом: очікувач може знищити подію одразу після пробудження
+                // Notify under the mutex: the waiter may destroy the event as soon as it wakes
+                // Оповещение под мьютексом: ожидающий может уничтожить событие сразу после пробуждения
+                std::lock_guard<std::mutex> lock(mutex);
+                done = true;
+                condition.notify_all();
+            }
+
+            void wait() {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this]() { return done; });
+            }
+
+        private:
+            std::mutex mutex;
+            std::condition_variable condition;
+            bool done = false;
+        };
+
+    } // namespace Detail
+
+    // Ліниве співпрограмне завдання.
+    // Тіло починає виконуватися при першому co_await і виконується на потоці, що його відновив;
+    // призупинене завдання не займає робочий потік. Результат або виняток передаються очікувачу.
+    // Завдання володіє кадром співпрограми і знищує його в деструкторі.
+    // Lazy coroutine task.
+    // The body starts at the first co_await and runs on whichever thread resumed it;
+    // a suspended task does not occupy a worker thread. The result or exception goes to the awaiter.
+    // The task owns the coroutine frame and destroys it in its destructor.
+    // Ленивая сопрограммная задача.
+    // Тело начинает выполняться при первом co_await и выполняется на потоке, который его возобновил;
+    // приостановленная задача не занимает рабочий поток. Результат или исключение передаются ожидающему.
+    // Задача владеет кадром сопрограммы и уничтожает его в деструкторе.
+    template<typename T>
+    class Task {
+    public:
+        using promise_type = Detail::Promise<T>;
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        Task() noexcept : handle(nullptr) {}
+        explicit Task(handle_type handle) noexcept : handle(handle) {}
+
+        Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                if (handle) {
+                    handle.destroy();
+                }
+                handle = std::exchange(other.handle, nullptr);
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task() {
+            if (handle) {
+                handle.destroy();
+            }
+        }
+
+        // Чи завершено тіло завдання
+        // Whether the task body has finished
+        // Завершено ли тело задачи
+        bool isReady() const noexcept { return !handle || handle.done(); }
+
+        // Очікування: запуск тіла з поверненням до очікувача після завершення
+        // Awaiting: start the body and return to the awaiter when it finishes
+        // Ожидание: запуск тела с возвратом к ожидающему после завершения
+        auto operator co_await() & noexcept { return Awaiter{handle}; }
+        auto operator co_await() && noexcept { return Awaiter{handle}; }
+
+    private:
+        struct Awaiter {
+            handle_type handle;
+
+            bool await_ready() const noexcept { return !handle || handle.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+
+            T await_resume() { return handle.promise().result(); }
+        };
+
+        handle_type handle;
+    };
+
+    namespace Detail {
+
+        template<typename T>
+        Task<T> Promise<T>::get_return_object() noexcept {
+            return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+        }
+
+        inline Task<void> Promise<void>::get_return_object() noexcept {
+            return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+        }
+
+        template<typename T>
+        DetachedTask signalWhenDone(Task<T>& task, std::optional<T>& result, std::exception_ptr& error, SyncEvent& event) {
+            try {
+                result.emplace(co_await task);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            event.set();
+        }
+
+        inline DetachedTask signalWhenDone(Task<void>& task, std::exception_ptr& error, SyncEvent& event) {
+            try {
+                co_await task;
+            } catch (...) {
+                error = std::current_exception();
+            }
+            event.set();
+        }
+
+    } // namespace Detail
+
+    // Блокуюче очікування завдання з потоку, що не є співпрограмою (main, тести).
+    // Завдання виконується на поточному потоці до першого призупинення, далі - там, де його відновлять.
+    // Blocking wait for a task from a non-coroutine thread (main, tests).
+    // The task runs on the current thread until it first suspends, then wherever it is resumed.
+    // Блокирующее ожидание задачи из потока, не являющегося сопрограммой (main, тесты).
+    // Задача выполняется на текущем потоке до первой приостановки, далее - там, где ее возобновят.
+    template<typename T>
+    T syncWait(Task<T> task) {
+        Detail::SyncEvent event;
+        std::exception_ptr error;
+        if constexpr (std::is_void<T>::value) {
+            Detail::signalWhenDone(task, error, event);
+            event.wait();
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        } else {
+            std::optional<T> result;
+            Detail::signalWhenDone(task, result, error, event);
+            event.wait();
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return std::move(*result);
+        }
+    }
+
+} // namespace Coroutine
+} // namespace NeuroSync
+
+#endif // NEUROSYNC_COROUTINE_TASK_H
@@ -1,4 +1,5 @@
 #include "EventSystem.h"
+#include "../memory/Arena.h"
 #include <chrono>
 #include <algorithm>
 #include <iostream>
@@ -369,98 +370,65 @@ namespace Event {
     }
 
     void EventSystem::processEvents() {
-        while (running) {
-            std::unique_lock<std::mutex> lock(queueMutex);
-            
-            // Wait for events or stop signal
-            eventCondition.wait(lock, [this] { return !eventQueue.empty() || !running; });
-            
-            if (!running && eventQueue.empty()) {
-                break;
-            }
-            
-            // Process all available events
-            while (!eventQueue.empty()) {
-                Event event = eventQueue.front();
-                eventQueue.pop();
-                
-                lock.unlock(); // Unlock while processing to avoid deadlocks
-                
-                // Process the event
-                long long startTime = getCurrentTimeMillis();
-                
-                // Check if there are handlers for this event type
-                {
-                    std::lock_guard<std::mutex> handlersLock(handlersMutex);
-                    auto it = handlers.find(event.type);
-                    if (it != handlers.end()) {
-                        // Call all handlers for this event type
-                        for (const auto& handler : it->second) {
-                            try {
-                                handler(event);
-                            } catch (...) {
-                                // Handle exceptions in handlers gracefully
-                                std::cerr << "Exception in event handler for event type: " 
-                                          << static_cast<int>(event.type) << std::endl;
-                            }
-                        }
-                    }
-                }
-                
-                // Update statistics
-                long long processingTime = getCurrentTimeMillis() - startTime;
-                updateStatistics(event, true);
-                
-                lock.lock(); // Lock again for the next iteration
-            }
-        }
+        runEventLoop(eventQueue, queueMutex, eventCondition, "event handler");
     }
 
     void EventSystem::processAsyncEvents() {
+        runEventLoop(asyncEventQueue, asyncQueueMutex, asyncEventCondition, "async event handler");
+    }
+
+    void EventSystem::runEventLoop(std::queue<Event>& queue, std::mutex& mutex,
+                                   std::condition_variable& condition, const char* handlerKind) {
+        // The batch vector lives in this thread's arena and is freed with one reset() per batch
+        Memory::Arena arena(16 * 1024);
+        Memory::ArenaResource resource(arena);
+
         while (running) {
-            std::unique_lock<std::mutex> lock(asyncQueueMutex);
-            
-            // Wait for async events or stop signal
-            asyncEventCondition.wait(lock, [this] { return !asyncEventQueue.empty() || !running; });
-            
-            if (!running && asyncEventQueue.empty()) {
-                break;
-            }
-            
-            // Process all available async events
-            while (!asyncEventQueue.empty()) {
-                Event event = asyncEventQueue.front();
-                asyncEventQueue.pop();
-                
-                lock.unlock(); // Unlock while processing to avoid deadlocks
-                
-                // Process the async event
-                long long startTime = getCurrentTimeMillis();
-                
-                // Check if there are handlers for this event type
+            {
+                std::pmr::vector<Event> batch(&resource);
                 {
-                    std::lock_guard<std::mutex> handlersLock(handlersMutex);
-                    auto it = handlers.find(event.type);
-                    if (it != handlers.end()) {
-                        // Call all handlers for this event type
-                        for (const auto& handler : it->second) {
-                            try {
-                                handler(event);
-                            } catch (...) {
-                                // Handle exceptions in handlers gracefully
-                                std::cerr << "Exception in async event handler for event type: " 
-                                          << static_cast<int>(event.type) << std::endl;
+                    std::unique_lock<std::mutex> lock(mutex);
+
+                    // Wait for events or stop signal
+                    condition.wait(lock, [this, &queue] { return !queue.empty() || !running; });
+
+                    if (!running && queue.empty()) {
+                        break;
+                    }
+
+                    // Take all available events under one lock, moving rather than copying them
+                    batch.reserve(queue.size());
+                    while (!queue.empty()) {
+                        batch.push_back(std::move(queue.front()));
+                        queue.pop();
+                    }
+                }
+
+                // Process the batch without holding the queue lock to avoid deadlocks
+                for (const Event& event : batch) {
+                    // Check if there are handlers for this event type
+                    {
+                        std::lock_guard<std::mutex> handlersLock(handlersMutex);
+                        auto it = handlers.find(event.type);
+                        if (it != handlers.end()) {
+                            // Call all handlers for this event type
+                            for (const auto& handler : it->second) {
+                                try {
+                                    handler(event);
+                                } catch (...) {
+                                    // Handle exceptions in handlers gracefully
+                                    std::cerr << "Exception in " << handlerKind << " for event type: "
+                                              << static_cast<int>(event.type) << std::endl;
+                                }
                             }
                         }
                     }
+
+                    // Update statistics
+                    updateStatistics(event, true);
                 }
-                
-                // Update statistics
-                long long processingTime = getCurrentTimeMillis() - startTime;
-                updateStatistics(event, true);
-                
-                lock.lock(); // Lock again for the next iteration
             }
+            arena.reset();
         }
     }
 
@@ -248,6 +248,12 @@ namespace Event {
         // Внутренние методы
         void processEvents();
         void processAsyncEvents();
+        
+        // Цикл обробки черги: події забираються пакетом під одним блокуванням у вектор в арені потоку
+        // Queue processing loop: events are taken as a batch under one lock into a vector in the thread's arena
+        // Цикл обработки очереди: события забираются пакетом под одной блокировкой в вектор в арене потока
+        void runEventLoop(std::queue<Event>& queue, std::mutex& mutex,
+                          std::condition_variable& condition, const char* handlerKind);
         long long getCurrentTimeMillis() const;
         void updateStatistics(const Event& event, bool processed);
         bool isSubscribed(int neuronId, EventType type) const;
@@ -0,0 +1,81 @@
+/*
+ * advanced_scheduler_benchmark.cpp
+ * Пропускная способность AdvancedScheduler на маленьких задачах: пул потоков против потока на задачу
+ * AdvancedScheduler throughput on small tasks: thread pool versus a thread per task
+ * Пропускна здатність AdvancedScheduler на маленьких завданнях: пул потоків проти потоку на завдання
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../core/AdvancedScheduler.h"
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NeuroSync;
+using NeuroSync::Core::AdvancedScheduler;
+using NeuroSync::Core::SchedulingAlgorithmType;
+
+static std::atomic<size_t> executedTasks(0);
+
+// Маленькое тело задачи
+// Small task body
+// Маленьке тіло завдання
+static void smallTask() {
+    executedTasks.fetch_add(1, std::memory_order_relaxed);
+}
+
+int main() {
+    std::cout << "AdvancedScheduler Task Throughput Benchmark\n";
+    std::cout << "===========================================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = 100000;   // Задач на прогон / Tasks per run / Завдань на прогін
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    // Прежняя модель выполнения: отдельный std::thread на каждую задачу
+    // The previous execution model: a separate std::thread per task
+    // Попередня модель виконання: окремий std::thread на кожне завдання
+    gBenchmarkSuite->registerBenchmark("Tasks[thread-per-task]", BenchmarkType::CPU, [](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i) {
+            std::thread taskThread(smallTask);
+            taskThread.join();
+        }
+    });
+
+    // AdvancedScheduler на пуле с разным ограничением одновременных задач
+    // AdvancedScheduler on a pool with different concurrent task limits
+    // AdvancedScheduler на пулі з різним обмеженням одночасних завдань
+    const size_t limits[] = {1, 2, 4, 8};
+    for (size_t limit : limits) {
+        gBenchmarkSuite->registerBenchmark("Tasks[AdvancedScheduler pool x" + std::to_string(limit) + "]",
+                                           BenchmarkType::CPU, [limit](size_t iterations) {
+            AdvancedScheduler scheduler;
+            scheduler.initialize(SchedulingAlgorithmType::PRIORITY_BASED, limit);
+            scheduler.start();
+            for (size_t i = 0; i < iterations; ++i) {
+                scheduler.addTask("small", Core::Utils::TaskType::CUSTOM, static_cast<int>(i % 8), 1, smallTask);
+            }
+            scheduler.waitForAllTasks();
+            scheduler.stop();
+        });
+    }
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускная способность отчета = задач в секунду
+    // Report throughput = tasks per second
+    // Пропускна здатність звіту = завдань за секунду
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+    std::cout << "Executed tasks: " << executedTasks.load() << "\n";
+
+    gBenchmarkSuite->exportResults("csv", "./advanced_scheduler_benchmark.csv");
+    return 0;
+}
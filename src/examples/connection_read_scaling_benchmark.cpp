@@ -0,0 +1,142 @@
+/*
+ * connection_read_scaling_benchmark.cpp
+ * Масштабування читань ваг з'єднань за кількістю потоків при активному письменнику
+ * Connection weight read scaling by thread count with an active writer
+ * Масштабирование чтений весов соединений по количеству потоков при активном писателе
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../synapse/utils/WeightedConnectionManager.h"
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NeuroSync;
+using NeuroSync::Synapse::Utils::ConnectionConcurrencyMode;
+using NeuroSync::Synapse::Utils::WeightedConnection;
+using NeuroSync::Synapse::Utils::WeightedConnectionManager;
+
+// Граф: NEURON_COUNT нейронів по FAN_OUT вихідних з'єднань
+// Graph: NEURON_COUNT neurons with FAN_OUT outgoing connections each
+// Граф: NEURON_COUNT нейронов по FAN_OUT исходящих соединений
+static const int NEURON_COUNT = 4096;
+static const int FAN_OUT = 32;
+
+static std::shared_ptr<WeightedConnectionManager> buildGraph(ConnectionConcurrencyMode mode) {
+    auto manager = std::make_shared<WeightedConnectionManager>();
+    manager->initialize(mode);
+    for (int source = 0; source < NEURON_COUNT; ++source) {
+        for (int k = 0; k < FAN_OUT; ++k) {
+            manager->createConnection(source, (source * 31 + k * 127) % NEURON_COUNT, 0.5);
+        }
+    }
+    return manager;
+}
+
+// iterations читань (пошук ваги та обхід вихідних з'єднань), розподілених між readerCount
+// потоками, поки окремий потік безперервно оновлює ваги; з creates він ще й створює та
+// видаляє додаткове з'єднання випадкового джерела між оновленнями
+// iterations reads (weight lookup and outgoing traversal) split across readerCount
+// threads while a separate thread keeps updating weights; with creates it also creates and
+// removes an extra connection of a random source between the updates
+// iterations чтений (поиск веса и обход исходящих соединений), распределенных между readerCount
+// потоками, пока отдельный поток непрерывно обновляет веса; с creates он еще и создает и
+// удаляет дополнительное соединение случайного источника между обновлениями
+static double runReaders(WeightedConnectionManager& manager, size_t readerCount, size_t iterations, bool creates) {
+    std::atomic<bool> readersDone(false);
+    std::thread writer([&manager, &readersDone, creates]() {
+        unsigned int state = 99;
+        while (!readersDone.load(std::memory_order_relaxed)) {
+            state = state * 1103515245u + 12345u;
+            int source = static_cast<int>((state >> 8) % NEURON_COUNT);
+            int k = static_cast<int>((state >> 4) % FAN_OUT);
+            manager.updateConnectionWeight(source, (source * 31 + k * 127) % NEURON_COUNT, (state % 100) / 100.0);
+            if (creates) {
+                manager.createConnection(source, NEURON_COUNT, 0.5);
+                manager.removeConnection(source, NEURON_COUNT);
+            }
+        }
+    });
+
+    std::vector<double> sums(readerCount, 0.0);
+    std::vector<std::thread> readers;
+    for (size_t r = 0; r < readerCount; ++r) {
+        readers.emplace_back([&manager, &sums, r, readerCount, iterations]() {
+            unsigned int state = static_cast<unsigned int>(r + 1);
+            double sum = 0.0;
+            for (size_t i = r; i < iterations; i += readerCount) {
+                state = state * 1103515245u + 12345u;
+                int source = static_cast<int>((state >> 8) % NEURON_COUNT);
+                if (i % 16 == 0) {
+                    manager.forEachOutgoingConnection(source, [&sum](const WeightedConnection& connection) {
+                        sum += connection.weight;
+                    });
+                } else {
+                    int k = static_cast<int>((state >> 4) % FAN_OUT);
+                    sum += manager.getConnectionWeight(source, (source * 31 + k * 127) % NEURON_COUNT);
+                }
+            }
+            sums[r] = sum;
+        });
+    }
+
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    readersDone = true;
+    writer.join();
+
+    double total = 0.0;
+    for (double sum : sums) {
+        total += sum;
+    }
+    return total;
+}
+
+int main() {
+    std::cout << "WeightedConnectionManager Read Scaling Benchmark ("
+              << NEURON_COUNT * FAN_OUT << " edges, one active writer)\n";
+    std::cout << "==============================================================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = 400000;   // Читань на прогін / Reads per run / Чтений на прогон
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    auto lockedGraph = buildGraph(ConnectionConcurrencyMode::LOCKED);
+    auto readOptimizedGraph = buildGraph(ConnectionConcurrencyMode::READ_OPTIMIZED);
+    volatile double sink = 0.0;
+
+    const size_t readerCounts[] = {1, 2, 4, 8};
+    for (bool creates : {false, true}) {
+        for (size_t readerCount : readerCounts) {
+            std::string suffix = " x" + std::to_string(readerCount) + " readers" + (creates ? " with creates" : "");
+            gBenchmarkSuite->registerBenchmark("Connections[locked]" + suffix, BenchmarkType::SYNAPSE,
+                [lockedGraph, readerCount, creates, &sink](size_t iterations) {
+                    sink = sink + runReaders(*lockedGraph, readerCount, iterations, creates);
+                });
+            gBenchmarkSuite->registerBenchmark("Connections[read-optimized]" + suffix, BenchmarkType::SYNAPSE,
+                [readOptimizedGraph, readerCount, creates, &sink](size_t iterations) {
+                    sink = sink + runReaders(*readOptimizedGraph, readerCount, iterations, creates);
+                });
+        }
+    }
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускна здатність звіту = сумарних читань за секунду
+    // Report throughput = total reads per second
+    // Пропускная способность отчета = суммарных чтений в секунду
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    gBenchmarkSuite->exportResults("csv", "./connection_read_scaling_benchmark.csv");
+    return 0;
+}
@@ -0,0 +1,269 @@
+/*
+ * connection_store_benchmark.cpp
+ * Порівняння сховища з'єднань з цілочисельними ключами та CSR зі старими рядковими картами
+ * Integer-keyed CSR connection store versus the old string-keyed maps
+ * Сравнение хранилища соединений с целочисленными ключами и CSR со старыми строковыми картами
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../synapse/utils/WeightedConnectionManager.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace NeuroSync;
+using NeuroSync::Synapse::Utils::ConnectionSlice;
+using NeuroSync::Synapse::Utils::WeightedConnection;
+using NeuroSync::Synapse::Utils::WeightedConnectionManager;
+
+// Граф: NEURON_COUNT нейронів по FAN_OUT вихідних з'єднань = мільйон ребер
+// Graph: NEURON_COUNT neurons with FAN_OUT outgoing connections each = one million edges
+// Граф: NEURON_COUNT нейронов по FAN_OUT исходящих соединений = миллион ребер
+static const int NEURON_COUNT = 10000;
+static const int FAN_OUT = 100;
+static const size_t EDGE_COUNT = static_cast<size_t>(NEURON_COUNT) * FAN_OUT;
+
+// Ціль k-го з'єднання нейрона (детерміновано розкидана по графу)
+// Target of a neuron's k-th connection (deterministically spread over the graph)
+// Цель k-го соединения нейрона (детерминированно разбросана по графу)
+static int edgeTarget(int source, int k) {
+    return static_cast<int>((static_cast<long long>(source) * 7919 + static_cast<long long>(k) * 104729) % NEURON_COUNT);
+}
+
+// Попередня схема WeightedConnectionManager: рядкові ключі "source_target" у std::map
+// та індекси вхідних/вихідних з'єднань як std::map<int, std::vector<std::string>>
+// The previous WeightedConnectionManager layout: "source_target" string keys in std::map
+// and incoming/outgoing indices as std::map<int, std::vector<std::string>>
+// Прежняя схема WeightedConnectionManager: строковые ключи "source_target" в std::map
+// и индексы входящих/исходящих соединений как std::map<int, std::vector<std::string>>
+class StringKeyedConnections {
+public:
+    bool createConnection(int source, int target, double weight) {
+        std::string key = makeKey(source, target);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (connections.find(key) != connections.end()) {
+            return false;
+        }
+        WeightedConnection connection{source, target, weight, 0, 0, 0, true};
+        connections[key] = connection;
+        incoming[target].push_back(key);
+        outgoing[source].push_back(key);
+        return true;
+    }
+
+    bool removeConnection(int source, int target) {
+        std::string key = makeKey(source, target);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (connections.erase(key) == 0) {
+            return false;
+        }
+        std::vector<std::string>& incomingKeys = incoming[target];
+        incomingKeys.erase(std::find(incomingKeys.begin(), incomingKeys.end(), key));
+        std::vector<std::string>& outgoingKeys = outgoing[source];
+        outgoingKeys.erase(std::find(outgoingKeys.begin(), outgoingKeys.end(), key));
+        return true;
+    }
+
+    double getConnectionWeight(int source, int target) const {
+        std::string key = makeKey(source, target);
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = connections.find(key);
+        return it == connections.end() ? 0.0 : it->second.weight;
+    }
+
+    std::vector<WeightedConnection> getOutgoingConnections(int neuronId) const {
+        std::vector<WeightedConnection> result;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto outgoingIt = outgoing.find(neuronId);
+        if (outgoingIt != outgoing.end()) {
+            for (const std::string& key : outgoingIt->second) {
+                auto connIt = connections.find(key);
+                if (connIt != connections.end()) {
+                    result.push_back(connIt->second);
+                }
+            }
+        }
+        return result;
+    }
+
+private:
+    static std::string makeKey(int source, int target) {
+        std::ostringstream keyStream;
+        keyStream << source << "_" << target;
+        return keyStream.str();
+    }
+
+    std::map<std::string, WeightedConnection> connections;
+    std::map<int, std::vector<std::string>> incoming;
+    std::map<int, std::vector<std::string>> outgoing;
+    mutable std::mutex mutex;
+};
+
+// Заповнення iterations з'єднань у новому екземплярі
+// Insert iterations connections into a fresh instance
+// Вставка iterations соединений в новый экземпляр
+template<typename Connections>
+static void insertEdges(Connections& connections, size_t iterations) {
+    size_t inserted = 0;
+    for (int source = 0; inserted < iterations; source = (source + 1) % NEURON_COUNT) {
+        for (int k = 0; k < FAN_OUT && inserted < iterations; ++k, ++inserted) {
+            connections.createConnection(source, edgeTarget(source, k), ((source + k) % 1000) / 1000.0);
+        }
+    }
+}
+
+// Випадкові пошуки існуючих з'єднань
+// Random lookups of existing connections
+// Случайные поиски существующих соединений
+template<typename Connections>
+static double lookupEdges(const Connections& connections, size_t iterations) {
+    double sum = 0.0;
+    unsigned int state = 12345;
+    for (size_t i = 0; i < iterations; ++i) {
+        state = state * 1103515245u + 12345u;
+        int source = static_cast<int>((state >> 8) % NEURON_COUNT);
+        int k = static_cast<int>((state >> 4) % FAN_OUT);
+        sum += connections.getConnectionWeight(source, edgeTarget(source, k));
+    }
+    return sum;
+}
+
+int main() {
+    std::cout << "WeightedConnectionManager Store Benchmark (" << EDGE_COUNT << " edges)\n";
+    std::cout << "==============================================================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = EDGE_COUNT;   // Операцій на прогін / Operations per run / Операций на прогон
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    // Заздалегідь побудовані графи для пошуку та обходу
+    // Prebuilt graphs for lookup and traversal
+    // Заранее построенные графы для поиска и обхода
+    auto legacyGraph = std::make_shared<StringKeyedConnections>();
+    insertEdges(*legacyGraph, EDGE_COUNT);
+    auto storeGraph = std::make_shared<WeightedConnectionManager>();
+    storeGraph->initialize();
+    insertEdges(*storeGraph, EDGE_COUNT);
+    
+    volatile double sink = 0.0;
+
+    gBenchmarkSuite->registerBenchmark("Connections[string-map] insert", BenchmarkType::SYNAPSE, [](size_t iterations) {
+        StringKeyedConnections connections;
+        insertEdges(connections, iterations);
+    });
+    gBenchmarkSuite->registerBenchmark("Connections[csr-store] insert", BenchmarkType::SYNAPSE, [](size_t iterations) {
+        WeightedConnectionManager connections;
+        connections.initialize();
+        insertEdges(connections, iterations);
+    });
+
+    gBenchmarkSuite->registerBenchmark("Connections[string-map] lookup", BenchmarkType::SYNAPSE, [legacyGraph, &sink](size_t iterations) {
+        sink = sink + lookupEdges(*legacyGraph, iterations);
+    });
+    gBenchmarkSuite->registerBenchmark("Connections[csr-store] lookup", BenchmarkType::SYNAPSE, [storeGraph, &sink](size_t iterations) {
+        sink = sink + lookupEdges(*storeGraph, iterations);
+    });
+
+    // Обхід вихідних з'єднань: iterations = кількість відвіданих ребер
+    // Outgoing fan-out traversal: iterations = number of visited edges
+    // Обход исходящих соединений: iterations = количество посещенных ребер
+    gBenchmarkSuite->registerBenchmark("Connections[string-map] fan-out", BenchmarkType::SYNAPSE, [legacyGraph, &sink](size_t iterations) {
+        double sum = 0.0;
+        for (size_t visited = 0, neuron = 0; visited < iterations; neuron = (neuron + 1) % NEURON_COUNT) {
+            for (const WeightedConnection& connection : legacyGraph->getOutgoingConnections(static_cast<int>(neuron))) {
+                sum += connection.weight;
+                visited++;
+            }
+        }
+        sink = sink + sum;
+    });
+    gBenchmarkSuite->registerBenchmark("Connections[csr-store] fan-out", BenchmarkType::SYNAPSE, [storeGraph, &sink](size_t iterations) {
+        double sum = 0.0;
+        for (size_t visited = 0, neuron = 0; visited < iterations; neuron = (neuron + 1) % NEURON_COUNT) {
+            for (const WeightedConnection& connection : storeGraph->getOutgoingConnectionSlice(static_cast<int>(neuron))) {
+                sum += connection.weight;
+                visited++;
+            }
+        }
+        sink = sink + sum;
+    });
+
+    // Вставка, обхід вихідних з'єднань джерела та видалення вставленого, упереміш:
+    // iterations = кількість відвіданих ребер, як і в fan-out
+    // Insert, fan-out over the source's outgoing connections and removal of the inserted edge, interleaved:
+    // iterations = number of visited edges, as in fan-out
+    // Вставка, обход исходящих соединений источника и удаление вставленного, вперемешку:
+    // iterations = количество посещенных ребер, как и в fan-out
+    gBenchmarkSuite->registerBenchmark("Connections[string-map] insert+fan-out", BenchmarkType::SYNAPSE, [legacyGraph, &sink](size_t iterations) {
+        double sum = 0.0;
+        for (size_t visited = 0, step = 0; visited < iterations; ++step) {
+            int source = static_cast<int>(step % NEURON_COUNT);
+            legacyGraph->createConnection(source, NEURON_COUNT, 1.0);
+            for (const WeightedConnection& connection : legacyGraph->getOutgoingConnections(source)) {
+                sum += connection.weight;
+                visited++;
+            }
+            legacyGraph->removeConnection(source, NEURON_COUNT);
+        }
+        sink = sink + sum;
+    });
+    gBenchmarkSuite->registerBenchmark("Connections[csr-store] insert+fan-out", BenchmarkType::SYNAPSE, [storeGraph, &sink](size_t iterations) {
+        double sum = 0.0;
+        for (size_t visited = 0, step = 0; visited < iterations; ++step) {
+            int source = static_cast<int>(step % NEURON_COUNT);
+            storeGraph->createConnection(source, NEURON_COUNT, 1.0);
+            for (const WeightedConnection& connection : storeGraph->getOutgoingConnectionSlice(source)) {
+                sum += connection.weight;
+                visited++;
+            }
+            storeGraph->removeConnection(source, NEURON_COUNT);
+        }
+        sink = sink + sum;
+    });
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускна здатність звіту = операцій за секунду
+    // Report throughput = operations per second
+    // Пропускная способность отчета = операций в секунду
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    // Опитування панелі моніторингу: статистика та top-10 проти повного сортування
+    // Monitoring dashboard poll: statistics and top-10 versus a full sort
+    // Опрос панели мониторинга: статистика и top-10 против полной сортировки
+    auto pollTime = [](size_t polls, const std::function<void()>& poll) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < polls; ++i) {
+            poll();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start).count();
+        return static_cast<double>(elapsed) / polls / 1000.0;
+    };
+    std::cout << "Dashboard poll (us/poll):\n";
+    std::cout << "  getStatistics:                 " << pollTime(10000, [storeGraph, &sink]() {
+        sink = sink + storeGraph->getStatistics().averageWeight;
+    }) << "\n";
+    std::cout << "  getTopConnectionsByWeight(10): " << pollTime(10000, [storeGraph, &sink]() {
+        sink = sink + storeGraph->getTopConnectionsByWeight(10).front().weight;
+    }) << "\n";
+    std::cout << "  getConnectionsSortedByWeight:  " << pollTime(3, [storeGraph, &sink]() {
+        sink = sink + storeGraph->getConnectionsSortedByWeight(true).front().weight;
+    }) << "\n\n";
+
+    gBenchmarkSuite->exportResults("csv", "./connection_store_benchmark.csv");
+    return 0;
+}
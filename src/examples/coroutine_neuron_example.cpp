@@ -0,0 +1,98 @@
+#include "../coroutine/Task.h"
+#include "../coroutine/Awaitables.h"
+#include "../coroutine/MessageReceiver.h"
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+// Приклад співпрограмних нейронів: кілька потоків ведуть тисячі одночасних розмов через SynapseBus
+// Coroutine neuron example: a few threads drive thousands of concurrent conversations over SynapseBus
+// Пример сопрограммных нейронов: несколько потоков ведут тысячи одновременных разговоров через SynapseBus
+
+using namespace NeuroSync;
+using namespace NeuroSync::Coroutine;
+
+static const int CONVERSATIONS = 5000;
+static const int ROUNDS = 20;
+
+static std::atomic<int> finishedConversations(0);
+
+// Надсилання сигналу; коли черга шини повна, нейрон поступається потоком пулу і пробує знову
+// Send a signal; when the bus queue is full the neuron yields its pool thread and retries
+// Отправка сигнала; когда очередь шины полна, нейрон уступает поток пула и пробует снова
+Coroutine::Task<void> send(Synapse::SynapseBus& bus, ThreadPool& pool, int self, int peer, int value) {
+    while (!bus.sendMessage(self, peer, &value, sizeof(value))) {
+        co_await schedule(pool);
+    }
+}
+
+// Нейрон-ініціатор: надсилає сигнал, чекає відповіді, після кожного обміну засинає на таймері
+// Initiator neuron: sends a signal, awaits the reply and sleeps on a timer after every exchange
+// Нейрон-инициатор: отправляет сигнал, ждет ответа, после каждого обмена засыпает на таймере
+Coroutine::Task<void> initiator(Synapse::SynapseBus& bus, MessageReceiver& receiver, ::Core::Scheduler& timers,
+                                ThreadPool& pool, int self, int peer) {
+    for (int round = 0; round < ROUNDS; ++round) {
+        co_await send(bus, pool, self, peer, round);
+        MessageReceiver::Message reply = co_await receiver.receive(self);
+        (void)reply;
+        co_await sleepFor(timers, std::chrono::milliseconds(1));
+        co_await schedule(pool);
+    }
+    finishedConversations++;
+}
+
+// Нейрон-відповідач: збільшує отриманий сигнал і повертає його
+// Responder neuron: increments the received signal and sends it back
+// Нейрон-ответчик: увеличивает полученный сигнал и возвращает его
+Coroutine::Task<void> responder(Synapse::SynapseBus& bus, MessageReceiver& receiver, ThreadPool& pool, int self, int peer) {
+    for (int round = 0; round < ROUNDS; ++round) {
+        MessageReceiver::Message request = co_await receiver.receive(self);
+        int value;
+        std::memcpy(&value, request.payload.data(), sizeof(value));
+        co_await send(bus, pool, self, peer, value + 1);
+    }
+}
+
+int main() {
+    std::cout << "=== Coroutine Neuron Example ===" << std::endl;
+
+    // Два потоки пулу, один потік шини та один робітник таймерів на 10000 нейронів
+    // Two pool threads, one bus thread and one timer worker for 10000 neurons
+    // Два потока пула, один поток шины и один рабочий таймеров на 10000 нейронов
+    ThreadPool pool(2);
+    ::Core::Scheduler timers;
+    timers.start();
+
+    Synapse::SynapseBus bus;
+    if (!bus.initialize()) {
+        std::cerr << "Failed to initialize synapse bus" << std::endl;
+        return 1;
+    }
+
+    {
+        MessageReceiver receiver(bus, &pool);
+        bus.start();
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < CONVERSATIONS; ++i) {
+            spawn(pool, responder(bus, receiver, pool, 2 * i + 1, 2 * i));
+            spawn(pool, initiator(bus, receiver, timers, pool, 2 * i, 2 * i + 1));
+        }
+        while (finishedConversations.load() < CONVERSATIONS) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << 2 * CONVERSATIONS << " neurons, " << CONVERSATIONS << " conversations of " << ROUNDS
+                  << " exchanges with a 1 ms timer each" << std::endl;
+        std::cout << "Finished in " << seconds << " s ("
+                  << 2.0 * CONVERSATIONS * ROUNDS / seconds << " messages/s)" << std::endl;
+
+        bus.stop();
+    }
+
+    timers.stop();
+    return 0;
+}
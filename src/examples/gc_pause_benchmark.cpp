@@ -0,0 +1,122 @@
+/*
+ * gc_pause_benchmark.cpp
+ * Паузи збору сміття: повний цикл за один квант проти квантів з бюджетом
+ * Garbage collection pauses: a whole cycle in one slice versus budgeted slices
+ * Паузы сборки мусора: полный цикл за один квант против квантов с бюджетом
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../memory/GarbageCollector.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace NeuroSync;
+using NeuroSync::Memory::GarbageCollector;
+using NeuroSync::Memory::GCPauseStatistics;
+
+static const size_t liveObjects = 200000;
+static const size_t garbagePerRound = 20000;
+static const size_t fanOut = 4;
+
+// Живе дерево з одним коренем; кожен прогін додає відчеплений ланцюжок сміття і збирає його
+// A live tree with one root; every round adds a detached chain of garbage and collects it
+// Живое дерево с одним корнем; каждый прогон добавляет отцепленную цепочку мусора и собирает ее
+struct CollectorHeap {
+    GarbageCollector gc;
+    void* root;
+
+    explicit CollectorHeap(std::chrono::microseconds budget) {
+        gc.setPauseBudget(budget);
+        std::vector<void*> nodes;
+        nodes.reserve(liveObjects);
+        root = registerNode();
+        nodes.push_back(root);
+        for (size_t i = 1; i < liveObjects; ++i) {
+            void* node = registerNode();
+            gc.addObjectReference(nodes[(i - 1) / fanOut], node);
+            gc.removeReference(node);
+            nodes.push_back(node);
+        }
+    }
+
+    void* registerNode() {
+        void* node = malloc(32);
+        gc.registerObject(node, 32);
+        return node;
+    }
+
+    void round() {
+        void* previous = nullptr;
+        for (size_t i = 0; i < garbagePerRound; ++i) {
+            void* node = registerNode();
+            if (previous) {
+                gc.addObjectReference(previous, node);
+            }
+            gc.removeReference(node);
+            previous = node;
+        }
+        gc.collect();
+    }
+};
+
+int main() {
+    std::cout << "GC Pause Benchmark\n";
+    std::cout << "==================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = 10;                  // Прогонів / Rounds / Прогонов
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    // Бюджет 1 година - фактично без обмеження: кожен цикл іде одним квантом, як до інкрементального збору
+    // A budget of 1 hour is effectively unbounded: every cycle runs as one slice, as before incremental collection
+    // Бюджет 1 час - фактически без ограничения: каждый цикл идет одним квантом, как до инкрементальной сборки
+    const std::pair<std::string, std::chrono::microseconds> budgets[] = {
+        {"unbounded", std::chrono::hours(1)},
+        {"1000us", std::chrono::microseconds(1000)},
+        {"100us", std::chrono::microseconds(100)},
+    };
+    std::map<std::string, GCPauseStatistics> pauses;
+    for (const auto& budget : budgets) {
+        std::string label = budget.first;
+        std::chrono::microseconds limit = budget.second;
+        gBenchmarkSuite->registerBenchmark("Collect[budget " + label + "]", BenchmarkType::MEMORY,
+                                           [label, limit, &pauses](size_t iterations) {
+            CollectorHeap heap(limit);
+            for (size_t i = 0; i < iterations; ++i) {
+                heap.round();
+            }
+            pauses[label] = heap.gc.getPauseStatistics();
+        });
+    }
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускна здатність звіту = циклів за секунду (20000 нових об'єктів сміття у кожному)
+    // Report throughput = cycles per second (20000 new garbage objects in each)
+    // Пропускная способность отчета = циклов в секунду (20000 новых объектов мусора в каждом)
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    std::cout << "Collector pauses (us), " << liveObjects << " live objects\n";
+    for (const auto& budget : budgets) {
+        const GCPauseStatistics& statistics = pauses[budget.first];
+        std::cout << std::setw(10) << budget.first
+                  << "  slices " << std::setw(6) << statistics.slices
+                  << "  p50 " << std::setw(9) << statistics.p50Nanos / 1000
+                  << "  p99 " << std::setw(9) << statistics.p99Nanos / 1000
+                  << "  max " << std::setw(9) << statistics.maxNanos / 1000 << "\n";
+    }
+
+    gBenchmarkSuite->exportResults("csv", "./gc_pause_benchmark.csv");
+    return 0;
+}
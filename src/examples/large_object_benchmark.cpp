@@ -0,0 +1,94 @@
+/*
+ * large_object_benchmark.cpp
+ * Великі об'єкти MemoryCore: виділення з першим зверненням, звільнення та пам'ять, що лишається за процесом
+ * MemoryCore large objects: allocation with first touch, release and the memory the process keeps
+ * Большие объекты MemoryCore: выделение с первым обращением, освобождение и память, остающаяся за процессом
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../memory/MemoryCore.h"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace NeuroSync;
+using NeuroSync::Memory::MemoryCore;
+
+// Резидентна пам'ять процесу в KB (Linux)
+// Resident memory of the process in KB (Linux)
+// Резидентная память процесса в KB (Linux)
+static long residentKb() {
+    std::ifstream statm("/proc/self/statm");
+    long pages = 0;
+    long resident = 0;
+    statm >> pages >> resident;
+    return resident * 4;
+}
+
+int main() {
+    std::cout << "Large Object Benchmark\n";
+    std::cout << "======================\n\n";
+
+    // Запуск: час створення MemoryCore і першого виділення, резидентна пам'ять після них
+    // Startup: time to create MemoryCore and to make the first allocation, resident memory after them
+    // Запуск: время создания MemoryCore и первого выделения, резидентная память после них
+    long residentBefore = residentKb();
+    auto start = std::chrono::steady_clock::now();
+    MemoryCore memoryCore;
+    auto created = std::chrono::steady_clock::now();
+    void* first = memoryCore.allocate(64 * 1024);
+    auto allocated = std::chrono::steady_clock::now();
+    std::cout << "Startup: create " << std::chrono::duration<double, std::micro>(created - start).count() << " us"
+              << ", first large allocation " << std::chrono::duration<double, std::micro>(allocated - created).count() << " us"
+              << ", resident +" << residentKb() - residentBefore << " KB\n\n";
+    memoryCore.deallocate(first);
+
+    BenchmarkConfig config;
+    config.defaultIterations = 20;                  // Прогонів / Rounds / Прогонов
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    // Кожен прогін виділяє 32 MB об'єктами заданого розміру, записує їх повністю і звільняє
+    // Every round allocates 32 MB in objects of the given size, writes them fully and frees them
+    // Каждый прогон выделяет 32 MB объектами заданного размера, записывает их полностью и освобождает
+    const size_t roundBytes = 32 * 1024 * 1024;
+    const size_t objectSizes[] = {64 * 1024, 1024 * 1024, 16 * 1024 * 1024};
+    for (size_t objectSize : objectSizes) {
+        std::string name = "AllocTouchFree[" + std::to_string(objectSize / 1024) + " KB]";
+        gBenchmarkSuite->registerBenchmark(name, BenchmarkType::MEMORY, [&memoryCore, objectSize, roundBytes](size_t iterations) {
+            std::vector<void*> objects(roundBytes / objectSize);
+            for (size_t i = 0; i < iterations; ++i) {
+                for (auto& object : objects) {
+                    object = memoryCore.allocate(objectSize);
+                    memset(object, 1, objectSize);
+                }
+                for (void* object : objects) {
+                    memoryCore.deallocate(object);
+                }
+            }
+        });
+    }
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускна здатність звіту = прогонів за секунду (32 MB у кожному)
+    // Report throughput = rounds per second (32 MB each)
+    // Пропускная способность отчета = прогонов в секунду (32 MB в каждом)
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    const char* modes[] = {"none", "transparent", "explicit"};
+    std::cout << "Huge pages: " << modes[static_cast<int>(memoryCore.getLargeObjectHugePageMode())]
+              << ", returned to the system " << memoryCore.getLargeObjectDecommittedBytes() / (1024 * 1024) << " MB"
+              << ", resident after all frees +" << residentKb() - residentBefore << " KB\n";
+
+    gBenchmarkSuite->exportResults("csv", "./large_object_benchmark.csv");
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ * memory_allocator_benchmark.cpp
+ * Порівняння режимів MemoryCore (POOLS, SLAB) та glibc malloc з 1-32 потоками
+ * Comparison of MemoryCore modes (POOLS, SLAB) and glibc malloc with 1-32 threads
+ * Сравнение режимов MemoryCore (POOLS, SLAB) и glibc malloc с 1-32 потоками
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../memory/MemoryCore.h"
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NeuroSync;
+using NeuroSync::Memory::MemoryCore;
+
+static const size_t operationsPerThread = 20000;
+static const size_t liveObjects = 64;
+
+// Розподільник для одного прогону: MemoryCore у вибраному режимі або malloc/free
+// Allocator of one run: MemoryCore in the chosen mode or malloc/free
+// Распределитель одного прогона: MemoryCore в выбранном режиме или malloc/free
+struct AllocatorUnderTest {
+    MemoryCore* core;
+
+    void* allocate(size_t size) { return core ? core->allocate(size) : malloc(size); }
+    void deallocate(void* ptr) {
+        if (core) {
+            core->deallocate(ptr);
+        } else {
+            free(ptr);
+        }
+    }
+};
+
+// Один прогін: кожен потік тримає liveObjects об'єктів (16-4096 байт) і по черзі замінює їх
+// One run: every thread keeps liveObjects objects (16-4096 bytes) and replaces them in turn
+// Один прогон: каждый поток держит liveObjects объектов (16-4096 байт) и по очереди заменяет их
+static void churnRound(AllocatorUnderTest allocator, size_t threadCount) {
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([allocator, t]() mutable {
+            void* objects[liveObjects] = {};
+            uint32_t state = static_cast<uint32_t>(t * 2654435761u + 1);
+            for (size_t i = 0; i < operationsPerThread; ++i) {
+                state = state * 1664525u + 1013904223u;
+                size_t slot = (state >> 8) % liveObjects;
+                size_t size = (state >> 20) % 8 == 0 ? 256 + (state >> 4) % 3841 : 16 + (state >> 4) % 241;
+                if (objects[slot]) {
+                    allocator.deallocate(objects[slot]);
+                }
+                objects[slot] = allocator.allocate(size);
+                static_cast<char*>(objects[slot])[0] = static_cast<char>(i);
+            }
+            for (void* ptr : objects) {
+                if (ptr) {
+                    allocator.deallocate(ptr);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+int main() {
+    std::cout << "Memory Allocator Benchmark\n";
+    std::cout << "==========================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = 5;                   // Прогонів / Rounds / Прогонов
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    const size_t threadCounts[] = {1, 2, 4, 8, 16, 32};
+    const char* modes[] = {"POOLS", "SLAB", "malloc"};
+    for (size_t threads : threadCounts) {
+        for (size_t mode = 0; mode < 3; ++mode) {
+            std::string name = std::string("Churn[") + modes[mode] + " / threads x" + std::to_string(threads) + "]";
+            gBenchmarkSuite->registerBenchmark(name, BenchmarkType::MEMORY, [threads, mode](size_t iterations) {
+                std::unique_ptr<MemoryCore> core;
+                if (mode < 2) {
+                    core.reset(new MemoryCore(mode == 0 ? MemoryCore::AllocatorMode::POOLS : MemoryCore::AllocatorMode::SLAB));
+                }
+                AllocatorUnderTest allocator = {core.get()};
+                for (size_t i = 0; i < iterations; ++i) {
+                    churnRound(allocator, threads);
+                }
+            });
+        }
+    }
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускна здатність звіту = прогонів за секунду (threads x 20000 замін у кожному)
+    // Report throughput = rounds per second (threads x 20000 replacements each)
+    // Пропускная способность отчета = прогонов в секунду (threads x 20000 замен в каждом)
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    gBenchmarkSuite->exportResults("csv", "./memory_allocator_benchmark.csv");
+    return 0;
+}
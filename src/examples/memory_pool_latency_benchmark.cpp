@@ -0,0 +1,117 @@
+/*
+ * memory_pool_latency_benchmark.cpp
+ * Затримка виділення/звільнення MemoryPool при зміні об'єктів середнього розміру
+ * MemoryPool allocate/free latency under medium-object churn
+ * Задержка выделения/освобождения MemoryPool при смене объектов среднего размера
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../memory/MemoryPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace NeuroSync;
+using NeuroSync::Memory::MemoryPool;
+
+static const size_t replacementsPerRound = 20000;
+
+// Робочий набір: liveBlocks блоків по 256-4096 байт, кожна заміна звільняє випадковий блок і виділяє новий
+// Working set: liveBlocks blocks of 256-4096 bytes, every replacement frees a random block and allocates a new one
+// Рабочий набор: liveBlocks блоков по 256-4096 байт, каждая замена освобождает случайный блок и выделяет новый
+struct ChurnState {
+    MemoryPool pool;
+    std::vector<void*> blocks;
+    uint32_t state;
+
+    explicit ChurnState(size_t liveBlocks) : pool(64 * 1024 * 1024), blocks(liveBlocks), state(1) {
+        for (auto& block : blocks) {
+            block = pool.allocate(nextSize());
+        }
+    }
+
+    size_t nextSize() {
+        state = state * 1664525u + 1013904223u;
+        return 256 + (state >> 12) % 3841;
+    }
+
+    size_t nextSlot() {
+        state = state * 1664525u + 1013904223u;
+        return (state >> 8) % blocks.size();
+    }
+
+    void replace() {
+        size_t slot = nextSlot();
+        pool.deallocate(blocks[slot]);
+        blocks[slot] = pool.allocate(nextSize());
+    }
+};
+
+// Перцентилі затримки однієї заміни (звільнення + виділення) у наносекундах
+// Latency percentiles of one replacement (free + allocate) in nanoseconds
+// Перцентили задержки одной замены (освобождение + выделение) в наносекундах
+static void printLatency(size_t liveBlocks) {
+    ChurnState churn(liveBlocks);
+    std::vector<long long> samples(replacementsPerRound);
+    for (auto& sample : samples) {
+        auto start = std::chrono::steady_clock::now();
+        churn.replace();
+        sample = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+    std::sort(samples.begin(), samples.end());
+
+    Memory::FragmentationReport report = churn.pool.getFragmentationReport();
+    std::cout << "live x" << std::setw(6) << liveBlocks
+              << "  p50 " << std::setw(8) << samples[samples.size() / 2]
+              << "  p99 " << std::setw(8) << samples[samples.size() * 99 / 100]
+              << "  max " << std::setw(9) << samples.back()
+              << "  free blocks " << std::setw(6) << report.freeBlocks
+              << "  fragmentation " << std::fixed << std::setprecision(3) << report.fragmentation << "\n";
+}
+
+int main() {
+    std::cout << "Memory Pool Latency Benchmark\n";
+    std::cout << "=============================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = 5;                   // Прогонів / Rounds / Прогонов
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    const size_t liveCounts[] = {256, 2048, 8192};
+    for (size_t liveBlocks : liveCounts) {
+        std::string name = "Churn[live x" + std::to_string(liveBlocks) + "]";
+        gBenchmarkSuite->registerBenchmark(name, BenchmarkType::MEMORY, [liveBlocks](size_t iterations) {
+            ChurnState churn(liveBlocks);
+            for (size_t i = 0; i < iterations; ++i) {
+                for (size_t r = 0; r < replacementsPerRound; ++r) {
+                    churn.replace();
+                }
+            }
+        });
+    }
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускна здатність звіту = прогонів за секунду (20000 замін у кожному)
+    // Report throughput = rounds per second (20000 replacements each)
+    // Пропускная способность отчета = прогонов в секунду (20000 замен в каждом)
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    std::cout << "Replacement latency (ns)\n";
+    for (size_t liveBlocks : liveCounts) {
+        printLatency(liveBlocks);
+    }
+
+    gBenchmarkSuite->exportResults("csv", "./memory_pool_latency_benchmark.csv");
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * neuron_cycle_arena_benchmark.cpp
+ * Цикл обробки нейронів: сигнали в купі проти сигналів в арені циклу
+ * Neuron processing cycle: signals on the heap versus signals in a cycle arena
+ * Цикл обработки нейронов: сигналы в куче против сигналов в арене цикла
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../memory/Arena.h"
+#include "../neuron/models/NeuronModel.h"
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace NeuroSync;
+using NeuroSync::Neuron::Models::NeuronInput;
+using NeuroSync::Neuron::Models::NeuronModel;
+using NeuroSync::Neuron::Models::NeuronOutput;
+using NeuroSync::Neuron::Models::NeuronType;
+
+static const size_t neuronCount = 256;
+static const size_t signalValues = 8;
+
+// Один цикл: кожен нейрон отримує inputsPerNeuron сигналів по signalValues чисел і видає один вихід
+// One cycle: every neuron receives inputsPerNeuron signals of signalValues numbers and emits one output
+// Один цикл: каждый нейрон получает inputsPerNeuron сигналов по signalValues чисел и выдает один выход
+static double runCycle(std::vector<std::unique_ptr<NeuronModel>>& neurons, size_t inputsPerNeuron) {
+    double total = 0.0;
+    for (auto& neuron : neurons) {
+        NeuronInput input;
+        input.data.assign(signalValues, 0.5);
+        for (size_t i = 0; i < inputsPerNeuron; ++i) {
+            input.sourceNeuronId = static_cast<int>(i);
+            input.signalStrength = 0.1 * static_cast<double>(i);
+            neuron->addInput(input);
+        }
+
+        NeuronOutput output;
+        output.targetNeuronId = neuron->getId() + 1;
+        for (const auto& received : neuron->getInputs()) {
+            output.signalStrength += received.signalStrength * received.data[0];
+        }
+        output.data.assign(signalValues, output.signalStrength);
+        neuron->addOutput(output);
+        total += neuron->getOutputs().back().signalStrength;
+    }
+    return total;
+}
+
+static std::vector<std::unique_ptr<NeuronModel>> makeNeurons(std::pmr::memory_resource* resource) {
+    std::vector<std::unique_ptr<NeuronModel>> neurons;
+    for (size_t i = 0; i < neuronCount; ++i) {
+        neurons.emplace_back(new NeuronModel(static_cast<int>(i), NeuronType::PROCESSING,
+                                             "neuron" + std::to_string(i)));
+        neurons.back()->setSignalResource(resource);
+    }
+    return neurons;
+}
+
+int main() {
+    std::cout << "Neuron Cycle Arena Benchmark\n";
+    std::cout << "============================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = 200;                 // Циклів / Cycles / Циклов
+    config.enableWarmup = true;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    const size_t inputCounts[] = {4, 16, 64};
+    for (size_t inputsPerNeuron : inputCounts) {
+        std::string suffix = "[" + std::to_string(neuronCount) + " neurons x" + std::to_string(inputsPerNeuron) + " inputs]";
+
+        // Купа: clearInputs() звільняє дані кожного сигналу окремо
+        // Heap: clearInputs() frees every signal's data separately
+        // Куча: clearInputs() освобождает данные каждого сигнала отдельно
+        gBenchmarkSuite->registerBenchmark("Heap" + suffix, BenchmarkType::MEMORY, [inputsPerNeuron](size_t iterations) {
+            auto neurons = makeNeurons(nullptr);
+            volatile double sink = 0.0;
+            for (size_t i = 0; i < iterations; ++i) {
+                sink = sink + runCycle(neurons, inputsPerNeuron);
+                for (auto& neuron : neurons) {
+                    neuron->clearInputs();
+                    neuron->clearOutputs();
+                }
+            }
+        });
+
+        // Арена: сигнали та їхні дані в одній арені, кінець циклу - releaseSignals() і reset()
+        // Arena: signals and their data in one arena, the end of a cycle is releaseSignals() and reset()
+        // Арена: сигналы и их данные в одной арене, конец цикла - releaseSignals() и reset()
+        gBenchmarkSuite->registerBenchmark("Arena" + suffix, BenchmarkType::MEMORY, [inputsPerNeuron](size_t iterations) {
+            Memory::Arena arena;
+            Memory::ArenaResource resource(arena);
+            auto neurons = makeNeurons(&resource);
+            volatile double sink = 0.0;
+            for (size_t i = 0; i < iterations; ++i) {
+                sink = sink + runCycle(neurons, inputsPerNeuron);
+                for (auto& neuron : neurons) {
+                    neuron->releaseSignals();
+                }
+                arena.reset();
+            }
+        });
+    }
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускна здатність звіту = циклів за секунду
+    // Report throughput = cycles per second
+    // Пропускная способность отчета = циклов в секунду
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    gBenchmarkSuite->exportResults("csv", "./neuron_cycle_arena_benchmark.csv");
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * parallel_for_scaling_benchmark.cpp
+ * Масштабування parallelFor / parallelReduce / parallelTransform за кількістю потоків пулу
+ * Scaling of parallelFor / parallelReduce / parallelTransform with the pool thread count
+ * Масштабирование parallelFor / parallelReduce / parallelTransform по количеству потоков пула
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../threadpool/ParallelAlgorithms.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NeuroSync;
+
+static const size_t elementCount = size_t(1) << 20;             // 1M елементів / elements / элементов
+
+// Нормалізація на зразок DataProcessor::normalizeData: кілька операцій з плаваючою комою на елемент
+// Normalization in the style of DataProcessor::normalizeData: a few floating-point operations per element
+// Нормализация в духе DataProcessor::normalizeData: несколько операций с плавающей точкой на элемент
+static inline float normalize(float value) {
+    return std::tanh((value - 0.5f) * 4.0f);
+}
+
+int main() {
+    std::cout << "Parallel Algorithms Scaling Benchmark\n";
+    std::cout << "=====================================\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = 20;                  // Проходів по масиву на прогін / Passes over the array per run / Проходов по массиву на прогон
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    std::vector<float> input(elementCount);
+    for (size_t i = 0; i < elementCount; ++i) {
+        input[i] = static_cast<float>(i % 1000) / 1000.0f;
+    }
+    std::vector<float> output(elementCount);
+
+    // Однопотокова базова лінія
+    // Single-threaded baseline
+    // Однопоточная базовая линия
+    gBenchmarkSuite->registerBenchmark("Transform[serial]", BenchmarkType::CPU, [&input, &output](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i) {
+            std::transform(input.begin(), input.end(), output.begin(), normalize);
+        }
+    });
+    gBenchmarkSuite->registerBenchmark("Reduce[serial]", BenchmarkType::CPU, [&input](size_t iterations) {
+        volatile double sink = 0.0;
+        for (size_t i = 0; i < iterations; ++i) {
+            double sum = 0.0;
+            for (float value : input) {
+                sum += normalize(value);
+            }
+            sink = sum;
+        }
+        (void)sink;
+    });
+
+    const size_t threadCounts[] = {1, 2, 4, 8};
+    for (size_t threads : threadCounts) {
+        std::string suffix = " x" + std::to_string(threads) + "]";
+
+        gBenchmarkSuite->registerBenchmark("Transform[pool" + suffix, BenchmarkType::CPU,
+                                           [&input, &output, threads](size_t iterations) {
+            ThreadPool pool(threads, ThreadPoolMode::WORK_STEALING);
+            for (size_t i = 0; i < iterations; ++i) {
+                parallelTransform(pool, input.begin(), input.end(), output.begin(), normalize);
+            }
+        });
+
+        gBenchmarkSuite->registerBenchmark("Reduce[pool" + suffix, BenchmarkType::CPU,
+                                           [&input, threads](size_t iterations) {
+            ThreadPool pool(threads, ThreadPoolMode::WORK_STEALING);
+            volatile double sink = 0.0;
+            for (size_t i = 0; i < iterations; ++i) {
+                sink = parallelReduce(pool, size_t(0), input.size(), 0.0,
+                    [&input](size_t begin, size_t end, double sum) {
+                        for (size_t j = begin; j < end; ++j) {
+                            sum += normalize(input[j]);
+                        }
+                        return sum;
+                    },
+                    [](double a, double b) { return a + b; });
+            }
+            (void)sink;
+        });
+
+        // Дрібна порція: накладні витрати на захоплення порцій та помічників
+        // Fine grain: overhead of claiming chunks and of helpers
+        // Мелкая порция: накладные расходы на захват порций и помощников
+        gBenchmarkSuite->registerBenchmark("ForFineGrain[pool" + suffix, BenchmarkType::CPU,
+                                           [&input, &output, threads](size_t iterations) {
+            ThreadPool pool(threads, ThreadPoolMode::WORK_STEALING);
+            for (size_t i = 0; i < iterations; ++i) {
+                parallelFor(pool, size_t(0), input.size(), [&input, &output](size_t j) {
+                    output[j] = normalize(input[j]);
+                }, 256);
+            }
+        });
+    }
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускна здатність звіту = проходів по 1M елементів за секунду
+    // Report throughput = passes over 1M elements per second
+    // Пропускная способность отчета = проходов по 1M элементов в секунду
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    gBenchmarkSuite->exportResults("csv", "./parallel_for_scaling_benchmark.csv");
+    return 0;
+}
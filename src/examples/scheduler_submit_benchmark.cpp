@@ -0,0 +1,83 @@
+/*
+ * scheduler_submit_benchmark.cpp
+ * Пропускна здатність Core::Scheduler::addTask з кількох потоків-виробників
+ * Core::Scheduler::addTask throughput from several producer threads
+ * Пропускная способность Core::Scheduler::addTask из нескольких потоков-производителей
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../core/Scheduler.h"
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NeuroSync;
+
+static const size_t tasksPerProducer = 20000;
+
+// Один прогін: producers потоків додають задачі з восьми пріоритетів, потім очікування їх виконання
+// One run: producers threads add tasks of eight priorities, then wait until they have run
+// Один прогон: producers потоков добавляют задачи восьми приоритетов, затем ожидание их выполнения
+static void submitRound(::Core::Scheduler& scheduler, size_t producers) {
+    std::atomic<size_t> executed(0);
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&scheduler, &executed, p]() {
+            for (size_t i = 0; i < tasksPerProducer; ++i) {
+                scheduler.addTask([&executed]() {
+                    executed.fetch_add(1, std::memory_order_relaxed);
+                }, static_cast<int>((p + i) % 8));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    while (executed.load(std::memory_order_relaxed) < producers * tasksPerProducer) {
+        std::this_thread::yield();
+    }
+}
+
+int main() {
+    std::cout << "Scheduler Submit Benchmark\n";
+    std::cout << "==========================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = 10;                  // Прогонів / Rounds / Прогонов
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    const size_t workerCounts[] = {1, 4};
+    const size_t producerCounts[] = {1, 2, 4, 8};
+    for (size_t workers : workerCounts) {
+        for (size_t producers : producerCounts) {
+            std::string name = "Submit[workers x" + std::to_string(workers) +
+                               " / producers x" + std::to_string(producers) + "]";
+            gBenchmarkSuite->registerBenchmark(name, BenchmarkType::CPU, [workers, producers](size_t iterations) {
+                ::Core::Scheduler scheduler(std::chrono::milliseconds(1), workers);
+                scheduler.start();
+                for (size_t i = 0; i < iterations; ++i) {
+                    submitRound(scheduler, producers);
+                }
+                scheduler.stop();
+            });
+        }
+    }
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускна здатність звіту = прогонів за секунду (producers x 20000 задач у кожному)
+    // Report throughput = rounds per second (producers x 20000 tasks each)
+    // Пропускная способность отчета = прогонов в секунду (producers x 20000 задач в каждом)
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    gBenchmarkSuite->exportResults("csv", "./scheduler_submit_benchmark.csv");
+    return 0;
+}
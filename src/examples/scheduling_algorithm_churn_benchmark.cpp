@@ -0,0 +1,170 @@
+/*
+ * scheduling_algorithm_churn_benchmark.cpp
+ * Отмена задач и смена приоритетов при 100k ожидающих задач: индексированная куча против перестройки очереди
+ * Task cancellation and priority changes with 100k pending tasks: indexed heap versus rebuilding the queue
+ * Скасування завдань та зміна пріоритетів при 100k завдань в очікуванні: індексована купа проти перебудови черги
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../core/algorithms/PriorityBasedScheduling.h"
+#include "../core/algorithms/RoundRobinScheduling.h"
+#include "../core/algorithms/WeightedFairQueuingScheduling.h"
+#include <iostream>
+#include <map>
+#include <memory>
+#include <queue>
+#include <random>
+#include <vector>
+
+using namespace NeuroSync;
+using namespace NeuroSync::Core::Algorithms;
+
+// Ожидающих задач; один прогон меняет 10% из них
+// Pending tasks; one run churns 10% of them
+// Завдань в очікуванні; один прогін змінює 10% з них
+static const int PENDING_TASKS = 100000;
+static const size_t CHURN_OPERATIONS = PENDING_TASKS / 10;
+
+// Прежняя реализация: priority_queue + map, удаление через извлечение и повторную вставку всей очереди
+// The previous implementation: priority_queue + map, removal by popping and re-pushing the whole queue
+// Попередня реалізація: priority_queue + map, видалення через вилучення та повторну вставку всієї черги
+class LegacyPriorityScheduling {
+public:
+    void addTask(int taskId, int priority) {
+        if (taskMap.find(taskId) != taskMap.end()) {
+            return;
+        }
+        PriorityTask task;
+        task.taskId = taskId;
+        task.priority = priority;
+        task.timestamp = timestampCounter++;
+        taskQueue.push(task);
+        taskMap[taskId] = task;
+    }
+
+    void removeTask(int taskId) {
+        if (taskMap.erase(taskId) == 0) {
+            return;
+        }
+        std::vector<PriorityTask> tempTasks;
+        while (!taskQueue.empty()) {
+            PriorityTask task = taskQueue.top();
+            taskQueue.pop();
+            if (task.taskId != taskId) {
+                tempTasks.push_back(task);
+            }
+        }
+        for (const auto& task : tempTasks) {
+            taskQueue.push(task);
+        }
+    }
+
+    void updateTaskPriority(int taskId, int newPriority) {
+        if (taskMap.find(taskId) != taskMap.end()) {
+            removeTask(taskId);
+            addTask(taskId, newPriority);
+        }
+    }
+
+private:
+    std::priority_queue<PriorityTask> taskQueue;
+    std::map<int, PriorityTask> taskMap;
+    long long timestampCounter = 0;
+};
+
+// Нагрузка: половина операций меняет приоритет, половина отменяет задачу и ставит новую,
+// так что число ожидающих задач остается постоянным
+// Workload: half the operations change a priority, half cancel a task and submit a new one,
+// so the number of pending tasks stays constant
+// Навантаження: половина операцій змінює пріоритет, половина скасовує завдання та ставить нове,
+// тож кількість завдань в очікуванні лишається сталою
+template<typename Scheduling>
+class ChurnWorkload {
+public:
+    explicit ChurnWorkload(Scheduling& scheduling) : scheduling(scheduling), random(7), nextTaskId(0) {
+        liveTasks.reserve(PENDING_TASKS);
+        for (int i = 0; i < PENDING_TASKS; ++i) {
+            scheduling.addTask(nextTaskId, static_cast<int>(random() % 64));
+            liveTasks.push_back(nextTaskId++);
+        }
+    }
+
+    void run(size_t operations) {
+        for (size_t i = 0; i < operations; ++i) {
+            size_t index = random() % liveTasks.size();
+            int priority = static_cast<int>(random() % 64);
+            if (i % 2 == 0) {
+                scheduling.updateTaskPriority(liveTasks[index], priority);
+            } else {
+                scheduling.removeTask(liveTasks[index]);
+                scheduling.addTask(nextTaskId, priority);
+                liveTasks[index] = nextTaskId++;
+            }
+        }
+    }
+
+private:
+    Scheduling& scheduling;
+    std::mt19937 random;
+    std::vector<int> liveTasks;
+    int nextTaskId;
+};
+
+int main() {
+    std::cout << "Scheduling Algorithm Churn Benchmark\n";
+    std::cout << "====================================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = CHURN_OPERATIONS;   // Операций на прогон / Operations per run / Операцій на прогін
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    PriorityBasedScheduling priorityScheduling;
+    RoundRobinScheduling roundRobinScheduling;
+    WeightedFairQueuingScheduling weightedFairQueuingScheduling;
+    priorityScheduling.initialize();
+    roundRobinScheduling.initialize();
+    weightedFairQueuingScheduling.initialize();
+
+    ChurnWorkload<PriorityBasedScheduling> priorityWorkload(priorityScheduling);
+    ChurnWorkload<RoundRobinScheduling> roundRobinWorkload(roundRobinScheduling);
+    ChurnWorkload<WeightedFairQueuingScheduling> weightedFairQueuingWorkload(weightedFairQueuingScheduling);
+
+    gBenchmarkSuite->registerBenchmark("Churn[PriorityBased]", BenchmarkType::CPU, [&priorityWorkload](size_t iterations) {
+        priorityWorkload.run(iterations);
+    });
+    gBenchmarkSuite->registerBenchmark("Churn[RoundRobin]", BenchmarkType::CPU, [&roundRobinWorkload](size_t iterations) {
+        roundRobinWorkload.run(iterations);
+    });
+    gBenchmarkSuite->registerBenchmark("Churn[WeightedFairQueuing]", BenchmarkType::CPU, [&weightedFairQueuingWorkload](size_t iterations) {
+        weightedFairQueuingWorkload.run(iterations);
+    });
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускная способность отчета = операций отмены/смены приоритета в секунду
+    // Report throughput = cancel/reprioritize operations per second
+    // Пропускна здатність звіту = операцій скасування/зміни пріоритету за секунду
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    // Прежняя реализация тратит O(n log n) на операцию, поэтому меряется на выборке
+    // The previous implementation spends O(n log n) per operation, so it is measured on a sample
+    // Попередня реалізація витрачає O(n log n) на операцію, тому міряється на вибірці
+    LegacyPriorityScheduling legacyScheduling;
+    ChurnWorkload<LegacyPriorityScheduling> legacyWorkload(legacyScheduling);
+    gBenchmarkSuite->registerBenchmark("Churn[legacy priority_queue rebuild]", BenchmarkType::CPU, [&legacyWorkload](size_t iterations) {
+        legacyWorkload.run(iterations);
+    });
+    BenchmarkResult legacy = gBenchmarkSuite->runBenchmark("Churn[legacy priority_queue rebuild]", 100);
+    std::cout << "Legacy priority_queue rebuild: " << legacy.averageTimePerIteration / 1000.0
+              << " us per operation (" << legacy.averageTimePerIteration * CHURN_OPERATIONS / 1e9
+              << " s per 10% churn)\n";
+
+    gBenchmarkSuite->exportResults("csv", "./scheduling_algorithm_churn_benchmark.csv");
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * synapse_queue_benchmark.cpp
+ * Масштабування черг повідомлень SynapseBus за кількістю виробників/споживачів
+ * Producer/consumer scaling of SynapseBus message queues
+ * Масштабирование очередей сообщений SynapseBus по количеству производителей/потребителей
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../synapse/priority/PriorityMessageQueue.h"
+#include "../synapse/priority/LockFreePriorityMessageQueue.h"
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <string>
+
+using namespace NeuroSync;
+using namespace NeuroSync::Synapse::Priority;
+
+// Створення черги заданого типу
+// Create queue of the given type
+// Создание очереди заданного типа
+static std::unique_ptr<MessageQueue> createQueue(MessageQueueType type) {
+    if (type == MessageQueueType::LOCK_FREE) {
+        return std::make_unique<LockFreePriorityMessageQueue>();
+    }
+    return std::make_unique<PriorityMessageQueue>();
+}
+
+// Передати totalMessages повідомлень від threadCount виробників до threadCount споживачів
+// Pass totalMessages messages from threadCount producers to threadCount consumers
+// Передать totalMessages сообщений от threadCount производителей к threadCount потребителям
+static void runProducerConsumer(MessageQueueType type, size_t threadCount, size_t totalMessages) {
+    std::unique_ptr<MessageQueue> queue = createQueue(type);
+    queue->setMaxSize(4096);
+    queue->initialize();
+
+    std::atomic<size_t> received(0);
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount * 2);
+
+    for (size_t p = 0; p < threadCount; ++p) {
+        size_t share = totalMessages / threadCount + (p < totalMessages % threadCount ? 1 : 0);
+        threads.emplace_back([&queue, p, share]() {
+            PriorityMessage message{};
+            message.senderId = static_cast<int>(p);
+            message.receiverId = static_cast<int>(p + 1);
+            message.weight = 1;
+            message.dataSize = 0;
+            for (size_t i = 0; i < share; ++i) {
+                message.priority = static_cast<MessagePriority>(i % MESSAGE_PRIORITY_LEVELS);
+                while (!queue->enqueue(message)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (size_t c = 0; c < threadCount; ++c) {
+        threads.emplace_back([&queue, &received, totalMessages]() {
+            PriorityMessage message;
+            while (received.load(std::memory_order_relaxed) < totalMessages) {
+                if (queue->dequeue(message)) {
+                    // Останній споживач будить інших, що чекають у dequeue
+                    // The last consumer wakes the others waiting in dequeue
+                    // Последний потребитель будит остальных, ждущих в dequeue
+                    if (received.fetch_add(1, std::memory_order_relaxed) + 1 == totalMessages) {
+                        queue->setStopping(true);
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+int main() {
+    std::cout << "SynapseBus Message Queue Scaling Benchmark\n";
+    std::cout << "==========================================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = 200000;   // Повідомлень на прогін / Messages per run / Сообщений на прогон
+    config.enableWarmup = true;
+    config.warmupIterations = 2;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    const size_t threadCounts[] = {1, 2, 4, 8, 16, 32};
+    const std::pair<MessageQueueType, const char*> queueTypes[] = {
+        {MessageQueueType::PRIORITY_HEAP, "heap"},
+        {MessageQueueType::LOCK_FREE, "lock-free"}
+    };
+
+    for (const auto& queueType : queueTypes) {
+        for (size_t threads : threadCounts) {
+            std::string count = (threads < 10 ? "0" : "") + std::to_string(threads);
+            std::string name = std::string("MessageQueue[") + queueType.second + "] " +
+                               count + "P/" + count + "C";
+            MessageQueueType type = queueType.first;
+            gBenchmarkSuite->registerBenchmark(name, BenchmarkType::SYNAPSE, [type, threads](size_t iterations) {
+                runProducerConsumer(type, threads, iterations);
+            });
+        }
+    }
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускна здатність звіту = повідомлень за секунду
+    // Report throughput = messages per second
+    // Пропускная способность отчета = сообщений в секунду
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    gBenchmarkSuite->exportResults("csv", "./synapse_queue_benchmark.csv");
+    return 0;
+}
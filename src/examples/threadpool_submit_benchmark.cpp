@@ -0,0 +1,155 @@
+/*
+ * threadpool_submit_benchmark.cpp
+ * Накладні витрати на постановку завдань у ThreadPool: попередній enqueue, новий enqueue та post
+ * ThreadPool task submission overhead: the previous enqueue, the new enqueue and post
+ * Накладные расходы на постановку задач в ThreadPool: прежний enqueue, новый enqueue и post
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../threadpool/ThreadPool.h"
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NeuroSync;
+
+// Лічильник звернень до глобальної купи
+// Global heap allocation counter
+// Счетчик обращений к глобальной куче
+static std::atomic<size_t> heapAllocations(0);
+
+void* operator new(size_t size) {
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+static std::atomic<size_t> executedTasks(0);
+
+static int smallTask(int value) {
+    executedTasks.fetch_add(1, std::memory_order_relaxed);
+    return value + 1;
+}
+
+// Попередня реалізація enqueue: make_shared<packaged_task> + std::bind + обгортка std::function
+// The previous enqueue implementation: make_shared<packaged_task> + std::bind + a std::function wrapper
+// Прежняя реализация enqueue: make_shared<packaged_task> + std::bind + обертка std::function
+static std::future<int> legacyEnqueue(ThreadPool& pool, int value) {
+    auto task = std::make_shared<std::packaged_task<int()>>(std::bind(smallTask, value));
+    std::future<int> result = task->get_future();
+    pool.post(std::function<void()>([task]() { (*task)(); }));
+    return result;
+}
+
+// Пакети по BATCH завдань: постановка, потім очікування всіх результатів
+// Batches of BATCH tasks: submit, then wait for every result
+// Пакеты по BATCH задач: постановка, затем ожидание всех результатов
+static const size_t BATCH = 256;
+
+int main() {
+    std::cout << "ThreadPool Submission Overhead Benchmark\n";
+    std::cout << "========================================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = 200000;   // Завдань на прогін / Tasks per run / Задач на прогон
+    config.enableWarmup = true;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    ThreadPool pool(2);
+    std::vector<std::future<int>> futures;
+    futures.reserve(BATCH);
+
+    gBenchmarkSuite->registerBenchmark("Submit[legacy enqueue]", BenchmarkType::CPU, [&pool, &futures](size_t iterations) {
+        for (size_t done = 0; done < iterations; done += BATCH) {
+            futures.clear();
+            for (size_t i = 0; i < BATCH; ++i) {
+                futures.push_back(legacyEnqueue(pool, static_cast<int>(i)));
+            }
+            for (auto& future : futures) {
+                future.get();
+            }
+        }
+    });
+
+    gBenchmarkSuite->registerBenchmark("Submit[enqueue]", BenchmarkType::CPU, [&pool, &futures](size_t iterations) {
+        for (size_t done = 0; done < iterations; done += BATCH) {
+            futures.clear();
+            for (size_t i = 0; i < BATCH; ++i) {
+                futures.push_back(pool.enqueue(smallTask, static_cast<int>(i)));
+            }
+            for (auto& future : futures) {
+                future.get();
+            }
+        }
+    });
+
+    gBenchmarkSuite->registerBenchmark("Submit[post]", BenchmarkType::CPU, [&pool](size_t iterations) {
+        for (size_t done = 0; done < iterations; done += BATCH) {
+            size_t target = executedTasks.load() + BATCH;
+            for (size_t i = 0; i < BATCH; ++i) {
+                pool.post(smallTask, static_cast<int>(i));
+            }
+            while (executedTasks.load() < target) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    gBenchmarkSuite->runAllBenchmarks();
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    // Звернення до купи на одне завдання після прогріву пулу
+    // Heap allocations per task once the pool is warm
+    // Обращения к куче на одну задачу после прогрева пула
+    const size_t measuredTasks = BATCH * 200;
+    const char* names[] = {"legacy enqueue", "enqueue", "post"};
+    for (int variant = 0; variant < 3; ++variant) {
+        size_t before = heapAllocations.load();
+        for (size_t done = 0; done < measuredTasks; done += BATCH) {
+            futures.clear();
+            size_t target = executedTasks.load() + BATCH;
+            for (size_t i = 0; i < BATCH; ++i) {
+                if (variant == 0) {
+                    futures.push_back(legacyEnqueue(pool, static_cast<int>(i)));
+                } else if (variant == 1) {
+                    futures.push_back(pool.enqueue(smallTask, static_cast<int>(i)));
+                } else {
+                    pool.post(smallTask, static_cast<int>(i));
+                }
+            }
+            for (auto& future : futures) {
+                future.get();
+            }
+            while (executedTasks.load() < target) {
+                std::this_thread::yield();
+            }
+        }
+        double perTask = static_cast<double>(heapAllocations.load() - before) / measuredTasks;
+        std::cout << "Heap allocations per task [" << names[variant] << "]: " << perTask << "\n";
+    }
+
+    gBenchmarkSuite->exportResults("csv", "./threadpool_submit_benchmark.csv");
+    return 0;
+}
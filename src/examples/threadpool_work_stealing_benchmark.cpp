@@ -0,0 +1,80 @@
+/*
+ * threadpool_work_stealing_benchmark.cpp
+ * Дрібнозернисте рекурсивне породження завдань: спільна черга проти деків з крадіжкою роботи
+ * Fine-grained recursive task spawning: shared queue versus work-stealing deques
+ * Мелкозернистое рекурсивное порождение задач: общая очередь против деков с кражей работы
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../threadpool/ThreadPool.h"
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace NeuroSync;
+
+static const int treeDepth = 12;                                // 4096 листів на дерево / leaves per tree / листьев на дерево
+static const size_t leavesPerTree = size_t(1) << treeDepth;
+
+// Вузол дерева: лист рахує себе, внутрішній вузол породжує двох нащадків з робочого потоку
+// Tree node: a leaf counts itself, an inner node spawns two children from the worker thread
+// Узел дерева: лист считает себя, внутренний узел порождает двух потомков из рабочего потока
+static void spawnNode(ThreadPool& pool, int depth, std::atomic<size_t>& leaves) {
+    if (depth == 0) {
+        leaves.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    for (int child = 0; child < 2; ++child) {
+        pool.post([&pool, depth, &leaves]() {
+            spawnNode(pool, depth - 1, leaves);
+        });
+    }
+}
+
+int main() {
+    std::cout << "ThreadPool Work-Stealing Benchmark\n";
+    std::cout << "==================================\n\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = 50;                  // Дерев на прогін / Trees per run / Деревьев на прогон
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    const ThreadPoolMode modes[] = {ThreadPoolMode::SHARED_QUEUE, ThreadPoolMode::WORK_STEALING};
+    const size_t threadCounts[] = {2, 4, 8};
+    for (ThreadPoolMode mode : modes) {
+        for (size_t threads : threadCounts) {
+            std::string name = std::string("SpawnTree[") +
+                (mode == ThreadPoolMode::WORK_STEALING ? "work-stealing" : "shared-queue") +
+                " x" + std::to_string(threads) + "]";
+            gBenchmarkSuite->registerBenchmark(name, BenchmarkType::CPU, [mode, threads](size_t iterations) {
+                ThreadPool pool(threads, mode);
+                for (size_t i = 0; i < iterations; ++i) {
+                    std::atomic<size_t> leaves(0);
+                    pool.post([&pool, &leaves]() {
+                        spawnNode(pool, treeDepth, leaves);
+                    });
+                    while (leaves.load(std::memory_order_relaxed) < leavesPerTree) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+    }
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускна здатність звіту = дерев за секунду (по 8191 завданню в кожному)
+    // Report throughput = trees per second (8191 tasks each)
+    // Пропускная способность отчета = деревьев в секунду (по 8191 задаче в каждом)
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    gBenchmarkSuite->exportResults("csv", "./threadpool_work_stealing_benchmark.csv");
+    return 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * weighted_fair_queuing_fairness_benchmark.cpp
+ * Ошибка справедливости и стоимость операций WFQ: куча с вещественным временем против календарной очереди
+ * WFQ fairness error and operation cost: heap with floating-point time versus the calendar queue
+ * Помилка справедливості та вартість операцій WFQ: купа з дійсним часом проти календарної черги
+ */
+
+#include "../benchmark/BenchmarkSuite.h"
+#include "../core/algorithms/WeightedFairQueuingScheduling.h"
+#include "../core/algorithms/CalendarFairQueuingScheduling.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace NeuroSync;
+using namespace NeuroSync::Core::Algorithms;
+
+// Ожидающих задач в замерах стоимости операций
+// Pending tasks in the operation cost runs
+// Завдань в очікуванні в замірах вартості операцій
+static const int PENDING_TASKS = 100000;
+static const size_t OPERATIONS_PER_RUN = 100000;
+
+// Обслуживаний в замере справедливости
+// Services in a fairness run
+// Обслуговувань у замірі справедливості
+static const size_t FAIRNESS_SERVICES = 200000;
+
+// Результат замера справедливости. Каждый поток всегда держит в очереди одну задачу и после
+// обслуживания ставит следующую с тем же весом. normalizedSpread - наибольший за прогон разброс
+// served_i / w_i между потоками (в обслуживаниях с весом 1), gpsLag - наибольшее отклонение
+// served_i от идеальной доли t * w_i / sum(w) (в задачах).
+// Result of a fairness run. Every flow always keeps one task queued and submits the next one
+// with the same weight once it is served. normalizedSpread is the largest spread of served_i / w_i
+// across flows during the run (in weight-1 services), gpsLag is the largest deviation of served_i
+// from the ideal share t * w_i / sum(w) (in tasks).
+// Результат заміру справедливості. Кожен потік завжди тримає в черзі одне завдання і після
+// обслуговування ставить наступне з тією ж вагою. normalizedSpread - найбільший за прогін розкид
+// served_i / w_i між потоками (в обслуговуваннях з вагою 1), gpsLag - найбільше відхилення
+// served_i від ідеальної частки t * w_i / sum(w) (у завданнях).
+struct FairnessResult {
+    double normalizedSpread;
+    double gpsLag;
+};
+
+template<typename Scheduling>
+FairnessResult measureFairness(const std::vector<int>& weights, size_t services) {
+    Scheduling scheduling;
+    scheduling.initialize();
+
+    double totalWeight = 0.0;
+    std::unordered_map<int, size_t> flowByTask;
+    int nextTaskId = 1;
+    for (size_t flow = 0; flow < weights.size(); ++flow) {
+        totalWeight += weights[flow];
+        scheduling.addTask(nextTaskId, 0);
+        scheduling.setTaskWeight(nextTaskId, weights[flow]);
+        flowByTask[nextTaskId++] = flow;
+    }
+
+    std::vector<size_t> served(weights.size(), 0);
+    FairnessResult result = {0.0, 0.0};
+    for (size_t t = 1; t <= services; ++t) {
+        int taskId = scheduling.selectNextTask();
+        size_t flow = flowByTask[taskId];
+        flowByTask.erase(taskId);
+        served[flow]++;
+
+        scheduling.addTask(nextTaskId, 0);
+        scheduling.setTaskWeight(nextTaskId, weights[flow]);
+        flowByTask[nextTaskId++] = flow;
+
+        double minNormalized = 1e300;
+        double maxNormalized = 0.0;
+        for (size_t i = 0; i < weights.size(); ++i) {
+            double normalized = static_cast<double>(served[i]) / weights[i];
+            minNormalized = std::min(minNormalized, normalized);
+            maxNormalized = std::max(maxNormalized, normalized);
+            double ideal = static_cast<double>(t) * weights[i] / totalWeight;
+            result.gpsLag = std::max(result.gpsLag, std::fabs(served[i] - ideal));
+        }
+        result.normalizedSpread = std::max(result.normalizedSpread, maxNormalized - minNormalized);
+    }
+    return result;
+}
+
+// Нагрузка стоимости операций: PENDING_TASKS задач с весами по закону Ципфа.
+// Цикл планировщика: выбор задачи, постановка новой и установка ее веса (как в AdvancedScheduler);
+// смена веса: случайная задача получает новый вес.
+// Operation cost workload: PENDING_TASKS tasks with Zipf-distributed weights.
+// Scheduler loop: select a task, queue a new one and set its weight (as AdvancedScheduler does);
+// reweighting: a random task gets a new weight.
+// Навантаження вартості операцій: PENDING_TASKS завдань з вагами за законом Ципфа.
+// Цикл планувальника: вибір завдання, постановка нового та встановлення його ваги (як в AdvancedScheduler);
+// зміна ваги: випадкове завдання отримує нову вагу.
+template<typename Scheduling>
+class OperationWorkload {
+public:
+    OperationWorkload() : random(11), nextTaskId(PENDING_TASKS) {
+        scheduling.initialize();
+        for (int taskId = 0; taskId < PENDING_TASKS; ++taskId) {
+            scheduling.addTask(taskId, 0);
+            scheduling.setTaskWeight(taskId, zipfWeight());
+        }
+    }
+
+    void runSchedulerLoop(size_t operations) {
+        for (size_t i = 0; i < operations; ++i) {
+            scheduling.selectNextTask();
+            scheduling.addTask(nextTaskId, 0);
+            scheduling.setTaskWeight(nextTaskId++, zipfWeight());
+        }
+    }
+
+    // Смена весов только у задач, которые цикл планировщика не выбирает (отдельный экземпляр)
+    // Reweights only tasks the scheduler loop never selects (a separate instance)
+    // Зміна ваг лише у завдань, які цикл планувальника не вибирає (окремий екземпляр)
+    void runReweight(size_t operations) {
+        for (size_t i = 0; i < operations; ++i) {
+            scheduling.setTaskWeight(static_cast<int>(random() % PENDING_TASKS), zipfWeight());
+        }
+    }
+
+private:
+    int zipfWeight() {
+        // Вес 4096 / k для равномерного k в [1, 4096]: много легких задач и редкие тяжелые
+        // Weight 4096 / k for a uniform k in [1, 4096]: many light tasks and rare heavy ones
+        // Вага 4096 / k для рівномірного k в [1, 4096]: багато легких завдань і рідкісні важкі
+        return static_cast<int>(4096 / (1 + random() % 4096));
+    }
+
+    Scheduling scheduling;
+    std::mt19937 random;
+    int nextTaskId;
+};
+
+static void printFairness(const std::string& scenario, const std::vector<int>& weights) {
+    FairnessResult heap = measureFairness<WeightedFairQueuingScheduling>(weights, FAIRNESS_SERVICES);
+    FairnessResult calendar = measureFairness<CalendarFairQueuingScheduling>(weights, FAIRNESS_SERVICES);
+    std::cout << std::left << std::setw(34) << scenario << std::right << std::fixed << std::setprecision(3)
+              << std::setw(12) << heap.normalizedSpread << std::setw(12) << heap.gpsLag
+              << std::setw(12) << calendar.normalizedSpread << std::setw(12) << calendar.gpsLag << "\n";
+}
+
+int main() {
+    std::cout << "Weighted Fair Queuing Fairness Benchmark\n";
+    std::cout << "========================================\n\n";
+
+    // Ошибка справедливости при перекошенных весах
+    // Fairness error under skewed weights
+    // Помилка справедливості при перекошених вагах
+    std::vector<int> powersOfTwo;
+    for (int weight = 1; weight <= 1024; weight *= 2) {
+        powersOfTwo.push_back(weight);
+    }
+    std::vector<int> oneHeavy(100, 1);
+    oneHeavy.push_back(1000);
+    std::vector<int> zipf;
+    for (int k = 1; k <= 64; ++k) {
+        zipf.push_back(256 / k);
+    }
+
+    std::cout << std::left << std::setw(34) << "Scenario" << std::right
+              << std::setw(12) << "heap spread" << std::setw(12) << "heap lag"
+              << std::setw(12) << "cal spread" << std::setw(12) << "cal lag" << "\n";
+    printFairness("11 flows, weights 1..1024 (x2)", powersOfTwo);
+    printFairness("100 flows of 1 + one of 1000", oneHeavy);
+    printFairness("64 flows, weights 256 / k", zipf);
+    std::cout << "\n";
+
+    BenchmarkConfig config;
+    config.defaultIterations = OPERATIONS_PER_RUN;   // Операций на прогон / Operations per run / Операцій на прогін
+    config.enableWarmup = false;
+    config.verboseOutput = false;
+
+    if (!gBenchmarkSuite->initialize(config)) {
+        std::cerr << "Failed to initialize benchmark suite\n";
+        return 1;
+    }
+
+    OperationWorkload<WeightedFairQueuingScheduling> heapLoop;
+    OperationWorkload<CalendarFairQueuingScheduling> calendarLoop;
+    OperationWorkload<WeightedFairQueuingScheduling> heapReweight;
+    OperationWorkload<CalendarFairQueuingScheduling> calendarReweight;
+
+    gBenchmarkSuite->registerBenchmark("SchedulerLoop[heap WFQ]", BenchmarkType::CPU, [&heapLoop](size_t iterations) {
+        heapLoop.runSchedulerLoop(iterations);
+    });
+    gBenchmarkSuite->registerBenchmark("SchedulerLoop[calendar WFQ]", BenchmarkType::CPU, [&calendarLoop](size_t iterations) {
+        calendarLoop.runSchedulerLoop(iterations);
+    });
+    gBenchmarkSuite->registerBenchmark("SetTaskWeight[heap WFQ]", BenchmarkType::CPU, [&heapReweight](size_t iterations) {
+        heapReweight.runReweight(iterations);
+    });
+    gBenchmarkSuite->registerBenchmark("SetTaskWeight[calendar WFQ]", BenchmarkType::CPU, [&calendarReweight](size_t iterations) {
+        calendarReweight.runReweight(iterations);
+    });
+
+    gBenchmarkSuite->runAllBenchmarks();
+
+    // Пропускная способность отчета = операций в секунду при 100k ожидающих задач
+    // Report throughput = operations per second with 100k pending tasks
+    // Пропускна здатність звіту = операцій за секунду при 100k завдань в очікуванні
+    std::cout << gBenchmarkSuite->generateReport() << std::endl;
+
+    gBenchmarkSuite->exportResults("csv", "./weighted_fair_queuing_fairness_benchmark.csv");
+    return 0;
+}
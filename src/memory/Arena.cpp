@@ -0,0 +1,129 @@
+#include "Arena.h"
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace NeuroSync {
+namespace Memory {
+
+    const size_t Arena::DEFAULT_BLOCK_SIZE;
+
+    // Конструктор арени (перший блок виділяється при першому запиті)
+    // Arena constructor (the first block is allocated on the first request)
+    // Конструктор арени (перший блок виділяється при першому запиті)
+    Arena::Arena(size_t blockSize)
+        : blockSize(blockSize > 0 ? blockSize : DEFAULT_BLOCK_SIZE), head(nullptr), current(nullptr),
+          cursor(nullptr), limit(nullptr), usedBytes(0), capacity(0), blockCount(0) {
+    }
+
+    Arena::~Arena() {
+        release();
+    }
+
+    char* Arena::alignUp(char* pointer, size_t alignment) {
+        uintptr_t value = reinterpret_cast<uintptr_t>(pointer);
+        return reinterpret_cast<char*>((value + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1));
+    }
+
+    // Виділити пам'ять: швидкий шлях - зсув курсора в поточному блоці
+    // Allocate memory: the fast path bumps the cursor in the current block
+    // Виділити пам'ять: швидкий шлях - зсув курсора в поточному блоці
+    void* Arena::allocate(size_t size, size_t alignment) {
+        if (size == 0) {
+            size = 1;
+        }
+        if (cursor) {
+            char* aligned = alignUp(cursor, alignment);
+            if (aligned <= limit && static_cast<size_t>(limit - aligned) >= size) {
+                cursor = aligned + size;
+                usedBytes += size;
+                return aligned;
+            }
+        }
+        return allocateSlow(size, alignment);
+    }
+
+    void* Arena::allocateSlow(size_t size, size_t alignment) {
+        // Наступні блоки ланцюжка залишилися від попередніх циклів
+        // The next chain blocks are left over from previous cycles
+        // Наступні блоки ланцюжка залишилися від попередніх циклів
+        Block* candidate = current ? current->next : head;
+        while (candidate) {
+            char* aligned = alignUp(candidate->begin(), alignment);
+            if (aligned <= candidate->end() && static_cast<size_t>(candidate->end() - aligned) >= size) {
+                current = candidate;
+                cursor = aligned + size;
+                limit = candidate->end();
+                usedBytes += size;
+                return aligned;
+            }
+            candidate = candidate->next;
+        }
+
+        // Новий блок вставляється після поточного, щоб не загубити решту ланцюжка
+        // A new block is inserted after the current one so the rest of the chain is kept
+        // Новий блок вставляється після поточного, щоб не загубити решту ланцюжка
+        size_t dataSize = size + alignment > blockSize ? size + alignment : blockSize;
+        Block* block = static_cast<Block*>(malloc(sizeof(Block) + dataSize));
+        if (!block) {
+            throw std::bad_alloc();
+        }
+        block->size = dataSize;
+        if (current) {
+            block->next = current->next;
+            current->next = block;
+        } else {
+            block->next = head;
+            head = block;
+        }
+        capacity += dataSize;
+        blockCount++;
+
+        current = block;
+        char* aligned = alignUp(block->begin(), alignment);
+        cursor = aligned + size;
+        limit = block->end();
+        usedBytes += size;
+        return aligned;
+    }
+
+    // Звільнити все виділене: курсор повертається на початок ланцюжка
+    // Free everything allocated: the cursor goes back to the start of the chain
+    // Звільнити все виділене: курсор повертається на початок ланцюжка
+    void Arena::reset() {
+        current = head;
+        cursor = head ? head->begin() : nullptr;
+        limit = head ? head->end() : nullptr;
+        usedBytes = 0;
+    }
+
+    void Arena::release() {
+        while (head) {
+            Block* next = head->next;
+            free(head);
+            head = next;
+        }
+        current = nullptr;
+        cursor = nullptr;
+        limit = nullptr;
+        usedBytes = 0;
+        capacity = 0;
+        blockCount = 0;
+    }
+
+    void* ArenaResource::do_allocate(size_t bytes, size_t alignment) {
+        return arena.allocate(bytes, alignment);
+    }
+
+    void ArenaResource::do_deallocate(void*, size_t, size_t) {
+        // Пам'ять повертається разом з reset() арени
+        // Memory comes back with the arena's reset()
+        // Пам'ять повертається разом з reset() арени
+    }
+
+    bool ArenaResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+} // namespace Memory
+} // namespace NeuroSync
@@ -0,0 +1,117 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+
+// Arena.h
+// Монотонний розподільник для короткоживучих об'єктів циклу обробки
+// Monotonic allocator for short-lived objects of a processing cycle
+// Монотонний розподільник для короткоживучих об'єктів циклу обробки
+
+namespace NeuroSync {
+namespace Memory {
+
+    // Арена: виділення зсувом вказівника в ланцюжку блоків, окремих звільнень немає.
+    // reset() повертає вказівник на початок першого блоку, тому весь цикл звільняється однією
+    // операцією, а блоки залишаються для наступного циклу і після розігріву арена не звертається
+    // до системного розподільника. Запит, більший за блок, отримує власний блок у ланцюжку.
+    // Деструктори об'єктів арена не викликає; арена не потокобезпечна (одна на потік або цикл).
+    // Arena: pointer-bump allocation over a chain of blocks, no individual frees.
+    // reset() moves the pointer back to the start of the first block, so a whole cycle is freed with one
+    // operation, and the blocks stay for the next cycle, so after warm-up the arena does not call
+    // the system allocator. A request larger than a block gets its own block in the chain.
+    // The arena does not run destructors and is not thread-safe (one per thread or cycle).
+    // Арена: виділення зсувом вказівника в ланцюжку блоків, окремих звільнень немає.
+    // reset() повертає вказівник на початок першого блоку, тому весь цикл звільняється однією
+    // операцією, а блоки залишаються для наступного циклу і після розігріву арена не звертається
+    // до системного розподільника. Запит, більший за блок, отримує власний блок у ланцюжку.
+    // Деструктори об'єктів арена не викликає; арена не потокобезпечна (одна на потік або цикл).
+    class Arena {
+    public:
+        static const size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+        explicit Arena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+        ~Arena();
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        // Виділити пам'ять (alignment - степінь двійки)
+        // Allocate memory (alignment is a power of two)
+        // Виділити пам'ять (alignment - степінь двійки)
+        void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        // Звільнити все виділене, зберігши блоки
+        // Free everything allocated while keeping the blocks
+        // Звільнити все виділене, зберігши блоки
+        void reset();
+
+        // Повернути всі блоки системному розподільнику
+        // Return all blocks to the system allocator
+        // Повернути всі блоки системному розподільнику
+        void release();
+
+        // Статистика: байти, видані з останнього reset(), сумарна ємність блоків та їх кількість
+        // Statistics: bytes handed out since the last reset(), total block capacity and block count
+        // Статистика: байти, видані з останнього reset(), сумарна ємність блоків та їх кількість
+        size_t getUsedBytes() const { return usedBytes; }
+        size_t getCapacity() const { return capacity; }
+        size_t getBlockCount() const { return blockCount; }
+
+    private:
+        // Заголовок блоку лежить на початку самого блоку
+        // The block header sits at the start of the block itself
+        // Заголовок блоку лежить на початку самого блоку
+        struct Block {
+            Block* next;
+            size_t size;        // Розмір області даних / Size of the data area / Розмір області даних
+
+            char* begin() { return reinterpret_cast<char*>(this + 1); }
+            char* end() { return begin() + size; }
+        };
+
+        // Перейти до наступного блоку ланцюжка, що вміщує запит, або вставити новий
+        // Move to the next chain block that fits the request, or insert a new one
+        // Перейти до наступного блоку ланцюжка, що вміщує запит, або вставити новий
+        void* allocateSlow(size_t size, size_t alignment);
+
+        static char* alignUp(char* pointer, size_t alignment);
+
+        const size_t blockSize;
+        Block* head;
+        Block* current;
+        char* cursor;
+        char* limit;
+        size_t usedBytes;
+        size_t capacity;
+        size_t blockCount;
+    };
+
+    // Адаптер арени до std::pmr::memory_resource: контейнери std::pmr розміщують дані в арені,
+    // звільнення нічого не робить, пам'ять повертається разом з reset() арени.
+    // Контейнери мають бути знищені або звільнити сховище до reset().
+    // Adapter of an arena to std::pmr::memory_resource: std::pmr containers place their data in the arena,
+    // deallocation does nothing and memory comes back with the arena's reset().
+    // Containers must be destroyed or release their storage before reset().
+    // Адаптер арени до std::pmr::memory_resource: контейнери std::pmr розміщують дані в арені,
+    // звільнення нічого не робить, пам'ять повертається разом з reset() арени.
+    // Контейнери мають бути знищені або звільнити сховище до reset().
+    class ArenaResource : public std::pmr::memory_resource {
+    public:
+        explicit ArenaResource(Arena& arena) : arena(arena) {}
+
+        Arena& getArena() const { return arena; }
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        Arena& arena;
+    };
+
+} // namespace Memory
+} // namespace NeuroSync
+
+#endif // ARENA_H
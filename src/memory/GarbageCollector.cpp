@@ -1,22 +1,34 @@
 #include "GarbageCollector.h"
 #include <iostream>
 #include <algorithm>
+#include <cstdlib>
 
 namespace NeuroSync {
 namespace Memory {
 
+    const size_t GCObject::NOT_ROOT;
+    const size_t GarbageCollector::PAUSE_SAMPLE_COUNT;
+
+    // Кількість одиниць роботи між перевірками дедлайну кванту
+    // Number of work units between checks of the slice deadline
+    // Кількість одиниць роботи між перевірками дедлайну кванту
+    static const size_t DEADLINE_CHECK_INTERVAL = 32;
+
     // Конструктор системи збору сміття
     // Garbage collector constructor
     // Конструктор системи збору сміття
-    GarbageCollector::GarbageCollector() 
-        : collectedObjects(0), totalMemoryFreed(0), autoCollectionRunning(false) {}
+    GarbageCollector::GarbageCollector()
+        : phase(Phase::IDLE), currentColor(0), rootCursor(0), sweepCursor(0),
+          deallocator([](void* address) { free(address); }), pauseBudget(std::chrono::milliseconds(1)),
+          collectedObjects(0), totalMemoryFreed(0), completedCycles(0), autoCollectionRunning(false),
+          pauseSamples(PAUSE_SAMPLE_COUNT, 0), pauseSlices(0), maxPause(0) {}
 
     // Деструктор системи збору сміття
     // Garbage collector destructor
     // Деструктор системи збору сміття
     GarbageCollector::~GarbageCollector() {
         stopAutoCollection();
-        
+
         // Звільнити всі об'єкти GC
         // Free all GC objects
         // Звільнити всі об'єкти GC
@@ -32,22 +44,27 @@ namespace Memory {
         if (!address) {
             return;
         }
-        
+
         std::lock_guard<std::mutex> lock(gcMutex);
-        
+
         // Перевірити, чи об'єкт вже зареєстровано
         // Check if the object is already registered
         // Перевірити, чи об'єкт вже зареєстровано
         if (objects.find(address) != objects.end()) {
             return;
         }
-        
-        // Створити новий об'єкт GC
-        // Create a new GC object
-        // Створити новий об'єкт GC
-        GCObject* obj = new GCObject(address, size);
+
+        // Новий об'єкт отримує колір поточного циклу: під час циклу він уже чорний,
+        // поза циклом стане білим після зміни кольору на початку наступного
+        // A new object gets the current cycle's color: during a cycle it is already black,
+        // outside a cycle it turns white when the color flips at the start of the next one
+        // Новий об'єкт отримує колір поточного циклу: під час циклу він уже чорний,
+        // поза циклом стане білим після зміни кольору на початку наступного
+        GCObject* obj = new GCObject(address, size, currentColor);
+        obj->heapIndex = heap.size();
+        heap.push_back(obj);
         objects[address] = obj;
-        roots.insert(obj); // Додати як кореневий об'єкт за замовчуванням
+        addRoot(obj); // Додати як кореневий об'єкт за замовчуванням
     }
 
     // Додати посилання на об'єкт
@@ -57,9 +74,9 @@ namespace Memory {
         if (!address) {
             return;
         }
-        
+
         std::lock_guard<std::mutex> lock(gcMutex);
-        
+
         // Знайти об'єкт за адресою
         // Find the object by address
         // Знайти об'єкт за адресою
@@ -67,6 +84,13 @@ namespace Memory {
         if (it != objects.end()) {
             it->second->refCount++;
             it->second->lastAccess = std::chrono::steady_clock::now();
+
+            // Об'єкт, на який знову посилаються ззовні, повертається до коренів
+            // An object referenced from outside again goes back to the roots
+            // Об'єкт, на який знову посилаються ззовні, повертається до коренів
+            if (it->second->refCount.load() > 0 && it->second->rootIndex == GCObject::NOT_ROOT) {
+                addRoot(it->second);
+            }
         }
     }
 
@@ -77,9 +101,9 @@ namespace Memory {
         if (!address) {
             return;
         }
-        
+
         std::lock_guard<std::mutex> lock(gcMutex);
-        
+
         // Знайти об'єкт за адресою
         // Find the object by address
         // Знайти об'єкт за адресою
@@ -87,16 +111,64 @@ namespace Memory {
         if (it != objects.end()) {
             it->second->refCount--;
             it->second->lastAccess = std::chrono::steady_clock::now();
-            
+
             // Якщо лічильник посилань став нульовим, видалити з коренів
             // If the reference count becomes zero, remove from roots
             // Якщо лічильник посилань став нульовим, видалити з коренів
-            if (it->second->refCount.load() <= 0) {
-                roots.erase(it->second);
+            if (it->second->refCount.load() <= 0 && it->second->rootIndex != GCObject::NOT_ROOT) {
+                removeRoot(it->second);
             }
         }
     }
 
+    // Додати посилання між об'єктами (з бар'єром запису)
+    // Add a reference between objects (with the write barrier)
+    // Додати посилання між об'єктами (з бар'єром запису)
+    void GarbageCollector::addObjectReference(void* from, void* to) {
+        if (!from || !to) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(gcMutex);
+
+        auto fromIt = objects.find(from);
+        auto toIt = objects.find(to);
+        if (fromIt == objects.end() || toIt == objects.end()) {
+            return;
+        }
+        fromIt->second->references.push_back(toIt->second);
+
+        // Бар'єр вставки: чорний об'єкт не повинен посилатися на білий, тому ціль фарбується в сірий
+        // Insertion barrier: a black object must not point to a white one, so the target is shaded grey
+        // Бар'єр вставки: чорний об'єкт не повинен посилатися на білий, тому ціль фарбується в сірий
+        if (phase != Phase::IDLE) {
+            shade(toIt->second);
+        }
+    }
+
+    // Видалити посилання між об'єктами
+    // Remove a reference between objects
+    // Видалити посилання між об'єктами
+    void GarbageCollector::removeObjectReference(void* from, void* to) {
+        if (!from || !to) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(gcMutex);
+
+        auto fromIt = objects.find(from);
+        auto toIt = objects.find(to);
+        if (fromIt == objects.end() || toIt == objects.end()) {
+            return;
+        }
+        std::vector<GCObject*>& references = fromIt->second->references;
+        auto ref = std::find(references.begin(), references.end(), toIt->second);
+        if (ref != references.end()) {
+            *ref = references.back();
+            references.pop_back();
+        }
+    }
+
     // Позначити об'єкт як доступний (для збору сміття)
     // Mark an object as reachable (for garbage collection)
     // Позначити об'єкт як доступний (для збору сміття)
@@ -104,16 +176,24 @@ namespace Memory {
         if (!address) {
             return;
         }
-        
+
         std::lock_guard<std::mutex> lock(gcMutex);
-        
+
         // Знайти об'єкт за адресою
         // Find the object by address
         // Знайти об'єкт за адресою
         auto it = objects.find(address);
         if (it != objects.end()) {
-            it->second->marked = true;
             it->second->lastAccess = std::chrono::steady_clock::now();
+
+            // Поза циклом позначка чекає на початок наступного циклу
+            // Outside a cycle the mark waits for the start of the next cycle
+            // Поза циклом позначка чекає на початок наступного циклу
+            if (phase == Phase::IDLE) {
+                pendingMarks.push_back(it->second);
+            } else {
+                shade(it->second);
+            }
         }
     }
 
@@ -121,8 +201,109 @@ namespace Memory {
     // Perform garbage collection
     // Виконати збір сміття
     void GarbageCollector::collect() {
+        size_t targetCycles;
+        {
+            std::lock_guard<std::mutex> lock(gcMutex);
+            targetCycles = completedCycles.load() + (phase == Phase::IDLE ? 1 : 2);
+        }
+
+        // Між квантами потік поступається м'ютексом, щоб програма могла продовжити роботу
+        // Between slices the thread yields the mutex so the program can make progress
+        // Між квантами потік поступається м'ютексом, щоб програма могла продовжити роботу
+        while (completedCycles.load() < targetCycles) {
+            collectStep();
+            std::this_thread::yield();
+        }
+    }
+
+    // Виконати один квант збору
+    // Run one collection slice
+    // Виконати один квант збору
+    bool GarbageCollector::collectStep() {
+        std::vector<void*> freed;
+        std::function<void(void*)> release;
+        bool completed = false;
+        {
+            std::lock_guard<std::mutex> lock(gcMutex);
+            auto start = std::chrono::steady_clock::now();
+            auto deadline = start + pauseBudget;
+
+            // Початок циклу: зміна кольору робить усі об'єкти білими
+            // Start of a cycle: flipping the color turns every object white
+            // Початок циклу: зміна кольору робить усі об'єкти білими
+            if (phase == Phase::IDLE) {
+                currentColor ^= 1;
+                phase = Phase::MARK;
+                rootCursor = 0;
+                for (GCObject* obj : pendingMarks) {
+                    shade(obj);
+                }
+                pendingMarks.clear();
+            }
+            if (phase == Phase::MARK && mark(deadline)) {
+                phase = Phase::SWEEP;
+                sweepCursor = 0;
+            }
+            if (phase == Phase::SWEEP && sweep(deadline, freed)) {
+                phase = Phase::IDLE;
+                completed = true;
+                completedCycles++;
+            }
+
+            recordPause(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count());
+            if (!freed.empty()) {
+                release = deallocator;
+            }
+        }
+
+        // Пам'ять звільняється поза м'ютексом колектора
+        // Memory is freed outside the collector mutex
+        // Пам'ять звільняється поза м'ютексом колектора
+        for (void* address : freed) {
+            release(address);
+        }
+        return completed;
+    }
+
+    void GarbageCollector::setPauseBudget(std::chrono::microseconds budget) {
         std::lock_guard<std::mutex> lock(gcMutex);
-        markAndSweep();
+        pauseBudget = budget;
+    }
+
+    std::chrono::microseconds GarbageCollector::getPauseBudget() const {
+        std::lock_guard<std::mutex> lock(gcMutex);
+        return std::chrono::duration_cast<std::chrono::microseconds>(pauseBudget);
+    }
+
+    void GarbageCollector::setDeallocator(std::function<void(void*)> newDeallocator) {
+        std::lock_guard<std::mutex> lock(gcMutex);
+        deallocator = std::move(newDeallocator);
+    }
+
+    size_t GarbageCollector::getTotalObjects() const {
+        std::lock_guard<std::mutex> lock(gcMutex);
+        return objects.size();
+    }
+
+    // Отримати статистику пауз
+    // Get pause statistics
+    // Отримати статистику пауз
+    GCPauseStatistics GarbageCollector::getPauseStatistics() const {
+        std::lock_guard<std::mutex> lock(gcMutex);
+        GCPauseStatistics statistics;
+        statistics.slices = pauseSlices;
+        statistics.cycles = completedCycles.load();
+        statistics.maxNanos = maxPause;
+
+        size_t count = std::min(pauseSlices, pauseSamples.size());
+        if (count > 0) {
+            std::vector<long long> sorted(pauseSamples.begin(), pauseSamples.begin() + count);
+            std::sort(sorted.begin(), sorted.end());
+            statistics.p50Nanos = sorted[count / 2];
+            statistics.p99Nanos = sorted[count * 99 / 100];
+        }
+        return statistics;
     }
 
     // Отримати список всіх зареєстрованих об'єктів
@@ -131,79 +312,150 @@ namespace Memory {
     std::vector<std::pair<void*, size_t>> GarbageCollector::getAllObjects() const {
         std::lock_guard<std::mutex> lock(gcMutex);
         std::vector<std::pair<void*, size_t>> result;
-        
+
         for (const auto& pair : objects) {
             result.emplace_back(pair.first, pair.second->size);
         }
-        
+
         return result;
     }
 
-    // Виконати алгоритм позначення-збору
-    // Perform mark-and-sweep algorithm
-    // Виконати алгоритм позначення-збору
-    void GarbageCollector::markAndSweep() {
-        mark();
-        sweep();
+    // Пофарбувати білий об'єкт у сірий
+    // Shade a white object grey
+    // Пофарбувати білий об'єкт у сірий
+    void GarbageCollector::shade(GCObject* obj) {
+        if (obj->color != currentColor) {
+            obj->color = currentColor;
+            greyStack.push_back(obj);
+        }
+    }
+
+    // Додати об'єкт до коренів; під час циклу новий корінь одразу фарбується
+    // Add an object to the roots; during a cycle a new root is shaded at once
+    // Додати об'єкт до коренів; під час циклу новий корінь одразу фарбується
+    void GarbageCollector::addRoot(GCObject* obj) {
+        obj->rootIndex = roots.size();
+        roots.push_back(obj);
+        if (phase != Phase::IDLE) {
+            shade(obj);
+        }
+    }
+
+    // Прибрати об'єкт з коренів. Під час позначення корінь, що йде, і корінь, перенесений на його місце
+    // (можливо, на вже проскановану позицію), фарбуються - так сканування коренів не пропускає жодного
+    // Take an object off the roots. During marking the leaving root and the root moved into its place
+    // (possibly at an already scanned position) are shaded, so the root scan never misses one
+    // Прибрати об'єкт з коренів. Під час позначення корінь, що йде, і корінь, перенесений на його місце
+    // (можливо, на вже проскановану позицію), фарбуються - так сканування коренів не пропускає жодного
+    void GarbageCollector::removeRoot(GCObject* obj) {
+        GCObject* moved = roots.back();
+        roots[obj->rootIndex] = moved;
+        moved->rootIndex = obj->rootIndex;
+        roots.pop_back();
+        obj->rootIndex = GCObject::NOT_ROOT;
+        if (phase == Phase::MARK) {
+            shade(obj);
+            shade(moved);
+        }
     }
 
     // Позначити доступні об'єкти
     // Mark reachable objects
     // Позначити доступні об'єкти
-    void GarbageCollector::mark() {
-        // У цій спрощеній реалізації ми вважаємо всі кореневі об'єкти позначеними
-        // In this simplified implementation, we consider all root objects as marked
-        // У цій спрощеній реалізації ми вважаємо всі кореневі об'єкти позначеними
-        for (GCObject* obj : roots) {
-            obj->marked = true;
+    bool GarbageCollector::mark(std::chrono::steady_clock::time_point deadline) {
+        size_t work = 0;
+        while (true) {
+            // Спочатку сірі об'єкти (стек лишається малим), потім наступний корінь
+            // Grey objects first (keeps the stack small), then the next root
+            // Спочатку сірі об'єкти (стек лишається малим), потім наступний корінь
+            if (!greyStack.empty()) {
+                GCObject* obj = greyStack.back();
+                greyStack.pop_back();
+                for (GCObject* child : obj->references) {
+                    shade(child);
+                }
+                work += obj->references.size();
+            } else if (rootCursor < roots.size()) {
+                shade(roots[rootCursor++]);
+            } else {
+                return true;
+            }
+
+            if (++work >= DEADLINE_CHECK_INTERVAL) {
+                work = 0;
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    return false;
+                }
+            }
         }
     }
 
     // Зібрати недоступні об'єкти
     // Sweep unreachable objects
     // Зібрати недоступні об'єкти
-    void GarbageCollector::sweep() {
+    bool GarbageCollector::sweep(std::chrono::steady_clock::time_point deadline, std::vector<void*>& freed) {
+        size_t work = 0;
         size_t collected = 0;
         size_t memoryFreed = 0;
-        
-        // Пройтися по всіх об'єктах
-        // Iterate through all objects
-        // Пройтися по всіх об'єктах
-        auto it = objects.begin();
-        while (it != objects.end()) {
-            GCObject* obj = it->second;
-            
-            // Якщо об'єкт не позначений і має нульовий лічильник посилань
-            // If the object is not marked and has zero reference count
-            // Якщо об'єкт не позначений і має нульовий лічильник посилань
-            if (!obj->marked && obj->refCount.load() <= 0) {
-                // Звільнити пам'ять об'єкта
-                // Free the object's memory
-                // Звільнити пам'ять об'єкта
-                free(obj->address);
-                memoryFreed += obj->size;
-                collected++;
-                
-                // Видалити об'єкт з колекцій
-                // Remove the object from collections
-                // Видалити об'єкт з колекцій
-                roots.erase(obj);
-                delete obj;
-                it = objects.erase(it);
+        bool finished = false;
+        while (true) {
+            // Об'єкти, пофарбовані бар'єром під час прибирання, трасуються до продовження прибирання
+            // Objects shaded by the barrier during the sweep are traced before sweeping continues
+            // Об'єкти, пофарбовані бар'єром під час прибирання, трасуються до продовження прибирання
+            if (!greyStack.empty()) {
+                GCObject* obj = greyStack.back();
+                greyStack.pop_back();
+                for (GCObject* child : obj->references) {
+                    shade(child);
+                }
+            } else if (sweepCursor < heap.size()) {
+                GCObject* obj = heap[sweepCursor];
+
+                // Білий об'єкт недоступний: на його місце переноситься останній ще не прибраний
+                // A white object is unreachable: the last not yet swept object moves into its place
+                // Білий об'єкт недоступний: на його місце переноситься останній ще не прибраний
+                if (obj->color != currentColor) {
+                    freed.push_back(obj->address);
+                    memoryFreed += obj->size;
+                    collected++;
+
+                    if (obj->rootIndex != GCObject::NOT_ROOT) {
+                        removeRoot(obj);
+                    }
+                    objects.erase(obj->address);
+                    GCObject* last = heap.back();
+                    heap[sweepCursor] = last;
+                    last->heapIndex = sweepCursor;
+                    heap.pop_back();
+                    delete obj;
+                } else {
+                    sweepCursor++;
+                }
             } else {
-                // Скинути прапор позначення для наступного циклу
-                // Reset the marked flag for the next cycle
-                // Скинути прапор позначення для наступного циклу
-                obj->marked = false;
-                ++it;
+                finished = true;
+                break;
+            }
+
+            if (++work >= DEADLINE_CHECK_INTERVAL) {
+                work = 0;
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    break;
+                }
             }
         }
-        
+
         // Оновити статистику
         // Update statistics
         // Оновити статистику
         collectedObjects += collected;
         totalMemoryFreed += memoryFreed;
+        return finished;
+    }
+
+    void GarbageCollector::recordPause(long long nanos) {
+        pauseSamples[pauseSlices % pauseSamples.size()] = nanos;
+        pauseSlices++;
+        maxPause = std::max(maxPause, nanos);
     }
 
     // Запустити автоматичний збір сміття у фоновому потоці
@@ -213,7 +465,7 @@ namespace Memory {
         if (autoCollectionRunning) {
             return;
         }
-        
+
         autoCollectionRunning = true;
         autoCollectionThread = std::thread(&GarbageCollector::autoCollectionLoop, this, interval);
     }
@@ -230,17 +482,17 @@ namespace Memory {
         }
     }
 
-    // Фонова функція автоматичного збору сміття
-    // Background function for automatic garbage collection
-    // Фонова функція автоматичного збору сміття
+    // Фонова функція автоматичного збору сміття: цикл іде квантами в межах бюджету паузи
+    // Background function for automatic garbage collection: a cycle runs in slices within the pause budget
+    // Фонова функція автоматичного збору сміття: цикл іде квантами в межах бюджету паузи
     void GarbageCollector::autoCollectionLoop(std::chrono::milliseconds interval) {
         while (autoCollectionRunning) {
             std::this_thread::sleep_for(interval);
-            if (autoCollectionRunning) {
-                collect();
+            while (autoCollectionRunning && !collectStep()) {
+                std::this_thread::yield();
             }
         }
     }
 
 } // namespace Memory
-} // namespace NeuroSync
\ No newline at end of file
+} // namespace NeuroSync
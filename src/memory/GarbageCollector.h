@@ -2,13 +2,14 @@
 #define GARBAGE_COLLECTOR_H
 
 #include <cstddef>
+#include <cstdint>
 #include <vector>
-#include <unordered_set>
 #include <unordered_map>
 #include <mutex>
 #include <atomic>
 #include <thread>
 #include <chrono>
+#include <functional>
 
 namespace NeuroSync {
 namespace Memory {
@@ -19,27 +20,69 @@ namespace Memory {
     struct GCObject {
         void* address;              // Адреса об'єкта
         size_t size;                // Розмір об'єкта
-        std::atomic<int> refCount;  // Лічильник посилань
+        std::atomic<int> refCount;  // Лічильник зовнішніх посилань (> 0 - корінь) / External reference count (> 0 - root) / Лічильник зовнішніх посилань (> 0 - корінь)
         std::chrono::steady_clock::time_point lastAccess; // Час останнього доступу
-        bool marked;                // Прапор позначення для збору сміття
+        uint8_t color;              // Колір позначення циклу / Marking color of the cycle / Колір позначення циклу
+        size_t heapIndex;           // Позиція в списку об'єктів / Position in the object list / Позиція в списку об'єктів
+        size_t rootIndex;           // Позиція в списку коренів (NOT_ROOT - не корінь) / Position in the root list (NOT_ROOT - not a root) / Позиція в списку коренів (NOT_ROOT - не корінь)
+        std::vector<GCObject*> references; // Вихідні посилання на інші об'єкти / Outgoing references to other objects / Вихідні посилання на інші об'єкти
         
-        GCObject(void* addr, size_t sz) 
-            : address(addr), size(sz), refCount(1), marked(false) {
+        static const size_t NOT_ROOT = SIZE_MAX;
+        
+        GCObject(void* addr, size_t sz, uint8_t initialColor) 
+            : address(addr), size(sz), refCount(1), color(initialColor), heapIndex(0), rootIndex(NOT_ROOT) {
             lastAccess = std::chrono::steady_clock::now();
         }
     };
 
-    // Система збору сміття для автоматичного управління пам'яттю
-    // Garbage collection system for automatic memory management
-    // Система збору сміття для автоматичного управління пам'яттю
+    // Статистика пауз збору сміття: кожна пауза - один квант роботи під м'ютексом колектора,
+    // перцентилі рахуються за останніми PAUSE_SAMPLE_COUNT квантами
+    // Garbage collection pause statistics: every pause is one slice of work under the collector mutex,
+    // percentiles are computed over the last PAUSE_SAMPLE_COUNT slices
+    // Статистика пауз збору сміття: кожна пауза - один квант роботи під м'ютексом колектора,
+    // перцентилі рахуються за останніми PAUSE_SAMPLE_COUNT квантами
+    struct GCPauseStatistics {
+        size_t slices;              // Усього квантів / Total slices / Усього квантів
+        size_t cycles;              // Завершених циклів збору / Completed collection cycles / Завершених циклів збору
+        long long p50Nanos;         // Медіана паузи / Median pause / Медіана паузи
+        long long p99Nanos;         // 99-й перцентиль паузи / 99th percentile pause / 99-й перцентиль паузи
+        long long maxNanos;         // Найдовша пауза за весь час / Longest pause ever / Найдовша пауза за весь час
+        
+        GCPauseStatistics() : slices(0), cycles(0), p50Nanos(0), p99Nanos(0), maxNanos(0) {}
+    };
+
+    // Система збору сміття для автоматичного управління пам'яттю.
+    // Інкрементальний трасуючий колектор: корені - об'єкти з ненульовим лічильником зовнішніх посилань,
+    // граф будується з addObjectReference(). Позначення трикольорове: сірі об'єкти лежать у стеку,
+    // чорні вже проскановані; бар'єр запису (вставки) фарбує ціль нового посилання в сірий, тому
+    // програма може змінювати граф між квантами. Кольори чергуються між циклами, тож вижилі об'єкти
+    // не треба перефарбовувати. Позначення і прибирання виконуються квантами не довшими за бюджет
+    // паузи, пам'ять звільняється поза м'ютексом колектора.
+    // Garbage collection system for automatic memory management.
+    // Incremental tracing collector: roots are objects with a non-zero external reference count,
+    // the graph is built with addObjectReference(). Marking is tri-color: grey objects sit on a stack,
+    // black ones are already scanned; an (insertion) write barrier shades the target of a new reference grey,
+    // so the program may change the graph between slices. Colors alternate between cycles, so survivors
+    // never need repainting. Marking and sweeping run in slices no longer than the pause budget,
+    // and memory is freed outside the collector mutex.
+    // Система збору сміття для автоматичного управління пам'яттю.
+    // Інкрементальний трасуючий колектор: корені - об'єкти з ненульовим лічильником зовнішніх посилань,
+    // граф будується з addObjectReference(). Позначення трикольорове: сірі об'єкти лежать у стеку,
+    // чорні вже проскановані; бар'єр запису (вставки) фарбує ціль нового посилання в сірий, тому
+    // програма може змінювати граф між квантами. Кольори чергуються між циклами, тож вижилі об'єкти
+    // не треба перефарбовувати. Позначення і прибирання виконуються квантами не довшими за бюджет
+    // паузи, пам'ять звільняється поза м'ютексом колектора.
     class GarbageCollector {
     public:
         GarbageCollector();
         ~GarbageCollector();
         
-        // Зареєструвати об'єкт для збору сміття
-        // Register an object for garbage collection
-        // Зареєструвати об'єкт для збору сміття
+        GarbageCollector(const GarbageCollector&) = delete;
+        GarbageCollector& operator=(const GarbageCollector&) = delete;
+        
+        // Зареєструвати об'єкт для збору сміття (об'єкт стає коренем з одним посиланням)
+        // Register an object for garbage collection (the object becomes a root with one reference)
+        // Зареєструвати об'єкт для збору сміття (об'єкт стає коренем з одним посиланням)
         void registerObject(void* address, size_t size);
         
         // Додати посилання на об'єкт
@@ -52,16 +95,38 @@ namespace Memory {
         // Видалити посилання на об'єкт
         void removeReference(void* address);
         
+        // Додати або видалити посилання з одного зареєстрованого об'єкта на інший
+        // Add or remove a reference from one registered object to another
+        // Додати або видалити посилання з одного зареєстрованого об'єкта на інший
+        void addObjectReference(void* from, void* to);
+        void removeObjectReference(void* from, void* to);
+        
         // Позначити об'єкт як доступний (для збору сміття)
         // Mark an object as reachable (for garbage collection)
         // Позначити об'єкт як доступний (для збору сміття)
         void markObject(void* address);
         
-        // Виконати збір сміття
-        // Perform garbage collection
-        // Виконати збір сміття
+        // Виконати збір сміття (завершити поточний цикл і провести ще один повний цикл)
+        // Perform garbage collection (finish the current cycle and run one more full cycle)
+        // Виконати збір сміття (завершити поточний цикл і провести ще один повний цикл)
         void collect();
         
+        // Виконати один квант збору; повертає true, якщо квант завершив цикл
+        // Run one collection slice; returns true if the slice completed a cycle
+        // Виконати один квант збору; повертає true, якщо квант завершив цикл
+        bool collectStep();
+        
+        // Бюджет паузи: найдовший час, на який квант збору займає м'ютекс колектора
+        // Pause budget: the longest time a collection slice holds the collector mutex
+        // Бюджет паузи: найдовший час, на який квант збору займає м'ютекс колектора
+        void setPauseBudget(std::chrono::microseconds budget);
+        std::chrono::microseconds getPauseBudget() const;
+        
+        // Функція звільнення пам'яті зібраних об'єктів (за замовчуванням free)
+        // Function that frees the memory of collected objects (free by default)
+        // Функція звільнення пам'яті зібраних об'єктів (за замовчуванням free)
+        void setDeallocator(std::function<void(void*)> deallocator);
+        
         // Запустити автоматичний збір сміття у фоновому потоці
         // Start automatic garbage collection in a background thread
         // Запустити автоматичний збір сміття у фоновому потоці
@@ -75,38 +140,78 @@ namespace Memory {
         // Отримати статистику збору сміття
         // Get garbage collection statistics
         // Отримати статистику збору сміття
-        size_t getTotalObjects() const { return objects.size(); }
+        size_t getTotalObjects() const;
         size_t getCollectedObjects() const { return collectedObjects; }
         size_t getTotalMemoryFreed() const { return totalMemoryFreed; }
+        GCPauseStatistics getPauseStatistics() const;
         
         // Отримати список всіх зареєстрованих об'єктів
         // Get list of all registered objects
         // Отримати список всіх зареєстрованих об'єктів
         std::vector<std::pair<void*, size_t>> getAllObjects() const;
         
+        static const size_t PAUSE_SAMPLE_COUNT = 1024;
+        
     private:
+        // Фаза циклу збору
+        // Phase of the collection cycle
+        // Фаза циклу збору
+        enum class Phase {
+            IDLE,       // Цикл не йде / No cycle in progress
+            MARK,       // Сканування коренів і трасування / Root scan and tracing
+            SWEEP       // Прибирання непозначених об'єктів / Sweeping unmarked objects
+        };
+        
         std::unordered_map<void*, GCObject*> objects;  // Зареєстровані об'єкти
-        std::unordered_set<GCObject*> roots;           // Кореневі об'єкти
+        std::vector<GCObject*> heap;                   // Усі об'єкти для прибирання / All objects for sweeping / Усі об'єкти для прибирання
+        std::vector<GCObject*> roots;                  // Кореневі об'єкти
+        std::vector<GCObject*> greyStack;              // Сірі об'єкти / Grey objects / Сірі об'єкти
+        std::vector<GCObject*> pendingMarks;           // Позначені поза циклом / Marked outside a cycle / Позначені поза циклом
+        Phase phase;                                   // Поточна фаза / Current phase / Поточна фаза
+        uint8_t currentColor;                          // Колір позначених у поточному циклі / Color of objects marked in the current cycle / Колір позначених у поточному циклі
+        size_t rootCursor;                             // Наступний корінь для сканування / Next root to scan / Наступний корінь для сканування
+        size_t sweepCursor;                            // Наступний об'єкт для прибирання / Next object to sweep / Наступний об'єкт для прибирання
+        std::function<void(void*)> deallocator;        // Звільнення пам'яті / Memory release / Звільнення пам'яті
+        std::chrono::nanoseconds pauseBudget;          // Бюджет паузи / Pause budget / Бюджет паузи
         mutable std::mutex gcMutex;                    // М'ютекс для потокобезпеки
         std::atomic<size_t> collectedObjects;          // Кількість зібраних об'єктів
         std::atomic<size_t> totalMemoryFreed;          // Загальна звільнена пам'ять
+        std::atomic<size_t> completedCycles;           // Завершені цикли / Completed cycles / Завершені цикли
         std::atomic<bool> autoCollectionRunning;       // Прапор автоматичного збору
         std::thread autoCollectionThread;              // Потік автоматичного збору
         
-        // Виконати алгоритм позначення-збору
-        // Perform mark-and-sweep algorithm
-        // Виконати алгоритм позначення-збору
-        void markAndSweep();
+        // Кільцевий буфер тривалостей квантів
+        // Ring buffer of slice durations
+        // Кільцевий буфер тривалостей квантів
+        std::vector<long long> pauseSamples;
+        size_t pauseSlices;
+        long long maxPause;
+        
+        // Пофарбувати білий об'єкт у сірий (бар'єр запису та сканування коренів)
+        // Shade a white object grey (write barrier and root scan)
+        // Пофарбувати білий об'єкт у сірий (бар'єр запису та сканування коренів)
+        void shade(GCObject* obj);
+        
+        // Додати об'єкт до коренів або прибрати з них
+        // Add an object to the roots or take it off them
+        // Додати об'єкт до коренів або прибрати з них
+        void addRoot(GCObject* obj);
+        void removeRoot(GCObject* obj);
+        
+        // Позначити доступні об'єкти до дедлайну; повертає true, коли сірих об'єктів не залишилось
+        // Mark reachable objects until the deadline; returns true when no grey objects are left
+        // Позначити доступні об'єкти до дедлайну; повертає true, коли сірих об'єктів не залишилось
+        bool mark(std::chrono::steady_clock::time_point deadline);
         
-        // Позначити доступні об'єкти
-        // Mark reachable objects
-        // Позначити доступні об'єкти
-        void mark();
+        // Зібрати недоступні об'єкти до дедлайну; повертає true, коли прибирання завершено
+        // Sweep unreachable objects until the deadline; returns true when the sweep is complete
+        // Зібрати недоступні об'єкти до дедлайну; повертає true, коли прибирання завершено
+        bool sweep(std::chrono::steady_clock::time_point deadline, std::vector<void*>& freed);
         
-        // Зібрати недоступні об'єкти
-        // Sweep unreachable objects
-        // Зібрати недоступні об'єкти
-        void sweep();
+        // Записати тривалість кванту
+        // Record the duration of a slice
+        // Записати тривалість кванту
+        void recordPause(long long nanos);
         
         // Фонова функція автоматичного збору сміття
         // Background function for automatic garbage collection
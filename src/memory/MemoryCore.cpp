@@ -8,9 +8,14 @@ namespace Memory {
     // Конструктор ядра управління пам'яттю
     // Memory management core constructor
     // Конструктор ядра управління пам'яттю
-    MemoryCore::MemoryCore() {
+    MemoryCore::MemoryCore(AllocatorMode mode) : allocatorMode(mode) {
         initializePools();
         garbageCollector = std::make_unique<GarbageCollector>();
+
+        // Зібрані об'єкти повертаються в той пул, з якого їх виділено
+        // Collected objects go back to the pool they were allocated from
+        // Зібрані об'єкти повертаються в той пул, з якого їх виділено
+        garbageCollector->setDeallocator([this](void* address) { deallocate(address); });
     }
 
     // Ініціалізація ядра управління пам'яттю
@@ -35,6 +40,15 @@ namespace Memory {
     // Initialize memory pools
     // Ініціалізувати пули пам'яті
     void MemoryCore::initializePools() {
+        // У режимі SLAB малі та середні об'єкти обслуговує SlabAllocator з областями тих самих розмірів
+        // In SLAB mode small and medium objects are served by SlabAllocator with regions of the same sizes
+        // У режимі SLAB малі та середні об'єкти обслуговує SlabAllocator з областями тих самих розмірів
+        if (allocatorMode == AllocatorMode::SLAB) {
+            slabAllocator = std::make_unique<SlabAllocator>(16 * 1024 * 1024, 64 * 1024 * 1024);
+            initializeLargePool();
+            return;
+        }
+        
         // Ініціалізація пулу для малих об'єктів (16 MB)
         // Initialize pool for small objects (16 MB)
         // Ініціалізація пулу для малих об'єктів (16 MB)
@@ -45,10 +59,24 @@ namespace Memory {
         // Ініціалізація пулу для середніх об'єктів (64 MB)
         mediumPool = std::make_unique<MemoryPool>(64 * 1024 * 1024);
         
-        // Ініціалізація пулу для великих об'єктів (256 MB)
-        // Initialize pool for large objects (256 MB)
-        // Ініціалізація пулу для великих об'єктів (256 MB)
-        largePool = std::make_unique<MemoryPool>(256 * 1024 * 1024);
+        initializeLargePool();
+    }
+
+    // Ініціалізувати пул великих об'єктів (256 MB віртуальної пам'яті).
+    // Сторінки займають фізичну пам'ять лише після першого звернення, прозорі великі сторінки
+    // зменшують кількість промахів TLB, а сторінки звільнених блоків повертаються системі.
+    // Initialize the large object pool (256 MB of virtual memory).
+    // Pages take physical memory only after first touch, transparent huge pages
+    // reduce TLB misses, and pages of freed blocks are returned to the system.
+    // Ініціалізувати пул великих об'єктів (256 MB віртуальної пам'яті).
+    // Сторінки займають фізичну пам'ять лише після першого звернення, прозорі великі сторінки
+    // зменшують кількість промахів TLB, а сторінки звільнених блоків повертаються системі.
+    void MemoryCore::initializeLargePool() {
+        largeRegion = std::make_unique<VirtualRegion>(256 * 1024 * 1024, HugePageMode::TRANSPARENT);
+        largePool = std::make_unique<MemoryPool>(largeRegion->getBase(), largeRegion->getSize());
+        VirtualRegion* region = largeRegion.get();
+        largePool->setReleaseHandler([region](void* begin, size_t size) { region->decommit(begin, size); },
+                                     region->getPageSize());
     }
 
     // Визначити тип пулу за розміром
@@ -72,6 +100,14 @@ namespace Memory {
             return nullptr;
         }
         
+        // Режим SLAB не бере спільний м'ютекс: кеші потоків та пул великих об'єктів синхронізуються самі
+        // SLAB mode does not take the shared mutex: thread caches and the large pool synchronize themselves
+        // Режим SLAB не бере спільний м'ютекс: кеші потоків та пул великих об'єктів синхронізуються самі
+        if (slabAllocator) {
+            void* ptr = size <= SlabAllocator::MAX_SLAB_SIZE ? slabAllocator->allocate(size) : largePool->allocate(size);
+            return ptr ? ptr : malloc(size);
+        }
+        
         std::lock_guard<std::mutex> lock(coreMutex);
         
         // Визначити тип пулу за розміром
@@ -113,6 +149,18 @@ namespace Memory {
             return;
         }
         
+        if (slabAllocator) {
+            if (slabAllocator->deallocate(ptr)) {
+                return;
+            }
+            if (largePool->contains(ptr)) {
+                largePool->deallocate(ptr);
+            } else {
+                free(ptr);
+            }
+            return;
+        }
+        
         std::lock_guard<std::mutex> lock(coreMutex);
         
         // Визначити, до якого пулу належить вказівник
@@ -140,7 +188,6 @@ namespace Memory {
             return;
         }
         
-        std::lock_guard<std::mutex> lock(coreMutex);
         garbageCollector->registerObject(address, size);
     }
 
@@ -152,7 +199,6 @@ namespace Memory {
             return;
         }
         
-        std::lock_guard<std::mutex> lock(coreMutex);
         garbageCollector->addReference(address);
     }
 
@@ -164,23 +210,41 @@ namespace Memory {
             return;
         }
         
-        std::lock_guard<std::mutex> lock(coreMutex);
         garbageCollector->removeReference(address);
     }
 
-    // Виконати збір сміття
-    // Perform garbage collection
-    // Виконати збір сміття
+    // Додати посилання між об'єктами
+    // Add a reference between objects
+    // Додати посилання між об'єктами
+    void MemoryCore::addObjectReference(void* from, void* to) {
+        garbageCollector->addObjectReference(from, to);
+    }
+
+    // Видалити посилання між об'єктами
+    // Remove a reference between objects
+    // Видалити посилання між об'єктами
+    void MemoryCore::removeObjectReference(void* from, void* to) {
+        garbageCollector->removeObjectReference(from, to);
+    }
+
+    // Виконати збір сміття. Колектор синхронізується сам і звільняє пам'ять поза своїм м'ютексом,
+    // тому спільний м'ютекс тут не береться і виділення пам'яті не чекає на весь цикл
+    // Perform garbage collection. The collector synchronizes itself and frees memory outside its mutex,
+    // so the shared mutex is not taken here and allocation does not wait for the whole cycle
+    // Виконати збір сміття. Колектор синхронізується сам і звільняє пам'ять поза своїм м'ютексом,
+    // тому спільний м'ютекс тут не береться і виділення пам'яті не чекає на весь цикл
     void MemoryCore::collectGarbage() {
-        std::lock_guard<std::mutex> lock(coreMutex);
         garbageCollector->collect();
     }
 
+    void MemoryCore::setGCPauseBudget(std::chrono::microseconds budget) {
+        garbageCollector->setPauseBudget(budget);
+    }
+
     // Отримати список всіх зареєстрованих блоків пам'яті
     // Get list of all registered memory blocks
     // Отримати список всіх зареєстрованих блоків пам'яті
     std::vector<std::pair<void*, size_t>> MemoryCore::getAllMemoryBlocks() const {
-        std::lock_guard<std::mutex> lock(coreMutex);
         return garbageCollector->getAllObjects();
     }
 
@@ -188,24 +252,24 @@ namespace Memory {
     // Get memory usage statistics
     // Отримати статистику використання пам'яті
     size_t MemoryCore::getUsedMemory() {
-        std::lock_guard<std::mutex> lock(coreMutex);
-        return smallPool->getUsedSize() + mediumPool->getUsedSize() + largePool->getUsedSize();
+        return getPoolUsedMemory(PoolType::SMALL) + getPoolUsedMemory(PoolType::MEDIUM) + getPoolUsedMemory(PoolType::LARGE);
     }
 
     size_t MemoryCore::getTotalMemory() {
-        std::lock_guard<std::mutex> lock(coreMutex);
-        return smallPool->getTotalSize() + mediumPool->getTotalSize() + largePool->getTotalSize();
+        return getPoolTotalMemory(PoolType::SMALL) + getPoolTotalMemory(PoolType::MEDIUM) + getPoolTotalMemory(PoolType::LARGE);
     }
 
     size_t MemoryCore::getFreeMemory() {
-        std::lock_guard<std::mutex> lock(coreMutex);
-        return smallPool->getFreeSize() + mediumPool->getFreeSize() + largePool->getFreeSize();
+        return getPoolFreeMemory(PoolType::SMALL) + getPoolFreeMemory(PoolType::MEDIUM) + getPoolFreeMemory(PoolType::LARGE);
     }
 
-    // Отримати статистику пулу пам'яті
-    // Get memory pool statistics
-    // Отримати статистику пулу пам'яті
+    // Отримати статистику пулу пам'яті (у режимі SLAB малий і середній пули - області SlabAllocator)
+    // Get memory pool statistics (in SLAB mode the small and medium pools are the SlabAllocator regions)
+    // Отримати статистику пулу пам'яті (у режимі SLAB малий і середній пули - області SlabAllocator)
     size_t MemoryCore::getPoolUsedMemory(PoolType type) {
+        if (slabAllocator && type != PoolType::LARGE) {
+            return slabStatistics(type).usedSize;
+        }
         std::lock_guard<std::mutex> lock(coreMutex);
         switch (type) {
             case PoolType::SMALL:
@@ -220,6 +284,9 @@ namespace Memory {
     }
 
     size_t MemoryCore::getPoolTotalMemory(PoolType type) {
+        if (slabAllocator && type != PoolType::LARGE) {
+            return slabStatistics(type).totalSize;
+        }
         std::lock_guard<std::mutex> lock(coreMutex);
         switch (type) {
             case PoolType::SMALL:
@@ -234,6 +301,10 @@ namespace Memory {
     }
 
     size_t MemoryCore::getPoolFreeMemory(PoolType type) {
+        if (slabAllocator && type != PoolType::LARGE) {
+            SlabAllocator::RegionStatistics statistics = slabStatistics(type);
+            return statistics.totalSize - statistics.usedSize;
+        }
         std::lock_guard<std::mutex> lock(coreMutex);
         switch (type) {
             case PoolType::SMALL:
@@ -247,23 +318,44 @@ namespace Memory {
         }
     }
 
+    FragmentationReport MemoryCore::getPoolFragmentation(PoolType type) {
+        if (slabAllocator && type != PoolType::LARGE) {
+            return FragmentationReport();
+        }
+        switch (type) {
+            case PoolType::SMALL:
+                return smallPool->getFragmentationReport();
+            case PoolType::MEDIUM:
+                return mediumPool->getFragmentationReport();
+            case PoolType::LARGE:
+                return largePool->getFragmentationReport();
+            default:
+                return FragmentationReport();
+        }
+    }
+
+    SlabAllocator::RegionStatistics MemoryCore::slabStatistics(PoolType type) const {
+        return type == PoolType::SMALL ? slabAllocator->getSmallStatistics() : slabAllocator->getMediumStatistics();
+    }
+
     // Отримати статистику збору сміття
     // Get garbage collection statistics
     // Отримати статистику збору сміття
     size_t MemoryCore::getGCTotalObjects() {
-        std::lock_guard<std::mutex> lock(coreMutex);
         return garbageCollector->getTotalObjects();
     }
 
     size_t MemoryCore::getGCCollectedObjects() {
-        std::lock_guard<std::mutex> lock(coreMutex);
         return garbageCollector->getCollectedObjects();
     }
 
     size_t MemoryCore::getGCTotalMemoryFreed() {
-        std::lock_guard<std::mutex> lock(coreMutex);
         return garbageCollector->getTotalMemoryFreed();
     }
 
+    GCPauseStatistics MemoryCore::getGCPauseStatistics() {
+        return garbageCollector->getPauseStatistics();
+    }
+
 } // namespace Memory
 } // namespace NeuroSync
\ No newline at end of file
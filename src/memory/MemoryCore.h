@@ -10,6 +10,8 @@
 // Include new memory management components
 // Підключення нових компонентів управління пам'яттю
 #include "MemoryPool.h"
+#include "SlabAllocator.h"
+#include "VirtualRegion.h"
 #include "GarbageCollector.h"
 
 // MemoryCore.h
@@ -31,7 +33,15 @@ namespace Memory {
             LARGE     // Великі об'єкти (понад 4KB)
         };
         
-        MemoryCore();
+        // Режим розподілу малих і середніх об'єктів
+        // Allocation mode for small and medium objects
+        // Режим розподілу малих і середніх об'єктів
+        enum class AllocatorMode {
+            POOLS,    // Пули першого підходящого блоку під спільним м'ютексом / First-fit pools under a shared mutex
+            SLAB      // Класи розмірів з кешами потоків (SlabAllocator) / Size classes with thread caches (SlabAllocator)
+        };
+        
+        explicit MemoryCore(AllocatorMode mode = AllocatorMode::POOLS);
         ~MemoryCore();
         
         // Ініціалізація ядра управління пам'яттю
@@ -64,11 +74,22 @@ namespace Memory {
         // Видалити посилання на об'єкт
         void removeReference(void* address);
         
-        // Виконати збір сміття
-        // Perform garbage collection
-        // Виконати збір сміття
+        // Додати або видалити посилання між зареєстрованими об'єктами (граф для трасування)
+        // Add or remove a reference between registered objects (the graph for tracing)
+        // Додати або видалити посилання між зареєстрованими об'єктами (граф для трасування)
+        void addObjectReference(void* from, void* to);
+        void removeObjectReference(void* from, void* to);
+        
+        // Виконати збір сміття (квантами; між квантами виділення пам'яті не блокується)
+        // Perform garbage collection (in slices; allocation is not blocked between slices)
+        // Виконати збір сміття (квантами; між квантами виділення пам'яті не блокується)
         void collectGarbage();
         
+        // Бюджет паузи збору сміття
+        // Garbage collection pause budget
+        // Бюджет паузи збору сміття
+        void setGCPauseBudget(std::chrono::microseconds budget);
+        
         // Отримати список всіх зареєстрованих блоків пам'яті
         // Get list of all registered memory blocks
         // Отримати список всіх зареєстрованих блоків пам'яті
@@ -88,14 +109,44 @@ namespace Memory {
         size_t getPoolTotalMemory(PoolType type);
         size_t getPoolFreeMemory(PoolType type);
         
+        // Отримати звіт про фрагментацію пулу (у режимі SLAB для малих і середніх об'єктів - порожній звіт,
+        // бо області SlabAllocator не діляться на блоки змінного розміру)
+        // Get pool fragmentation report (empty for small and medium objects in SLAB mode,
+        // since SlabAllocator regions are not split into variable-size blocks)
+        // Отримати звіт про фрагментацію пулу (у режимі SLAB для малих і середніх об'єктів - порожній звіт,
+        // бо області SlabAllocator не діляться на блоки змінного розміру)
+        FragmentationReport getPoolFragmentation(PoolType type);
+        
         // Отримати статистику збору сміття
         // Get garbage collection statistics
         // Отримати статистику збору сміття
         size_t getGCTotalObjects();
         size_t getGCCollectedObjects();
         size_t getGCTotalMemoryFreed();
+        GCPauseStatistics getGCPauseStatistics();
+        
+        // Отримати режим розподілу
+        // Get allocation mode
+        // Отримати режим розподілу
+        AllocatorMode getAllocatorMode() const { return allocatorMode; }
+        
+        // Отримати режим великих сторінок області великих об'єктів і кількість байт, повернутих з неї системі
+        // Get the huge page mode of the large object region and the number of bytes returned from it to the system
+        // Отримати режим великих сторінок області великих об'єктів і кількість байт, повернутих з неї системі
+        HugePageMode getLargeObjectHugePageMode() const { return largeRegion->getHugePageMode(); }
+        size_t getLargeObjectDecommittedBytes() const { return largeRegion->getDecommittedBytes(); }
         
     private:
+        // Режим розподілу (не змінюється після створення)
+        // Allocation mode (fixed after construction)
+        // Режим розподілу (не змінюється після створення)
+        const AllocatorMode allocatorMode;
+        
+        // Область віртуальної пам'яті під пул великих об'єктів (знищується після пулу)
+        // Virtual memory region under the large object pool (destroyed after the pool)
+        // Область віртуальної пам'яті під пул великих об'єктів (знищується після пулу)
+        std::unique_ptr<VirtualRegion> largeRegion;
+        
         // Пули пам'яті для різних розмірів об'єктів
         // Memory pools for different object sizes
         // Пули пам'яті для різних розмірів об'єктів
@@ -103,6 +154,11 @@ namespace Memory {
         std::unique_ptr<MemoryPool> mediumPool;
         std::unique_ptr<MemoryPool> largePool;
         
+        // Розподільник малих і середніх об'єктів у режимі SLAB (замість smallPool і mediumPool)
+        // Small and medium object allocator in SLAB mode (instead of smallPool and mediumPool)
+        // Розподільник малих і середніх об'єктів у режимі SLAB (замість smallPool і mediumPool)
+        std::unique_ptr<SlabAllocator> slabAllocator;
+        
         // Система збору сміття
         // Garbage collection system
         // Система збору сміття
@@ -122,6 +178,12 @@ namespace Memory {
         // Initialize memory pools
         // Ініціалізувати пули пам'яті
         void initializePools();
+        void initializeLargePool();
+        
+        // Статистика області SlabAllocator для малого або середнього пулу
+        // SlabAllocator region statistics for the small or medium pool
+        // Статистика області SlabAllocator для малого або середнього пулу
+        SlabAllocator::RegionStatistics slabStatistics(PoolType type) const;
     };
 
 } // namespace Memory
@@ -1,16 +1,60 @@
 #include "MemoryPool.h"
 #include <stdexcept>
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
 
 namespace NeuroSync {
 namespace Memory {
 
+    const size_t MemoryPool::ALIGNMENT;
+
+    namespace {
+        // Номер старшого встановленого біта (value != 0)
+        // Index of the highest set bit (value != 0)
+        // Номер старшого встановленого біта (value != 0)
+        size_t highestBit(size_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(63 - __builtin_clzll(static_cast<unsigned long long>(value)));
+#else
+            size_t bit = 0;
+            while (value >>= 1) {
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+
+        // Номер молодшого встановленого біта (value != 0)
+        // Index of the lowest set bit (value != 0)
+        // Номер молодшого встановленого біта (value != 0)
+        size_t lowestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctzll(value));
+#else
+            size_t bit = 0;
+            while ((value & 1) == 0) {
+                value >>= 1;
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+    }
+
     // Конструктор пулу пам'яті
     // Memory pool constructor
     // Конструктор пулу пам'яті
-    MemoryPool::MemoryPool(size_t poolSize) 
-        : totalSize(poolSize), usedSize(0), blockCount(0), freeBlocks(nullptr), usedBlocks(nullptr) {
+    MemoryPool::MemoryPool(size_t poolSize)
+        : poolMemory(nullptr), ownsMemory(true), totalSize(poolSize), usedSize(0), blockCount(0),
+          firstBlock(nullptr), sentinel(nullptr), flBitmap(0), releasePageSize(0) {
+        // Пул має вмістити хоча б один мінімальний блок і завершальний заголовок
+        // The pool must hold at least one minimal block and the terminating header
+        // Пул має вмістити хоча б один мінімальний блок і завершальний заголовок
+        if (poolSize < 2 * HEADER_SIZE + MIN_BLOCK_SIZE + ALIGNMENT) {
+            throw std::invalid_argument("MemoryPool size is too small");
+        }
+
         // Виділити пам'ять для пулу
         // Allocate memory for the pool
         // Виділити пам'ять для пулу
@@ -18,40 +62,38 @@ namespace Memory {
         if (!poolMemory) {
             throw std::bad_alloc();
         }
-        
+
         // Ініціалізувати пул
         // Initialize the pool
         // Ініціалізувати пул
         initializePool();
     }
 
+    MemoryPool::MemoryPool(void* memory, size_t poolSize)
+        : poolMemory(static_cast<char*>(memory)), ownsMemory(false), totalSize(poolSize), usedSize(0), blockCount(0),
+          firstBlock(nullptr), sentinel(nullptr), flBitmap(0), releasePageSize(0) {
+        if (!memory || poolSize < 2 * HEADER_SIZE + MIN_BLOCK_SIZE + ALIGNMENT) {
+            throw std::invalid_argument("MemoryPool memory is too small");
+        }
+        initializePool();
+    }
+
     // Деструктор пулу пам'яті
     // Memory pool destructor
     // Деструктор пулу пам'яті
     MemoryPool::~MemoryPool() {
-        // Звільнити всю пам'ять пулу
-        // Free all pool memory
-        // Звільнити всю пам'ять пулу
-        if (poolMemory) {
+        // Заголовки лежать у самому пулі, тож достатньо звільнити його пам'ять
+        // Headers live inside the pool, so freeing its memory is enough
+        // Заголовки лежать у самому пулі, тож достатньо звільнити його пам'ять
+        if (ownsMemory) {
             free(poolMemory);
         }
-        
-        // Звільнити всі блоки
-        // Free all blocks
-        // Звільнити всі блоки
-        MemoryBlock* current = freeBlocks;
-        while (current) {
-            MemoryBlock* next = current->next;
-            delete current;
-            current = next;
-        }
-        
-        current = usedBlocks;
-        while (current) {
-            MemoryBlock* next = current->next;
-            delete current;
-            current = next;
-        }
+    }
+
+    void MemoryPool::setReleaseHandler(std::function<void(void*, size_t)> handler, size_t pageSize) {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        releaseHandler = std::move(handler);
+        releasePageSize = pageSize;
     }
 
     // Ініціалізувати пул пам'яті
@@ -59,12 +101,27 @@ namespace Memory {
     // Ініціалізувати пул пам'яті
     void MemoryPool::initializePool() {
         std::lock_guard<std::mutex> lock(poolMutex);
-        
-        // Створити один великий вільний блок
-        // Create one large free block
-        // Створити один великий вільний блок
-        MemoryBlock* initialBlock = new MemoryBlock(poolMemory, totalSize);
-        freeBlocks = initialBlock;
+
+        std::memset(slBitmap, 0, sizeof(slBitmap));
+        std::memset(freeLists, 0, sizeof(freeLists));
+
+        // Один великий вільний блок від вирівняного початку та завершальний заголовок у кінці
+        // One large free block from the aligned start and the terminating header at the end
+        // Один великий вільний блок від вирівняного початку та завершальний заголовок у кінці
+        uintptr_t start = reinterpret_cast<uintptr_t>(poolMemory);
+        uintptr_t alignedStart = (start + ALIGNMENT - 1) & ~static_cast<uintptr_t>(ALIGNMENT - 1);
+        size_t usable = (totalSize - (alignedStart - start)) & ~(ALIGNMENT - 1);
+        usable = std::min(usable, (size_t(1) << FL_INDEX_MAX) - ALIGNMENT);
+
+        firstBlock = reinterpret_cast<BlockHeader*>(alignedStart);
+        firstBlock->prevPhysical = nullptr;
+        firstBlock->sizeAndFlags = (usable - 2 * HEADER_SIZE) | 1;
+
+        sentinel = nextPhysical(firstBlock);
+        sentinel->prevPhysical = firstBlock;
+        sentinel->sizeAndFlags = 0;
+
+        insertFreeBlock(firstBlock);
         blockCount = 1;
     }
 
@@ -72,264 +129,306 @@ namespace Memory {
     // Allocate a block of memory from the pool
     // Виділити блок пам'яті з пулу
     void* MemoryPool::allocate(size_t size) {
-        if (size == 0) {
+        if (size == 0 || size >= (size_t(1) << FL_INDEX_MAX)) {
             return nullptr;
         }
-        
+
+        // Розмір корисних даних округлюється до вирівнювання, але не менше посилань списку
+        // The payload size is rounded up to the alignment, but not below the list links
+        // Розмір корисних даних округлюється до вирівнювання, але не менше посилань списку
+        size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        if (size < MIN_BLOCK_SIZE) {
+            size = MIN_BLOCK_SIZE;
+        }
+
         std::lock_guard<std::mutex> lock(poolMutex);
-        
+
         // Знайти вільний блок потрібного розміру
         // Find a free block of required size
         // Знайти вільний блок потрібного розміру
-        MemoryBlock* block = findFreeBlock(size);
+        BlockHeader* block = findFreeBlock(size);
         if (!block) {
             // Недостатньо пам'яті в пулі
             // Not enough memory in the pool
             // Недостатньо пам'яті в пулі
             return nullptr;
         }
-        
-        // Розділити блок, якщо він занадто великий
-        // Split the block if it's too large
-        // Розділити блок, якщо він занадто великий
-        if (block->size > size + sizeof(MemoryBlock)) {
+        removeFreeBlock(block);
+
+        // Розділити блок, якщо залишок вміщує ще один блок
+        // Split the block if the remainder fits another block
+        // Розділити блок, якщо залишок вміщує ще один блок
+        if (blockSize(block) >= size + HEADER_SIZE + MIN_BLOCK_SIZE) {
             splitBlock(block, size);
         }
-        
+
         // Позначити блок як використаний
         // Mark the block as used
         // Позначити блок як використаний
-        block->isFree = false;
-        usedSize += block->size;
-        
-        // Перемістити блок зі списку вільних до списку використаних
-        // Move the block from free list to used list
-        // Перемістити блок зі списку вільних до списку використаних
-        if (block->prev) {
-            block->prev->next = block->next;
-        } else {
-            freeBlocks = block->next;
-        }
-        
-        if (block->next) {
-            block->next->prev = block->prev;
-        }
-        
-        block->prev = nullptr;
-        block->next = usedBlocks;
-        if (usedBlocks) {
-            usedBlocks->prev = block;
-        }
-        usedBlocks = block;
-        
-        return block->address;
+        block->sizeAndFlags &= ~size_t(1);
+        usedSize += blockSize(block);
+
+        return block + 1;
     }
 
     // Звільнити блок пам'яті в пул
     // Deallocate a block of memory to the pool
     // Звільнити блок пам'яті в пул
     void MemoryPool::deallocate(void* ptr) {
-        if (!ptr) {
-            return;
-        }
-        
-        std::lock_guard<std::mutex> lock(poolMutex);
-        
-        // Знайти блок за адресою
-        // Find the block by address
-        // Знайти блок за адресою
-        MemoryBlock* current = usedBlocks;
-        while (current) {
-            if (current->address == ptr) {
-                break;
-            }
-            current = current->next;
-        }
-        
-        if (!current) {
+        // Корисні дані кожного блоку вирівняні, а заголовок лежить безпосередньо перед ними
+        // Every block's payload is aligned and its header sits right before it
+        // Корисні дані кожного блоку вирівняні, а заголовок лежить безпосередньо перед ними
+        char* address = static_cast<char*>(ptr);
+        if (address < reinterpret_cast<char*>(firstBlock + 1) || address >= reinterpret_cast<char*>(sentinel) ||
+            (reinterpret_cast<uintptr_t>(address) & (ALIGNMENT - 1)) != 0) {
             // Адреса не належить цьому пулу
             // Address doesn't belong to this pool
             // Адреса не належить цьому пулу
             return;
         }
-        
+
+        std::lock_guard<std::mutex> lock(poolMutex);
+
+        BlockHeader* block = reinterpret_cast<BlockHeader*>(address) - 1;
+        if (isFree(block) || !isBlockHeader(block)) {
+            // Повторне звільнення або вказівник не на початок блоку
+            // Double free or a pointer that is not at the start of a block
+            // Повторне звільнення або вказівник не на початок блоку
+            return;
+        }
+
         // Позначити блок як вільний
         // Mark the block as free
         // Позначити блок як вільний
-        current->isFree = true;
-        usedSize -= current->size;
-        
-        // Перемістити блок зі списку використаних до списку вільних
-        // Move the block from used list to free list
-        // Перемістити блок зі списку використаних до списку вільних
-        if (current->prev) {
-            current->prev->next = current->next;
-        } else {
-            usedBlocks = current->next;
-        }
-        
-        if (current->next) {
-            current->next->prev = current->prev;
-        }
-        
-        current->prev = nullptr;
-        current->next = freeBlocks;
-        if (freeBlocks) {
-            freeBlocks->prev = current;
-        }
-        freeBlocks = current;
-        
+        usedSize -= blockSize(block);
+        block->sizeAndFlags |= 1;
+        char* freedBegin = reinterpret_cast<char*>(block);
+        char* freedEnd = address + blockSize(block);
+
         // Об'єднати суміжні вільні блоки
         // Merge adjacent free blocks
         // Об'єднати суміжні вільні блоки
-        mergeFreeBlocks();
+        BlockHeader* merged = mergeFreeBlocks(block);
+        insertFreeBlock(merged);
+
+        // Передати обробнику байти звільненого блоку з запасом, обрізані до вільної частини об'єднаного блоку
+        // (посилання списку на початку та заголовок наступного блоку в кінці залишаються)
+        // Hand the freed block's bytes with slack to the handler, clipped to the free part of the merged block
+        // (the list links at the start and the next block's header at the end stay)
+        // Передати обробнику байти звільненого блоку з запасом, обрізані до вільної частини об'єднаного блоку
+        // (посилання списку на початку та заголовок наступного блоку в кінці залишаються)
+        if (releaseHandler) {
+            char* freeBegin = reinterpret_cast<char*>(linksOf(merged) + 1);
+            char* freeEnd = reinterpret_cast<char*>(nextPhysical(merged));
+            char* begin = freedBegin - freeBegin > static_cast<ptrdiff_t>(releasePageSize) ? freedBegin - releasePageSize : freeBegin;
+            char* end = freeEnd - freedEnd > static_cast<ptrdiff_t>(releasePageSize) ? freedEnd + releasePageSize : freeEnd;
+            if (begin < end) {
+                releaseHandler(begin, end - begin);
+            }
+        }
+    }
+
+    bool MemoryPool::isBlockHeader(BlockHeader* block) const {
+        // Розмір перевіряється до переходу до наступного блоку, щоб не читати поза пулом
+        // The size is checked before stepping to the next block so nothing outside the pool is read
+        // Розмір перевіряється до переходу до наступного блоку, щоб не читати поза пулом
+        size_t size = blockSize(block);
+        size_t room = static_cast<size_t>(reinterpret_cast<char*>(sentinel) - reinterpret_cast<char*>(block + 1));
+        if (size == 0 || size > room || (size & (ALIGNMENT - 1)) != 0 || nextPhysical(block)->prevPhysical != block) {
+            return false;
+        }
+
+        BlockHeader* prev = block->prevPhysical;
+        if (prev == nullptr) {
+            return block == firstBlock;
+        }
+        if (prev < firstBlock || prev >= block || (reinterpret_cast<uintptr_t>(prev) & (ALIGNMENT - 1)) != 0) {
+            return false;
+        }
+        return nextPhysical(prev) == block;
+    }
+
+    // Точні індекси: перший рівень - степінь двійки, другий - частина всередині неї
+    // Exact indices: the first level is the power of two, the second is the part inside it
+    // Точні індекси: перший рівень - степінь двійки, другий - частина всередині неї
+    void MemoryPool::mappingInsert(size_t size, size_t& fl, size_t& sl) {
+        if (size < SMALL_BLOCK_SIZE) {
+            fl = 0;
+            sl = size / (SMALL_BLOCK_SIZE / SL_INDEX_COUNT);
+        } else {
+            size_t bit = highestBit(size);
+            sl = (size >> (bit - SL_INDEX_COUNT_LOG2)) ^ SL_INDEX_COUNT;
+            fl = bit - FL_INDEX_SHIFT + 1;
+        }
     }
 
-    // Знайти вільний блок потрібного розміру
-    // Find a free block of required size
-    // Знайти вільний блок потрібного розміру
-    MemoryBlock* MemoryPool::findFreeBlock(size_t size) {
-        MemoryBlock* current = freeBlocks;
-        while (current) {
-            if (current->size >= size) {
-                return current;
+    // Округлення вгору до наступного списку: будь-який блок знайденого списку вміщує запит
+    // Rounding up to the next list: any block of the found list fits the request
+    // Округлення вгору до наступного списку: будь-який блок знайденого списку вміщує запит
+    bool MemoryPool::mappingSearch(size_t size, size_t& fl, size_t& sl) {
+        if (size >= SMALL_BLOCK_SIZE) {
+            size += (size_t(1) << (highestBit(size) - SL_INDEX_COUNT_LOG2)) - 1;
+        }
+        mappingInsert(size, fl, sl);
+        return fl < FL_INDEX_COUNT;
+    }
+
+    // Знайти вільний блок потрібного розміру за бітовими картами
+    // Find a free block of required size using the bitmaps
+    // Знайти вільний блок потрібного розміру за бітовими картами
+    MemoryPool::BlockHeader* MemoryPool::findFreeBlock(size_t size) {
+        size_t fl = 0;
+        size_t sl = 0;
+        if (!mappingSearch(size, fl, sl)) {
+            return nullptr;
+        }
+
+        uint32_t slMap = slBitmap[fl] & (~uint32_t(0) << sl);
+        if (slMap == 0) {
+            uint64_t flMap = flBitmap & (~uint64_t(0) << (fl + 1));
+            if (flMap == 0) {
+                return nullptr;
             }
-            current = current->next;
+            fl = lowestBit(flMap);
+            slMap = slBitmap[fl];
         }
-        return nullptr;
+        return freeLists[fl][lowestBit(slMap)];
     }
 
     // Розділити блок на два менші блоки
     // Split a block into two smaller blocks
     // Розділити блок на два менші блоки
-    void MemoryPool::splitBlock(MemoryBlock* block, size_t size) {
-        // Обчислити розмір нового блоку
-        // Calculate the size of the new block
-        // Обчислити розмір нового блоку
-        size_t remainingSize = block->size - size;
-        
-        // Створити новий блок для решти пам'яті
-        // Create a new block for the remaining memory
-        // Створити новий блок для решти пам'яті
-        void* newAddress = static_cast<char*>(block->address) + size;
-        MemoryBlock* newBlock = new MemoryBlock(newAddress, remainingSize);
-        
-        // Оновити розмір оригінального блоку
-        // Update the size of the original block
-        // Оновити розмір оригінального блоку
-        block->size = size;
-        
-        // Додати новий блок до списку вільних блоків
-        // Add the new block to the free blocks list
-        // Додати новий блок до списку вільних блоків
-        newBlock->next = freeBlocks;
-        if (freeBlocks) {
-            freeBlocks->prev = newBlock;
-        }
-        freeBlocks = newBlock;
+    void MemoryPool::splitBlock(BlockHeader* block, size_t size) {
+        // Залишок отримує власний заголовок одразу за новим розміром блоку
+        // The remainder gets its own header right after the new block size
+        // Залишок отримує власний заголовок одразу за новим розміром блоку
+        size_t remainingSize = blockSize(block) - size - HEADER_SIZE;
+        block->sizeAndFlags = size | (block->sizeAndFlags & 1);
+
+        BlockHeader* remainder = nextPhysical(block);
+        remainder->prevPhysical = block;
+        remainder->sizeAndFlags = remainingSize | 1;
+        nextPhysical(remainder)->prevPhysical = remainder;
+
+        insertFreeBlock(remainder);
         blockCount++;
     }
 
-    // Об'єднати суміжні вільні блоки
-    // Merge adjacent free blocks
-    // Об'єднати суміжні вільні блоки
-    void MemoryPool::mergeFreeBlocks() {
-        // Сортуємо вільні блоки за адресою для полегшення об'єднання
-        // Sort free blocks by address to facilitate merging
-        // Сортируем свободные блоки по адресу для облегчения объединения
-        
-        // Створюємо вектор вільних блоків
-        // Create a vector of free blocks
-        // Создаем вектор свободных блоков
-        std::vector<MemoryBlock*> freeBlocksVector;
-        MemoryBlock* current = freeBlocks;
-        
-        while (current) {
-            freeBlocksVector.push_back(current);
-            current = current->next;
+    // Об'єднати блок із вільними сусідами за граничними тегами
+    // Merge a block with its free neighbours using the boundary tags
+    // Об'єднати блок із вільними сусідами за граничними тегами
+    MemoryPool::BlockHeader* MemoryPool::mergeFreeBlocks(BlockHeader* block) {
+        BlockHeader* prev = block->prevPhysical;
+        if (prev && isFree(prev)) {
+            removeFreeBlock(prev);
+            prev->sizeAndFlags += HEADER_SIZE + blockSize(block);
+            nextPhysical(prev)->prevPhysical = prev;
+            block = prev;
+            blockCount--;
+        }
+
+        // Завершальний заголовок завжди зайнятий, тому сусід справа існує і не вільний за межами пулу
+        // The terminating header is always used, so the right neighbour exists and never runs past the pool
+        // Завершальний заголовок завжди зайнятий, тому сусід справа існує і не вільний за межами пулу
+        BlockHeader* next = nextPhysical(block);
+        if (isFree(next)) {
+            removeFreeBlock(next);
+            block->sizeAndFlags += HEADER_SIZE + blockSize(next);
+            nextPhysical(block)->prevPhysical = block;
+            blockCount--;
+        }
+        return block;
+    }
+
+    // Додати вільний блок на початок його списку
+    // Push a free block to the head of its list
+    // Додати вільний блок на початок його списку
+    void MemoryPool::insertFreeBlock(BlockHeader* block) {
+        size_t fl = 0;
+        size_t sl = 0;
+        mappingInsert(blockSize(block), fl, sl);
+
+        FreeLinks* links = linksOf(block);
+        links->prev = nullptr;
+        links->next = freeLists[fl][sl];
+        if (links->next) {
+            linksOf(links->next)->prev = block;
         }
-        
-        // Сортуємо блоки за адресою
-        // Sort blocks by address
-        // Сортируем блоки по адресу
-        std::sort(freeBlocksVector.begin(), freeBlocksVector.end(), 
-                 [](MemoryBlock* a, MemoryBlock* b) {
-                     return a->address < b->address;
-                 });
-        
-        // Об'єднуємо суміжні блоки
-        // Merge adjacent blocks
-        // Объединяем смежные блоки
-        for (size_t i = 0; i < freeBlocksVector.size(); ) {
-            MemoryBlock* currentBlock = freeBlocksVector[i];
-            size_t mergedCount = 1;
-            
-            // Перевіряємо наступні блоки на суміжність
-            // Check next blocks for adjacency
-            // Проверяем следующие блоки на смежность
-            for (size_t j = i + 1; j < freeBlocksVector.size(); ++j) {
-                MemoryBlock* nextBlock = freeBlocksVector[j];
-                
-                // Перевіряємо, чи блоки суміжні
-                // Check if blocks are adjacent
-                // Проверяем, являются ли блоки смежными
-                char* currentEnd = static_cast<char*>(currentBlock->address) + currentBlock->size;
-                char* nextStart = static_cast<char*>(nextBlock->address);
-                
-                if (currentEnd == nextStart) {
-                    // Блоки суміжні, об'єднуємо їх
-                    // Blocks are adjacent, merge them
-                    // Блоки смежные, объединяем их
-                    currentBlock->size += nextBlock->size;
-                    mergedCount++;
-                    
-                    // Видаляємо об'єднаний блок зі списку
-                    // Remove merged block from list
-                    // Удаляем объединенный блок из списка
-                    if (nextBlock->prev) {
-                        nextBlock->prev->next = nextBlock->next;
-                    } else {
-                        freeBlocks = nextBlock->next;
-                    }
-                    
-                    if (nextBlock->next) {
-                        nextBlock->next->prev = nextBlock->prev;
-                    }
-                    
-                    // Видаляємо блок
-                    // Delete block
-                    // Удаляем блок
-                    delete nextBlock;
-                    blockCount--;
-                } else {
-                    // Блоки не суміжні, зупиняємося
-                    // Blocks are not adjacent, stop
-                    // Блоки не смежные, останавливаемся
-                    break;
+        freeLists[fl][sl] = block;
+        flBitmap |= uint64_t(1) << fl;
+        slBitmap[fl] |= uint32_t(1) << sl;
+    }
+
+    // Вилучити вільний блок з його списку (біти порожнього списку знімаються)
+    // Unlink a free block from its list (bits of an emptied list are cleared)
+    // Вилучити вільний блок з його списку (біти порожнього списку знімаються)
+    void MemoryPool::removeFreeBlock(BlockHeader* block) {
+        size_t fl = 0;
+        size_t sl = 0;
+        mappingInsert(blockSize(block), fl, sl);
+
+        FreeLinks* links = linksOf(block);
+        if (links->next) {
+            linksOf(links->next)->prev = links->prev;
+        }
+        if (links->prev) {
+            linksOf(links->prev)->next = links->next;
+        } else {
+            freeLists[fl][sl] = links->next;
+            if (!links->next) {
+                slBitmap[fl] &= ~(uint32_t(1) << sl);
+                if (slBitmap[fl] == 0) {
+                    flBitmap &= ~(uint64_t(1) << fl);
                 }
             }
-            
-            i += mergedCount;
         }
-        
-        // Перебудовуємо список вільних блоків
-        // Rebuild the free blocks list
-        // Перестраиваем список свободных блоков
-        freeBlocks = nullptr;
-        MemoryBlock* prevBlock = nullptr;
-        
-        for (MemoryBlock* block : freeBlocksVector) {
-            block->prev = prevBlock;
-            block->next = nullptr;
-            
-            if (prevBlock) {
-                prevBlock->next = block;
+    }
+
+    // Отримати статистику пулу
+    // Get pool statistics
+    // Отримати статистику пулу
+    size_t MemoryPool::getUsedSize() const {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        return usedSize;
+    }
+
+    size_t MemoryPool::getFreeSize() const {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        return totalSize - usedSize;
+    }
+
+    size_t MemoryPool::getBlockCount() const {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        return blockCount;
+    }
+
+    // Звіт про фрагментацію: обхід блоків у фізичному порядку
+    // Fragmentation report: walk the blocks in physical order
+    // Звіт про фрагментацію: обхід блоків у фізичному порядку
+    FragmentationReport MemoryPool::getFragmentationReport() const {
+        std::lock_guard<std::mutex> lock(poolMutex);
+
+        FragmentationReport report;
+        for (BlockHeader* block = firstBlock; block != sentinel; block = nextPhysical(block)) {
+            size_t size = blockSize(block);
+            if (isFree(block)) {
+                report.freeBytes += size;
+                report.freeBlocks++;
+                report.largestFreeBlock = std::max(report.largestFreeBlock, size);
             } else {
-                freeBlocks = block;
+                report.usedBlocks++;
             }
-            
-            prevBlock = block;
+            report.headerBytes += HEADER_SIZE;
         }
+
+        // Завершальний заголовок теж займає місце
+        // The terminating header takes space too
+        // Завершальний заголовок теж займає місце
+        report.headerBytes += HEADER_SIZE;
+        if (report.freeBytes > 0) {
+            report.fragmentation = 1.0 - static_cast<double>(report.largestFreeBlock) / static_cast<double>(report.freeBytes);
+        }
+        return report;
     }
 
     // Перевірити, чи належить вказівник цьому пулу
@@ -339,7 +438,7 @@ namespace Memory {
         if (!ptr) {
             return false;
         }
-        
+
         // Перевірити, чи адреса знаходиться в межах пулу
         // Check if the address is within the pool bounds
         // Перевірити, чи адреса знаходиться в межах пулу
@@ -348,4 +447,4 @@ namespace Memory {
     }
 
 } // namespace Memory
-} // namespace NeuroSync
\ No newline at end of file
+} // namespace NeuroSync
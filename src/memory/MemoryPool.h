@@ -2,88 +2,202 @@
 #define MEMORY_POOL_H
 
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <mutex>
+#include <functional>
 
 namespace NeuroSync {
 namespace Memory {
 
-    // Структура для представлення блоку пам'яті в пулі
-    // Structure to represent a memory block in the pool
-    // Структура для представлення блоку пам'яті в пулі
-    struct MemoryBlock {
-        void* address;           // Адреса блоку пам'яті
-        size_t size;             // Розмір блоку
-        bool isFree;             // Прапор вільного блоку
-        MemoryBlock* next;       // Наступний блок у списку
-        MemoryBlock* prev;       // Попередній блок у списку
-        
-        MemoryBlock(void* addr, size_t sz) 
-            : address(addr), size(sz), isFree(true), next(nullptr), prev(nullptr) {}
+    // Звіт про фрагментацію пулу
+    // Pool fragmentation report
+    // Звіт про фрагментацію пулу
+    struct FragmentationReport {
+        size_t freeBytes;           // Сумарний розмір вільних блоків / Total size of free blocks / Сумарний розмір вільних блоків
+        size_t freeBlocks;          // Кількість вільних блоків / Number of free blocks / Кількість вільних блоків
+        size_t largestFreeBlock;    // Найбільший вільний блок / Largest free block / Найбільший вільний блок
+        size_t usedBlocks;          // Кількість зайнятих блоків / Number of used blocks / Кількість зайнятих блоків
+        size_t headerBytes;         // Байти заголовків блоків / Bytes of block headers / Байти заголовків блоків
+        double fragmentation;       // 1 - найбільший / вільні (0 - вся вільна пам'ять суцільна) / 1 - largest / free (0 - all free memory is contiguous) / 1 - найбільший / вільні (0 - вся вільна пам'ять суцільна)
+
+        FragmentationReport()
+            : freeBytes(0), freeBlocks(0), largestFreeBlock(0), usedBlocks(0), headerBytes(0), fragmentation(0.0) {}
     };
 
-    // Пул пам'яті для ефективного управління пам'яттю
-    // Memory pool for efficient memory management
-    // Пул пам'яті для ефективного управління пам'яттю
+    // Пул пам'яті з розподілом Two-Level Segregated Fit (TLSF).
+    // Вільні блоки розкладено по списках за двома рівнями: степінь двійки розміру та одна з
+    // SL_INDEX_COUNT рівних частин усередині неї; дві бітові карти непорожніх списків дозволяють знайти
+    // підходящий блок за сталий час. Заголовок блоку лежить у самому пулі перед корисними даними і
+    // містить розмір та посилання на фізично попередній блок (граничний тег), тому звільнення
+    // об'єднує сусідні вільні блоки теж за сталий час, а сам пул не виділяє пам'ять для обліку.
+    // Pool with Two-Level Segregated Fit (TLSF) allocation.
+    // Free blocks are kept in lists by two levels: the power of two of the size and one of
+    // SL_INDEX_COUNT equal parts inside it; two bitmaps of non-empty lists find a fitting block in
+    // constant time. A block's header lives in the pool itself right before its payload and holds the
+    // size and a link to the physically previous block (a boundary tag), so freeing also merges
+    // neighbouring free blocks in constant time and the pool never allocates for its bookkeeping.
+    // Пул пам'яті з розподілом Two-Level Segregated Fit (TLSF).
+    // Вільні блоки розкладено по списках за двома рівнями: степінь двійки розміру та одна з
+    // SL_INDEX_COUNT рівних частин усередині неї; дві бітові карти непорожніх списків дозволяють знайти
+    // підходящий блок за сталий час. Заголовок блоку лежить у самому пулі перед корисними даними і
+    // містить розмір та посилання на фізично попередній блок (граничний тег), тому звільнення
+    // об'єднує сусідні вільні блоки теж за сталий час, а сам пул не виділяє пам'ять для обліку.
     class MemoryPool {
     public:
         MemoryPool(size_t poolSize);
-        ~MemoryPool();
         
-        // Виділити блок пам'яті з пулу
-        // Allocate a block of memory from the pool
-        // Виділити блок пам'яті з пулу
+        // Пул над зовнішньою пам'яттю (наприклад, VirtualRegion); пул її не звільняє
+        // Pool over external memory (for example a VirtualRegion); the pool does not free it
+        // Пул над зовнішньою пам'яттю (наприклад, VirtualRegion); пул її не звільняє
+        MemoryPool(void* memory, size_t poolSize);
+        ~MemoryPool();
+
+        MemoryPool(const MemoryPool&) = delete;
+        MemoryPool& operator=(const MemoryPool&) = delete;
+
+        // Виділити блок пам'яті з пулу (вирівнювання ALIGNMENT байт)
+        // Allocate a block of memory from the pool (ALIGNMENT-byte aligned)
+        // Виділити блок пам'яті з пулу (вирівнювання ALIGNMENT байт)
         void* allocate(size_t size);
-        
-        // Звільнити блок пам'яті в пул
-        // Deallocate a block of memory to the pool
-        // Звільнити блок пам'яті в пул
+
+        // Звільнити блок пам'яті в пул (вказівники поза пулом, не на початок блоку та повторне звільнення
+        // ігноруються: заголовок перевіряється за граничними тегами сусідів)
+        // Deallocate a block of memory to the pool (pointers outside the pool or not at the start of a block and
+        // double frees are ignored: the header is checked against the neighbours' boundary tags)
+        // Звільнити блок пам'яті в пул (вказівники поза пулом, не на початок блоку та повторне звільнення
+        // ігноруються: заголовок перевіряється за граничними тегами сусідів)
         void deallocate(void* ptr);
         
-        // Отримати статистику пулу
-        // Get pool statistics
-        // Отримати статистику пулу
+        // Обробник звільненої пам'яті: після звільнення блоку отримує (під м'ютексом пулу) ту частину
+        // вільного блоку, де немає даних пулу, - байти самого блоку з запасом pageSize з кожного боку,
+        // щоб сторінки на межі з сусідніми вільними блоками теж повернулися. Власник пам'яті може
+        // повернути ці сторінки системі.
+        // Freed memory handler: after a block is freed it receives (under the pool mutex) the part
+        // of the free block that holds no pool data - the block's own bytes with pageSize of slack on each side,
+        // so pages on the boundary with neighbouring free blocks come back too. The owner of the memory may
+        // return these pages to the system.
+        // Обробник звільненої пам'яті: після звільнення блоку отримує (під м'ютексом пулу) ту частину
+        // вільного блоку, де немає даних пулу, - байти самого блоку з запасом pageSize з кожного боку,
+        // щоб сторінки на межі з сусідніми вільними блоками теж повернулися. Власник пам'яті може
+        // повернути ці сторінки системі.
+        void setReleaseHandler(std::function<void(void*, size_t)> handler, size_t pageSize);
+
+        // Отримати статистику пулу (використаний розмір - корисні дані зайнятих блоків)
+        // Get pool statistics (used size is the payload of used blocks)
+        // Отримати статистику пулу (використаний розмір - корисні дані зайнятих блоків)
         size_t getTotalSize() const { return totalSize; }
-        size_t getUsedSize() const { return usedSize; }
-        size_t getFreeSize() const { return totalSize - usedSize; }
-        size_t getBlockCount() const { return blockCount; }
-        
+        size_t getUsedSize() const;
+        size_t getFreeSize() const;
+        size_t getBlockCount() const;
+
+        // Звіт про фрагментацію (обходить усі блоки пулу)
+        // Fragmentation report (walks all blocks of the pool)
+        // Звіт про фрагментацію (обходить усі блоки пулу)
+        FragmentationReport getFragmentationReport() const;
+
         // Перевірити, чи належить вказівник цьому пулу
         // Check if pointer belongs to this pool
         // Перевірити, чи належить вказівник цьому пулу
         bool contains(void* ptr) const;
-        
+
+        static const size_t ALIGNMENT = 16;
+
     private:
+        // Заголовок блоку всередині пулу; у вільного блоку на початку корисних даних лежать посилання списку
+        // In-pool block header; a free block keeps its list links at the start of its payload
+        // Заголовок блоку всередині пулу; у вільного блоку на початку корисних даних лежать посилання списку
+        struct BlockHeader {
+            BlockHeader* prevPhysical;      // Фізично попередній блок (nullptr для першого) / Physically previous block (nullptr for the first) / Фізично попередній блок (nullptr для першого)
+            size_t sizeAndFlags;            // Розмір корисних даних, молодший біт - прапор вільного блоку / Payload size, the low bit is the free flag / Розмір корисних даних, молодший біт - прапор вільного блоку
+        };
+
+        struct FreeLinks {
+            BlockHeader* next;
+            BlockHeader* prev;
+        };
+
+        // Параметри TLSF: 16 частин на степінь двійки, блоки до 256 байт лежать у першому рядку
+        // TLSF parameters: 16 parts per power of two, blocks below 256 bytes live in the first row
+        // Параметри TLSF: 16 частин на степінь двійки, блоки до 256 байт лежать у першому рядку
+        static const size_t SL_INDEX_COUNT_LOG2 = 4;
+        static const size_t SL_INDEX_COUNT = size_t(1) << SL_INDEX_COUNT_LOG2;
+        static const size_t FL_INDEX_SHIFT = SL_INDEX_COUNT_LOG2 + 4;
+        static const size_t FL_INDEX_MAX = 48;
+        static const size_t FL_INDEX_COUNT = FL_INDEX_MAX - FL_INDEX_SHIFT + 1;
+        static const size_t SMALL_BLOCK_SIZE = size_t(1) << FL_INDEX_SHIFT;
+        static const size_t HEADER_SIZE = sizeof(BlockHeader);
+        static const size_t MIN_BLOCK_SIZE = sizeof(FreeLinks);
+
         char* poolMemory;           // Базова пам'ять пулу
+        bool ownsMemory;            // Пам'ять виділена пулом / Memory allocated by the pool / Пам'ять виділена пулом
         size_t totalSize;           // Загальний розмір пулу
         size_t usedSize;            // Використаний розмір
         size_t blockCount;          // Кількість блоків
-        MemoryBlock* freeBlocks;    // Список вільних блоків
-        MemoryBlock* usedBlocks;    // Список використаних блоків
+        BlockHeader* firstBlock;    // Перший блок пулу / First block of the pool / Перший блок пулу
+        BlockHeader* sentinel;      // Зайнятий блок нульового розміру в кінці пулу / Used zero-size block at the end of the pool / Зайнятий блок нульового розміру в кінці пулу
+
+        // Бітові карти непорожніх списків та самі списки
+        // Bitmaps of non-empty lists and the lists themselves
+        // Бітові карти непорожніх списків та самі списки
+        uint64_t flBitmap;
+        uint32_t slBitmap[FL_INDEX_COUNT];
+        BlockHeader* freeLists[FL_INDEX_COUNT][SL_INDEX_COUNT];
+
         mutable std::mutex poolMutex; // М'ютекс для потокобезпеки
         
+        std::function<void(void*, size_t)> releaseHandler; // Обробник звільненої пам'яті / Freed memory handler / Обробник звільненої пам'яті
+        size_t releasePageSize;
+
         // Ініціалізувати пул пам'яті
         // Initialize memory pool
         // Ініціалізувати пул пам'яті
         void initializePool();
-        
+
+        // Індекси списку для розміру: точні (для вставки) та округлені вгору (для пошуку)
+        // List indices for a size: exact (for insertion) and rounded up (for search)
+        // Індекси списку для розміру: точні (для вставки) та округлені вгору (для пошуку)
+        static void mappingInsert(size_t size, size_t& fl, size_t& sl);
+        static bool mappingSearch(size_t size, size_t& fl, size_t& sl);
+
         // Знайти вільний блок потрібного розміру
         // Find a free block of required size
         // Знайти вільний блок потрібного розміру
-        MemoryBlock* findFreeBlock(size_t size);
-        
-        // Розділити блок на два менші блоки
-        // Split a block into two smaller blocks
-        // Розділити блок на два менші блоки
-        void splitBlock(MemoryBlock* block, size_t size);
-        
-        // Об'єднати суміжні вільні блоки
-        // Merge adjacent free blocks
-        // Об'єднати суміжні вільні блоки
-        void mergeFreeBlocks();
+        BlockHeader* findFreeBlock(size_t size);
+
+        // Розділити блок на два менші блоки (залишок стає вільним)
+        // Split a block into two smaller blocks (the remainder becomes free)
+        // Розділити блок на два менші блоки (залишок стає вільним)
+        void splitBlock(BlockHeader* block, size_t size);
+
+        // Об'єднати вільний блок із вільними фізичними сусідами
+        // Merge a free block with its free physical neighbours
+        // Об'єднати вільний блок із вільними фізичними сусідами
+        BlockHeader* mergeFreeBlocks(BlockHeader* block);
+
+        // Чи є block справжнім заголовком блоку: розмір ненульовий і в межах пулу, а граничні теги
+        // сусідів указують на нього. Застарілий заголовок усередині вільного блоку (можливо, обнулений
+        // обробником звільненої пам'яті) та внутрішній вказівник блоку цю перевірку не проходять.
+        // Whether block is a real block header: its size is non-zero and within the pool, and the boundary tags
+        // of its neighbours point at it. A stale header inside a free block (possibly zeroed by the
+        // freed memory handler) and a pointer into a block's interior fail this check.
+        // Чи є block справжнім заголовком блоку: розмір ненульовий і в межах пулу, а граничні теги
+        // сусідів указують на нього. Застарілий заголовок усередині вільного блоку (можливо, обнулений
+        // обробником звільненої пам'яті) та внутрішній вказівник блоку цю перевірку не проходять.
+        bool isBlockHeader(BlockHeader* block) const;
+
+        void insertFreeBlock(BlockHeader* block);
+        void removeFreeBlock(BlockHeader* block);
+
+        static size_t blockSize(const BlockHeader* block) { return block->sizeAndFlags & ~size_t(1); }
+        static bool isFree(const BlockHeader* block) { return (block->sizeAndFlags & 1) != 0; }
+        static FreeLinks* linksOf(BlockHeader* block) { return reinterpret_cast<FreeLinks*>(block + 1); }
+        static BlockHeader* nextPhysical(BlockHeader* block) {
+            return reinterpret_cast<BlockHeader*>(reinterpret_cast<char*>(block + 1) + blockSize(block));
+        }
     };
 
 } // namespace Memory
 } // namespace NeuroSync
 
-#endif // MEMORY_POOL_H
\ No newline at end of file
+#endif // MEMORY_POOL_H
@@ -0,0 +1,350 @@
+#include "SlabAllocator.h"
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+namespace NeuroSync {
+namespace Memory {
+
+    namespace {
+        // Кількість малих класів (до SMALL_OBJECT_LIMIT включно)
+        // Number of small classes (up to SMALL_OBJECT_LIMIT inclusive)
+        // Кількість малих класів (до SMALL_OBJECT_LIMIT включно)
+        const size_t SMALL_CLASS_COUNT = 12;
+
+        // Обсяг, який магазин класу може тримати в кеші потоку
+        // Amount a class magazine may hold in a thread cache
+        // Обсяг, який магазин класу може тримати в кеші потоку
+        const size_t MAGAZINE_BYTES = 32 * 1024;
+
+        // Реєстр кешів потоків: захищає списки кешів розподільників і їхніх власників.
+        // Ніколи не знищується, щоб пережити thread_local кеші.
+        // Thread cache registry: guards the allocators' cache lists and the caches' owners.
+        // Never destroyed so it outlives thread_local caches.
+        // Реєстр кешів потоків: захищає списки кешів розподільників і їхніх власників.
+        // Ніколи не знищується, щоб пережити thread_local кеші.
+        std::mutex& registryMutex() {
+            static std::mutex* mutex = new std::mutex();
+            return *mutex;
+        }
+
+        // Ідентифікатори розподільників не повторюються, тож кеш знищеного розподільника не сплутати з новим
+        // Allocator IDs are never reused, so the cache of a destroyed allocator cannot be mistaken for a new one
+        // Ідентифікатори розподільників не повторюються, тож кеш знищеного розподільника не сплутати з новим
+        std::atomic<uint64_t> nextAllocatorId(1);
+    }
+
+    // Кеш потоку: магазин на кожен клас і байти, видані цим потоком (пише лише власний потік)
+    // Thread cache: a magazine per class and the bytes handed out by this thread (written by its own thread only)
+    // Кеш потоку: магазин на кожен клас і байти, видані цим потоком (пише лише власний потік)
+    struct SlabAllocator::ThreadCache {
+        struct Magazine {
+            size_t count;
+            size_t capacity;
+            void* objects[MAX_MAGAZINE_SIZE];
+        };
+
+        SlabAllocator* owner;                // nullptr після знищення власника (під реєстром) / nullptr once the owner is destroyed (under the registry) / nullptr після знищення власника (під реєстром)
+        const uint64_t ownerId;
+        Magazine magazines[SIZE_CLASS_COUNT];
+        std::atomic<long long> usedBytes[2];
+
+        ThreadCache(SlabAllocator* owner, uint64_t ownerId) : owner(owner), ownerId(ownerId) {
+            for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i) {
+                magazines[i].count = 0;
+                magazines[i].capacity = std::max<size_t>(8, std::min(MAX_MAGAZINE_SIZE, MAGAZINE_BYTES / classSize(i)));
+            }
+            usedBytes[0].store(0, std::memory_order_relaxed);
+            usedBytes[1].store(0, std::memory_order_relaxed);
+        }
+
+        void addUsed(size_t sizeClass, long long bytes) {
+            std::atomic<long long>& counter = usedBytes[sizeClass < SMALL_CLASS_COUNT ? 0 : 1];
+            counter.store(counter.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+        }
+    };
+
+    // Кеші поточного потоку для всіх розподільників; при завершенні потоку повертаються власникам
+    // The current thread's caches for all allocators; returned to their owners when the thread exits
+    // Кеші поточного потоку для всіх розподільників; при завершенні потоку повертаються власникам
+    struct ThreadCacheList {
+        uint64_t lastId;
+        SlabAllocator::ThreadCache* last;
+        std::vector<SlabAllocator::ThreadCache*> entries;
+
+        ThreadCacheList() : lastId(0), last(nullptr) {}
+
+        ~ThreadCacheList() {
+            std::lock_guard<std::mutex> lock(registryMutex());
+            for (SlabAllocator::ThreadCache* cache : entries) {
+                if (cache->owner) {
+                    cache->owner->releaseCache(cache);
+                }
+                delete cache;
+            }
+        }
+    };
+
+    static thread_local ThreadCacheList threadCaches;
+
+    const size_t SlabAllocator::SIZE_CLASS_COUNT;
+    const size_t SlabAllocator::MAX_SLAB_SIZE;
+    const size_t SlabAllocator::SMALL_OBJECT_LIMIT;
+    const size_t SlabAllocator::SPAN_SIZE;
+    const size_t SlabAllocator::MAX_MAGAZINE_SIZE;
+
+    // Конструктор розподільника
+    // Allocator constructor
+    // Конструктор розподільника
+    SlabAllocator::SlabAllocator(size_t smallRegionSize, size_t mediumRegionSize)
+        : id(nextAllocatorId.fetch_add(1)) {
+        retiredUsedBytes[0] = 0;
+        retiredUsedBytes[1] = 0;
+        initializeRegion(smallRegion, smallRegionSize);
+        try {
+            initializeRegion(mediumRegion, mediumRegionSize);
+        } catch (...) {
+            free(smallRegion.memory);
+            throw;
+        }
+    }
+
+    // Деструктор: кеші інших потоків втрачають власника і звільняються при завершенні своїх потоків
+    // Destructor: other threads' caches lose their owner and are freed when their threads exit
+    // Деструктор: кеші інших потоків втрачають власника і звільняються при завершенні своїх потоків
+    SlabAllocator::~SlabAllocator() {
+        {
+            std::lock_guard<std::mutex> lock(registryMutex());
+            for (ThreadCache* cache : caches) {
+                cache->owner = nullptr;
+            }
+            caches.clear();
+        }
+        free(smallRegion.memory);
+        free(mediumRegion.memory);
+    }
+
+    // Ініціалізувати область (розмір округлюється вниз до цілих прольотів, але не менше одного)
+    // Initialize a region (the size is rounded down to whole spans, but at least one)
+    // Ініціалізувати область (розмір округлюється вниз до цілих прольотів, але не менше одного)
+    void SlabAllocator::initializeRegion(Region& region, size_t size) {
+        region.spanCount = std::max<size_t>(1, size / SPAN_SIZE);
+        region.size = region.spanCount * SPAN_SIZE;
+        region.memory = static_cast<char*>(malloc(region.size));
+        if (!region.memory) {
+            throw std::bad_alloc();
+        }
+        region.spanClasses.assign(region.spanCount, 0);
+    }
+
+    // Клас розміру: кроком 16 байт до 128, далі чотири класи на степінь двійки
+    // Size class: 16-byte steps up to 128, then four classes per power of two
+    // Клас розміру: кроком 16 байт до 128, далі чотири класи на степінь двійки
+    size_t SlabAllocator::sizeClassOf(size_t size) {
+        if (size <= 128) {
+            return size == 0 ? 0 : (size + 15) / 16 - 1;
+        }
+        size_t value = size - 1;
+        size_t highBit = 7;
+        while ((value >> (highBit + 1)) != 0) {
+            ++highBit;
+        }
+        size_t base = size_t(1) << highBit;
+        return 8 + (highBit - 7) * 4 + (value - base) / (base / 4);
+    }
+
+    size_t SlabAllocator::classSize(size_t sizeClass) {
+        if (sizeClass < 8) {
+            return 16 * (sizeClass + 1);
+        }
+        size_t base = size_t(128) << ((sizeClass - 8) / 4);
+        return base + ((sizeClass - 8) % 4 + 1) * (base / 4);
+    }
+
+    // Виділити об'єкт з магазину потоку, поповнивши його пакетом з центрального списку
+    // Allocate an object from the thread's magazine, refilling it with a batch from the central list
+    // Виділити об'єкт з магазину потоку, поповнивши його пакетом з центрального списку
+    void* SlabAllocator::allocate(size_t size) {
+        if (size > MAX_SLAB_SIZE) {
+            return nullptr;
+        }
+        size_t sizeClass = sizeClassOf(size);
+        ThreadCache& cache = localCache();
+        ThreadCache::Magazine& magazine = cache.magazines[sizeClass];
+        if (magazine.count == 0) {
+            magazine.count = refill(sizeClass, magazine.objects, magazine.capacity / 2);
+            if (magazine.count == 0) {
+                return nullptr;
+            }
+        }
+        cache.addUsed(sizeClass, static_cast<long long>(classSize(sizeClass)));
+        return magazine.objects[--magazine.count];
+    }
+
+    // Звільнити об'єкт до магазину потоку; повний магазин віддає половину центральному списку
+    // Free an object into the thread's magazine; a full magazine hands half to the central list
+    // Звільнити об'єкт до магазину потоку; повний магазин віддає половину центральному списку
+    bool SlabAllocator::deallocate(void* ptr) {
+        const Region* region = regionContaining(ptr);
+        if (!region) {
+            return false;
+        }
+        size_t span = static_cast<size_t>(static_cast<char*>(ptr) - region->memory) / SPAN_SIZE;
+        size_t sizeClass = region->spanClasses[span];
+
+        ThreadCache& cache = localCache();
+        ThreadCache::Magazine& magazine = cache.magazines[sizeClass];
+        if (magazine.count == magazine.capacity) {
+            size_t half = magazine.capacity / 2;
+            flush(sizeClass, magazine.objects + magazine.count - half, half);
+            magazine.count -= half;
+        }
+        magazine.objects[magazine.count++] = ptr;
+        cache.addUsed(sizeClass, -static_cast<long long>(classSize(sizeClass)));
+        return true;
+    }
+
+    bool SlabAllocator::contains(const void* ptr) const {
+        return regionContaining(ptr) != nullptr;
+    }
+
+    SlabAllocator::Region& SlabAllocator::regionOf(size_t sizeClass) {
+        return sizeClass < SMALL_CLASS_COUNT ? smallRegion : mediumRegion;
+    }
+
+    const SlabAllocator::Region* SlabAllocator::regionContaining(const void* ptr) const {
+        const char* address = static_cast<const char*>(ptr);
+        if (address >= smallRegion.memory && address < smallRegion.memory + smallRegion.size) {
+            return &smallRegion;
+        }
+        if (address >= mediumRegion.memory && address < mediumRegion.memory + mediumRegion.size) {
+            return &mediumRegion;
+        }
+        return nullptr;
+    }
+
+    SlabAllocator::ThreadCache& SlabAllocator::localCache() {
+        ThreadCacheList& list = threadCaches;
+        if (list.lastId == id) {
+            return *list.last;
+        }
+        for (ThreadCache* cache : list.entries) {
+            if (cache->ownerId == id) {
+                list.lastId = id;
+                list.last = cache;
+                return *cache;
+            }
+        }
+        return *createCache();
+    }
+
+    // Створити кеш потоку; заодно прибрати кеші вже знищених розподільників
+    // Create a thread cache; caches of already destroyed allocators are dropped on the way
+    // Створити кеш потоку; заодно прибрати кеші вже знищених розподільників
+    SlabAllocator::ThreadCache* SlabAllocator::createCache() {
+        ThreadCacheList& list = threadCaches;
+        std::unique_ptr<ThreadCache> cache(new ThreadCache(this, id));
+
+        std::lock_guard<std::mutex> lock(registryMutex());
+        auto dead = std::remove_if(list.entries.begin(), list.entries.end(), [](ThreadCache* entry) {
+            if (entry->owner) {
+                return false;
+            }
+            delete entry;
+            return true;
+        });
+        list.entries.erase(dead, list.entries.end());
+
+        caches.push_back(cache.get());
+        list.entries.push_back(cache.get());
+        list.lastId = id;
+        list.last = cache.release();
+        return list.last;
+    }
+
+    // Взяти до count об'єктів: спершу вільні, потім нарізати з прольоту класу
+    // Take up to count objects: free ones first, then carve from the class's span
+    // Взяти до count об'єктів: спершу вільні, потім нарізати з прольоту класу
+    size_t SlabAllocator::refill(size_t sizeClass, void** objects, size_t count) {
+        CentralList& central = centralLists[sizeClass];
+        std::lock_guard<std::mutex> lock(central.mutex);
+
+        size_t taken = std::min(count, central.freeObjects.size());
+        std::copy(central.freeObjects.end() - taken, central.freeObjects.end(), objects);
+        central.freeObjects.resize(central.freeObjects.size() - taken);
+
+        size_t size = classSize(sizeClass);
+        while (taken < count) {
+            if (!central.spanCursor || static_cast<size_t>(central.spanEnd - central.spanCursor) < size) {
+                Region& region = regionOf(sizeClass);
+                size_t span = region.nextSpan.fetch_add(1);
+                if (span >= region.spanCount) {
+                    break;
+                }
+                region.spanClasses[span] = static_cast<uint8_t>(sizeClass);
+                central.spanCursor = region.memory + span * SPAN_SIZE;
+                central.spanEnd = central.spanCursor + SPAN_SIZE;
+            }
+            objects[taken++] = central.spanCursor;
+            central.spanCursor += size;
+        }
+        return taken;
+    }
+
+    void SlabAllocator::flush(size_t sizeClass, void* const* objects, size_t count) {
+        CentralList& central = centralLists[sizeClass];
+        std::lock_guard<std::mutex> lock(central.mutex);
+        central.freeObjects.insert(central.freeObjects.end(), objects, objects + count);
+    }
+
+    // Повернути магазини та облік завершеного потоку (викликається під реєстром)
+    // Return the magazines and accounting of an exited thread (called under the registry)
+    // Повернути магазини та облік завершеного потоку (викликається під реєстром)
+    void SlabAllocator::releaseCache(ThreadCache* cache) {
+        for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i) {
+            ThreadCache::Magazine& magazine = cache->magazines[i];
+            if (magazine.count > 0) {
+                flush(i, magazine.objects, magazine.count);
+                magazine.count = 0;
+            }
+        }
+        retiredUsedBytes[0] += cache->usedBytes[0].load(std::memory_order_relaxed);
+        retiredUsedBytes[1] += cache->usedBytes[1].load(std::memory_order_relaxed);
+        caches.erase(std::remove(caches.begin(), caches.end(), cache), caches.end());
+    }
+
+    SlabAllocator::RegionStatistics SlabAllocator::getSmallStatistics() const {
+        return regionStatistics(smallRegion, true);
+    }
+
+    SlabAllocator::RegionStatistics SlabAllocator::getMediumStatistics() const {
+        return regionStatistics(mediumRegion, false);
+    }
+
+    // Зведення обліку кешів потоків; об'єкт, звільнений іншим потоком, зменшує лічильник саме того потоку,
+    // тому окремі лічильники можуть бути від'ємними, а сума - ні
+    // Merge the thread caches' accounting; an object freed by another thread decrements that thread's counter,
+    // so single counters may go negative while the sum does not
+    // Зведення обліку кешів потоків; об'єкт, звільнений іншим потоком, зменшує лічильник саме того потоку,
+    // тому окремі лічильники можуть бути від'ємними, а сума - ні
+    SlabAllocator::RegionStatistics SlabAllocator::regionStatistics(const Region& region, bool small) const {
+        size_t index = small ? 0 : 1;
+        long long used = 0;
+        {
+            std::lock_guard<std::mutex> lock(registryMutex());
+            used = retiredUsedBytes[index];
+            for (const ThreadCache* cache : caches) {
+                used += cache->usedBytes[index].load(std::memory_order_relaxed);
+            }
+        }
+
+        RegionStatistics statistics;
+        statistics.totalSize = region.size;
+        statistics.usedSize = static_cast<size_t>(std::max(0LL, used));
+        statistics.spansInUse = std::min(region.nextSpan.load(), region.spanCount);
+        return statistics;
+    }
+
+} // namespace Memory
+} // namespace NeuroSync
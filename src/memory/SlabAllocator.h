@@ -0,0 +1,163 @@
+#ifndef SLAB_ALLOCATOR_H
+#define SLAB_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// SlabAllocator.h
+// Розподільник малих об'єктів за класами розмірів з кешами потоків
+// Size-class allocator for small objects with per-thread caches
+// Розподільник малих об'єктів за класами розмірів з кешами потоків
+
+namespace NeuroSync {
+namespace Memory {
+
+    // Розподільник малих об'єктів (до MAX_SLAB_SIZE байт).
+    // Розмір округлюється до одного з SIZE_CLASS_COUNT класів: кроком 16 байт до 128, далі чотири класи
+    // на кожен степінь двійки. Об'єкти класу нарізаються з прольотів SPAN_SIZE байт, що беруться з двох
+    // неперервних областей: малої (класи до SMALL_OBJECT_LIMIT) та середньої (решта). Розміри областей
+    // відповідають пулам MemoryCore, тому облік пам'яті пулів зберігається.
+    // Кожен потік має магазин вільних об'єктів на клас: виділення та звільнення працюють з ним без
+    // блокувань і атомарних операцій, а з центральним списком класу (під м'ютексом класу) обмінюються
+    // лише пакети по половині магазину. Об'єкт можна звільнити з будь-якого потоку.
+    // Проліт, виданий класу, залишається за ним до знищення розподільника.
+    // Small object allocator (up to MAX_SLAB_SIZE bytes).
+    // A size is rounded up to one of SIZE_CLASS_COUNT classes: 16-byte steps up to 128, then four classes
+    // per power of two. Objects of a class are carved from spans of SPAN_SIZE bytes taken from two
+    // contiguous regions: a small one (classes up to SMALL_OBJECT_LIMIT) and a medium one (the rest). The region
+    // sizes match the MemoryCore pools, so pool memory accounting is kept.
+    // Every thread has a magazine of free objects per class: allocation and deallocation work on it without
+    // locks or atomic operations, and only batches of half a magazine are exchanged with the class's
+    // central list (under the class mutex). An object may be freed from any thread.
+    // A span given to a class stays with it until the allocator is destroyed.
+    // Розподільник малих об'єктів (до MAX_SLAB_SIZE байт).
+    // Розмір округлюється до одного з SIZE_CLASS_COUNT класів: кроком 16 байт до 128, далі чотири класи
+    // на кожен степінь двійки. Об'єкти класу нарізаються з прольотів SPAN_SIZE байт, що беруться з двох
+    // неперервних областей: малої (класи до SMALL_OBJECT_LIMIT) та середньої (решта). Розміри областей
+    // відповідають пулам MemoryCore, тому облік пам'яті пулів зберігається.
+    // Кожен потік має магазин вільних об'єктів на клас: виділення та звільнення працюють з ним без
+    // блокувань і атомарних операцій, а з центральним списком класу (під м'ютексом класу) обмінюються
+    // лише пакети по половині магазину. Об'єкт можна звільнити з будь-якого потоку.
+    // Проліт, виданий класу, залишається за ним до знищення розподільника.
+    class SlabAllocator {
+    public:
+        static const size_t SIZE_CLASS_COUNT = 28;
+        static const size_t MAX_SLAB_SIZE = 4096;
+        static const size_t SMALL_OBJECT_LIMIT = 256;
+        static const size_t SPAN_SIZE = 64 * 1024;
+        static const size_t MAX_MAGAZINE_SIZE = 64;
+
+        // Статистика області
+        // Region statistics
+        // Статистика області
+        struct RegionStatistics {
+            size_t totalSize;       // Розмір області / Region size / Розмір області
+            size_t usedSize;        // Байти виданих об'єктів (за розміром класу) / Bytes of live objects (by class size) / Байти виданих об'єктів (за розміром класу)
+            size_t spansInUse;      // Прольоти, видані класам / Spans given to classes / Прольоти, видані класам
+
+            RegionStatistics() : totalSize(0), usedSize(0), spansInUse(0) {}
+        };
+
+        SlabAllocator(size_t smallRegionSize, size_t mediumRegionSize);
+        ~SlabAllocator();
+
+        SlabAllocator(const SlabAllocator&) = delete;
+        SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+        // Виділити об'єкт; nullptr, якщо розмір більший за MAX_SLAB_SIZE або область вичерпано
+        // Allocate an object; nullptr if the size exceeds MAX_SLAB_SIZE or the region is exhausted
+        // Виділити об'єкт; nullptr, якщо розмір більший за MAX_SLAB_SIZE або область вичерпано
+        void* allocate(size_t size);
+
+        // Звільнити об'єкт; false, якщо вказівник не належить цьому розподільнику
+        // Free an object; false if the pointer does not belong to this allocator
+        // Звільнити об'єкт; false, якщо вказівник не належить цьому розподільнику
+        bool deallocate(void* ptr);
+
+        // Перевірити, чи належить вказівник одній з областей
+        // Check if the pointer belongs to one of the regions
+        // Перевірити, чи належить вказівник одній з областей
+        bool contains(const void* ptr) const;
+
+        // Клас розміру та його розмір у байтах
+        // Size class and its size in bytes
+        // Клас розміру та його розмір у байтах
+        static size_t sizeClassOf(size_t size);
+        static size_t classSize(size_t sizeClass);
+
+        // Статистика малої та середньої областей (об'єкти в кешах потоків вважаються вільними)
+        // Statistics of the small and medium regions (objects in thread caches count as free)
+        // Статистика малої та середньої областей (об'єкти в кешах потоків вважаються вільними)
+        RegionStatistics getSmallStatistics() const;
+        RegionStatistics getMediumStatistics() const;
+
+    private:
+        struct ThreadCache;
+        friend struct ThreadCacheList;
+
+        // Неперервна область, з якої по черзі видаються прольоти
+        // A contiguous region that hands out spans in turn
+        // Неперервна область, з якої по черзі видаються прольоти
+        struct Region {
+            char* memory;
+            size_t size;
+            size_t spanCount;
+            std::atomic<size_t> nextSpan;
+            std::vector<uint8_t> spanClasses;       // Клас кожного виданого прольоту / Class of every given span / Клас кожного виданого прольоту
+
+            Region() : memory(nullptr), size(0), spanCount(0), nextSpan(0) {}
+        };
+
+        // Центральний список класу: вільні об'єкти та залишок поточного прольоту
+        // Central list of a class: free objects and the rest of the current span
+        // Центральний список класу: вільні об'єкти та залишок поточного прольоту
+        struct CentralList {
+            std::mutex mutex;
+            std::vector<void*> freeObjects;
+            char* spanCursor;
+            char* spanEnd;
+
+            CentralList() : spanCursor(nullptr), spanEnd(nullptr) {}
+        };
+
+        void initializeRegion(Region& region, size_t size);
+        Region& regionOf(size_t sizeClass);
+        const Region* regionContaining(const void* ptr) const;
+        RegionStatistics regionStatistics(const Region& region, bool small) const;
+
+        // Кеш поточного потоку для цього розподільника (створюється при першому зверненні)
+        // The current thread's cache for this allocator (created on first use)
+        // Кеш поточного потоку для цього розподільника (створюється при першому зверненні)
+        ThreadCache& localCache();
+        ThreadCache* createCache();
+
+        // Обмін пакетами між магазином і центральним списком
+        // Batch exchange between a magazine and the central list
+        // Обмін пакетами між магазином і центральним списком
+        size_t refill(size_t sizeClass, void** objects, size_t count);
+        void flush(size_t sizeClass, void* const* objects, size_t count);
+
+        // Повернення всього кешу потоку (при завершенні потоку)
+        // Return a whole thread cache (when the thread exits)
+        // Повернення всього кешу потоку (при завершенні потоку)
+        void releaseCache(ThreadCache* cache);
+
+        const uint64_t id;
+        Region smallRegion;
+        Region mediumRegion;
+        CentralList centralLists[SIZE_CLASS_COUNT];
+
+        // Кеші потоків цього розподільника та байти, враховані кешами завершених потоків (під реєстром)
+        // Thread caches of this allocator and bytes accounted by caches of exited threads (under the registry)
+        // Кеші потоків цього розподільника та байти, враховані кешами завершених потоків (під реєстром)
+        std::vector<ThreadCache*> caches;
+        long long retiredUsedBytes[2];
+    };
+
+} // namespace Memory
+} // namespace NeuroSync
+
+#endif // SLAB_ALLOCATOR_H
@@ -0,0 +1,163 @@
+#include "VirtualRegion.h"
+#include <cstdint>
+#include <new>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace NeuroSync {
+namespace Memory {
+
+    const size_t VirtualRegion::HUGE_PAGE_SIZE;
+
+    static size_t roundUp(size_t value, size_t granularity) {
+        return (value + granularity - 1) / granularity * granularity;
+    }
+
+    // Зарезервувати область, понижуючи режим великих сторінок до доступного
+    // Reserve the region, downgrading the huge page mode to an available one
+    // Зарезервувати область, понижуючи режим великих сторінок до доступного
+    VirtualRegion::VirtualRegion(size_t size, HugePageMode requested)
+        : base(nullptr), size(size), pageSize(getSystemPageSize()), hugePageMode(HugePageMode::NONE), decommittedBytes(0) {
+        if (requested == HugePageMode::EXPLICIT) {
+            base = mapExplicit();
+        }
+        if (!base && requested != HugePageMode::NONE) {
+            base = mapTransparent();
+        }
+        if (!base) {
+            base = mapRegular();
+        }
+        if (!base) {
+            throw std::bad_alloc();
+        }
+    }
+
+    VirtualRegion::~VirtualRegion() {
+#ifdef _WIN32
+        VirtualFree(base, 0, MEM_RELEASE);
+#else
+        munmap(base, size);
+#endif
+    }
+
+    size_t VirtualRegion::getSystemPageSize() {
+#ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwPageSize;
+#else
+        return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    }
+
+    // Явні великі сторінки: відображення з hugetlbfs, decommit() працює цілими великими сторінками.
+    // Без MAP_NORESERVE: сторінки резервуються з пулу hugetlbfs одразу, тож порожній пул дає помилку тут,
+    // а не SIGBUS при першому зверненні
+    // Explicit huge pages: a hugetlbfs mapping, decommit() works in whole huge pages.
+    // No MAP_NORESERVE: pages are reserved from the hugetlbfs pool at once, so an empty pool fails here
+    // rather than with SIGBUS on first touch
+    // Явні великі сторінки: відображення з hugetlbfs, decommit() працює цілими великими сторінками.
+    // Без MAP_NORESERVE: сторінки резервуються з пулу hugetlbfs одразу, тож порожній пул дає помилку тут,
+    // а не SIGBUS при першому зверненні
+    char* VirtualRegion::mapExplicit() {
+#if !defined(_WIN32) && defined(MAP_HUGETLB)
+        size_t hugeSize = roundUp(size, HUGE_PAGE_SIZE);
+        void* mapped = mmap(nullptr, hugeSize, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mapped == MAP_FAILED) {
+            return nullptr;
+        }
+        size = hugeSize;
+        pageSize = HUGE_PAGE_SIZE;
+        hugePageMode = HugePageMode::EXPLICIT;
+        return static_cast<char*>(mapped);
+#else
+        return nullptr;
+#endif
+    }
+
+    // Прозорі великі сторінки: область вирівнюється на межу великої сторінки і позначається MADV_HUGEPAGE
+    // Transparent huge pages: the region is aligned to a huge page boundary and advised with MADV_HUGEPAGE
+    // Прозорі великі сторінки: область вирівнюється на межу великої сторінки і позначається MADV_HUGEPAGE
+    char* VirtualRegion::mapTransparent() {
+#if !defined(_WIN32) && defined(MADV_HUGEPAGE)
+        size_t hugeSize = roundUp(size, HUGE_PAGE_SIZE);
+        size_t reserved = hugeSize + HUGE_PAGE_SIZE;
+        void* mapped = mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (mapped == MAP_FAILED) {
+            return nullptr;
+        }
+
+        // Надлишок до та після вирівняної частини повертається одразу
+        // The excess before and after the aligned part is unmapped at once
+        // Надлишок до та після вирівняної частини повертається одразу
+        char* start = static_cast<char*>(mapped);
+        char* aligned = reinterpret_cast<char*>(roundUp(reinterpret_cast<uintptr_t>(start), HUGE_PAGE_SIZE));
+        if (aligned > start) {
+            munmap(start, aligned - start);
+        }
+        char* end = aligned + hugeSize;
+        if (end < start + reserved) {
+            munmap(end, start + reserved - end);
+        }
+
+        // Перша й остання великі сторінки лишаються звичайними: власник зазвичай пише службові дані
+        // на обох кінцях області (заголовки пулу), і це не повинно одразу займати по 2 MB
+        // The first and last huge pages stay regular: the owner usually writes bookkeeping
+        // at both ends of the region (pool headers), which must not take 2 MB each right away
+        // Перша й остання великі сторінки лишаються звичайними: власник зазвичай пише службові дані
+        // на обох кінцях області (заголовки пулу), і це не повинно одразу займати по 2 MB
+        size = hugeSize;
+        if (hugeSize > 2 * HUGE_PAGE_SIZE &&
+            madvise(aligned + HUGE_PAGE_SIZE, hugeSize - 2 * HUGE_PAGE_SIZE, MADV_HUGEPAGE) == 0) {
+            hugePageMode = HugePageMode::TRANSPARENT;
+        }
+        return aligned;
+#else
+        return nullptr;
+#endif
+    }
+
+    char* VirtualRegion::mapRegular() {
+        size = roundUp(size, pageSize);
+#ifdef _WIN32
+        // Windows: зафіксовані сторінки все одно отримують фізичну пам'ять лише при першому зверненні
+        // Windows: committed pages still get physical memory only on first touch
+        // Windows: зафіксовані сторінки все одно отримують фізичну пам'ять лише при першому зверненні
+        return static_cast<char*>(VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+#else
+        void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        return mapped == MAP_FAILED ? nullptr : static_cast<char*>(mapped);
+#endif
+    }
+
+    // Повернути сторінки системі: межі вирівнюються всередину до розміру сторінки області
+    // Return pages to the system: the bounds are aligned inwards to the region's page size
+    // Повернути сторінки системі: межі вирівнюються всередину до розміру сторінки області
+    size_t VirtualRegion::decommit(void* begin, size_t length) {
+        uintptr_t first = roundUp(reinterpret_cast<uintptr_t>(begin), pageSize);
+        uintptr_t last = (reinterpret_cast<uintptr_t>(begin) + length) / pageSize * pageSize;
+        if (first >= last) {
+            return 0;
+        }
+        size_t bytes = last - first;
+#ifdef _WIN32
+        if (!VirtualAlloc(reinterpret_cast<void*>(first), bytes, MEM_RESET, PAGE_READWRITE)) {
+            return 0;
+        }
+#else
+        if (madvise(reinterpret_cast<void*>(first), bytes, MADV_DONTNEED) != 0) {
+            return 0;
+        }
+#endif
+        decommittedBytes.fetch_add(bytes, std::memory_order_relaxed);
+        return bytes;
+    }
+
+} // namespace Memory
+} // namespace NeuroSync
@@ -0,0 +1,94 @@
+#ifndef VIRTUAL_REGION_H
+#define VIRTUAL_REGION_H
+
+#include <cstddef>
+#include <atomic>
+
+// VirtualRegion.h
+// Область віртуальної пам'яті з відкладеним виділенням сторінок
+// Virtual memory region with lazily committed pages
+// Область віртуальної пам'яті з відкладеним виділенням сторінок
+
+namespace NeuroSync {
+namespace Memory {
+
+    // Режим великих сторінок
+    // Huge page mode
+    // Режим великих сторінок
+    enum class HugePageMode {
+        NONE,           // Звичайні сторінки / Regular pages / Звичайні сторінки
+        TRANSPARENT,    // Прозорі великі сторінки ядра (madvise) / Kernel transparent huge pages (madvise) / Прозорі великі сторінки ядра (madvise)
+        EXPLICIT        // Явні великі сторінки hugetlbfs / Explicit hugetlbfs huge pages / Явні великі сторінки hugetlbfs
+    };
+
+    // Область віртуальної пам'яті: адреси резервуються одразу без резервування фізичної пам'яті
+    // (крім явних великих сторінок, які беруться з пулу hugetlbfs),
+    // а сторінки з'являються при першому зверненні. decommit() повертає сторінки системі
+    // (madvise(MADV_DONTNEED)), адреси при цьому лишаються за областю і знову заповнюються нулями
+    // при наступному зверненні. Запитаний режим великих сторінок понижується, якщо система його не дає:
+    // EXPLICIT -> TRANSPARENT -> NONE.
+    // Virtual memory region: addresses are reserved up front without reserving physical memory
+    // (except explicit huge pages, which come from the hugetlbfs pool),
+    // and pages appear on first touch. decommit() returns pages to the system
+    // (madvise(MADV_DONTNEED)); the addresses stay with the region and read as zeros
+    // on the next touch. The requested huge page mode is downgraded if the system does not provide it:
+    // EXPLICIT -> TRANSPARENT -> NONE.
+    // Область віртуальної пам'яті: адреси резервуються одразу без резервування фізичної пам'яті
+    // (крім явних великих сторінок, які беруться з пулу hugetlbfs),
+    // а сторінки з'являються при першому зверненні. decommit() повертає сторінки системі
+    // (madvise(MADV_DONTNEED)), адреси при цьому лишаються за областю і знову заповнюються нулями
+    // при наступному зверненні. Запитаний режим великих сторінок понижується, якщо система його не дає:
+    // EXPLICIT -> TRANSPARENT -> NONE.
+    class VirtualRegion {
+    public:
+        explicit VirtualRegion(size_t size, HugePageMode requested = HugePageMode::TRANSPARENT);
+        ~VirtualRegion();
+
+        VirtualRegion(const VirtualRegion&) = delete;
+        VirtualRegion& operator=(const VirtualRegion&) = delete;
+
+        // Повернути системі сторінки, що повністю лежать у [begin, begin + length); повертає кількість байт
+        // Return to the system the pages lying entirely in [begin, begin + length); returns the number of bytes
+        // Повернути системі сторінки, що повністю лежать у [begin, begin + length); повертає кількість байт
+        size_t decommit(void* begin, size_t length);
+
+        char* getBase() const { return base; }
+        size_t getSize() const { return size; }
+        bool contains(const void* ptr) const {
+            return static_cast<const char*>(ptr) >= base && static_cast<const char*>(ptr) < base + size;
+        }
+
+        // Отриманий режим великих сторінок і гранулярність decommit()
+        // The obtained huge page mode and the granularity of decommit()
+        // Отриманий режим великих сторінок і гранулярність decommit()
+        HugePageMode getHugePageMode() const { return hugePageMode; }
+        size_t getPageSize() const { return pageSize; }
+
+        // Усього байт, повернутих системі
+        // Total bytes returned to the system
+        // Усього байт, повернутих системі
+        size_t getDecommittedBytes() const { return decommittedBytes.load(std::memory_order_relaxed); }
+
+        static size_t getSystemPageSize();
+
+        static const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    private:
+        char* base;
+        size_t size;
+        size_t pageSize;
+        HugePageMode hugePageMode;
+        std::atomic<size_t> decommittedBytes;
+
+        // Спроби відобразити область у заданому режимі (nullptr - режим недоступний)
+        // Attempts to map the region in the given mode (nullptr - the mode is unavailable)
+        // Спроби відобразити область у заданому режимі (nullptr - режим недоступний)
+        char* mapExplicit();
+        char* mapTransparent();
+        char* mapRegular();
+    };
+
+} // namespace Memory
+} // namespace NeuroSync
+
+#endif // VIRTUAL_REGION_H
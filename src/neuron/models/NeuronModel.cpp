@@ -3,6 +3,7 @@
 #include <numeric>
 #include <cmath>
 #include <chrono>
+#include <new>
 
 // NeuronModel.cpp
 // Реалізація моделі нейрона для NeuroSync OS Sparky
@@ -103,7 +104,7 @@ namespace Models {
     // Получение всех входных сигналов
     // Get all input signals
     // Отримання всіх вхідних сигналів
-    const std::vector<NeuronInput>& NeuronModel::getInputs() const {
+    const std::pmr::vector<NeuronInput>& NeuronModel::getInputs() const {
         return inputs;
     }
 
@@ -126,7 +127,7 @@ namespace Models {
     // Получение всех выходных сигналов
     // Get all output signals
     // Отримання всіх вихідних сигналів
-    const std::vector<NeuronOutput>& NeuronModel::getOutputs() const {
+    const std::pmr::vector<NeuronOutput>& NeuronModel::getOutputs() const {
         return outputs;
     }
 
@@ -138,6 +139,37 @@ namespace Models {
         setLastUpdateTime(getCurrentTimeMillis());
     }
 
+    // Установка ресурса памяти сигналов.
+    // Аллокатор pmr-контейнера не меняется присваиванием, поэтому контейнеры создаются заново.
+    // Set the signal memory resource.
+    // A pmr container's allocator does not change on assignment, so the containers are recreated.
+    // Встановлення ресурсу пам'яті сигналів.
+    // Розподільник pmr-контейнера не змінюється присвоєнням, тому контейнери створюються заново.
+    void NeuronModel::setSignalResource(std::pmr::memory_resource* resource) {
+        if (!resource) {
+            resource = std::pmr::get_default_resource();
+        }
+        inputs.~vector();
+        new (&inputs) std::pmr::vector<NeuronInput>(resource);
+        outputs.~vector();
+        new (&outputs) std::pmr::vector<NeuronOutput>(resource);
+    }
+
+    std::pmr::memory_resource* NeuronModel::getSignalResource() const {
+        return inputs.get_allocator().resource();
+    }
+
+    // Удаление сигналов вместе с хранилищем: перемещение пустого контейнера с тем же ресурсом
+    // освобождает буфер (clear() оставил бы емкость в арене)
+    // Drop the signals together with their storage: moving in an empty container with the same resource
+    // frees the buffer (clear() would leave the capacity in the arena)
+    // Видалення сигналів разом зі сховищем: переміщення порожнього контейнера з тим самим ресурсом
+    // звільняє буфер (clear() залишив би ємність в арені)
+    void NeuronModel::releaseSignals() {
+        inputs = std::pmr::vector<NeuronInput>(inputs.get_allocator());
+        outputs = std::pmr::vector<NeuronOutput>(outputs.get_allocator());
+    }
+
     // Добавление связи с другим нейроном
     // Add connection to another neuron
     // Додавання зв'язку з іншим нейроном
@@ -5,6 +5,7 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <atomic>
 
 // NeuronModel.h
@@ -52,24 +53,62 @@ namespace Models {
         double energyLevel;         // Уровень энергии / Energy level / Рівень енергії
     };
 
-    // Структура для представления входных данных нейрона
-    // Structure to represent neuron input data
-    // Структура для представлення вхідних даних нейрона
+    // Структура для представления входных данных нейрона.
+    // Данные сигнала используют полиморфный аллокатор: в std::pmr-контейнере с арендой цикла
+    // (Memory::ArenaResource) они размещаются в той же арене; обычная копия берет память из кучи.
+    // Structure to represent neuron input data.
+    // Signal data uses a polymorphic allocator: inside a std::pmr container backed by a cycle arena
+    // (Memory::ArenaResource) it is placed in the same arena; a plain copy takes heap memory.
+    // Структура для представлення вхідних даних нейрона.
+    // Дані сигналу використовують поліморфний розподільник: у std::pmr-контейнері з ареною циклу
+    // (Memory::ArenaResource) вони розміщуються в тій самій арені; звичайна копія бере пам'ять з купи.
     struct NeuronInput {
+        using allocator_type = std::pmr::polymorphic_allocator<double>;
+
         int sourceNeuronId;         // ID источника / Source ID / ID джерела
         double signalStrength;      // Сила сигнала / Signal strength / Сила сигналу
         long long timestamp;        // Временная метка / Timestamp / Тимчасова мітка
-        std::vector<double> data;   // Данные сигнала / Signal data / Дані сигналу
+        std::pmr::vector<double> data; // Данные сигнала / Signal data / Дані сигналу
+
+        NeuronInput() : sourceNeuronId(0), signalStrength(0.0), timestamp(0) {}
+        explicit NeuronInput(const allocator_type& allocator)
+            : sourceNeuronId(0), signalStrength(0.0), timestamp(0), data(allocator) {}
+        NeuronInput(const NeuronInput& other) = default;
+        NeuronInput(NeuronInput&& other) = default;
+        NeuronInput(const NeuronInput& other, const allocator_type& allocator)
+            : sourceNeuronId(other.sourceNeuronId), signalStrength(other.signalStrength),
+              timestamp(other.timestamp), data(other.data, allocator) {}
+        NeuronInput(NeuronInput&& other, const allocator_type& allocator)
+            : sourceNeuronId(other.sourceNeuronId), signalStrength(other.signalStrength),
+              timestamp(other.timestamp), data(std::move(other.data), allocator) {}
+        NeuronInput& operator=(const NeuronInput& other) = default;
+        NeuronInput& operator=(NeuronInput&& other) = default;
     };
 
-    // Структура для представления выходных данных нейрона
-    // Structure to represent neuron output data
-    // Структура для представлення вихідних даних нейрона
+    // Структура для представления выходных данных нейрона (аллокатор - как у NeuronInput)
+    // Structure to represent neuron output data (allocator as in NeuronInput)
+    // Структура для представлення вихідних даних нейрона (розподільник - як у NeuronInput)
     struct NeuronOutput {
+        using allocator_type = std::pmr::polymorphic_allocator<double>;
+
         int targetNeuronId;         // ID цели / Target ID / ID цілі
         double signalStrength;      // Сила сигнала / Signal strength / Сила сигналу
         long long timestamp;        // Временная метка / Timestamp / Тимчасова мітка
-        std::vector<double> data;   // Данные сигнала / Signal data / Дані сигналу
+        std::pmr::vector<double> data; // Данные сигнала / Signal data / Дані сигналу
+
+        NeuronOutput() : targetNeuronId(0), signalStrength(0.0), timestamp(0) {}
+        explicit NeuronOutput(const allocator_type& allocator)
+            : targetNeuronId(0), signalStrength(0.0), timestamp(0), data(allocator) {}
+        NeuronOutput(const NeuronOutput& other) = default;
+        NeuronOutput(NeuronOutput&& other) = default;
+        NeuronOutput(const NeuronOutput& other, const allocator_type& allocator)
+            : targetNeuronId(other.targetNeuronId), signalStrength(other.signalStrength),
+              timestamp(other.timestamp), data(other.data, allocator) {}
+        NeuronOutput(NeuronOutput&& other, const allocator_type& allocator)
+            : targetNeuronId(other.targetNeuronId), signalStrength(other.signalStrength),
+              timestamp(other.timestamp), data(std::move(other.data), allocator) {}
+        NeuronOutput& operator=(const NeuronOutput& other) = default;
+        NeuronOutput& operator=(NeuronOutput&& other) = default;
     };
 
     // Модель нейрона
@@ -123,7 +162,7 @@ namespace Models {
         // Получение всех входных сигналов
         // Get all input signals
         // Отримання всіх вхідних сигналів
-        const std::vector<NeuronInput>& getInputs() const;
+        const std::pmr::vector<NeuronInput>& getInputs() const;
         
         // Очистка входных сигналов
         // Clear input signals
@@ -138,13 +177,31 @@ namespace Models {
         // Получение всех выходных сигналов
         // Get all output signals
         // Отримання всіх вихідних сигналів
-        const std::vector<NeuronOutput>& getOutputs() const;
+        const std::pmr::vector<NeuronOutput>& getOutputs() const;
         
         // Очистка выходных сигналов
         // Clear output signals
         // Очищення вихідних сигналів
         void clearOutputs();
         
+        // Установка ресурса памяти для входных и выходных сигналов (nullptr - куча).
+        // Текущие сигналы удаляются; новые сигналы и их данные размещаются в ресурсе.
+        // Set the memory resource for input and output signals (nullptr - heap).
+        // Current signals are dropped; new signals and their data are placed in the resource.
+        // Встановлення ресурсу пам'яті для вхідних і вихідних сигналів (nullptr - купа).
+        // Поточні сигнали видаляються; нові сигнали та їхні дані розміщуються в ресурсі.
+        void setSignalResource(std::pmr::memory_resource* resource);
+        
+        // Получение ресурса памяти сигналов
+        // Get the signal memory resource
+        // Отримання ресурсу пам'яті сигналів
+        std::pmr::memory_resource* getSignalResource() const;
+        
+        // Удаление сигналов вместе с их хранилищем; вызывается в конце цикла перед reset() арены
+        // Drop the signals together with their storage; called at the end of a cycle before the arena's reset()
+        // Видалення сигналів разом з їхнім сховищем; викликається в кінці циклу перед reset() арени
+        void releaseSignals();
+        
         // Добавление связи с другим нейроном
         // Add connection to another neuron
         // Додавання зв'язку з іншим нейроном
@@ -206,8 +263,8 @@ namespace Models {
         std::string name;                   // Имя нейрона / Neuron name / Ім'я нейрона
         std::atomic<NeuronStatus> status;   // Статус нейрона / Neuron status / Статус нейрона
         NeuronState state;                  // Состояние нейрона / Neuron state / Стан нейрона
-        std::vector<NeuronInput> inputs;    // Входные сигналы / Input signals / Вхідні сигнали
-        std::vector<NeuronOutput> outputs;  // Выходные сигналы / Output signals / Вихідні сигнали
+        std::pmr::vector<NeuronInput> inputs;   // Входные сигналы / Input signals / Вхідні сигнали
+        std::pmr::vector<NeuronOutput> outputs; // Выходные сигналы / Output signals / Вихідні сигнали
         std::map<int, double> connections;  // Связи с другими нейронами / Connections to other neurons / Зв'язки з іншими нейронами
         long long creationTime;             // Время создания / Creation time / Час створення
         std::atomic<long long> lastUpdateTime; // Время последнего обновления / Last update time / Час останнього оновлення
@@ -15,6 +15,16 @@
 namespace NeuroSync {
 namespace Performance {
 
+    namespace {
+
+        // Пороги завантаженості пулу: вище - бракує потоків, нижче - потоки простоюють
+        // Pool utilization thresholds: above - threads are short, below - threads sit idle
+        // Пороги загруженности пула: выше - потоков не хватает, ниже - потоки простаивают
+        const double POOL_GROW_UTILIZATION = 0.75;
+        const double POOL_SHRINK_UTILIZATION = 0.25;
+
+    } // namespace
+
     // Конструктор оптимізатора продуктивності
     // Performance optimizer constructor
     // Конструктор оптимизатора производительности
@@ -47,7 +57,7 @@ namespace Performance {
         // Ініціалізація компонентів
         // Initialize components
         // Инициализация компонентов
-        scheduler = std::make_unique<Core::Scheduler>();
+        scheduler = std::make_unique<::Core::Scheduler>();
         threadPool = std::make_unique<NeuroSync::ThreadPool>(configuration.threadCount);  // Fixed: Use correct namespace
         memoryCore = std::make_unique<Memory::MemoryCore>();
         
@@ -262,18 +272,16 @@ namespace Performance {
     // Optimize threads
     // Оптимизировать потоки
     double PerformanceOptimizer::optimizeThreading() {
-        // У реальній реалізації тут би була логіка оптимізації потоків
-        // In real implementation, there would be threading optimization logic
-        // В реальной реализации здесь была бы логика оптимизации потоков
-        
-        // Для демонстрації оновлюємо розмір пулу потоків
-        // For demonstration, update thread pool size
-        // Для демонстрации обновляем размер пула потоков
+        // Розмір пулу за статистикою з попереднього виклику; далі починається нове вікно вимірювання
+        // Pool size from the statistics since the previous call; then a new measurement window begins
+        // Размер пула по статистике с предыдущего вызова; далее начинается новое окно измерения
         if (threadPool) {
-            int optimalThreadCount = std::thread::hardware_concurrency();
-            if (optimalThreadCount > 0) {
-                updateThreadPoolSize(optimalThreadCount);
+            ThreadPoolStatistics poolStats = threadPool->getStatistics();
+            int targetSize = calculateThreadPoolSize(poolStats);
+            if (targetSize != static_cast<int>(poolStats.threadCount)) {
+                updateThreadPoolSize(targetSize);
             }
+            threadPool->resetStatistics();
         }
         
         // Для демонстрації повертаємо випадкове покращення
@@ -398,7 +406,10 @@ namespace Performance {
         // Сбор статистики потоков
         stats.activeThreads = calculateActiveThreads();
         if (threadPool) {
-            stats.threadPoolSize = threadPool->getThreadCount();
+            ThreadPoolStatistics poolStats = threadPool->getStatistics();
+            stats.threadPoolSize = static_cast<int>(poolStats.threadCount);
+            stats.threadPoolQueueSize = poolStats.queueSize;
+            stats.threadPoolUtilization = poolStats.utilization;
         }
         
         // Інші метрики (для демонстрації)
@@ -533,18 +544,13 @@ namespace Performance {
     // Calculate active threads
     // Вычисление количества активных потоков
     int PerformanceOptimizer::calculateActiveThreads() const {
-        // У реальній реалізації тут би був код для отримання реальної кількості активних потоків
-        // In real implementation, there would be code to get real active thread count
-        // В реальной реализации здесь был бы код для получения реального количества активных потоков
-        
-        // Для демонстрації повертаємо випадкове значення
-        // For demonstration, return random value
-        // Для демонстрации возвращаем случайное значение
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_int_distribution<int> dis(1, 16);
-        
-        return dis(gen);
+        // Потоки пулу, що зараз виконують завдання
+        // Pool threads currently running a task
+        // Потоки пула, которые сейчас выполняют задачу
+        if (threadPool) {
+            return static_cast<int>(threadPool->getStatistics().activeThreads);
+        }
+        return 0;
     }
 
     // Застосування стратегії оптимізації
@@ -610,16 +616,81 @@ namespace Performance {
         return ss.str();
     }
 
+    // Обчислення розміру пулу потоків.
+    // Пул росте, коли потоки майже весь час зайняті і завдання стоять у черзі (зараз або в більшості
+    // вибірок глибини), і зменшується, коли черга порожня, а потоки здебільшого простоюють.
+    // Крок залежить від стратегії; результат обмежено [minThreadCount, maxThreadCount].
+    // Calculate the thread pool size.
+    // The pool grows when its threads are busy nearly all the time and tasks are queued (right now or in most
+    // depth samples), and shrinks when the queue is empty and the threads mostly sit idle.
+    // The step depends on the strategy; the result is clamped to [minThreadCount, maxThreadCount].
+    // Вычисление размера пула потоков.
+    // Пул растет, когда потоки почти все время заняты и задачи стоят в очереди (сейчас или в большинстве
+    // выборок глубины), и уменьшается, когда очередь пуста, а потоки в основном простаивают.
+    // Шаг зависит от стратегии; результат ограничен [minThreadCount, maxThreadCount].
+    int PerformanceOptimizer::calculateThreadPoolSize(const ThreadPoolStatistics& poolStats) const {
+        int current = static_cast<int>(poolStats.threadCount);
+        if (poolStats.tasksExecuted == 0 && poolStats.queueSize == 0) {
+            return current;
+        }
+
+        // Частка завдань, взятих із черги, в якій чекало щонайменше стільки завдань, скільки є потоків
+        // Share of tasks taken from a queue holding at least as many tasks as there are threads
+        // Доля задач, взятых из очереди, в которой ждало не меньше задач, чем есть потоков
+        uint64_t backlogged = 0;
+        for (size_t bucket = 0; bucket < ThreadPoolStatistics::QUEUE_DEPTH_BUCKETS; ++bucket) {
+            size_t lowerBound = bucket == 0 ? 0 : size_t(1) << (bucket - 1);
+            if (lowerBound >= poolStats.threadCount) {
+                backlogged += poolStats.queueDepthHistogram[bucket];
+            }
+        }
+        bool backlog = poolStats.queueSize > poolStats.threadCount ||
+                       (poolStats.tasksExecuted > 0 && backlogged * 2 > poolStats.tasksExecuted);
+
+        int growStep;
+        int shrinkStep;
+        switch (configuration.strategy) {
+            case OptimizationStrategy::AGGRESSIVE:
+                growStep = current;
+                shrinkStep = current / 2;
+                break;
+            case OptimizationStrategy::CONSERVATIVE:
+                growStep = 1;
+                shrinkStep = 1;
+                break;
+            case OptimizationStrategy::BALANCED:
+            default:
+                growStep = std::max(1, current / 2);
+                shrinkStep = std::max(1, current / 4);
+                break;
+        }
+
+        int target = current;
+        if (backlog && poolStats.utilization >= POOL_GROW_UTILIZATION) {
+            target = current + growStep;
+        } else if (!backlog && poolStats.queueSize == 0 && poolStats.utilization < POOL_SHRINK_UTILIZATION) {
+            target = current - shrinkStep;
+        }
+
+        int minThreads = std::max(1, configuration.minThreadCount);
+        int maxThreads = configuration.maxThreadCount > 0
+            ? configuration.maxThreadCount
+            : std::max(configuration.threadCount, static_cast<int>(std::thread::hardware_concurrency()));
+        maxThreads = std::max(minThreads, std::min(maxThreads, static_cast<int>(ThreadPool::MAX_THREAD_COUNT)));
+        return std::min(std::max(target, minThreads), maxThreads);
+    }
+
     // Оновлення розміру пулу потоків
     // Update thread pool size
     // Обновление размера пула потоков
     void PerformanceOptimizer::updateThreadPoolSize(int newSize) {
         if (threadPool && newSize > 0) {
-            // У реальній реалізації тут би був код для оновлення розміру пулу потоків
-            // In real implementation, there would be code to update thread pool size
-            // В реальной реализации здесь был бы код для обновления размера пула потоков
-            
-            std::cout << "[PERFORMANCE] Updating thread pool size to " << newSize << std::endl;
+            try {
+                threadPool->resize(static_cast<size_t>(newSize));
+                std::cout << "[PERFORMANCE] Updating thread pool size to " << newSize << std::endl;
+            } catch (const std::exception& e) {
+                std::cerr << "[PERFORMANCE] Failed to resize thread pool: " << e.what() << std::endl;
+            }
         }
     }
 
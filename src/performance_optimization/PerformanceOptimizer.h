@@ -53,12 +53,14 @@ namespace Performance {
         double cpuThreshold;                    // Поріг завантаження ЦП / CPU load threshold / Порог загрузки ЦП
         size_t memoryThreshold;                 // Поріг використання пам'яті / Memory usage threshold / Порог использования памяти
         int threadCount;                        // Кількість потоків / Thread count / Количество потоков
+        int minThreadCount;                     // Мінімальний розмір пулу / Minimum pool size / Минимальный размер пула
+        int maxThreadCount;                     // Максимальний розмір пулу (0 - за кількістю ядер) / Maximum pool size (0 - by core count) / Максимальный размер пула (0 - по количеству ядер)
         bool enableProfiling;                   // Увімкнути профілювання / Enable profiling / Включить профилирование
         
         OptimizerConfig() 
             : strategy(OptimizationStrategy::BALANCED), autoOptimization(true), 
               optimizationInterval(5000), cpuThreshold(0.8), memoryThreshold(1024 * 1024 * 100), // 100 MB
-              threadCount(4), enableProfiling(true) {}
+              threadCount(4), minThreadCount(1), maxThreadCount(0), enableProfiling(true) {}
     };
 
     // Результати оптимізації
@@ -81,6 +83,8 @@ namespace Performance {
         size_t memoryAvailable;                 // Доступна пам'ять / Available memory / Доступная память
         int activeThreads;                      // Активні потоки / Active threads / Активные потоки
         int threadPoolSize;                     // Розмір пулу потоків / Thread pool size / Размер пула потоков
+        size_t threadPoolQueueSize;             // Черга пулу потоків / Thread pool queue / Очередь пула потоков
+        double threadPoolUtilization;           // Завантаженість пулу потоків / Thread pool utilization / Загруженность пула потоков
         size_t ioOperations;                    // Операції вводу-виводу / I/O operations / Операции ввода-вывода
         double networkLatency;                  // Затримка мережі / Network latency / Задержка сети
         size_t cacheHits;                       // Попадання в кеш / Cache hits / Попадания в кэш
@@ -89,7 +93,7 @@ namespace Performance {
         
         PerformanceStats() 
             : cpuUsage(0.0), memoryUsage(0), memoryAvailable(0), activeThreads(0),
-              threadPoolSize(0), ioOperations(0), networkLatency(0.0), 
+              threadPoolSize(0), threadPoolQueueSize(0), threadPoolUtilization(0.0), ioOperations(0), networkLatency(0.0), 
               cacheHits(0), cacheMisses(0), timestamp(0) {}
     };
 
@@ -197,7 +201,7 @@ namespace Performance {
     private:
         OptimizerConfig configuration;                          // Конфігурація / Configuration / Конфигурация
         mutable std::mutex optimizerMutex;                     // М'ютекс для потокобезпеки / Mutex for thread safety / Мьютекс для потокобезопасности
-        std::unique_ptr<Core::Scheduler> scheduler;            // Планувальник / Scheduler / Планировщик
+        std::unique_ptr<::Core::Scheduler> scheduler;          // Планувальник / Scheduler / Планировщик
         std::unique_ptr<NeuroSync::ThreadPool> threadPool;    // Пул потоків / Thread pool / Пул потоков
         std::unique_ptr<Memory::MemoryCore> memoryCore;        // Ядро пам'яті / Memory core / Ядро памяти
         std::unique_ptr<Diagnostics::Profiler> profiler;       // Профілювальник / Profiler / Профилировщик
@@ -219,6 +223,7 @@ namespace Performance {
         int calculateActiveThreads() const;
         void applyOptimizationStrategy();
         std::string generateRecommendations() const;
+        int calculateThreadPoolSize(const ThreadPoolStatistics& poolStats) const;
         void updateThreadPoolSize(int newSize);
         void triggerGarbageCollection();
         void optimizeCache();
@@ -1,6 +1,8 @@
 #include "SynapseBus.h"
 #include <iostream>
 #include <chrono>
+#include <cstring>
+#include <vector>
 
 // SynapseBus.cpp
 // Реалізація шини синапсів для NeuroSync OS Sparky
@@ -11,15 +13,18 @@
 namespace NeuroSync {
 namespace Synapse {
 
-SynapseBus::SynapseBus() : initialized(false), processing(false) {
+SynapseBus::SynapseBus() 
+    : messageQueueType(NeuroSync::Synapse::Priority::MessageQueueType::PRIORITY_HEAP),
+      processingBatchSize(DEFAULT_PROCESSING_BATCH_SIZE),
+      initialized(false), processing(false), enqueueEpoch(0), idleWorkers(0), receiveCursor(0) {
     // Ініціалізація шини синапсів
     // Initialize synapse bus
     // Ініціалізація шини синапсів
     
-    // Створення черги повідомлень
-    // Create message queue
-    // Создание очереди сообщений
-    messageQueue = std::make_unique<NeuroSync::Synapse::Priority::PriorityMessageQueue>();
+    // Один робочий потік з чергою за замовчуванням (може бути замінено в initialize())
+    // One worker with the default queue (may be replaced in initialize())
+    // Один рабочий поток с очередью по умолчанию (может быть заменено в initialize())
+    createWorkers(messageQueueType, 1);
     
     // Створення менеджера з'єднань
     // Create connection manager
@@ -34,7 +39,7 @@ SynapseBus::~SynapseBus() {
     stop();
 }
 
-bool SynapseBus::initialize() {
+bool SynapseBus::initialize(NeuroSync::Synapse::Priority::MessageQueueType queueType, size_t batchSize, size_t workerCount) {
     // Ініціалізація шини синапсів
     // Initialize synapse bus
     // Ініціалізація шини синапсів
@@ -43,17 +48,34 @@ bool SynapseBus::initialize() {
         return true; // Вже ініціалізовано / Already initialized / Уже инициализировано
     }
     
+    if (workerCount == 0) {
+        workerCount = 1;
+    }
+    
+    // Заміна шардів, якщо обрано іншу реалізацію черги або кількість потоків
+    // Replace shards if another queue implementation or worker count was chosen
+    // Замена шардов, если выбрана другая реализация очереди или количество потоков
+    if (workers.size() != workerCount || queueType != messageQueueType) {
+        if (!createWorkers(queueType, workerCount)) {
+            return false;
+        }
+        messageQueueType = queueType;
+    }
+    
     // Ініціалізація компонентів
     // Initialize components
     // Инициализация компонентов
-    if (!messageQueue->initialize()) {
-        return false;
+    for (auto& worker : workers) {
+        if (!worker->queue->initialize()) {
+            return false;
+        }
     }
     
     if (!connectionManager->initialize()) {
         return false;
     }
     
+    processingBatchSize = batchSize > 0 ? batchSize : 1;
     initialized = true;
     return true;
 }
@@ -68,7 +90,10 @@ void SynapseBus::start() {
     }
     
     processing = true;
-    processingThread = std::thread(&SynapseBus::messageProcessingLoop, this);
+    for (size_t i = 0; i < workers.size(); ++i) {
+        workers[i]->queue->setStopping(false);
+        workers[i]->thread = std::thread(&SynapseBus::messageProcessingLoop, this, i);
+    }
 }
 
 void NeuroSync::Synapse::SynapseBus::stop() {
@@ -79,42 +104,23 @@ void NeuroSync::Synapse::SynapseBus::stop() {
     if (processing) {
         processing = false;
         
-        // встановлюємо флаг зупинки для черги повідомлень
-        // set stopping flag for message queue
-        // устанавливаем флаг остановки для очереди сообщений
-        if (messageQueue) {
-            messageQueue->setStopping(true);
+        // встановлюємо флаг зупинки для черг усіх шардів (це будить потоки, що чекають)
+        // set stopping flag for the queues of all shards (this wakes waiting threads)
+        // устанавливаем флаг остановки для очередей всех шардов (это будит ждущие потоки)
+        for (auto& worker : workers) {
+            worker->queue->setStopping(true);
         }
-        
-        // надсилаємо фіктивне повідомлення для розблокування потоку обробки
-        // send dummy message to unblock processing thread
-        // отправляем фиктивное сообщение для разблокировки потока обработки
-        if (messageQueue && initialized) {
-            NeuroSync::Synapse::Priority::PriorityMessage dummyMessage;
-            dummyMessage.messageId = 0;
-            dummyMessage.senderId = -1;
-            dummyMessage.receiverId = -1;
-            dummyMessage.priority = NeuroSync::Synapse::Priority::MessagePriority::LOW;
-            dummyMessage.weight = 0;
-            dummyMessage.timestamp = 0;
-            dummyMessage.deadline = 0;
-            dummyMessage.dataSize = 0;
-            messageQueue->enqueue(dummyMessage);
+        {
+            std::lock_guard<std::mutex> lock(workMutex);
+            workCondition.notify_all();
         }
         
-        // очікуємо завершення потоку обробки
-        // wait for processing thread to finish
-        // ждем завершения потока обработки
-        if (processingThread.joinable()) {
-            // додаємо таймаут для join, щоб уникнути нескінченного очікування
-            // add timeout for join to avoid infinite waiting
-            // добавляем таймаут для join, чтобы избежать бесконечного ожидания
-            try {
-                processingThread.join();
-            } catch (...) {
-                // ігноруємо помилки при join
-                // ignore errors when joining
-                // игнорируем ошибки при join
+        // очікуємо завершення потоків обробки
+        // wait for processing threads to finish
+        // ждем завершения потоков обработки
+        for (auto& worker : workers) {
+            if (worker->thread.joinable()) {
+                worker->thread.join();
             }
         }
     }
@@ -130,6 +136,27 @@ bool NeuroSync::Synapse::SynapseBus::sendMessage(int senderId, int receiverId, c
         return false;
     }
     
+    // Єдина копія даних - у блок зі слебу
+    // The only data copy - into a slab block
+    // Единственная копия данных - в блок из слэба
+    NeuroSync::Synapse::Priority::MessagePayload payload;
+    if (data && dataSize > 0) {
+        payload = NeuroSync::Synapse::Priority::MessagePayload::copyFrom(data, dataSize);
+    }
+    
+    return sendMessage(senderId, receiverId, std::move(payload), priority, weight);
+}
+
+bool SynapseBus::sendMessage(int senderId, int receiverId, NeuroSync::Synapse::Priority::MessagePayload payload, 
+                             NeuroSync::Synapse::Priority::MessagePriority priority, int weight) {
+    // Надіслати повідомлення без копіювання даних
+    // Send message without copying data
+    // Отправить сообщение без копирования данных
+    
+    if (!initialized) {
+        return false;
+    }
+    
     // Створення повідомлення
     // Create message
     // Создание сообщения
@@ -142,25 +169,17 @@ bool NeuroSync::Synapse::SynapseBus::sendMessage(int senderId, int receiverId, c
     message.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::high_resolution_clock::now().time_since_epoch()).count();
     message.deadline = message.timestamp + 10000; // 10 секунд терміну / 10 seconds deadline / 10 секунд крайнего срока
+    message.dataSize = payload.size();
+    message.payload = std::move(payload);
     
-    // Копіювання даних
-    // Copy data
-    // Копирование данных
-    if (data && dataSize > 0) {
-        message.data.resize(dataSize);
-        std::memcpy(message.data.data(), data, dataSize);
-        message.dataSize = dataSize;
-    } else {
-        message.dataSize = 0;
-    }
-    
-    // Надсилання повідомлення
-    // Send message
-    // Отправка сообщения
-    if (messageQueue) {
-        return messageQueue->enqueue(message);
+    // Надсилання повідомлення до шарду отримувача (переміщенням, дані не копіюються)
+    // Send message to the receiver's shard (by move, data is not copied)
+    // Отправка сообщения в шард получателя (перемещением, данные не копируются)
+    if (!workers[shardFor(receiverId)]->queue->enqueue(std::move(message))) {
+        return false;
     }
-    return false;
+    notifyWork();
+    return true;
 }
 
 bool SynapseBus::receiveMessage(int& senderId, int& receiverId, void*& data, size_t& dataSize, 
@@ -169,6 +188,31 @@ bool SynapseBus::receiveMessage(int& senderId, int& receiverId, void*& data, siz
     // Receive message from synapse bus
     // Получить сообщение из шины синапсов
     
+    NeuroSync::Synapse::Priority::MessagePayload payload;
+    if (!receiveMessage(senderId, receiverId, payload, priority, weight)) {
+        return false;
+    }
+    
+    // Копіювання даних у буфер викликача (сумісний шлях)
+    // Copy data into the caller's buffer (compatibility path)
+    // Копирование данных в буфер вызывающего (совместимый путь)
+    dataSize = payload.size();
+    if (dataSize > 0) {
+        data = new char[dataSize];
+        std::memcpy(data, payload.data(), dataSize);
+    } else {
+        data = nullptr;
+    }
+    
+    return true;
+}
+
+bool SynapseBus::receiveMessage(int& senderId, int& receiverId, NeuroSync::Synapse::Priority::MessagePayload& payload, 
+                               NeuroSync::Synapse::Priority::MessagePriority& priority, int& weight) {
+    // Отримати повідомлення без копіювання даних
+    // Receive message without copying data
+    // Получить сообщение без копирования данных
+    
     if (!initialized) {
         return false;
     }
@@ -176,8 +220,16 @@ bool SynapseBus::receiveMessage(int& senderId, int& receiverId, void*& data, siz
     // Отримання повідомлення
     // Receive message
     // Получение сообщения
+    // Спершу непорожній шард без очікування, інакше очікування на черговому шарді
+    // First a non-empty shard without waiting, otherwise wait on the next shard in turn
+    // Сначала непустой шард без ожидания, иначе ожидание на очередном шарде
     NeuroSync::Synapse::Priority::PriorityMessage message;
-    if (!messageQueue->dequeue(message)) {
+    size_t start = receiveCursor.fetch_add(1, std::memory_order_relaxed);
+    bool received = false;
+    for (size_t i = 0; i < workers.size() && !received; ++i) {
+        received = workers[(start + i) % workers.size()]->queue->tryDequeueBatch(&message, 1) == 1;
+    }
+    if (!received && !workers[start % workers.size()]->queue->dequeue(message)) {
         return false;
     }
     
@@ -188,21 +240,35 @@ bool SynapseBus::receiveMessage(int& senderId, int& receiverId, void*& data, siz
     receiverId = message.receiverId;
     priority = message.priority;
     weight = message.weight;
-    dataSize = message.dataSize;
-    
-    // Копіювання даних
-    // Copy data
-    // Копирование данных
-    if (message.dataSize > 0) {
-        data = new char[message.dataSize];
-        std::memcpy(data, message.data.data(), message.dataSize);
-    } else {
-        data = nullptr;
-    }
+    payload = std::move(message.payload);
     
     return true;
 }
 
+size_t SynapseBus::receiveMessages(std::pmr::vector<NeuroSync::Synapse::Priority::PriorityMessage>& messages, size_t maxMessages) {
+    // Отримати пакет повідомлень без очікування
+    // Receive a batch of messages without waiting
+    // Получить пакет сообщений без ожидания
+    
+    if (!initialized || maxMessages == 0) {
+        return 0;
+    }
+    
+    // Шарди обходяться від курсора, кожен віддає пакет одразу у хвіст вектора
+    // Shards are visited from the cursor, each hands its batch straight into the tail of the vector
+    // Шарды обходятся от курсора, каждый отдает пакет сразу в хвост вектора
+    size_t first = messages.size();
+    messages.resize(first + maxMessages);
+    size_t received = 0;
+    size_t start = receiveCursor.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < workers.size() && received < maxMessages; ++i) {
+        received += workers[(start + i) % workers.size()]->queue->tryDequeueBatch(
+            messages.data() + first + received, maxMessages - received);
+    }
+    messages.resize(first + received);
+    return received;
+}
+
 bool SynapseBus::createConnection(int neuronA, int neuronB, double weight) {
     // Створити зв'язок між двома нейронами
     // Create connection between two neurons
@@ -296,7 +362,11 @@ size_t SynapseBus::getMessageQueueSize() const {
         return 0;
     }
     
-    return messageQueue->size();
+    size_t total = 0;
+    for (const auto& worker : workers) {
+        total += worker->queue->size();
+    }
+    return total;
 }
 
 SynapseBus::BusStatistics SynapseBus::getStatistics() const {
@@ -307,48 +377,178 @@ SynapseBus::BusStatistics SynapseBus::getStatistics() const {
     BusStatistics stats;
     
     if (initialized) {
-        stats.messageStats = messageQueue->getStatistics();
+        // Зведення статистики черг шардів; середній час очікування зважується кількістю повідомлень
+        // Roll up shard queue statistics; the average wait time is weighted by message count
+        // Сведение статистики очередей шардов; среднее время ожидания взвешивается количеством сообщений
+        stats.messageStats = NeuroSync::Synapse::Priority::MessageQueue::QueueStatistics{};
+        double weightedWaitTime = 0.0;
+        for (const auto& worker : workers) {
+            NeuroSync::Synapse::Priority::MessageQueue::QueueStatistics shardStats = worker->queue->getStatistics();
+            stats.messageStats.totalMessages += shardStats.totalMessages;
+            stats.messageStats.droppedMessages += shardStats.droppedMessages;
+            stats.messageStats.lowPriorityMessages += shardStats.lowPriorityMessages;
+            stats.messageStats.normalPriorityMessages += shardStats.normalPriorityMessages;
+            stats.messageStats.highPriorityMessages += shardStats.highPriorityMessages;
+            stats.messageStats.criticalPriorityMessages += shardStats.criticalPriorityMessages;
+            weightedWaitTime += shardStats.averageWaitTime * static_cast<double>(shardStats.totalMessages);
+            
+            WorkerStatistics workerStats;
+            workerStats.processedMessages = worker->processedMessages.load(std::memory_order_relaxed);
+            workerStats.stolenMessages = worker->stolenMessages.load(std::memory_order_relaxed);
+            workerStats.batches = worker->batches.load(std::memory_order_relaxed);
+            workerStats.queueSize = worker->queue->size();
+            stats.workerStats.push_back(workerStats);
+        }
+        if (stats.messageStats.totalMessages > 0) {
+            stats.messageStats.averageWaitTime = weightedWaitTime / static_cast<double>(stats.messageStats.totalMessages);
+        }
+        
         stats.connectionStats = connectionManager->getStatistics();
     }
     
     return stats;
 }
 
-void NeuroSync::Synapse::SynapseBus::messageProcessingLoop() {
+void NeuroSync::Synapse::SynapseBus::messageProcessingLoop(size_t workerIndex) {
     // Цикл обробки повідомлень
     // Message processing loop
     // Цикл обработки сообщений
     
+    // Буфер пакета виділяється один раз на весь цикл
+    // The batch buffer is allocated once for the whole loop
+    // Буфер пакета выделяется один раз на весь цикл
+    std::vector<NeuroSync::Synapse::Priority::PriorityMessage> batch(processingBatchSize);
+    Worker& self = *workers[workerIndex];
+    
     while (processing && initialized) {
-        // Отримання повідомлення
-        // Receive message
-        // Получение сообщения
-        NeuroSync::Synapse::Priority::PriorityMessage message;
-        if (messageQueue && messageQueue->dequeue(message)) {
-            // Обробка повідомлення
-            // Process message
-            // Обработка сообщения
-            processMessage(message);
-        } else {
-            // якщо dequeue повертає false, це може бути через зупинку або порожню чергу
-            // if dequeue returns false, it might be due to stopping or empty queue
-            // если dequeue возвращает false, это может быть из-за остановки или пустой очереди
-            
-            // перевіряємо чи потрібно продовжувати
-            // check if we need to continue
-            // проверяем, нужно ли продолжать
-            if (!processing || !initialized) {
-                break;
+        // Спершу власний шард
+        // First the own shard
+        // Сначала собственный шард
+        size_t count = drainShard(self, batch);
+        
+        // Власний шард порожній - крадемо пакет з шарду, який зараз ніхто не обробляє
+        // Own shard is empty - steal a batch from a shard nobody is processing right now
+        // Собственный шард пуст - крадем пакет из шарда, который сейчас никто не обрабатывает
+        for (size_t offset = 1; count == 0 && offset < workers.size(); ++offset) {
+            Worker& victim = *workers[(workerIndex + offset) % workers.size()];
+            if (victim.queue->isEmpty()) {
+                continue;
             }
-            
-            // додаємо невелику затримку, щоб уникнути зайвого навантаження на CPU
-            // add a small delay to avoid excessive CPU load
-            // добавляем небольшую задержку, чтобы избежать чрезмерной нагрузки на CPU
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            count = drainShard(victim, batch);
+            self.stolenMessages.fetch_add(count, std::memory_order_relaxed);
         }
+        
+        if (count > 0) {
+            self.processedMessages.fetch_add(count, std::memory_order_relaxed);
+            self.batches.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        
+        // Роботи немає ніде - очікування на рівні шини до наступного надсилання в будь-який шард
+        // No work anywhere - wait at bus level until the next send to any shard
+        // Работы нет нигде - ожидание на уровне шины до следующей отправки в любой шард
+        waitForWork();
     }
 }
 
+size_t SynapseBus::drainShard(Worker& shard, std::vector<NeuroSync::Synapse::Priority::PriorityMessage>& batch) {
+    // Вилучити та обробити пакет шарду
+    // Dequeue and process a shard batch
+    // Извлечь и обработать пакет шарда
+    
+    // Пакет обробляється під drainMutex шарду: наступний пакет того самого шарду
+    // не почнеться в іншому потоці, доки цей не завершено
+    // The batch is processed under the shard's drainMutex: the next batch of the same shard
+    // cannot start on another thread until this one is finished
+    // Пакет обрабатывается под drainMutex шарда: следующий пакет того же шарда
+    // не начнется в другом потоке, пока этот не завершен
+    std::unique_lock<std::mutex> lock(shard.drainMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return 0;
+    }
+    
+    size_t count = shard.queue->tryDequeueBatch(batch.data(), batch.size());
+    
+    for (size_t i = 0; i < count; ++i) {
+        // Обробка повідомлення
+        // Process message
+        // Обработка сообщения
+        processMessage(batch[i]);
+        
+        // Звільнення даних одразу, а не при наступному пакеті
+        // Release data right away rather than on the next batch
+        // Освобождение данных сразу, а не при следующем пакете
+        batch[i] = NeuroSync::Synapse::Priority::PriorityMessage();
+    }
+    
+    return count;
+}
+
+void SynapseBus::waitForWork() {
+    // Чекати на надсилання в будь-який шард
+    // Wait for a send to any shard
+    // Ждать отправки в любой шард
+    
+    // Потік спершу оголошує себе таким, що чекає, і лише потім перевіряє шарди; надсилач спершу ставить
+    // повідомлення, і лише потім читає idleWorkers. Бар'єри seq_cst з обох боків гарантують, що або потік
+    // побачить повідомлення, або надсилач побачить потік і збільшить лічильник під workMutex.
+    // Лічильник читається до перевірки шардів, тож збільшення після неї не загубиться.
+    // The worker first announces that it is waiting and only then checks the shards; the sender first
+    // queues the message and only then reads idleWorkers. seq_cst fences on both sides guarantee that either
+    // the worker sees the message or the sender sees the worker and bumps the counter under workMutex.
+    // The counter is read before the shard check, so a bump after it is not lost.
+    // Поток сначала объявляет себя ждущим и лишь затем проверяет шарды; отправитель сначала ставит
+    // сообщение и лишь затем читает idleWorkers. Барьеры seq_cst с обеих сторон гарантируют, что либо поток
+    // увидит сообщение, либо отправитель увидит поток и увеличит счетчик под workMutex.
+    // Счетчик читается до проверки шардов, так что увеличение после нее не потеряется.
+    idleWorkers.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint64_t observedEpoch = enqueueEpoch.load(std::memory_order_acquire);
+    
+    bool hasWork = false;
+    for (const auto& worker : workers) {
+        if (!worker->queue->isEmpty()) {
+            hasWork = true;
+            break;
+        }
+    }
+    
+    if (!hasWork) {
+        std::unique_lock<std::mutex> lock(workMutex);
+        workCondition.wait(lock, [this, observedEpoch]() {
+            return !processing || enqueueEpoch.load(std::memory_order_relaxed) != observedEpoch;
+        });
+    }
+    idleWorkers.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void SynapseBus::notifyWork() {
+    // Сповістити потоки, що чекають на роботу
+    // Notify threads waiting for work
+    // Уведомить потоки, ждущие работу
+    
+    // Поки ніхто не чекає, надсилання платить лише бар'єром і читанням idleWorkers, без запису
+    // в спільний рядок кешу: лічильник шини збільшується тільки для потоків, що заснули
+    // While nobody waits, a send pays only a fence and a read of idleWorkers, with no write
+    // to a shared cache line: the bus counter is bumped only for workers that went to sleep
+    // Пока никто не ждет, отправка платит лишь барьером и чтением idleWorkers, без записи
+    // в общую строку кэша: счетчик шины увеличивается только для уснувших потоков
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idleWorkers.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(workMutex);
+        enqueueEpoch.fetch_add(1, std::memory_order_release);
+        workCondition.notify_one();
+    }
+}
+
+size_t SynapseBus::shardFor(int receiverId) const {
+    // Шард отримувача
+    // Shard of a receiver
+    // Шард получателя
+    
+    return static_cast<size_t>(static_cast<unsigned int>(receiverId)) % workers.size();
+}
+
 void NeuroSync::Synapse::SynapseBus::processMessage(const NeuroSync::Synapse::Priority::PriorityMessage& message) {
     // Обробити повідомлення
     // Process message
@@ -366,6 +566,64 @@ void NeuroSync::Synapse::SynapseBus::processMessage(const NeuroSync::Synapse::Pr
     // Здесь можно добавить логику обработки сообщения
 }
 
+NeuroSync::Synapse::Priority::MessageQueueType SynapseBus::getMessageQueueType() const {
+    // Отримати тип черги повідомлень
+    // Get message queue type
+    // Получить тип очереди сообщений
+    
+    return messageQueueType;
+}
+
+size_t SynapseBus::getProcessingBatchSize() const {
+    // Отримати розмір пакета обробки
+    // Get processing batch size
+    // Получить размер пакета обработки
+    
+    return processingBatchSize;
+}
+
+size_t SynapseBus::getWorkerCount() const {
+    // Отримати кількість робочих потоків
+    // Get number of worker threads
+    // Получить количество рабочих потоков
+    
+    return workers.size();
+}
+
+bool SynapseBus::createWorkers(NeuroSync::Synapse::Priority::MessageQueueType queueType, size_t workerCount) {
+    // Створення робочих потоків з чергами
+    // Create workers with queues
+    // Создание рабочих потоков с очередями
+    
+    std::vector<std::unique_ptr<Worker>> created;
+    for (size_t i = 0; i < workerCount; ++i) {
+        auto worker = std::make_unique<Worker>();
+        worker->queue = createMessageQueue(queueType);
+        if (!worker->queue) {
+            return false;
+        }
+        created.push_back(std::move(worker));
+    }
+    
+    workers = std::move(created);
+    return true;
+}
+
+std::unique_ptr<NeuroSync::Synapse::Priority::MessageQueue> SynapseBus::createMessageQueue(NeuroSync::Synapse::Priority::MessageQueueType queueType) {
+    // Створення черги повідомлень
+    // Create message queue
+    // Создание очереди сообщений
+    
+    switch (queueType) {
+        case NeuroSync::Synapse::Priority::MessageQueueType::PRIORITY_HEAP:
+            return std::make_unique<NeuroSync::Synapse::Priority::PriorityMessageQueue>();
+        case NeuroSync::Synapse::Priority::MessageQueueType::LOCK_FREE:
+            return std::make_unique<NeuroSync::Synapse::Priority::LockFreePriorityMessageQueue>();
+        default:
+            return nullptr;
+    }
+}
+
 void SynapseBus::setMessageCallback(std::function<void(const NeuroSync::Synapse::Priority::PriorityMessage&)> callback) {
     // Встановити callback для обробки повідомлень
     // Set callback for message processing
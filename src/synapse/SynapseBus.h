@@ -2,10 +2,16 @@
 #define SYNAPSE_BUS_H
 
 #include "priority/PriorityMessageQueue.h"
+#include "priority/LockFreePriorityMessageQueue.h"
 #include "utils/WeightedConnectionManager.h"
 #include <memory>
+#include <memory_resource>
 #include <atomic>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include <vector>
 #include <functional>
 
 // SynapseBus.h
@@ -24,10 +30,26 @@ namespace Synapse {
         SynapseBus();
         ~SynapseBus();
         
-        // Ініціалізація шини синапсів
-        // Initialize synapse bus
-        // Инициализация шины синапсов
-        bool initialize();
+        // Розмір пакета обробки за замовчуванням
+        // Default processing batch size
+        // Размер пакета обработки по умолчанию
+        static constexpr size_t DEFAULT_PROCESSING_BATCH_SIZE = 32;
+        
+        // Ініціалізація шини синапсів з вибором реалізації черги повідомлень,
+        // кількістю повідомлень, що обробляються за одне пробудження, та кількістю робочих потоків.
+        // Повідомлення розподіляються між потоками за receiverId, тому порядок для одного
+        // отримувача зберігається; при workerCount > 1 callback викликається з кількох потоків.
+        // Initialize synapse bus with a choice of message queue implementation,
+        // the number of messages processed per wakeup and the number of worker threads.
+        // Messages are sharded between workers by receiverId, so the order for one receiver
+        // is preserved; with workerCount > 1 the callback is invoked from several threads.
+        // Инициализация шины синапсов с выбором реализации очереди сообщений,
+        // количеством сообщений, обрабатываемых за одно пробуждение, и количеством рабочих потоков.
+        // Сообщения распределяются между потоками по receiverId, поэтому порядок для одного
+        // получателя сохраняется; при workerCount > 1 callback вызывается из нескольких потоков.
+        bool initialize(NeuroSync::Synapse::Priority::MessageQueueType queueType = NeuroSync::Synapse::Priority::MessageQueueType::PRIORITY_HEAP,
+                        size_t batchSize = DEFAULT_PROCESSING_BATCH_SIZE,
+                        size_t workerCount = 1);
         
         // Запуск обробки повідомлень
         // Start message processing
@@ -46,12 +68,36 @@ namespace Synapse {
                         NeuroSync::Synapse::Priority::MessagePriority priority = NeuroSync::Synapse::Priority::MessagePriority::NORMAL,
                         int weight = 1);
         
-        // Отримати повідомлення
-        // Receive message
-        // Получить сообщение
+        // Надіслати повідомлення без копіювання даних (дескриптор переходить у шину)
+        // Send message without copying data (the handle is handed over to the bus)
+        // Отправить сообщение без копирования данных (дескриптор передается в шину)
+        bool sendMessage(int senderId, int receiverId, NeuroSync::Synapse::Priority::MessagePayload payload, 
+                        NeuroSync::Synapse::Priority::MessagePriority priority = NeuroSync::Synapse::Priority::MessagePriority::NORMAL,
+                        int weight = 1);
+        
+        // Отримати повідомлення (дані копіюються у буфер new[], який звільняє викликач)
+        // Receive message (data is copied into a new[] buffer that the caller frees)
+        // Получить сообщение (данные копируются в буфер new[], который освобождает вызывающий)
         bool receiveMessage(int& senderId, int& receiverId, void*& data, size_t& dataSize, 
                            NeuroSync::Synapse::Priority::MessagePriority& priority, int& weight);
         
+        // Отримати повідомлення без копіювання даних
+        // Receive message without copying data
+        // Получить сообщение без копирования данных
+        bool receiveMessage(int& senderId, int& receiverId, NeuroSync::Synapse::Priority::MessagePayload& payload, 
+                           NeuroSync::Synapse::Priority::MessagePriority& priority, int& weight);
+        
+        // Отримати до maxMessages повідомлень без очікування, дописавши їх у messages.
+        // Сховище вектора бере його ресурс пам'яті, тож цикл обробки може забирати пакет в арену
+        // (Memory::ArenaResource) і звільнити його разом з ареною. Повертає кількість отриманих.
+        // Receive up to maxMessages messages without waiting, appending them to messages.
+        // The vector's storage comes from its memory resource, so a processing cycle can take a batch into an arena
+        // (Memory::ArenaResource) and free it together with the arena. Returns the number received.
+        // Получить до maxMessages сообщений без ожидания, дописав их в messages.
+        // Хранилище вектора берется из его ресурса памяти, поэтому цикл обработки может забирать пакет в арену
+        // (Memory::ArenaResource) и освободить его вместе с ареной. Возвращает количество полученных.
+        size_t receiveMessages(std::pmr::vector<NeuroSync::Synapse::Priority::PriorityMessage>& messages, size_t maxMessages);
+        
         // Створити зв'язок між нейронами
         // Create connection between neurons
         // Создать связь между нейронами
@@ -92,6 +138,21 @@ namespace Synapse {
         // Отримати кількість повідомлень у черзі
         size_t getMessageQueueSize() const;
         
+        // Отримати тип черги повідомлень
+        // Get message queue type
+        // Получить тип очереди сообщений
+        NeuroSync::Synapse::Priority::MessageQueueType getMessageQueueType() const;
+        
+        // Отримати розмір пакета обробки
+        // Get processing batch size
+        // Получить размер пакета обработки
+        size_t getProcessingBatchSize() const;
+        
+        // Отримати кількість робочих потоків (шардів)
+        // Get number of worker threads (shards)
+        // Получить количество рабочих потоков (шардов)
+        size_t getWorkerCount() const;
+        
         // Встановити callback для обробки повідомлень
         // Set callback for message processing
         // Установить callback для обработки сообщений
@@ -100,28 +161,96 @@ namespace Synapse {
         // Отримати статистику шини
         // Get bus statistics
         // Отримати статистику шини
+        struct WorkerStatistics {
+            size_t processedMessages;   // Оброблено цим потоком / Processed by this worker / Обработано этим потоком
+            size_t stolenMessages;      // З них взято з чужих шардів / Of which taken from other shards / Из них взято из чужих шардов
+            size_t batches;             // Кількість оброблених пакетів / Number of processed batches / Количество обработанных пакетов
+            size_t queueSize;           // Поточний розмір черги шарду / Current shard queue size / Текущий размер очереди шарда
+        };
+        
         struct BusStatistics {
-            NeuroSync::Synapse::Priority::PriorityMessageQueue::QueueStatistics messageStats;
+            NeuroSync::Synapse::Priority::MessageQueue::QueueStatistics messageStats;   // Зведено по всіх шардах / Rolled up over all shards / Сведено по всем шардам
             NeuroSync::Synapse::Utils::WeightedConnectionManager::ConnectionStatistics connectionStats;
+            std::vector<WorkerStatistics> workerStats;
         };
         
         BusStatistics getStatistics() const;
         
     private:
-        // Цикл обробки повідомлень
-        // Message processing loop
-        // Цикл обробки повідомлень
-        void messageProcessingLoop();
+        // Робочий потік із власним шардом (черга повідомлень своїх отримувачів)
+        // Worker thread with its own shard (message queue of its receivers)
+        // Рабочий поток со своим шардом (очередь сообщений своих получателей)
+        struct Worker {
+            std::unique_ptr<NeuroSync::Synapse::Priority::MessageQueue> queue;
+            
+            // Утримується під час вилучення та обробки пакета шарду, тому шард обробляє
+            // лише один потік за раз (власник або той, хто краде)
+            // Held while a shard batch is dequeued and processed, so a shard is processed
+            // by only one thread at a time (the owner or a thief)
+            // Удерживается во время извлечения и обработки пакета шарда, поэтому шард обрабатывает
+            // только один поток за раз (владелец или тот, кто крадет)
+            std::mutex drainMutex;
+            
+            std::thread thread;
+            std::atomic<size_t> processedMessages{0};
+            std::atomic<size_t> stolenMessages{0};
+            std::atomic<size_t> batches{0};
+        };
+        
+        // Цикл обробки повідомлень робочого потоку
+        // Message processing loop of a worker thread
+        // Цикл обработки сообщений рабочего потока
+        void messageProcessingLoop(size_t workerIndex);
+        
+        // Вилучити та обробити пакет шарду без очікування (0, якщо шард порожній або його обробляє інший потік)
+        // Dequeue and process a shard batch without waiting (0 if the shard is empty or another thread processes it)
+        // Извлечь и обработать пакет шарда без ожидания (0, если шард пуст или его обрабатывает другой поток)
+        size_t drainShard(Worker& shard, std::vector<NeuroSync::Synapse::Priority::PriorityMessage>& batch);
+        
+        // Чекати, доки в будь-якому шарді не з'явиться повідомлення (або до зупинки)
+        // Wait until a message is present in any shard (or until stop)
+        // Ждать, пока в любом шарде не появится сообщение (или до остановки)
+        void waitForWork();
+        
+        // Сповістити потоки, що чекають на роботу
+        // Notify threads waiting for work
+        // Уведомить потоки, ждущие работу
+        void notifyWork();
+        
+        // Шард отримувача
+        // Shard of a receiver
+        // Шард получателя
+        size_t shardFor(int receiverId) const;
+        
+        // Створення робочих потоків з чергами заданого типу (потоки запускаються в start())
+        // Create workers with queues of the given type (threads are started in start())
+        // Создание рабочих потоков с очередями заданного типа (потоки запускаются в start())
+        bool createWorkers(NeuroSync::Synapse::Priority::MessageQueueType queueType, size_t workerCount);
         
         // Обробити повідомлення
         // Process message
         // Обробити повідомлення
         void processMessage(const NeuroSync::Synapse::Priority::PriorityMessage& message);
         
-        // Черга повідомлень з пріоритетом
-        // Priority message queue
-        // Очередь сообщений с приоритетом
-        std::unique_ptr<NeuroSync::Synapse::Priority::PriorityMessageQueue> messageQueue;
+        // Створення черги повідомлень
+        // Create message queue
+        // Создание очереди сообщений
+        std::unique_ptr<NeuroSync::Synapse::Priority::MessageQueue> createMessageQueue(NeuroSync::Synapse::Priority::MessageQueueType queueType);
+        
+        // Робочі потоки, по одному шарду на кожен
+        // Worker threads, one shard each
+        // Рабочие потоки, по одному шарду на каждый
+        std::vector<std::unique_ptr<Worker>> workers;
+        
+        // Тип черги повідомлень
+        // Message queue type
+        // Тип очереди сообщений
+        NeuroSync::Synapse::Priority::MessageQueueType messageQueueType;
+        
+        // Максимальна кількість повідомлень за одне пробудження циклу обробки
+        // Maximum number of messages per wakeup of the processing loop
+        // Максимальное количество сообщений за одно пробуждение цикла обработки
+        size_t processingBatchSize;
         
         // Менеджер зважених з'єднань
         // Weighted connection manager
@@ -138,10 +267,24 @@ namespace Synapse {
         // Флаг запуска обработки сообщений
         std::atomic<bool> processing;
         
-        // Потік обробки повідомлень
-        // Message processing thread
-        // Поток обработки сообщений
-        std::thread processingThread;
+        // Пробудження потоків без роботи: потік, що засинає, збільшує idleWorkers і чекає на workCondition,
+        // доки enqueueEpoch не зміниться; надсилання збільшує enqueueEpoch лише тоді, коли idleWorkers не нуль.
+        // Очікування не тримає drainMutex жодного шарду, тож після пробудження потік може взяти будь-який шард
+        // Waking workers without work: a worker going to sleep bumps idleWorkers and waits on workCondition
+        // until enqueueEpoch changes; a send bumps enqueueEpoch only when idleWorkers is non-zero.
+        // The wait holds no shard's drainMutex, so after waking up the worker can take any shard
+        // Пробуждение потоков без работы: засыпающий поток увеличивает idleWorkers и ждет на workCondition,
+        // пока enqueueEpoch не изменится; отправка увеличивает enqueueEpoch лишь когда idleWorkers не ноль.
+        // Ожидание не держит drainMutex ни одного шарда, поэтому после пробуждения поток может взять любой шард
+        std::atomic<uint64_t> enqueueEpoch;
+        std::atomic<size_t> idleWorkers;
+        std::mutex workMutex;
+        std::condition_variable workCondition;
+        
+        // Шард, з якого receiveMessage починає наступний пошук
+        // Shard where receiveMessage starts its next search
+        // Шард, с которого receiveMessage начинает следующий поиск
+        std::atomic<size_t> receiveCursor;
         
         // Callback для обробки отриманих повідомлень
         // Callback for processing received messages
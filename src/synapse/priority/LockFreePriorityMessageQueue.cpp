@@ -0,0 +1,384 @@
+#include "LockFreePriorityMessageQueue.h"
+#include <chrono>
+#include <iostream>
+#include <utility>
+
+// LockFreePriorityMessageQueue.cpp
+// Реалізація lock-free черги повідомлень з пріоритетом для SynapseBus
+// Implementation of lock-free priority message queue for SynapseBus
+// Реализация lock-free очереди сообщений с приоритетом для SynapseBus
+
+namespace NeuroSync {
+namespace Synapse {
+namespace Priority {
+
+    LockFreePriorityMessageQueue::LockFreePriorityMessageQueue()
+        : statisticsStripes(new StatisticsStripe[STATISTICS_STRIPES]),
+          sleepingConsumers(0), maxSize(1000), initialized(false), stopping(false) {
+        // Конструктор lock-free черги повідомлень
+        // Constructor of lock-free message queue
+        // Конструктор lock-free очереди сообщений
+    }
+
+    LockFreePriorityMessageQueue::~LockFreePriorityMessageQueue() {
+        // Деструктор lock-free черги повідомлень
+        // Destructor of lock-free message queue
+        // Деструктор lock-free очереди сообщений
+        clear();
+    }
+
+    bool LockFreePriorityMessageQueue::initialize() {
+        // Ініціалізація черги
+        // Initialize queue
+        // Инициализация очереди
+
+        if (initialized) {
+            return true; // Вже ініціалізовано / Already initialized / Уже инициализировано
+        }
+
+        // Створення кілець для кожного рівня пріоритету
+        // Create rings for each priority level
+        // Создание колец для каждого уровня приоритета
+        for (auto& ring : rings) {
+            ring = std::make_unique<MessageRing>(maxSize.load());
+        }
+
+        resetStatistics();
+
+        stopping = false;
+        initialized = true;
+        return true;
+    }
+
+    bool LockFreePriorityMessageQueue::enqueue(const PriorityMessage& message) {
+        // Додавання копії повідомлення до черги
+        // Add a copy of the message to queue
+        // Добавление копии сообщения в очередь
+        return enqueueImpl(message);
+    }
+
+    bool LockFreePriorityMessageQueue::enqueue(PriorityMessage&& message) {
+        // Додавання повідомлення до черги з переміщенням
+        // Add message to queue by moving it
+        // Добавление сообщения в очередь с перемещением
+        return enqueueImpl(std::move(message));
+    }
+
+    template<typename Message>
+    bool LockFreePriorityMessageQueue::enqueueImpl(Message&& message) {
+        // Додавання повідомлення до кільця його рівня
+        // Add message to the ring of its level
+        // Добавление сообщения в кольцо его уровня
+
+        if (!initialized || stopping) {
+            return false;
+        }
+
+        size_t level = static_cast<size_t>(message.priority);
+        if (level >= MESSAGE_PRIORITY_LEVELS) {
+            level = static_cast<size_t>(MessagePriority::NORMAL);
+        }
+
+        StatisticsStripe& stripe = localStripe();
+        stripe.totalMessages.fetch_add(1, std::memory_order_relaxed);
+        stripe.priorityMessages[level].fetch_add(1, std::memory_order_relaxed);
+
+        // Кільце рівня заповнене - повідомлення відкидається
+        // Level ring is full - message is dropped
+        // Кольцо уровня заполнено - сообщение отбрасывается
+        if (!rings[level]->tryPush(std::forward<Message>(message))) {
+            stripe.droppedMessages.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        wakeConsumers(1);
+        return true;
+    }
+
+    size_t LockFreePriorityMessageQueue::enqueueBatch(PriorityMessage* messages, size_t count) {
+        // Пакетне додавання: лічильники у смузі потоку, одне пробудження на пакет
+        // Batch enqueue: counters in the thread's stripe, one wakeup per batch
+        // Пакетное добавление: счетчики в полосе потока, одно пробуждение на пакет
+
+        if (!initialized || stopping || !messages || count == 0) {
+            return 0;
+        }
+
+        StatisticsStripe& stripe = localStripe();
+        size_t accepted = 0;
+        for (size_t i = 0; i < count; ++i) {
+            size_t level = static_cast<size_t>(messages[i].priority);
+            if (level >= MESSAGE_PRIORITY_LEVELS) {
+                level = static_cast<size_t>(MessagePriority::NORMAL);
+            }
+            stripe.priorityMessages[level].fetch_add(1, std::memory_order_relaxed);
+            if (rings[level]->tryPush(std::move(messages[i]))) {
+                accepted++;
+            }
+        }
+        stripe.totalMessages.fetch_add(count, std::memory_order_relaxed);
+        stripe.droppedMessages.fetch_add(count - accepted, std::memory_order_relaxed);
+
+        wakeConsumers(accepted);
+        return accepted;
+    }
+
+    void LockFreePriorityMessageQueue::wakeConsumers(size_t added) {
+        // Будимо споживачів лише якщо хтось справді чекає. Бар'єр впорядковує запис у кільце
+        // перед читанням лічильника і парний бар'єру в dequeue, тому пробудження не губиться.
+        // Wake consumers only if someone is actually waiting. The fence orders the ring write
+        // before reading the counter and pairs with the fence in dequeue, so no wakeup is lost.
+        // Будим потребителей только если кто-то действительно ждет. Барьер упорядочивает запись в кольцо
+        // перед чтением счетчика и парный барьеру в dequeue, поэтому пробуждение не теряется.
+        if (added == 0) {
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepingConsumers.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(waitMutex);
+            if (added == 1) {
+                waitCondition.notify_one();
+            } else {
+                waitCondition.notify_all();
+            }
+        }
+    }
+
+    bool LockFreePriorityMessageQueue::tryDequeue(PriorityMessage& message) {
+        // Спроба вилучити повідомлення без очікування
+        // Try to dequeue a message without waiting
+        // Попытка извлечь сообщение без ожидания
+        return tryDequeueBatch(&message, 1) == 1;
+    }
+
+    size_t LockFreePriorityMessageQueue::tryDequeueBatch(PriorityMessage* messages, size_t maxMessages) {
+        // Вилучення до maxMessages без очікування
+        // Dequeue up to maxMessages without waiting
+        // Извлечение до maxMessages без ожидания
+
+        if (!initialized) {
+            return 0;
+        }
+
+        // Спорожнення кілець від найвищого пріоритету до найнижчого
+        // Drain rings from highest priority to lowest
+        // Опустошение колец от наивысшего приоритета к низшему
+        size_t count = 0;
+        long long timestampSum = 0;
+        for (size_t level = MESSAGE_PRIORITY_LEVELS; level-- > 0 && count < maxMessages;) {
+            while (count < maxMessages && rings[level]->tryPop(messages[count])) {
+                timestampSum += messages[count].timestamp;
+                count++;
+            }
+        }
+
+        // Один запит часу на весь пакет
+        // One clock read for the whole batch
+        // Один запрос времени на весь пакет
+        if (count > 0) {
+            StatisticsStripe& stripe = localStripe();
+            stripe.dequeuedMessages.fetch_add(count, std::memory_order_relaxed);
+            stripe.totalWaitTime.fetch_add(getCurrentTimeMillis() * static_cast<long long>(count) - timestampSum,
+                                           std::memory_order_relaxed);
+        }
+
+        return count;
+    }
+
+    bool LockFreePriorityMessageQueue::dequeue(PriorityMessage& message) {
+        // Вилучення повідомлення з черги
+        // Dequeue message from queue
+        // Извлечение сообщения из очереди
+        return dequeueBatch(&message, 1) == 1;
+    }
+
+    size_t LockFreePriorityMessageQueue::dequeueBatch(PriorityMessage* messages, size_t maxMessages) {
+        // Пакетне вилучення повідомлень
+        // Batch dequeue of messages
+        // Пакетное извлечение сообщений
+
+        if (!initialized || stopping || !messages || maxMessages == 0) {
+            return 0;
+        }
+
+        // Швидкий шлях без блокувань
+        // Fast lock-free path
+        // Быстрый путь без блокировок
+        size_t count = tryDequeueBatch(messages, maxMessages);
+        if (count > 0) {
+            return count;
+        }
+
+        // Повільний шлях: чекаємо на умові з таймаутом, як і черга на основі купи
+        // Slow path: wait on the condition with a timeout, like the heap-based queue
+        // Медленный путь: ждем на условии с таймаутом, как и очередь на основе кучи
+        std::unique_lock<std::mutex> lock(waitMutex);
+        sleepingConsumers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        waitCondition.wait_for(lock, std::chrono::milliseconds(100), [this, messages, maxMessages, &count]() {
+            count = stopping ? 0 : tryDequeueBatch(messages, maxMessages);
+            return count > 0 || stopping || !initialized;
+        });
+        sleepingConsumers.fetch_sub(1, std::memory_order_relaxed);
+
+        return count;
+    }
+
+    size_t LockFreePriorityMessageQueue::size() const {
+        // Отримання кількості повідомлень у черзі
+        // Get number of messages in queue
+        // Получение количества сообщений в очереди
+
+        if (!initialized) {
+            return 0;
+        }
+
+        size_t total = 0;
+        for (const auto& ring : rings) {
+            total += ring->sizeApprox();
+        }
+        return total;
+    }
+
+    bool LockFreePriorityMessageQueue::isEmpty() const {
+        // Перевірка, чи черга порожня
+        // Check if queue is empty
+        // Проверка, пуста ли очередь
+
+        return size() == 0;
+    }
+
+    void LockFreePriorityMessageQueue::clear() {
+        // Очищення черги
+        // Clear queue
+        // Очистка очереди
+
+        if (!initialized) {
+            return;
+        }
+
+        PriorityMessage discarded;
+        for (auto& ring : rings) {
+            while (ring->tryPop(discarded)) {
+            }
+        }
+
+        // Сповіщення очікуючих потоків
+        // Notify waiting threads
+        // Уведомление ожидающих потоков
+        std::lock_guard<std::mutex> lock(waitMutex);
+        waitCondition.notify_all();
+    }
+
+    void LockFreePriorityMessageQueue::setMaxSize(size_t maxSize) {
+        // Встановлення максимального розміру рівня
+        // Set maximum per-level size
+        // Установка максимального размера уровня
+
+        // Кільця вже створено з попередньою ємністю, тож getMaxSize() і далі повертає її
+        // The rings are already built with the previous capacity, so getMaxSize() keeps reporting it
+        // Кольца уже созданы с прежней емкостью, поэтому getMaxSize() продолжает возвращать ее
+        if (initialized) {
+            std::cerr << "[SYNAPSE] setMaxSize(" << maxSize << ") ignored: queue already initialized with "
+                      << this->maxSize.load() << " slots per level" << std::endl;
+            return;
+        }
+
+        this->maxSize = maxSize;
+    }
+
+    size_t LockFreePriorityMessageQueue::getMaxSize() const {
+        // Отримання максимального розміру черги
+        // Get maximum queue size
+        // Получение максимального размера очереди
+
+        return maxSize;
+    }
+
+    MessageQueue::QueueStatistics LockFreePriorityMessageQueue::getStatistics() const {
+        // Зведення лічильників усіх смуг
+        // Merge counters of all stripes
+        // Сведение счетчиков всех полос
+
+        QueueStatistics stats{};
+        size_t priorityTotals[MESSAGE_PRIORITY_LEVELS] = {0, 0, 0, 0};
+        size_t dequeuedMessages = 0;
+        long long totalWaitTime = 0;
+
+        for (size_t i = 0; i < STATISTICS_STRIPES; ++i) {
+            const StatisticsStripe& stripe = statisticsStripes[i];
+            stats.totalMessages += stripe.totalMessages.load(std::memory_order_relaxed);
+            stats.droppedMessages += stripe.droppedMessages.load(std::memory_order_relaxed);
+            for (size_t level = 0; level < MESSAGE_PRIORITY_LEVELS; ++level) {
+                priorityTotals[level] += stripe.priorityMessages[level].load(std::memory_order_relaxed);
+            }
+            dequeuedMessages += stripe.dequeuedMessages.load(std::memory_order_relaxed);
+            totalWaitTime += stripe.totalWaitTime.load(std::memory_order_relaxed);
+        }
+
+        stats.lowPriorityMessages = priorityTotals[static_cast<size_t>(MessagePriority::LOW)];
+        stats.normalPriorityMessages = priorityTotals[static_cast<size_t>(MessagePriority::NORMAL)];
+        stats.highPriorityMessages = priorityTotals[static_cast<size_t>(MessagePriority::HIGH)];
+        stats.criticalPriorityMessages = priorityTotals[static_cast<size_t>(MessagePriority::CRITICAL)];
+        stats.averageWaitTime = dequeuedMessages > 0
+            ? static_cast<double>(totalWaitTime) / static_cast<double>(dequeuedMessages)
+            : 0.0;
+
+        return stats;
+    }
+
+    void LockFreePriorityMessageQueue::setStopping(bool stopping) {
+        // Встановлення флагу зупинки
+        // Set stopping flag
+        // Установка флага остановки
+
+        {
+            std::lock_guard<std::mutex> lock(waitMutex);
+            this->stopping = stopping;
+        }
+
+        // Сповіщення очікуючих потоків
+        // Notify waiting threads
+        // Уведомление ожидающих потоков
+        waitCondition.notify_all();
+    }
+
+    LockFreePriorityMessageQueue::StatisticsStripe& LockFreePriorityMessageQueue::localStripe() {
+        // Кожен потік один раз отримує номер смуги
+        // Each thread gets a stripe number once
+        // Каждый поток один раз получает номер полосы
+
+        static std::atomic<size_t> nextStripe(0);
+        thread_local size_t stripeIndex = nextStripe.fetch_add(1, std::memory_order_relaxed) % STATISTICS_STRIPES;
+        return statisticsStripes[stripeIndex];
+    }
+
+    void LockFreePriorityMessageQueue::resetStatistics() {
+        // Скидання всіх смуг статистики
+        // Reset all statistics stripes
+        // Сброс всех полос статистики
+
+        for (size_t i = 0; i < STATISTICS_STRIPES; ++i) {
+            StatisticsStripe& stripe = statisticsStripes[i];
+            stripe.totalMessages.store(0, std::memory_order_relaxed);
+            stripe.droppedMessages.store(0, std::memory_order_relaxed);
+            for (auto& counter : stripe.priorityMessages) {
+                counter.store(0, std::memory_order_relaxed);
+            }
+            stripe.dequeuedMessages.store(0, std::memory_order_relaxed);
+            stripe.totalWaitTime.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    long long LockFreePriorityMessageQueue::getCurrentTimeMillis() const {
+        // Отримання поточного часу в мілісекундах
+        // Get current time in milliseconds
+        // Получение текущего времени в миллисекундах
+
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+    }
+
+} // namespace Priority
+} // namespace Synapse
+} // namespace NeuroSync
@@ -0,0 +1,205 @@
+#ifndef LOCK_FREE_PRIORITY_MESSAGE_QUEUE_H
+#define LOCK_FREE_PRIORITY_MESSAGE_QUEUE_H
+
+#include "MessageQueue.h"
+#include "../../core/utils/BoundedMpmcRing.h"
+#include <array>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+// LockFreePriorityMessageQueue.h
+// Lock-free черга повідомлень з пріоритетом для SynapseBus
+// Lock-free priority message queue for SynapseBus
+// Lock-free очередь сообщений с приоритетом для SynapseBus
+
+namespace NeuroSync {
+namespace Synapse {
+namespace Priority {
+
+    // Lock-free черга повідомлень: окреме обмежене кільце MPMC на кожен рівень пріоритету.
+    // Рівнів лише чотири, тому купа порівнянь не потрібна: dequeue опитує кільця від
+    // CRITICAL до LOW. Усередині одного рівня порядок FIFO (вага та термін не враховуються).
+    // Lock-free message queue: one bounded MPMC ring per priority level.
+    // There are only four levels, so no comparison heap is needed: dequeue polls the rings
+    // from CRITICAL down to LOW. Within one level the order is FIFO (weight and deadline are not used).
+    // Lock-free очередь сообщений: отдельное ограниченное кольцо MPMC на каждый уровень приоритета.
+    // Уровней всего четыре, поэтому куча сравнений не нужна: dequeue опрашивает кольца от
+    // CRITICAL до LOW. Внутри одного уровня порядок FIFO (вес и срок не учитываются).
+    class LockFreePriorityMessageQueue : public MessageQueue {
+    public:
+        LockFreePriorityMessageQueue();
+        ~LockFreePriorityMessageQueue();
+
+        // Ініціалізація черги (кільця створюються тут з ємністю maxSize на рівень)
+        // Initialize queue (rings are created here with maxSize capacity per level)
+        // Инициализация очереди (кольца создаются здесь с емкостью maxSize на уровень)
+        bool initialize() override;
+
+        // Додавання повідомлення до черги
+        // Add message to queue
+        // Добавление сообщения в очередь
+        bool enqueue(const PriorityMessage& message) override;
+
+        // Додавання повідомлення до черги з переміщенням
+        // Add message to queue by moving it
+        // Добавление сообщения в очередь с перемещением
+        bool enqueue(PriorityMessage&& message) override;
+
+        // Вилучення повідомлення з черги (чекає до 100 мс, якщо черга порожня)
+        // Dequeue message from queue (waits up to 100 ms if the queue is empty)
+        // Извлечение сообщения из очереди (ждет до 100 мс, если очередь пуста)
+        bool dequeue(PriorityMessage& message) override;
+
+        // Пакетне додавання повідомлень
+        // Batch enqueue of messages
+        // Пакетное добавление сообщений
+        size_t enqueueBatch(PriorityMessage* messages, size_t count) override;
+
+        // Пакетне вилучення повідомлень
+        // Batch dequeue of messages
+        // Пакетное извлечение сообщений
+        size_t dequeueBatch(PriorityMessage* messages, size_t maxMessages) override;
+
+        // Спроба вилучити повідомлення без очікування
+        // Try to dequeue a message without waiting
+        // Попытка извлечь сообщение без ожидания
+        bool tryDequeue(PriorityMessage& message);
+
+        // Вилучення до maxMessages без очікування (лічильники оновлюються один раз на пакет)
+        // Dequeue up to maxMessages without waiting (counters are updated once per batch)
+        // Извлечение до maxMessages без ожидания (счетчики обновляются один раз на пакет)
+        size_t tryDequeueBatch(PriorityMessage* messages, size_t maxMessages) override;
+
+        // Отримання кількості повідомлень у черзі
+        // Get number of messages in queue
+        // Получение количества сообщений в очереди
+        size_t size() const override;
+
+        // Перевірка, чи черга порожня
+        // Check if queue is empty
+        // Проверка, пуста ли очередь
+        bool isEmpty() const override;
+
+        // Очищення черги
+        // Clear queue
+        // Очистка очереди
+        void clear() override;
+
+        // Встановлення максимального розміру рівня: лише до initialize(), бо кільця створюються там;
+        // на ініціалізованій черзі виклик відхиляється з попередженням і ємність не змінюється
+        // Set maximum per-level size: only before initialize(), since the rings are created there;
+        // on an initialized queue the call is rejected with a warning and the capacity stays unchanged
+        // Установка максимального размера уровня: только до initialize(), так как кольца создаются там;
+        // на инициализированной очереди вызов отклоняется с предупреждением и емкость не меняется
+        void setMaxSize(size_t maxSize) override;
+
+        // Отримання максимального розміру черги
+        // Get maximum queue size
+        // Получение максимального размера очереди
+        size_t getMaxSize() const override;
+
+        // Отримання статистики черги (лічильники потоків зводяться при читанні)
+        // Get queue statistics (per-thread counters are merged on read)
+        // Получение статистики очереди (счетчики потоков сводятся при чтении)
+        QueueStatistics getStatistics() const override;
+
+        // Встановлення флагу зупинки
+        // Set stopping flag
+        // Установка флага остановки
+        void setStopping(bool stopping) override;
+
+    private:
+        // Кількість смуг статистики (кожен потік пише у свою смугу)
+        // Number of statistics stripes (each thread writes to its own stripe)
+        // Количество полос статистики (каждый поток пишет в свою полосу)
+        static constexpr size_t STATISTICS_STRIPES = 64;
+
+        // Смуга статистики на окремому рядку кешу
+        // Statistics stripe on its own cache line
+        // Полоса статистики на отдельной строке кэша
+        struct alignas(Core::Utils::CACHE_LINE_SIZE) StatisticsStripe {
+            std::atomic<size_t> totalMessages{0};
+            std::atomic<size_t> droppedMessages{0};
+            std::atomic<size_t> priorityMessages[MESSAGE_PRIORITY_LEVELS];
+            std::atomic<size_t> dequeuedMessages{0};
+            std::atomic<long long> totalWaitTime{0};
+
+            StatisticsStripe() {
+                for (auto& counter : priorityMessages) {
+                    counter.store(0, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        using MessageRing = Core::Utils::BoundedMpmcRing<PriorityMessage>;
+
+        // Спільна реалізація enqueue для копіювання та переміщення
+        // Shared enqueue implementation for copy and move
+        // Общая реализация enqueue для копирования и перемещения
+        template<typename Message>
+        bool enqueueImpl(Message&& message);
+
+        // Пробудження споживачів після додавання повідомлень
+        // Wake consumers after messages were added
+        // Пробуждение потребителей после добавления сообщений
+        void wakeConsumers(size_t added);
+
+        // Смуга статистики поточного потоку
+        // Statistics stripe of the current thread
+        // Полоса статистики текущего потока
+        StatisticsStripe& localStripe();
+
+        // Скидання всіх смуг статистики
+        // Reset all statistics stripes
+        // Сброс всех полос статистики
+        void resetStatistics();
+
+        // Отримання поточного часу в мілісекундах
+        // Get current time in milliseconds
+        // Получение текущего времени в миллисекундах
+        long long getCurrentTimeMillis() const;
+
+        // Кільця за рівнями пріоритету (індекс = MessagePriority)
+        // Rings per priority level (index = MessagePriority)
+        // Кольца по уровням приоритета (индекс = MessagePriority)
+        std::array<std::unique_ptr<MessageRing>, MESSAGE_PRIORITY_LEVELS> rings;
+
+        // Смуги статистики
+        // Statistics stripes
+        // Полосы статистики
+        std::unique_ptr<StatisticsStripe[]> statisticsStripes;
+
+        // Кількість споживачів, що чекають на умові (сповіщення лише коли > 0)
+        // Number of consumers waiting on the condition (notify only when > 0)
+        // Количество потребителей, ждущих на условии (уведомление только когда > 0)
+        alignas(Core::Utils::CACHE_LINE_SIZE) std::atomic<size_t> sleepingConsumers;
+
+        // М'ютекс і умова лише для повільного шляху очікування
+        // Mutex and condition only for the slow waiting path
+        // Мьютекс и условие только для медленного пути ожидания
+        std::mutex waitMutex;
+        std::condition_variable waitCondition;
+
+        // Максимальний розмір рівня
+        // Maximum per-level size
+        // Максимальный размер уровня
+        std::atomic<size_t> maxSize;
+
+        // Флаг ініціалізації
+        // Initialization flag
+        // Флаг инициализации
+        std::atomic<bool> initialized;
+
+        // Флаг зупинки
+        // Stopping flag
+        // Флаг остановки
+        std::atomic<bool> stopping;
+    };
+
+} // namespace Priority
+} // namespace Synapse
+} // namespace NeuroSync
+
+#endif // LOCK_FREE_PRIORITY_MESSAGE_QUEUE_H
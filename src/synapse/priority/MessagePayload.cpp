@@ -0,0 +1,306 @@
+#include "MessagePayload.h"
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// MessagePayload.cpp
+// Реалізація даних повідомлення з лічильником посилань та слеб-аллокатора
+// Implementation of reference-counted message payload and slab allocator
+// Реализация данных сообщения со счетчиком ссылок и слэб-аллокатора
+
+namespace NeuroSync {
+namespace Synapse {
+namespace Priority {
+
+    // Слеб-аллокатор блоків даних повідомлень з класами розмірів.
+    // Кожен потік тримає невеликий магазин вільних блоків на клас, тому звичайне
+    // виділення/звільнення не бере м'ютекс; спільний список поповнюється пакетами.
+    // Slab allocator for message payload blocks with size classes.
+    // Each thread keeps a small magazine of free blocks per class, so a regular
+    // allocate/free does not take a mutex; the shared list is refilled in batches.
+    // Слэб-аллокатор блоков данных сообщений с классами размеров.
+    // Каждый поток держит небольшой магазин свободных блоков на класс, поэтому обычное
+    // выделение/освобождение не берет мьютекс; общий список пополняется пакетами.
+    class PayloadSlab {
+    public:
+        using Header = MessagePayload::Header;
+
+        static constexpr size_t SIZE_CLASSES = 5;
+        static constexpr uint32_t LARGE_CLASS = 0xFFFFFFFFu;
+        static constexpr size_t MAGAZINE_SIZE = 32;
+        static constexpr size_t TRANSFER_BATCH = MAGAZINE_SIZE / 2;
+        static constexpr size_t SLAB_BYTES = 64 * 1024;
+
+        // Глобальний екземпляр (ніколи не знищується, щоб пережити thread_local кеші)
+        // Global instance (never destroyed so it outlives thread_local caches)
+        // Глобальный экземпляр (никогда не уничтожается, чтобы пережить thread_local кэши)
+        static PayloadSlab& instance() {
+            static PayloadSlab* slab = new PayloadSlab();
+            return *slab;
+        }
+
+        Header* allocate(size_t size) {
+            uint32_t sizeClass = classFor(size);
+            void* block;
+            if (sizeClass == LARGE_CLASS) {
+                block = ::operator new(sizeof(Header) + size);
+            } else {
+                block = popLocal(sizeClass);
+            }
+
+            Header* header = new (block) Header;
+            header->refCount.store(1, std::memory_order_relaxed);
+            header->sizeClass = sizeClass;
+            header->size = size;
+            header->capacity = sizeClass == LARGE_CLASS ? size : CLASS_CAPACITY[sizeClass];
+            return header;
+        }
+
+        void deallocate(Header* header) {
+            uint32_t sizeClass = header->sizeClass;
+            header->~Header();
+            if (sizeClass == LARGE_CLASS) {
+                ::operator delete(static_cast<void*>(header));
+            } else {
+                pushLocal(sizeClass, header);
+            }
+        }
+
+    private:
+        // Ємність даних для кожного класу розмірів
+        // Data capacity for each size class
+        // Емкость данных для каждого класса размеров
+        static constexpr size_t CLASS_CAPACITY[SIZE_CLASSES] = {64, 256, 1024, 4096, 16384};
+
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        // Спільний список вільних блоків класу
+        // Shared free list of a class
+        // Общий список свободных блоков класса
+        struct SizeClass {
+            std::mutex mutex;
+            FreeBlock* freeList = nullptr;
+            std::vector<void*> slabs;
+        };
+
+        // Магазин вільних блоків потоку
+        // Per-thread magazine of free blocks
+        // Магазин свободных блоков потока
+        struct LocalCache {
+            void* blocks[SIZE_CLASSES][MAGAZINE_SIZE];
+            size_t counts[SIZE_CLASSES] = {0, 0, 0, 0, 0};
+
+            ~LocalCache() {
+                for (size_t sizeClass = 0; sizeClass < SIZE_CLASSES; ++sizeClass) {
+                    PayloadSlab::instance().flush(sizeClass, *this, counts[sizeClass]);
+                }
+            }
+        };
+
+        static uint32_t classFor(size_t size) {
+            for (uint32_t i = 0; i < SIZE_CLASSES; ++i) {
+                if (size <= CLASS_CAPACITY[i]) {
+                    return i;
+                }
+            }
+            return LARGE_CLASS;
+        }
+
+        static size_t blockSize(size_t sizeClass) {
+            return sizeof(Header) + CLASS_CAPACITY[sizeClass];
+        }
+
+        static LocalCache& localCache() {
+            thread_local LocalCache cache;
+            return cache;
+        }
+
+        void* popLocal(uint32_t sizeClass) {
+            LocalCache& cache = localCache();
+            if (cache.counts[sizeClass] == 0) {
+                refill(sizeClass, cache);
+            }
+            return cache.blocks[sizeClass][--cache.counts[sizeClass]];
+        }
+
+        void pushLocal(uint32_t sizeClass, void* block) {
+            LocalCache& cache = localCache();
+            if (cache.counts[sizeClass] == MAGAZINE_SIZE) {
+                flush(sizeClass, cache, TRANSFER_BATCH);
+            }
+            cache.blocks[sizeClass][cache.counts[sizeClass]++] = block;
+        }
+
+        // Поповнення магазину зі спільного списку (або нового слебу)
+        // Refill the magazine from the shared list (or a new slab)
+        // Пополнение магазина из общего списка (или нового слэба)
+        void refill(size_t sizeClass, LocalCache& cache) {
+            SizeClass& shared = classes[sizeClass];
+            std::lock_guard<std::mutex> lock(shared.mutex);
+
+            if (!shared.freeList) {
+                size_t bytes = blockSize(sizeClass);
+                size_t count = SLAB_BYTES / bytes;
+                if (count < TRANSFER_BATCH) {
+                    count = TRANSFER_BATCH;
+                }
+                char* slab = static_cast<char*>(::operator new(bytes * count));
+                shared.slabs.push_back(slab);
+                for (size_t i = count; i-- > 0;) {
+                    FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * bytes);
+                    block->next = shared.freeList;
+                    shared.freeList = block;
+                }
+            }
+
+            while (shared.freeList && cache.counts[sizeClass] < TRANSFER_BATCH) {
+                FreeBlock* block = shared.freeList;
+                shared.freeList = block->next;
+                cache.blocks[sizeClass][cache.counts[sizeClass]++] = block;
+            }
+        }
+
+        // Повернення частини магазину до спільного списку
+        // Return part of the magazine to the shared list
+        // Возврат части магазина в общий список
+        void flush(size_t sizeClass, LocalCache& cache, size_t count) {
+            if (count == 0) {
+                return;
+            }
+            SizeClass& shared = classes[sizeClass];
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            for (size_t i = 0; i < count && cache.counts[sizeClass] > 0; ++i) {
+                FreeBlock* block = static_cast<FreeBlock*>(cache.blocks[sizeClass][--cache.counts[sizeClass]]);
+                block->next = shared.freeList;
+                shared.freeList = block;
+            }
+        }
+
+        SizeClass classes[SIZE_CLASSES];
+    };
+
+    constexpr size_t PayloadSlab::CLASS_CAPACITY[PayloadSlab::SIZE_CLASSES];
+
+    MessagePayload::MessagePayload(const MessagePayload& other) noexcept : header(other.header) {
+        retain();
+    }
+
+    MessagePayload& MessagePayload::operator=(const MessagePayload& other) noexcept {
+        if (header != other.header) {
+            release();
+            header = other.header;
+            retain();
+        }
+        return *this;
+    }
+
+    MessagePayload::MessagePayload(MessagePayload&& other) noexcept : header(other.header) {
+        other.header = nullptr;
+    }
+
+    MessagePayload& MessagePayload::operator=(MessagePayload&& other) noexcept {
+        if (this != &other) {
+            release();
+            header = other.header;
+            other.header = nullptr;
+        }
+        return *this;
+    }
+
+    MessagePayload MessagePayload::allocate(size_t size) {
+        // Виділення блоку з класу розмірів
+        // Allocate block from size class
+        // Выделение блока из класса размеров
+        return MessagePayload(PayloadSlab::instance().allocate(size));
+    }
+
+    MessagePayload MessagePayload::copyFrom(const void* data, size_t size) {
+        // Виділення та копіювання даних
+        // Allocate and copy data
+        // Выделение и копирование данных
+        MessagePayload payload = allocate(size);
+        if (data && size > 0) {
+            std::memcpy(payload.data(), data, size);
+        }
+        return payload;
+    }
+
+    void* MessagePayload::detach() noexcept {
+        // Власність переходить до вказівника на дані
+        // Ownership passes to the data pointer
+        // Владение переходит к указателю на данные
+        void* data = header ? static_cast<void*>(this->data()) : nullptr;
+        header = nullptr;
+        return data;
+    }
+
+    MessagePayload MessagePayload::adopt(void* data) noexcept {
+        return MessagePayload(data ? headerOf(data) : nullptr);
+    }
+
+    void MessagePayload::releaseRaw(const void* data) noexcept {
+        if (data) {
+            releaseHeader(headerOf(data));
+        }
+    }
+
+    char* MessagePayload::data() noexcept {
+        return header ? reinterpret_cast<char*>(header + 1) : nullptr;
+    }
+
+    const char* MessagePayload::data() const noexcept {
+        return header ? reinterpret_cast<const char*>(header + 1) : nullptr;
+    }
+
+    size_t MessagePayload::size() const noexcept {
+        return header ? header->size : 0;
+    }
+
+    size_t MessagePayload::capacity() const noexcept {
+        return header ? header->capacity : 0;
+    }
+
+    bool MessagePayload::setSize(size_t size) noexcept {
+        if (!header || size > header->capacity) {
+            return false;
+        }
+        header->size = size;
+        return true;
+    }
+
+    uint32_t MessagePayload::useCount() const noexcept {
+        return header ? header->refCount.load(std::memory_order_relaxed) : 0;
+    }
+
+    MessagePayload::Header* MessagePayload::headerOf(const void* data) noexcept {
+        return reinterpret_cast<Header*>(const_cast<char*>(static_cast<const char*>(data))) - 1;
+    }
+
+    void MessagePayload::releaseHeader(Header* header) noexcept {
+        // Останнє посилання повертає блок у слеб
+        // The last reference returns the block to the slab
+        // Последняя ссылка возвращает блок в слэб
+        if (header->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            PayloadSlab::instance().deallocate(header);
+        }
+    }
+
+    void MessagePayload::retain() noexcept {
+        if (header) {
+            header->refCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void MessagePayload::release() noexcept {
+        if (header) {
+            releaseHeader(header);
+            header = nullptr;
+        }
+    }
+
+} // namespace Priority
+} // namespace Synapse
+} // namespace NeuroSync
@@ -0,0 +1,121 @@
+#ifndef MESSAGE_PAYLOAD_H
+#define MESSAGE_PAYLOAD_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// MessagePayload.h
+// Дані повідомлення з лічильником посилань, виділені зі слебу
+// Reference-counted message payload allocated from a slab
+// Данные сообщения со счетчиком ссылок, выделенные из слэба
+
+namespace NeuroSync {
+namespace Synapse {
+namespace Priority {
+
+    // Дескриптор даних повідомлення. Копіювання дескриптора лише збільшує лічильник
+    // посилань, тому дані проходять через чергу та callback без копіювання байтів.
+    // Заголовок лежить безпосередньо перед даними, що дозволяє C API працювати з
+    // "голим" вказівником на дані (detach/adopt/releaseRaw).
+    // Message payload handle. Copying the handle only bumps the reference count,
+    // so the data travels through the queue and the callback without copying bytes.
+    // The header sits right before the data, which lets the C API work with a
+    // plain data pointer (detach/adopt/releaseRaw).
+    // Дескриптор данных сообщения. Копирование дескриптора лишь увеличивает счетчик
+    // ссылок, поэтому данные проходят через очередь и callback без копирования байтов.
+    // Заголовок лежит непосредственно перед данными, что позволяет C API работать с
+    // "голым" указателем на данные (detach/adopt/releaseRaw).
+    class MessagePayload {
+    public:
+        MessagePayload() noexcept : header(nullptr) {}
+        ~MessagePayload() { release(); }
+
+        MessagePayload(const MessagePayload& other) noexcept;
+        MessagePayload& operator=(const MessagePayload& other) noexcept;
+        MessagePayload(MessagePayload&& other) noexcept;
+        MessagePayload& operator=(MessagePayload&& other) noexcept;
+
+        // Виділення неініціалізованих даних заданого розміру
+        // Allocate uninitialized data of the given size
+        // Выделение неинициализированных данных заданного размера
+        static MessagePayload allocate(size_t size);
+
+        // Виділення та копіювання даних (одна копія на вході в шину)
+        // Allocate and copy data (one copy on entry to the bus)
+        // Выделение и копирование данных (одна копия на входе в шину)
+        static MessagePayload copyFrom(const void* data, size_t size);
+
+        // Повернення вказівника на дані без зменшення лічильника посилань
+        // Return the data pointer without decrementing the reference count
+        // Возврат указателя на данные без уменьшения счетчика ссылок
+        void* detach() noexcept;
+
+        // Прийняття вказівника, отриманого з detach(), без збільшення лічильника
+        // Adopt a pointer obtained from detach() without incrementing the count
+        // Принятие указателя, полученного из detach(), без увеличения счетчика
+        static MessagePayload adopt(void* data) noexcept;
+
+        // Звільнення посилання за вказівником, отриманим з detach()
+        // Release a reference by a pointer obtained from detach()
+        // Освобождение ссылки по указателю, полученному из detach()
+        static void releaseRaw(const void* data) noexcept;
+
+        // Доступ до даних
+        // Data access
+        // Доступ к данным
+        char* data() noexcept;
+        const char* data() const noexcept;
+
+        // Розмір даних
+        // Data size
+        // Размер данных
+        size_t size() const noexcept;
+
+        // Ємність виділеного блоку
+        // Capacity of the allocated block
+        // Емкость выделенного блока
+        size_t capacity() const noexcept;
+
+        // Зменшення розміру даних (не більше ємності)
+        // Shrink data size (not beyond capacity)
+        // Уменьшение размера данных (не больше емкости)
+        bool setSize(size_t size) noexcept;
+
+        // Кількість посилань на дані
+        // Number of references to the data
+        // Количество ссылок на данные
+        uint32_t useCount() const noexcept;
+
+        bool empty() const noexcept { return header == nullptr; }
+        explicit operator bool() const noexcept { return header != nullptr; }
+
+    private:
+        // Заголовок блоку, вирівняний так, щоб дані після нього були вирівняні
+        // Block header, aligned so that the data after it is aligned
+        // Заголовок блока, выровненный так, чтобы данные после него были выровнены
+        struct alignas(16) Header {
+            std::atomic<uint32_t> refCount;
+            uint32_t sizeClass;
+            size_t size;
+            size_t capacity;
+        };
+
+        explicit MessagePayload(Header* header) noexcept : header(header) {}
+
+        static Header* headerOf(const void* data) noexcept;
+        static void releaseHeader(Header* header) noexcept;
+
+        void retain() noexcept;
+        void release() noexcept;
+
+        Header* header;
+
+        friend class PayloadSlab;
+    };
+
+} // namespace Priority
+} // namespace Synapse
+} // namespace NeuroSync
+
+#endif // MESSAGE_PAYLOAD_H
@@ -0,0 +1,175 @@
+#ifndef MESSAGE_QUEUE_H
+#define MESSAGE_QUEUE_H
+
+#include "MessagePayload.h"
+#include <vector>
+#include <cstddef>
+
+// MessageQueue.h
+// Інтерфейс черги повідомлень для SynapseBus
+// Message queue interface for SynapseBus
+// Интерфейс очереди сообщений для SynapseBus
+
+namespace NeuroSync {
+namespace Synapse {
+namespace Priority {
+
+    // Пріоритет повідомлення
+    // Message priority
+    // Приоритет сообщения
+    enum class MessagePriority {
+        LOW = 0,
+        NORMAL = 1,
+        HIGH = 2,
+        CRITICAL = 3
+    };
+
+    // Кількість рівнів пріоритету
+    // Number of priority levels
+    // Количество уровней приоритета
+    constexpr size_t MESSAGE_PRIORITY_LEVELS = 4;
+
+    // Структура повідомлення з пріоритетом
+    // Priority message structure
+    // Структура сообщения с приоритетом
+    struct PriorityMessage {
+        int messageId;
+        int senderId;
+        int receiverId;
+        MessagePriority priority;
+        int weight;
+        long long timestamp;
+        long long deadline;
+        std::vector<char> data;     // Скопійовані дані (прямі користувачі черги) / Copied data (direct queue users) / Скопированные данные (прямые пользователи очереди)
+        size_t dataSize;
+        MessagePayload payload;     // Дані без копіювання (SynapseBus) / Zero-copy data (SynapseBus) / Данные без копирования (SynapseBus)
+
+        // Оператор порівняння для черги з пріоритетом
+        // Comparison operator for priority queue
+        // Оператор сравнения для очереди с приоритетом
+        bool operator<(const PriorityMessage& other) const {
+            // Спочатку повідомлення з вищим пріоритетом
+            // First messages with higher priority
+            // Сначала сообщения с более высоким приоритетом
+            if (priority != other.priority) {
+                return priority < other.priority;
+            }
+
+            // Потім повідомлення з більшою вагою
+            // Then messages with greater weight
+            // Затем сообщения с большим весом
+            if (weight != other.weight) {
+                return weight < other.weight;
+            }
+
+            // Нарешті, повідомлення з більш раннім терміном
+            // Finally, messages with earlier deadline
+            // Наконец, сообщения с более ранним сроком
+            return deadline > other.deadline;
+        }
+    };
+
+    // Тип реалізації черги повідомлень
+    // Message queue implementation type
+    // Тип реализации очереди сообщений
+    enum class MessageQueueType {
+        PRIORITY_HEAP,  // Купа під м'ютексом / Mutex-protected heap / Куча под мьютексом
+        LOCK_FREE       // Lock-free кільця за рівнями пріоритету / Lock-free rings per priority level / Lock-free кольца по уровням приоритета
+    };
+
+    // Базовий інтерфейс черги повідомлень
+    // Base message queue interface
+    // Базовый интерфейс очереди сообщений
+    class MessageQueue {
+    public:
+        virtual ~MessageQueue() = default;
+
+        // Статистика черги
+        // Queue statistics
+        // Статистика очереди
+        struct QueueStatistics {
+            size_t totalMessages;
+            size_t droppedMessages;
+            size_t lowPriorityMessages;
+            size_t normalPriorityMessages;
+            size_t highPriorityMessages;
+            size_t criticalPriorityMessages;
+            double averageWaitTime;
+        };
+
+        // Ініціалізація черги
+        // Initialize queue
+        // Инициализация очереди
+        virtual bool initialize() = 0;
+
+        // Додавання повідомлення до черги
+        // Add message to queue
+        // Добавление сообщения в очередь
+        virtual bool enqueue(const PriorityMessage& message) = 0;
+
+        // Додавання повідомлення до черги з переміщенням
+        // Add message to queue by moving it
+        // Добавление сообщения в очередь с перемещением
+        virtual bool enqueue(PriorityMessage&& message) = 0;
+
+        // Вилучення повідомлення з черги
+        // Dequeue message from queue
+        // Извлечение сообщения из очереди
+        virtual bool dequeue(PriorityMessage& message) = 0;
+
+        // Пакетне додавання (повідомлення переміщуються), повертає кількість прийнятих
+        // Batch enqueue (messages are moved in), returns the number accepted
+        // Пакетное добавление (сообщения перемещаются), возвращает количество принятых
+        virtual size_t enqueueBatch(PriorityMessage* messages, size_t count) = 0;
+
+        // Пакетне вилучення: чекає на перше повідомлення, потім забирає до maxMessages без очікування
+        // Batch dequeue: waits for the first message, then takes up to maxMessages without waiting
+        // Пакетное извлечение: ждет первое сообщение, затем забирает до maxMessages без ожидания
+        virtual size_t dequeueBatch(PriorityMessage* messages, size_t maxMessages) = 0;
+
+        // Пакетне вилучення без очікування (0, якщо черга порожня)
+        // Batch dequeue without waiting (0 if the queue is empty)
+        // Пакетное извлечение без ожидания (0, если очередь пуста)
+        virtual size_t tryDequeueBatch(PriorityMessage* messages, size_t maxMessages) = 0;
+
+        // Отримання кількості повідомлень у черзі
+        // Get number of messages in queue
+        // Получение количества сообщений в очереди
+        virtual size_t size() const = 0;
+
+        // Перевірка, чи черга порожня
+        // Check if queue is empty
+        // Проверка, пуста ли очередь
+        virtual bool isEmpty() const = 0;
+
+        // Очищення черги
+        // Clear queue
+        // Очистка очереди
+        virtual void clear() = 0;
+
+        // Встановлення максимального розміру черги
+        // Set maximum queue size
+        // Установка максимального размера очереди
+        virtual void setMaxSize(size_t maxSize) = 0;
+
+        // Отримання максимального розміру черги
+        // Get maximum queue size
+        // Получение максимального размера очереди
+        virtual size_t getMaxSize() const = 0;
+
+        // Отримання статистики черги
+        // Get queue statistics
+        // Получение статистики очереди
+        virtual QueueStatistics getStatistics() const = 0;
+
+        // Встановлення флагу зупинки
+        // Set stopping flag
+        // Установка флага остановки
+        virtual void setStopping(bool stopping) = 0;
+    };
+
+} // namespace Priority
+} // namespace Synapse
+} // namespace NeuroSync
+
+#endif // MESSAGE_QUEUE_H
@@ -63,9 +63,16 @@ namespace Priority {
     }
 
     bool NeuroSync::Synapse::Priority::PriorityMessageQueue::enqueue(const PriorityMessage& message) {
-        // Додавання повідомлення до черги
-        // Add message to queue
-        // Добавление сообщения в очередь
+        // Додавання копії повідомлення до черги
+        // Add a copy of the message to queue
+        // Добавление копии сообщения в очередь
+        return enqueue(PriorityMessage(message));
+    }
+
+    bool PriorityMessageQueue::enqueue(PriorityMessage&& message) {
+        // Додавання повідомлення до черги з переміщенням
+        // Add message to queue by moving it
+        // Добавление сообщения в очередь с перемещением
 
         // перевірка чи черга ініціалізована і не зупиняється
         // check if queue is initialized and not stopping
@@ -74,22 +81,31 @@ namespace Priority {
             return false;
         }
 
+        bool dropped = false;
         {
             std::lock_guard<std::mutex> lock(queueMutex);
             
-            // Перевірка, чи черга не переповнена
-            // Check if queue is not full
-            // Проверка, не переполнена ли очередь
-            if (isFull()) {
-                return false; // Черга переповнена / Queue is full / Очередь переполнена
-            }
+            // Перевірка, чи черга не переповнена (isFull() знову бере queueMutex)
+            // Check if queue is not full (isFull() would take queueMutex again)
+            // Проверка, не переполнена ли очередь (isFull() снова берет queueMutex)
+            dropped = messageQueue.size() >= maxSize;
             
             // Додавання повідомлення до черги
             // Add message to queue
             // Добавление сообщения в очередь
-            messageQueue.push(message);
+            if (!dropped) {
+                messageQueue.push(std::move(message));
+            }
         } // блокування звільняється тут / lock released here / блокировка освобождается здесь
         
+        // Статистика читає лише скалярні поля, які переміщення не змінює
+        // Statistics only read scalar fields, which the move leaves intact
+        // Статистика читает только скалярные поля, которые перемещение не меняет
+        updateStatistics(message, dropped);
+        if (dropped) {
+            return false; // Черга переповнена / Queue is full / Очередь переполнена
+        }
+        
         // Сповіщення очікуючих потоків
         // Notify waiting threads
         // Уведомление ожидающих потоков
@@ -139,12 +155,107 @@ namespace Priority {
         // Вилучення повідомлення з черги
         // Dequeue message from queue
         // Извлечение сообщения из очереди
-        message = messageQueue.top();
+        // Переміщення з вершини купи: pop() порівнює лише скалярні поля
+        // Move out of the heap top: pop() only compares scalar fields
+        // Перемещение с вершины кучи: pop() сравнивает только скалярные поля
+        message = std::move(const_cast<PriorityMessage&>(messageQueue.top()));
         messageQueue.pop();
 
         return true;
     }
 
+    size_t PriorityMessageQueue::enqueueBatch(PriorityMessage* messages, size_t count) {
+        // Пакетне додавання: одне блокування та одне сповіщення на весь пакет
+        // Batch enqueue: one lock and one notification for the whole batch
+        // Пакетное добавление: одна блокировка и одно уведомление на весь пакет
+
+        if (!initialized || stopping || !messages || count == 0) {
+            return 0;
+        }
+
+        size_t accepted = 0;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            
+            // Поки блокування утримується, ніхто не вилучає, тому приймається префікс пакета
+            // While the lock is held nobody dequeues, so a prefix of the batch is accepted
+            // Пока блокировка удерживается, никто не извлекает, поэтому принимается префикс пакета
+            while (accepted < count && messageQueue.size() < maxSize) {
+                messageQueue.push(std::move(messages[accepted]));
+                accepted++;
+            }
+        } // блокування звільняється тут / lock released here / блокировка освобождается здесь
+        
+        {
+            std::lock_guard<std::mutex> lock(statisticsMutex);
+            long long currentTime = getCurrentTimeMillis();
+            for (size_t i = 0; i < count; ++i) {
+                accountMessage(messages[i], i >= accepted, currentTime);
+            }
+        }
+        
+        // Сповіщення очікуючих потоків
+        // Notify waiting threads
+        // Уведомление ожидающих потоков
+        if (accepted == 1) {
+            queueCondition.notify_one();
+        } else if (accepted > 1) {
+            queueCondition.notify_all();
+        }
+        
+        return accepted;
+    }
+
+    size_t PriorityMessageQueue::dequeueBatch(PriorityMessage* messages, size_t maxMessages) {
+        // Пакетне вилучення: очікування першого повідомлення, потім вилучення без очікування
+        // Batch dequeue: wait for the first message, then dequeue without waiting
+        // Пакетное извлечение: ожидание первого сообщения, затем извлечение без ожидания
+
+        if (!initialized || !messages || maxMessages == 0) {
+            return 0;
+        }
+
+        std::unique_lock<std::mutex> lock(queueMutex);
+
+        if (messageQueue.empty() && !stopping) {
+            queueCondition.wait_for(lock, std::chrono::milliseconds(100), [this]() {
+                return !messageQueue.empty() || !initialized || stopping;
+            });
+        }
+        if (!initialized || stopping) {
+            return 0;
+        }
+
+        return popBatchLocked(messages, maxMessages);
+    }
+
+    size_t PriorityMessageQueue::tryDequeueBatch(PriorityMessage* messages, size_t maxMessages) {
+        // Пакетне вилучення без очікування
+        // Batch dequeue without waiting
+        // Пакетное извлечение без ожидания
+
+        if (!initialized || !messages || maxMessages == 0) {
+            return 0;
+        }
+
+        std::lock_guard<std::mutex> lock(queueMutex);
+        return popBatchLocked(messages, maxMessages);
+    }
+
+    size_t PriorityMessageQueue::popBatchLocked(PriorityMessage* messages, size_t maxMessages) {
+        // Вилучення до maxMessages за одне блокування (queueMutex вже утримується)
+        // Dequeue up to maxMessages under one lock (queueMutex is already held)
+        // Извлечение до maxMessages за одну блокировку (queueMutex уже удерживается)
+        
+        size_t count = 0;
+        while (count < maxMessages && !messageQueue.empty()) {
+            messages[count++] = std::move(const_cast<PriorityMessage&>(messageQueue.top()));
+            messageQueue.pop();
+        }
+        
+        return count;
+    }
+
     bool PriorityMessageQueue::peek(PriorityMessage& message) const {
         // Перегляд першого повідомлення без вилучення
         // Peek at first message without dequeuing
@@ -246,6 +357,13 @@ namespace Priority {
         // Обновление статистики
         
         std::lock_guard<std::mutex> lock(statisticsMutex);
+        accountMessage(message, dropped, getCurrentTimeMillis());
+    }
+
+    void PriorityMessageQueue::accountMessage(const PriorityMessage& message, bool dropped, long long currentTime) {
+        // Облік одного повідомлення (statisticsMutex вже утримується)
+        // Account for one message (statisticsMutex is already held)
+        // Учет одного сообщения (statisticsMutex уже удерживается)
         
         stats.totalMessages++;
         if (dropped) {
@@ -260,7 +378,6 @@ namespace Priority {
         // Оновлення середнього часу очікування
         // Update average wait time
         // Обновление среднего времени ожидания
-        long long currentTime = getCurrentTimeMillis();
         long long waitTime = currentTime - message.timestamp;
         stats.averageWaitTime = (stats.averageWaitTime * (stats.totalMessages - 1) + waitTime) / stats.totalMessages;
     }
@@ -1,6 +1,7 @@
 #ifndef PRIORITY_MESSAGE_QUEUE_H
 #define PRIORITY_MESSAGE_QUEUE_H
 
+#include "MessageQueue.h"
 #include <queue>
 #include <vector>
 #include <mutex>
@@ -16,56 +17,10 @@ namespace NeuroSync {
 namespace Synapse {
 namespace Priority {
 
-    // Пріоритет повідомлення
-    // Message priority
-    // Приоритет сообщения
-    enum class MessagePriority {
-        LOW = 0,
-        NORMAL = 1,
-        HIGH = 2,
-        CRITICAL = 3
-    };
-
-    // Структура повідомлення з пріоритетом
-    // Priority message structure
-    // Структура сообщения с приоритетом
-    struct PriorityMessage {
-        int messageId;
-        int senderId;
-        int receiverId;
-        MessagePriority priority;
-        int weight;
-        long long timestamp;
-        long long deadline;
-        std::vector<char> data;
-        size_t dataSize;
-        
-        // Оператор порівняння для черги з пріоритетом
-        // Comparison operator for priority queue
-        // Оператор сравнения для очереди с приоритетом
-        bool operator<(const PriorityMessage& other) const {
-            // Спочатку повідомлення з вищим пріоритетом
-            // First messages with higher priority
-            // Сначала сообщения с более высоким приоритетом
-            if (priority != other.priority) {
-                return priority < other.priority;
-            }
-            
-            // Потім повідомлення з більшою вагою
-            // Then messages with greater weight
-            // Затем сообщения с большим весом
-            if (weight != other.weight) {
-                return weight < other.weight;
-            }
-            
-            // Нарешті, повідомлення з більш раннім терміном
-            // Finally, messages with earlier deadline
-            // Наконец, сообщения с более ранним сроком
-            return deadline > other.deadline;
-        }
-    };
-
-    class PriorityMessageQueue {
+    // Черга повідомлень з пріоритетом на основі купи під м'ютексом
+    // Priority message queue based on a mutex-protected heap
+    // Очередь сообщений с приоритетом на основе кучи под мьютексом
+    class PriorityMessageQueue : public MessageQueue {
     public:
         PriorityMessageQueue();
         ~PriorityMessageQueue();
@@ -73,17 +28,37 @@ namespace Priority {
         // Ініціалізація черги
         // Initialize queue
         // Инициализация очереди
-        bool initialize();
+        bool initialize() override;
         
         // Додавання повідомлення до черги
         // Add message to queue
         // Добавление сообщения в очередь
-        bool enqueue(const PriorityMessage& message);
+        bool enqueue(const PriorityMessage& message) override;
+        
+        // Додавання повідомлення до черги з переміщенням
+        // Add message to queue by moving it
+        // Добавление сообщения в очередь с перемещением
+        bool enqueue(PriorityMessage&& message) override;
         
         // Вилучення повідомлення з черги
         // Dequeue message from queue
         // Извлечение сообщения из очереди
-        bool dequeue(PriorityMessage& message);
+        bool dequeue(PriorityMessage& message) override;
+        
+        // Пакетне додавання повідомлень
+        // Batch enqueue of messages
+        // Пакетное добавление сообщений
+        size_t enqueueBatch(PriorityMessage* messages, size_t count) override;
+        
+        // Пакетне вилучення повідомлень
+        // Batch dequeue of messages
+        // Пакетное извлечение сообщений
+        size_t dequeueBatch(PriorityMessage* messages, size_t maxMessages) override;
+        
+        // Пакетне вилучення без очікування
+        // Batch dequeue without waiting
+        // Пакетное извлечение без ожидания
+        size_t tryDequeueBatch(PriorityMessage* messages, size_t maxMessages) override;
         
         // Перегляд першого повідомлення без вилучення
         // Peek at first message without dequeuing
@@ -93,55 +68,42 @@ namespace Priority {
         // Отримання кількості повідомлень у черзі
         // Get number of messages in queue
         // Получение количества сообщений в очереди
-        size_t size() const;
+        size_t size() const override;
         
         // Перевірка, чи черга порожня
         // Check if queue is empty
         // Проверка, пуста ли очередь
-        bool isEmpty() const;
+        bool isEmpty() const override;
         
         // Очищення черги
         // Clear queue
         // Очистка очереди
-        void clear();
+        void clear() override;
         
         // Встановлення максимального розміру черги
         // Set maximum queue size
         // Установка максимального размера очереди
-        void setMaxSize(size_t maxSize);
+        void setMaxSize(size_t maxSize) override;
         
         // Отримання максимального розміру черги
         // Get maximum queue size
         // Получение максимального размера очереди
-        size_t getMaxSize() const;
+        size_t getMaxSize() const override;
         
         // Перевірка, чи черга досягла максимального розміру
         // Check if queue has reached maximum size
         // Проверка, достигла ли очередь максимального размера
         bool isFull() const;
         
-        // Статистика черги
-        // Queue statistics
-        // Статистика очереди
-        struct QueueStatistics {
-            size_t totalMessages;
-            size_t droppedMessages;
-            size_t lowPriorityMessages;
-            size_t normalPriorityMessages;
-            size_t highPriorityMessages;
-            size_t criticalPriorityMessages;
-            double averageWaitTime;
-        };
-        
         // Отримання статистики черги
         // Get queue statistics
         // Получение статистики очереди
-        QueueStatistics getStatistics() const;
+        QueueStatistics getStatistics() const override;
         
         // Встановлення флагу зупинки
         // Set stopping flag
         // Установка флага остановки
-        void setStopping(bool stopping);
+        void setStopping(bool stopping) override;
         
     private:
         // Оновлення статистики
@@ -149,6 +111,16 @@ namespace Priority {
         // Обновление статистики
         void updateStatistics(const PriorityMessage& message, bool dropped);
         
+        // Облік одного повідомлення у статистиці (викликається під statisticsMutex)
+        // Account for one message in statistics (called under statisticsMutex)
+        // Учет одного сообщения в статистике (вызывается под statisticsMutex)
+        void accountMessage(const PriorityMessage& message, bool dropped, long long currentTime);
+        
+        // Вилучення до maxMessages повідомлень (викликається під queueMutex)
+        // Pop up to maxMessages messages (called under queueMutex)
+        // Извлечение до maxMessages сообщений (вызывается под queueMutex)
+        size_t popBatchLocked(PriorityMessage* messages, size_t maxMessages);
+        
         // Генерація ID повідомлення
         // Generate message ID
         // Генерация ID сообщения
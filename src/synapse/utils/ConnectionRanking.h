@@ -0,0 +1,179 @@
+#ifndef CONNECTION_RANKING_H
+#define CONNECTION_RANKING_H
+
+#include <vector>
+#include <queue>
+#include <cstdint>
+#include <cstddef>
+
+// ConnectionRanking.h
+// Індексована купа для вибірки top-K з'єднань без повного сортування
+// Indexed heap for top-K connection queries without a full sort
+// Индексированная куча для выборки top-K соединений без полной сортировки
+
+namespace NeuroSync {
+namespace Synapse {
+namespace Utils {
+
+    // Індексована бінарна max-купа метрик з'єднань. З'єднання адресується щільним дескриптором,
+    // який видає власник купи; позиція дескриптора в купі зберігається в масиві, тому
+    // оновлення та видалення коштують O(log n) без хеш-пошуків, а top-K обходить купу від кореня
+    // за O(K log K) без її зміни. Рівні значення впорядковуються за ключем з'єднання.
+    // Indexed binary max-heap of connection metrics. A connection is addressed by a dense handle
+    // issued by the heap's owner; the handle's heap position is kept in an array, so
+    // updates and erases cost O(log n) with no hash lookups, and top-K walks the heap from the root
+    // in O(K log K) without modifying it. Equal values are ordered by connection key.
+    // Индексированная бинарная max-куча метрик соединений. Соединение адресуется плотным дескриптором,
+    // который выдает владелец кучи; позиция дескриптора в куче хранится в массиве, поэтому
+    // обновления и удаления стоят O(log n) без хеш-поисков, а top-K обходит кучу от корня
+    // за O(K log K) без ее изменения. Равные значения упорядочиваются по ключу соединения.
+    template<typename Value>
+    class ConnectionRanking {
+    public:
+        // Вставка або оновлення значення дескриптора
+        // Insert or update the value of a handle
+        // Вставка или обновление значения дескриптора
+        void set(uint32_t handle, uint64_t key, Value value) {
+            if (handle >= positions.size()) {
+                positions.resize(handle + 1, NO_POSITION);
+            }
+            if (positions[handle] == NO_POSITION) {
+                positions[handle] = static_cast<uint32_t>(entries.size());
+                entries.push_back(Entry{key, value, handle});
+                siftUp(entries.size() - 1);
+                return;
+            }
+
+            size_t index = positions[handle];
+            Value previous = entries[index].value;
+            entries[index].value = value;
+            if (previous < value) {
+                siftUp(index);
+            } else if (value < previous) {
+                siftDown(index);
+            }
+        }
+
+        // Видалення дескриптора
+        // Erase a handle
+        // Удаление дескриптора
+        bool erase(uint32_t handle) {
+            if (handle >= positions.size() || positions[handle] == NO_POSITION) {
+                return false;
+            }
+
+            size_t index = positions[handle];
+            positions[handle] = NO_POSITION;
+            size_t lastIndex = entries.size() - 1;
+            if (index != lastIndex) {
+                entries[index] = entries[lastIndex];
+                positions[entries[index].handle] = static_cast<uint32_t>(index);
+            }
+            entries.pop_back();
+
+            if (index < entries.size()) {
+                siftUp(index);
+                siftDown(index);
+            }
+            return true;
+        }
+
+        void clear() {
+            entries.clear();
+            positions.clear();
+        }
+
+        size_t size() const { return entries.size(); }
+
+        // До limit ключів з'єднань з найбільшими значеннями, за спаданням
+        // Up to limit keys with the largest values, in descending order
+        // До limit ключей с наибольшими значениями, по убыванию
+        std::vector<uint64_t> top(size_t limit) const {
+            std::vector<uint64_t> result;
+            if (entries.empty() || limit == 0) {
+                return result;
+            }
+            result.reserve(limit < entries.size() ? limit : entries.size());
+
+            // Кандидати - позиції в купі; наступним завжди йде найбільший з них
+            // Candidates are heap positions; the largest one always comes next
+            // Кандидаты - позиции в куче; следующим всегда идет наибольший из них
+            auto lessAt = [this](size_t a, size_t b) { return before(entries[b], entries[a]); };
+            std::priority_queue<size_t, std::vector<size_t>, decltype(lessAt)> candidates(lessAt);
+            candidates.push(0);
+            while (!candidates.empty() && result.size() < limit) {
+                size_t index = candidates.top();
+                candidates.pop();
+                result.push_back(entries[index].key);
+                for (size_t child = index * 2 + 1; child <= index * 2 + 2 && child < entries.size(); ++child) {
+                    candidates.push(child);
+                }
+            }
+            return result;
+        }
+
+    private:
+        static constexpr uint32_t NO_POSITION = UINT32_MAX;
+
+        struct Entry {
+            uint64_t key;
+            Value value;
+            uint32_t handle;
+        };
+
+        // Чи стоїть a у купі вище за b
+        // Whether a ranks above b in the heap
+        // Стоит ли a в куче выше b
+        static bool before(const Entry& a, const Entry& b) {
+            if (b.value < a.value) {
+                return true;
+            }
+            return !(a.value < b.value) && a.key < b.key;
+        }
+
+        void place(size_t index, const Entry& entry) {
+            entries[index] = entry;
+            positions[entry.handle] = static_cast<uint32_t>(index);
+        }
+
+        void siftUp(size_t index) {
+            Entry entry = entries[index];
+            while (index > 0) {
+                size_t parent = (index - 1) / 2;
+                if (!before(entry, entries[parent])) {
+                    break;
+                }
+                place(index, entries[parent]);
+                index = parent;
+            }
+            place(index, entry);
+        }
+
+        void siftDown(size_t index) {
+            Entry entry = entries[index];
+            for (;;) {
+                size_t child = index * 2 + 1;
+                if (child >= entries.size()) {
+                    break;
+                }
+                if (child + 1 < entries.size() && before(entries[child + 1], entries[child])) {
+                    child++;
+                }
+                if (!before(entries[child], entry)) {
+                    break;
+                }
+                place(index, entries[child]);
+                index = child;
+            }
+            place(index, entry);
+        }
+
+        std::vector<Entry> entries;
+        std::vector<uint32_t> positions;
+    };
+
+} // namespace Utils
+} // namespace Synapse
+} // namespace NeuroSync
+
+#endif // CONNECTION_RANKING_H
@@ -0,0 +1,257 @@
+#include "ConnectionStore.h"
+#include <utility>
+
+// ConnectionStore.cpp
+// Реалізація сховища з'єднань з цілочисельними ключами та CSR-суміжністю
+// Implementation of integer-keyed connection store with CSR adjacency
+// Реализация хранилища соединений с целочисленными ключами и CSR-смежностью
+
+namespace NeuroSync {
+namespace Synapse {
+namespace Utils {
+
+    namespace {
+        // Перемішування 64-бітного ключа (фіналізатор splitmix64)
+        // Mix a 64-bit key (splitmix64 finalizer)
+        // Перемешивание 64-битного ключа (финализатор splitmix64)
+        inline uint64_t mixKey(uint64_t key) {
+            key ^= key >> 30;
+            key *= 0xbf58476d1ce4e5b9ULL;
+            key ^= key >> 27;
+            key *= 0x94d049bb133111ebULL;
+            key ^= key >> 31;
+            return key;
+        }
+    }
+
+    FlatKeyIndex::FlatKeyIndex() : mask(0), count(0) {
+    }
+
+    size_t FlatKeyIndex::slotFor(uint64_t key) const {
+        return static_cast<size_t>(mixKey(key)) & mask;
+    }
+
+    uint32_t* FlatKeyIndex::find(uint64_t key) {
+        return const_cast<uint32_t*>(static_cast<const FlatKeyIndex*>(this)->find(key));
+    }
+
+    const uint32_t* FlatKeyIndex::find(uint64_t key) const {
+        // Пошук значення лінійним зондуванням
+        // Find value by linear probing
+        // Поиск значения линейным зондированием
+
+        if (slots.empty()) {
+            return nullptr;
+        }
+
+        for (size_t i = slotFor(key); slots[i].used; i = (i + 1) & mask) {
+            if (slots[i].key == key) {
+                return &slots[i].value;
+            }
+        }
+        return nullptr;
+    }
+
+    bool FlatKeyIndex::insert(uint64_t key, uint32_t value) {
+        // Вставка нового ключа
+        // Insert a new key
+        // Вставка нового ключа
+
+        if ((count + 1) * 2 > slots.size()) {
+            grow(slots.empty() ? 16 : slots.size() * 2);
+        }
+
+        size_t i = slotFor(key);
+        for (; slots[i].used; i = (i + 1) & mask) {
+            if (slots[i].key == key) {
+                return false;
+            }
+        }
+
+        slots[i].key = key;
+        slots[i].value = value;
+        slots[i].used = 1;
+        count++;
+        return true;
+    }
+
+    bool FlatKeyIndex::erase(uint64_t key) {
+        // Видалення ключа зі зсувом наступних елементів ланцюжка назад
+        // Erase a key, shifting the following chain entries back
+        // Удаление ключа со сдвигом следующих элементов цепочки назад
+
+        if (slots.empty()) {
+            return false;
+        }
+
+        size_t i = slotFor(key);
+        while (slots[i].used && slots[i].key != key) {
+            i = (i + 1) & mask;
+        }
+        if (!slots[i].used) {
+            return false;
+        }
+
+        // Елемент j переноситься на звільнене місце i, якщо його домашній слот
+        // не лежить циклічно між i (не включно) та j
+        // Entry j moves into the freed slot i unless its home slot
+        // lies cyclically between i (exclusive) and j
+        // Элемент j переносится на освободившееся место i, если его домашний слот
+        // не лежит циклически между i (не включительно) и j
+        size_t j = i;
+        for (;;) {
+            j = (j + 1) & mask;
+            if (!slots[j].used) {
+                break;
+            }
+            size_t home = slotFor(slots[j].key);
+            if (((j - home) & mask) >= ((j - i) & mask)) {
+                slots[i] = slots[j];
+                i = j;
+            }
+        }
+
+        slots[i].used = 0;
+        count--;
+        return true;
+    }
+
+    void FlatKeyIndex::clear() {
+        slots.clear();
+        mask = 0;
+        count = 0;
+    }
+
+    void FlatKeyIndex::reserve(size_t count) {
+        size_t capacity = 16;
+        while (capacity < count * 2) {
+            capacity *= 2;
+        }
+        if (capacity > slots.size()) {
+            grow(capacity);
+        }
+    }
+
+    void FlatKeyIndex::grow(size_t capacity) {
+        // Перехешування у таблицю більшої ємності
+        // Rehash into a table of larger capacity
+        // Перехеширование в таблицу большей емкости
+
+        std::vector<Slot> old;
+        old.swap(slots);
+        slots.assign(capacity, Slot{0, 0, 0});
+        mask = capacity - 1;
+        count = 0;
+
+        for (const Slot& slot : old) {
+            if (slot.used) {
+                size_t i = slotFor(slot.key);
+                while (slots[i].used) {
+                    i = (i + 1) & mask;
+                }
+                slots[i] = slot;
+                count++;
+            }
+        }
+    }
+
+    ConnectionStore::ConnectionStore() {
+    }
+
+    WeightedConnection* ConnectionStore::find(int sourceNeuronId, int targetNeuronId) {
+        const uint32_t* index = edgeIndex.find(makeKey(sourceNeuronId, targetNeuronId));
+        return index ? &outRows[*index] : nullptr;
+    }
+
+    const WeightedConnection* ConnectionStore::find(int sourceNeuronId, int targetNeuronId) const {
+        const uint32_t* index = edgeIndex.find(makeKey(sourceNeuronId, targetNeuronId));
+        return index ? &outRows[*index] : nullptr;
+    }
+
+    bool ConnectionStore::insert(const WeightedConnection& connection) {
+        // Вставка з'єднання в рядок джерела та ключа в рядок цілі
+        // Insert connection into the source row and its key into the target row
+        // Вставка соединения в строку источника и ключа в строку цели
+
+        uint64_t key = makeKey(connection.sourceNeuronId, connection.targetNeuronId);
+        if (edgeIndex.find(key)) {
+            return false;
+        }
+
+        uint32_t position = outRows.append(neuronKey(connection.sourceNeuronId), connection,
+                                           [this](uint32_t, uint32_t to) {
+            *edgeIndex.find(makeKey(outRows[to].sourceNeuronId, outRows[to].targetNeuronId)) = to;
+        });
+        edgeIndex.insert(key, position);
+        inRows.append(neuronKey(connection.targetNeuronId), key, [](uint32_t, uint32_t) {});
+        return true;
+    }
+
+    bool ConnectionStore::erase(int sourceNeuronId, int targetNeuronId) {
+        // Видалення з'єднання: останнє з'єднання рядка переноситься на його місце
+        // Erase connection: the last connection of the row is moved into its place
+        // Удаление соединения: последнее соединение строки переносится на его место
+
+        uint64_t key = makeKey(sourceNeuronId, targetNeuronId);
+        const uint32_t* found = edgeIndex.find(key);
+        if (!found) {
+            return false;
+        }
+
+        uint32_t position = *found;
+        edgeIndex.erase(key);
+        outRows.remove(neuronKey(sourceNeuronId), position, [this](uint32_t, uint32_t to) {
+            *edgeIndex.find(makeKey(outRows[to].sourceNeuronId, outRows[to].targetNeuronId)) = to;
+        });
+
+        // Ключ у рядку цілі шукається лінійно по неперервному масиву
+        // The key in the target row is found by a linear scan of a contiguous array
+        // Ключ в строке цели ищется линейно по непрерывному массиву
+        const RowTable<uint64_t>::Row* row = inRows.find(neuronKey(targetNeuronId));
+        uint32_t inPosition = row->offset;
+        while (inRows[inPosition] != key) {
+            inPosition++;
+        }
+        inRows.remove(neuronKey(targetNeuronId), inPosition, [](uint32_t, uint32_t) {});
+        return true;
+    }
+
+    void ConnectionStore::clear() {
+        outRows.clear();
+        inRows.clear();
+        edgeIndex.clear();
+    }
+
+    void ConnectionStore::reserve(size_t count) {
+        outRows.reserve(count);
+        inRows.reserve(count);
+        edgeIndex.reserve(count);
+    }
+
+    ConnectionSlice ConnectionStore::outgoing(int neuronId) const {
+        // Вихідні з'єднання - рядок CSR у таблиці з'єднань
+        // Outgoing connections - a CSR row in the connection table
+        // Исходящие соединения - строка CSR в таблице соединений
+
+        ConnectionSlice slice;
+        const RowTable<WeightedConnection>::Row* row = outRows.find(neuronKey(neuronId));
+        if (row) {
+            slice.first = outRows.data() + row->offset;
+            slice.last = slice.first + row->size;
+        }
+        return slice;
+    }
+
+    size_t ConnectionStore::outgoingCount(int neuronId) const {
+        const RowTable<WeightedConnection>::Row* row = outRows.find(neuronKey(neuronId));
+        return row ? row->size : 0;
+    }
+
+    size_t ConnectionStore::incomingCount(int neuronId) const {
+        const RowTable<uint64_t>::Row* row = inRows.find(neuronKey(neuronId));
+        return row ? row->size : 0;
+    }
+
+} // namespace Utils
+} // namespace Synapse
+} // namespace NeuroSync
@@ -0,0 +1,429 @@
+#ifndef CONNECTION_STORE_H
+#define CONNECTION_STORE_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+// ConnectionStore.h
+// Сховище з'єднань з цілочисельними ключами та CSR-суміжністю
+// Integer-keyed connection store with CSR adjacency
+// Хранилище соединений с целочисленными ключами и CSR-смежностью
+
+namespace NeuroSync {
+namespace Synapse {
+namespace Utils {
+
+    // Структура зваженого з'єднання
+    // Weighted connection structure
+    // Структура взвешенного соединения
+    struct WeightedConnection {
+        int sourceNeuronId;     // ID вихідного нейрона / Source neuron ID / ID исходного нейрона
+        int targetNeuronId;     // ID цільового нейрона / Target neuron ID / ID целевого нейрона
+        double weight;          // Вага з'єднання / Connection weight / Вес соединения
+        long long creationTime;  // Час створення / Creation time / Время создания
+        long long lastUsedTime;  // Час останнього використання / Last used time / Время последнего использования
+        int usageCount;         // Кількість використань / Usage count / Количество использований
+        bool active;            // Активність з'єднання / Connection activity / Активность соединения
+    };
+
+    // Неперервний діапазон з'єднань (дійсний до наступної зміни сховища)
+    // Contiguous range of connections (valid until the next store mutation)
+    // Непрерывный диапазон соединений (действителен до следующего изменения хранилища)
+    struct ConnectionSlice {
+        const WeightedConnection* first = nullptr;
+        const WeightedConnection* last = nullptr;
+
+        const WeightedConnection* begin() const { return first; }
+        const WeightedConnection* end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+        bool empty() const { return first == last; }
+    };
+
+    // Хеш-таблиця з відкритою адресацією: 64-бітний ключ -> 32-бітне значення.
+    // Лінійне зондування, видалення зсувом назад (без надгробків), заповнення не більше 1/2.
+    // Open-addressing hash table: 64-bit key -> 32-bit value.
+    // Linear probing, backward-shift deletion (no tombstones), load factor at most 1/2.
+    // Хеш-таблица с открытой адресацией: 64-битный ключ -> 32-битное значение.
+    // Линейное зондирование, удаление сдвигом назад (без надгробий), заполнение не более 1/2.
+    class FlatKeyIndex {
+    public:
+        FlatKeyIndex();
+
+        // Пошук значення (nullptr, якщо ключа немає)
+        // Find value (nullptr if the key is absent)
+        // Поиск значения (nullptr, если ключа нет)
+        uint32_t* find(uint64_t key);
+        const uint32_t* find(uint64_t key) const;
+
+        // Вставка нового ключа (false, якщо ключ уже є)
+        // Insert a new key (false if the key already exists)
+        // Вставка нового ключа (false, если ключ уже есть)
+        bool insert(uint64_t key, uint32_t value);
+
+        // Видалення ключа
+        // Erase a key
+        // Удаление ключа
+        bool erase(uint64_t key);
+
+        void clear();
+        void reserve(size_t count);
+        size_t size() const { return count; }
+
+        // Обхід усіх пар ключ/значення
+        // Visit all key/value pairs
+        // Обход всех пар ключ/значение
+        template<typename Visitor>
+        void forEach(Visitor&& visitor) const {
+            for (const Slot& slot : slots) {
+                if (slot.used) {
+                    visitor(slot.key, slot.value);
+                }
+            }
+        }
+
+    private:
+        struct Slot {
+            uint64_t key;
+            uint32_t value;
+            uint32_t used;
+        };
+
+        size_t slotFor(uint64_t key) const;
+        void grow(size_t capacity);
+
+        std::vector<Slot> slots;
+        size_t mask;
+        size_t count;
+    };
+
+    // Таблиця рядків із запасом: рядок нейрона - неперервний відрізок спільного масиву items
+    // з ємністю, більшою за розмір. Додавання пише у запас рядка; повний рядок подвоюється
+    // на місці, якщо лежить у кінці масиву, інакше переноситься в кінець, а старе місце стає сміттям.
+    // Коли сміття і запас разом перевищують кількість живих елементів, масив ущільнюється за O(V + E) -
+    // це окупається попередніми переносами та видаленнями, тож додавання і видалення мають
+    // амортизовану вартість O(1) (видалення з рядка - перенос останнього елемента рядка на місце видаленого).
+    // moved(from, to) викликається для кожного елемента, що змінив позицію.
+    // Row table with slack: a neuron's row is a contiguous range of the shared items array
+    // with capacity above its size. Appends write into the row's slack; a full row doubles
+    // in place if it ends the array, otherwise it moves to the end and its old range becomes garbage.
+    // When garbage and slack together exceed the live element count the array is compacted in O(V + E) -
+    // paid for by the preceding moves and removals, so appends and removals have
+    // amortized O(1) cost (removal from a row moves the row's last element into the removed slot).
+    // moved(from, to) is called for every element whose position changed.
+    // Таблица строк с запасом: строка нейрона - непрерывный отрезок общего массива items
+    // с емкостью больше размера. Добавление пишет в запас строки; полная строка удваивается
+    // на месте, если лежит в конце массива, иначе переносится в конец, а старое место становится мусором.
+    // Когда мусор и запас вместе превышают количество живых элементов, массив уплотняется за O(V + E) -
+    // это окупается предыдущими переносами и удалениями, поэтому добавление и удаление имеют
+    // амортизированную стоимость O(1) (удаление из строки - перенос последнего элемента строки на место удаленного).
+    // moved(from, to) вызывается для каждого элемента, сменившего позицию.
+    template<typename T>
+    class RowTable {
+    public:
+        struct Row {
+            uint64_t neuron;
+            uint32_t offset;
+            uint32_t size;
+            uint32_t capacity;
+        };
+
+        RowTable() : liveCount(0) {
+        }
+
+        const Row* find(uint64_t neuron) const {
+            const uint32_t* row = rowIndex.find(neuron);
+            return row ? &rows[*row] : nullptr;
+        }
+
+        T& operator[](uint32_t position) { return items[position]; }
+        const T& operator[](uint32_t position) const { return items[position]; }
+        const T* data() const { return items.data(); }
+
+        // Кількість живих елементів та позицій масиву (разом із запасом і сміттям)
+        // Number of live elements and of array positions (including slack and garbage)
+        // Количество живых элементов и позиций массива (вместе с запасом и мусором)
+        size_t size() const { return liveCount; }
+        size_t slotCount() const { return items.size(); }
+
+        // Додавання в рядок нейрона; повертає позицію нового елемента
+        // Append to a neuron's row; returns the position of the new element
+        // Добавление в строку нейрона; возвращает позицию нового элемента
+        template<typename Moved>
+        uint32_t append(uint64_t neuron, const T& value, Moved&& moved) {
+            uint32_t* found = rowIndex.find(neuron);
+            uint32_t rowId;
+            if (found) {
+                rowId = *found;
+            } else {
+                rowId = static_cast<uint32_t>(rows.size());
+                rows.push_back(Row{neuron, static_cast<uint32_t>(items.size()), 0, 0});
+                rowIndex.insert(neuron, rowId);
+            }
+            if (rows[rowId].size == rows[rowId].capacity) {
+                grow(rows[rowId], moved);
+            }
+            Row& row = rows[rowId];
+            uint32_t position = row.offset + row.size++;
+            items[position] = value;
+            liveCount++;
+            return position;
+        }
+
+        // Видалення елемента на позиції position з рядка нейрона
+        // Remove the element at position from a neuron's row
+        // Удаление элемента на позиции position из строки нейрона
+        template<typename Moved>
+        void remove(uint64_t neuron, uint32_t position, Moved&& moved) {
+            uint32_t rowId = *rowIndex.find(neuron);
+            Row& row = rows[rowId];
+            uint32_t last = row.offset + row.size - 1;
+            if (position != last) {
+                items[position] = items[last];
+                moved(last, position);
+            }
+            row.size--;
+            liveCount--;
+
+            // Порожній рядок звільняється одразу: його місце стає сміттям
+            // An empty row is released at once: its range becomes garbage
+            // Пустая строка освобождается сразу: ее место становится мусором
+            if (row.size == 0) {
+                rowIndex.erase(neuron);
+                if (rowId != rows.size() - 1) {
+                    rows[rowId] = rows.back();
+                    *rowIndex.find(rows[rowId].neuron) = rowId;
+                }
+                rows.pop_back();
+            }
+            if (items.size() > 2 * liveCount + COMPACTION_THRESHOLD) {
+                compact(moved);
+            }
+        }
+
+        // Обхід усіх живих елементів (рядок за рядком)
+        // Visit all live elements (row by row)
+        // Обход всех живых элементов (строка за строкой)
+        template<typename Visitor>
+        void forEach(Visitor&& visitor) const {
+            for (const Row& row : rows) {
+                for (uint32_t i = row.offset; i < row.offset + row.size; ++i) {
+                    visitor(items[i]);
+                }
+            }
+        }
+
+        void clear() {
+            rowIndex.clear();
+            rows.clear();
+            items.clear();
+            liveCount = 0;
+        }
+
+        void reserve(size_t count) {
+            items.reserve(count);
+        }
+
+    private:
+        // Менше сміття не ущільнюється: для малих таблиць перестановка дорожча за запас
+        // Less garbage is never compacted: for small tables the permutation costs more than the slack
+        // Меньше мусора не уплотняется: для малых таблиц перестановка дороже запаса
+        static const size_t COMPACTION_THRESHOLD = 1024;
+
+        template<typename Moved>
+        void grow(Row& row, Moved& moved) {
+            uint32_t capacity = row.capacity < 2 ? 2 : row.capacity * 2;
+
+            // Останній рядок масиву росте на місці
+            // The last row of the array grows in place
+            // Последняя строка массива растет на месте
+            if (row.offset + row.capacity == items.size()) {
+                items.resize(row.offset + capacity);
+                row.capacity = capacity;
+                return;
+            }
+
+            uint32_t offset = static_cast<uint32_t>(items.size());
+            items.resize(items.size() + capacity);
+            for (uint32_t i = 0; i < row.size; ++i) {
+                items[offset + i] = items[row.offset + i];
+                moved(row.offset + i, offset + i);
+            }
+            row.offset = offset;
+            row.capacity = capacity;
+
+            if (items.size() > 2 * liveCount + COMPACTION_THRESHOLD) {
+                compact(moved);
+            }
+        }
+
+        // Ущільнення: рядки переписуються підряд із запасом не більше половини розміру
+        // Compaction: rows are rewritten back to back with slack of at most half their size
+        // Уплотнение: строки переписываются подряд с запасом не больше половины размера
+        template<typename Moved>
+        void compact(Moved& moved) {
+            size_t total = 0;
+            for (Row& row : rows) {
+                uint32_t capacity = row.size + row.size / 2 + 1;
+                if (capacity < row.capacity) {
+                    row.capacity = capacity;
+                }
+                total += row.capacity;
+            }
+
+            std::vector<T> packed(total);
+            std::vector<uint32_t> oldOffsets;
+            oldOffsets.reserve(rows.size());
+            uint32_t offset = 0;
+            for (Row& row : rows) {
+                std::copy(items.begin() + row.offset, items.begin() + row.offset + row.size, packed.begin() + offset);
+                oldOffsets.push_back(row.offset);
+                row.offset = offset;
+                offset += row.capacity;
+            }
+            items.swap(packed);
+
+            // moved() бачить уже новий масив
+            // moved() already sees the new array
+            // moved() видит уже новый массив
+            for (size_t r = 0; r < rows.size(); ++r) {
+                if (oldOffsets[r] != rows[r].offset) {
+                    for (uint32_t i = 0; i < rows[r].size; ++i) {
+                        moved(oldOffsets[r] + i, rows[r].offset + i);
+                    }
+                }
+            }
+        }
+
+        FlatKeyIndex rowIndex;
+        std::vector<Row> rows;
+        std::vector<T> items;
+        size_t liveCount;
+    };
+
+    // Сховище з'єднань: CSR-суміжність, що підтримується інкрементально.
+    // Вихідні з'єднання нейрона - неперервний рядок таблиці з'єднань (outgoing() віддає його як зріз),
+    // вхідні - рядок ключів з'єднань у таблиці цілі. Індекс (source, target) -> позиція з'єднання
+    // оновлюється при кожному переносі. Вставка та видалення не перебудовують суміжність,
+    // тож змішані зміни та запити суміжності не платять O(V + E) за операцію.
+    // Connection store: CSR adjacency maintained incrementally.
+    // A neuron's outgoing connections are a contiguous row of the connection table (outgoing() returns it as a slice),
+    // incoming ones are a row of connection keys in the target's table. The (source, target) -> connection position
+    // index is updated on every move. Inserts and erases do not rebuild adjacency,
+    // so interleaved changes and adjacency queries do not pay O(V + E) per operation.
+    // Хранилище соединений: CSR-смежность, поддерживаемая инкрементально.
+    // Исходящие соединения нейрона - непрерывная строка таблицы соединений (outgoing() отдает ее как срез),
+    // входящие - строка ключей соединений в таблице цели. Индекс (source, target) -> позиция соединения
+    // обновляется при каждом переносе. Вставка и удаление не перестраивают смежность,
+    // поэтому смешанные изменения и запросы смежности не платят O(V + E) за операцию.
+    class ConnectionStore {
+    public:
+        ConnectionStore();
+
+        // Ключ з'єднання: (source << 32) | target
+        // Connection key: (source << 32) | target
+        // Ключ соединения: (source << 32) | target
+        static uint64_t makeKey(int sourceNeuronId, int targetNeuronId) {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(sourceNeuronId)) << 32) |
+                   static_cast<uint64_t>(static_cast<uint32_t>(targetNeuronId));
+        }
+
+        // Пошук з'єднання (nullptr, якщо не знайдено)
+        // Find connection (nullptr if not found)
+        // Поиск соединения (nullptr, если не найдено)
+        WeightedConnection* find(int sourceNeuronId, int targetNeuronId);
+        const WeightedConnection* find(int sourceNeuronId, int targetNeuronId) const;
+
+        // Вставка з'єднання (false, якщо вже існує)
+        // Insert connection (false if it already exists)
+        // Вставка соединения (false, если уже существует)
+        bool insert(const WeightedConnection& connection);
+
+        // Видалення з'єднання (O(1) для вихідного рядка, O(вхідний ступінь цілі) для вхідного)
+        // Erase connection (O(1) for the outgoing row, O(target in-degree) for the incoming one)
+        // Удаление соединения (O(1) для исходящей строки, O(входящая степень цели) для входящей)
+        bool erase(int sourceNeuronId, int targetNeuronId);
+
+        // Очищення сховища
+        // Clear store
+        // Очистка хранилища
+        void clear();
+
+        // Резервування місця під count з'єднань
+        // Reserve room for count connections
+        // Резервирование места под count соединений
+        void reserve(size_t count);
+
+        size_t size() const { return outRows.size(); }
+
+        // Обхід усіх з'єднань (порядок не визначено)
+        // Visit all connections (order is unspecified)
+        // Обход всех соединений (порядок не определен)
+        template<typename Visitor>
+        void forEach(Visitor&& visitor) const {
+            outRows.forEach(visitor);
+        }
+
+        // Позиції з'єднань у таблиці: кожне з'єднання займає одну з slotCount() позицій,
+        // і позиція не змінюється, доки сховище не змінено
+        // Connection positions in the table: every connection takes one of slotCount() positions,
+        // and the position does not change until the store is modified
+        // Позиции соединений в таблице: каждое соединение занимает одну из slotCount() позиций,
+        // и позиция не меняется, пока хранилище не изменено
+        size_t slotCount() const { return outRows.slotCount(); }
+        size_t slotOf(const WeightedConnection& connection) const {
+            return static_cast<size_t>(&connection - outRows.data());
+        }
+
+        // Вихідні з'єднання нейрона як неперервний зріз (дійсний до наступної зміни сховища)
+        // Outgoing connections of a neuron as a contiguous slice (valid until the next store mutation)
+        // Исходящие соединения нейрона как непрерывный срез (действителен до следующего изменения хранилища)
+        ConnectionSlice outgoing(int neuronId) const;
+
+        // Обхід вхідних з'єднань нейрона
+        // Visit incoming connections of a neuron
+        // Обход входящих соединений нейрона
+        template<typename Visitor>
+        void forEachIncoming(int neuronId, Visitor&& visitor) const {
+            const RowTable<uint64_t>::Row* row = inRows.find(neuronKey(neuronId));
+            if (!row) {
+                return;
+            }
+            for (uint32_t i = row->offset; i < row->offset + row->size; ++i) {
+                visitor(outRows[*edgeIndex.find(inRows[i])]);
+            }
+        }
+
+        // Ступені нейрона
+        // Neuron degrees
+        // Степени нейрона
+        size_t outgoingCount(int neuronId) const;
+        size_t incomingCount(int neuronId) const;
+
+    private:
+        static uint64_t neuronKey(int neuronId) {
+            return static_cast<uint64_t>(static_cast<uint32_t>(neuronId));
+        }
+
+        // Вихідні рядки: з'єднання, згруповані за джерелом
+        // Outgoing rows: connections grouped by source
+        // Исходящие строки: соединения, сгруппированные по источнику
+        RowTable<WeightedConnection> outRows;
+
+        // Вхідні рядки: ключі з'єднань, згруповані за ціллю (не залежать від переносів у outRows)
+        // Incoming rows: connection keys grouped by target (independent of moves in outRows)
+        // Входящие строки: ключи соединений, сгруппированные по цели (не зависят от переносов в outRows)
+        RowTable<uint64_t> inRows;
+
+        // (source, target) -> позиція у outRows
+        // (source, target) -> position in outRows
+        // (source, target) -> позиция в outRows
+        FlatKeyIndex edgeIndex;
+    };
+
+} // namespace Utils
+} // namespace Synapse
+} // namespace NeuroSync
+
+#endif // CONNECTION_STORE_H
@@ -1,7 +1,7 @@
 #include "WeightedConnectionManager.h"
 #include <chrono>
 #include <algorithm>
-#include <sstream>
+#include <cmath>
 
 // WeightedConnectionManager.cpp
 // Реалізація менеджера зважених з'єднань для SynapseBus
@@ -12,20 +12,12 @@ namespace NeuroSync {
 namespace Synapse {
 namespace Utils {
 
-    WeightedConnectionManager::WeightedConnectionManager() : initialized(false) {
+    WeightedConnectionManager::WeightedConnectionManager()
+        : connectionCount(0), activeConnectionCount(0), weightSum(0.0), usageSum(0),
+          initialized(false), concurrencyMode(ConnectionConcurrencyMode::LOCKED), readSnapshot(nullptr) {
         // Конструктор менеджера зважених з'єднань
         // Constructor of weighted connection manager
         // Конструктор менеджера взвешенных соединений
-        
-        // Ініціалізація статистики
-        // Initialize statistics
-        // Инициализация статистики
-        stats.totalConnections = 0;
-        stats.activeConnections = 0;
-        stats.inactiveConnections = 0;
-        stats.averageWeight = 0.0;
-        stats.totalUsage = 0;
-        stats.averageUsagePerConnection = 0.0;
     }
 
     WeightedConnectionManager::~WeightedConnectionManager() {
@@ -33,9 +25,18 @@ namespace Utils {
         // Destructor of weighted connection manager
         // Деструктор менеджера взвешенных соединений
         clearAllConnections();
+        
+        // Читачів уже немає, тому опублікований і всі зняті знімки звільняються одразу
+        // No readers remain, so the published and all retired snapshots are freed immediately
+        // Читателей уже нет, поэтому опубликованный и все снятые снимки освобождаются сразу
+        delete readSnapshot.exchange(nullptr);
+        for (const RetiredSnapshot& retired : retiredSnapshots) {
+            delete retired.snapshot;
+        }
+        retiredSnapshots.clear();
     }
 
-    bool WeightedConnectionManager::initialize() {
+    bool WeightedConnectionManager::initialize(ConnectionConcurrencyMode mode) {
         // Ініціалізація менеджера
         // Initialize manager
         // Инициализация менеджера
@@ -44,14 +45,19 @@ namespace Utils {
             return true; // Вже ініціалізовано / Already initialized / Уже инициализировано
         }
         
-        // Очищення існуючих з'єднань
-        // Clear existing connections
-        // Очистка существующих соединений
+        // Очищення існуючих з'єднань (у режимі READ_OPTIMIZED публікується порожній знімок)
+        // Clear existing connections (READ_OPTIMIZED mode publishes an empty snapshot)
+        // Очистка существующих соединений (в режиме READ_OPTIMIZED публикуется пустой снимок)
+        concurrencyMode = mode;
         clearAllConnections();
         
         initialized = true;
         return true;
     }
+    
+    ConnectionConcurrencyMode WeightedConnectionManager::getConcurrencyMode() const {
+        return concurrencyMode;
+    }
 
     bool WeightedConnectionManager::createConnection(int sourceNeuronId, int targetNeuronId, double weight) {
         // Створення зваженого з'єднання
@@ -62,17 +68,12 @@ namespace Utils {
             return false;
         }
         
-        // Генерація ключа з'єднання
-        // Generate connection key
-        // Генерация ключа соединения
-        std::string key = generateConnectionKey(sourceNeuronId, targetNeuronId);
-        
         std::lock_guard<std::mutex> lock(connectionsMutex);
         
         // Перевірка, чи з'єднання вже існує
         // Check if connection already exists
         // Проверка, существует ли соединение
-        if (connections.find(key) != connections.end()) {
+        if (connections.find(sourceNeuronId, targetNeuronId)) {
             return false; // З'єднання вже існує / Connection already exists / Соединение уже существует
         }
         
@@ -88,17 +89,17 @@ namespace Utils {
         connection.usageCount = 0;
         connection.active = true;
         
-        // Додавання з'єднання до карт
-        // Add connection to maps
-        // Добавление соединения в карты
-        connections[key] = connection;
-        incomingConnections[targetNeuronId].push_back(key);
-        outgoingConnections[sourceNeuronId].push_back(key);
+        // Додавання з'єднання до сховища
+        // Add connection to store
+        // Добавление соединения в хранилище
+        connections.insert(connection);
+        publishSourceLocked(sourceNeuronId);
         
         // Оновлення статистики
         // Update statistics
         // Обновление статистики
-        updateConnectionStatistics(connection);
+        updateConnectionStatistics(connection, 1);
+        rankConnection(connection);
         
         return true;
     }
@@ -112,38 +113,24 @@ namespace Utils {
             return false;
         }
         
-        // Генерація ключа з'єднання
-        // Generate connection key
-        // Генерация ключа соединения
-        std::string key = generateConnectionKey(sourceNeuronId, targetNeuronId);
-        
         std::lock_guard<std::mutex> lock(connectionsMutex);
         
-        // Пошук з'єднання
-        // Find connection
-        // Поиск соединения
-        auto it = connections.find(key);
-        if (it == connections.end()) {
+        const WeightedConnection* connection = connections.find(sourceNeuronId, targetNeuronId);
+        if (!connection) {
             return false; // З'єднання не знайдено / Connection not found / Соединение не найдено
         }
         
-        // Отримання з'єднання для оновлення статистики
-        // Get connection for statistics update
-        // Получение соединения для обновления статистики
-        WeightedConnection connection = it->second;
-        
-        // Видалення з'єднання з карт
-        // Remove connection from maps
-        // Удаление соединения из карт
-        connections.erase(it);
-        removeConnectionFromMaps(sourceNeuronId, targetNeuronId);
-        
         // Оновлення статистики
         // Update statistics
         // Обновление статистики
-        // Тут можна оновити статистику, якщо потрібно
-        // Here we can update statistics if needed
-        // Тут можно обновить статистику, если нужно
+        updateConnectionStatistics(*connection, -1);
+        unrankConnection(sourceNeuronId, targetNeuronId);
+        
+        // Видалення з'єднання зі сховища
+        // Remove connection from store
+        // Удаление соединения из хранилища
+        connections.erase(sourceNeuronId, targetNeuronId);
+        publishSourceLocked(sourceNeuronId);
         
         return true;
     }
@@ -157,30 +144,36 @@ namespace Utils {
             return false;
         }
         
-        // Генерація ключа з'єднання
-        // Generate connection key
-        // Генерация ключа соединения
-        std::string key = generateConnectionKey(sourceNeuronId, targetNeuronId);
-        
         std::lock_guard<std::mutex> lock(connectionsMutex);
         
         // Пошук з'єднання
         // Find connection
         // Поиск соединения
-        auto it = connections.find(key);
-        if (it == connections.end()) {
+        WeightedConnection* connection = connections.find(sourceNeuronId, targetNeuronId);
+        if (!connection) {
             return false; // З'єднання не знайдено / Connection not found / Соединение не найдено
         }
         
         // Оновлення ваги
         // Update weight
         // Обновление веса
-        it->second.weight = weight;
+        updateConnectionStatistics(*connection, -1);
+        connection->weight = weight;
         
         // Оновлення часу останнього використання
         // Update last used time
         // Обновление времени последнего использования
-        it->second.lastUsedTime = getCurrentTimeMillis();
+        connection->lastUsedTime = getCurrentTimeMillis();
+        updateConnectionStatistics(*connection, 1);
+        rankConnection(*connection);
+        
+        // Публікація для читачів без блокувань
+        // Publish to lock-free readers
+        // Публикация для читателей без блокировок
+        if (ConnectionCell* cell = publishedCellLocked(sourceNeuronId, targetNeuronId)) {
+            cell->weight.store(connection->weight, std::memory_order_relaxed);
+            cell->lastUsedTime.store(connection->lastUsedTime, std::memory_order_relaxed);
+        }
         
         return true;
     }
@@ -194,22 +187,25 @@ namespace Utils {
             return 0.0;
         }
         
-        // Генерація ключа з'єднання
-        // Generate connection key
-        // Генерация ключа соединения
-        std::string key = generateConnectionKey(sourceNeuronId, targetNeuronId);
+        if (concurrencyMode == ConnectionConcurrencyMode::READ_OPTIMIZED) {
+            Core::Utils::EpochDomain::ReadGuard guard;
+            if (guard.active()) {
+                const ConnectionCell* cell = acquireReadSnapshot()->cellFor(sourceNeuronId, targetNeuronId);
+                return cell ? cell->weight.load(std::memory_order_relaxed) : 0.0;
+            }
+        }
         
         std::lock_guard<std::mutex> lock(connectionsMutex);
         
         // Пошук з'єднання
         // Find connection
         // Поиск соединения
-        auto it = connections.find(key);
-        if (it == connections.end()) {
+        const WeightedConnection* connection = connections.find(sourceNeuronId, targetNeuronId);
+        if (!connection) {
             return 0.0; // З'єднання не знайдено / Connection not found / Соединение не найдено
         }
         
-        return it->second.weight;
+        return connection->weight;
     }
 
     bool WeightedConnectionManager::connectionExists(int sourceNeuronId, int targetNeuronId) const {
@@ -221,13 +217,15 @@ namespace Utils {
             return false;
         }
         
-        // Генерація ключа з'єднання
-        // Generate connection key
-        // Генерация ключа соединения
-        std::string key = generateConnectionKey(sourceNeuronId, targetNeuronId);
+        if (concurrencyMode == ConnectionConcurrencyMode::READ_OPTIMIZED) {
+            Core::Utils::EpochDomain::ReadGuard guard;
+            if (guard.active()) {
+                return acquireReadSnapshot()->cellFor(sourceNeuronId, targetNeuronId) != nullptr;
+            }
+        }
         
         std::lock_guard<std::mutex> lock(connectionsMutex);
-        return connections.find(key) != connections.end();
+        return connections.find(sourceNeuronId, targetNeuronId) != nullptr;
     }
 
     bool WeightedConnectionManager::activateConnection(int sourceNeuronId, int targetNeuronId) {
@@ -239,25 +237,25 @@ namespace Utils {
             return false;
         }
         
-        // Генерація ключа з'єднання
-        // Generate connection key
-        // Генерация ключа соединения
-        std::string key = generateConnectionKey(sourceNeuronId, targetNeuronId);
-        
         std::lock_guard<std::mutex> lock(connectionsMutex);
         
         // Пошук з'єднання
         // Find connection
         // Поиск соединения
-        auto it = connections.find(key);
-        if (it == connections.end()) {
+        WeightedConnection* connection = connections.find(sourceNeuronId, targetNeuronId);
+        if (!connection) {
             return false; // З'єднання не знайдено / Connection not found / Соединение не найдено
         }
         
         // Активація з'єднання
         // Activate connection
         // Активация соединения
-        it->second.active = true;
+        updateConnectionStatistics(*connection, -1);
+        connection->active = true;
+        updateConnectionStatistics(*connection, 1);
+        if (ConnectionCell* cell = publishedCellLocked(sourceNeuronId, targetNeuronId)) {
+            cell->active.store(true, std::memory_order_relaxed);
+        }
         
         return true;
     }
@@ -271,25 +269,25 @@ namespace Utils {
             return false;
         }
         
-        // Генерація ключа з'єднання
-        // Generate connection key
-        // Генерация ключа соединения
-        std::string key = generateConnectionKey(sourceNeuronId, targetNeuronId);
-        
         std::lock_guard<std::mutex> lock(connectionsMutex);
         
         // Пошук з'єднання
         // Find connection
         // Поиск соединения
-        auto it = connections.find(key);
-        if (it == connections.end()) {
+        WeightedConnection* connection = connections.find(sourceNeuronId, targetNeuronId);
+        if (!connection) {
             return false; // З'єднання не знайдено / Connection not found / Соединение не найдено
         }
         
         // Деактивація з'єднання
         // Deactivate connection
         // Деактивация соединения
-        it->second.active = false;
+        updateConnectionStatistics(*connection, -1);
+        connection->active = false;
+        updateConnectionStatistics(*connection, 1);
+        if (ConnectionCell* cell = publishedCellLocked(sourceNeuronId, targetNeuronId)) {
+            cell->active.store(false, std::memory_order_relaxed);
+        }
         
         return true;
     }
@@ -310,31 +308,16 @@ namespace Utils {
         // Отримання вхідних з'єднань
         // Get incoming connections
         // Получение входящих соединений
-        auto incomingIt = incomingConnections.find(neuronId);
-        if (incomingIt != incomingConnections.end()) {
-            for (const std::string& key : incomingIt->second) {
-                auto connIt = connections.find(key);
-                if (connIt != connections.end()) {
-                    result.push_back(connIt->second);
-                }
-            }
-        }
-        
-        // Отримання вихідних з'єднань
-        // Get outgoing connections
-        // Получение исходящих соединений
-        auto outgoingIt = outgoingConnections.find(neuronId);
-        if (outgoingIt != outgoingConnections.end()) {
-            for (const std::string& key : outgoingIt->second) {
-                auto connIt = connections.find(key);
-                if (connIt != connections.end() && 
-                    std::find_if(result.begin(), result.end(), 
-                                [&connIt](const WeightedConnection& conn) {
-                                    return conn.sourceNeuronId == connIt->second.sourceNeuronId && 
-                                           conn.targetNeuronId == connIt->second.targetNeuronId;
-                                }) == result.end()) {
-                    result.push_back(connIt->second);
-                }
+        connections.forEachIncoming(neuronId, [&result](const WeightedConnection& connection) {
+            result.push_back(connection);
+        });
+        
+        // Отримання вихідних з'єднань (петля вже додана як вхідна)
+        // Get outgoing connections (a self-loop was already added as incoming)
+        // Получение исходящих соединений (петля уже добавлена как входящая)
+        for (const WeightedConnection& connection : connections.outgoing(neuronId)) {
+            if (connection.targetNeuronId != neuronId) {
+                result.push_back(connection);
             }
         }
         
@@ -357,15 +340,9 @@ namespace Utils {
         // Отримання вхідних з'єднань
         // Get incoming connections
         // Получение входящих соединений
-        auto incomingIt = incomingConnections.find(neuronId);
-        if (incomingIt != incomingConnections.end()) {
-            for (const std::string& key : incomingIt->second) {
-                auto connIt = connections.find(key);
-                if (connIt != connections.end()) {
-                    result.push_back(connIt->second);
-                }
-            }
-        }
+        connections.forEachIncoming(neuronId, [&result](const WeightedConnection& connection) {
+            result.push_back(connection);
+        });
         
         return result;
     }
@@ -377,28 +354,29 @@ namespace Utils {
         
         std::vector<WeightedConnection> result;
         
-        if (!initialized) {
-            return result;
-        }
-        
-        std::lock_guard<std::mutex> lock(connectionsMutex);
-        
         // Отримання вихідних з'єднань
         // Get outgoing connections
         // Получение исходящих соединений
-        auto outgoingIt = outgoingConnections.find(neuronId);
-        if (outgoingIt != outgoingConnections.end()) {
-            for (const std::string& key : outgoingIt->second) {
-                auto connIt = connections.find(key);
-                if (connIt != connections.end()) {
-                    result.push_back(connIt->second);
-                }
-            }
-        }
+        forEachOutgoingConnection(neuronId, [&result](const WeightedConnection& connection) {
+            result.push_back(connection);
+        });
         
         return result;
     }
 
+    ConnectionSlice WeightedConnectionManager::getOutgoingConnectionSlice(int neuronId) const {
+        // Отримання вихідних з'єднань як зрізу без копіювання
+        // Get outgoing connections as a slice without copying
+        // Получение исходящих соединений как среза без копирования
+        
+        if (!initialized) {
+            return ConnectionSlice();
+        }
+        
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        return connections.outgoing(neuronId);
+    }
+
     size_t WeightedConnectionManager::getConnectionCount() const {
         // Отримання кількості з'єднань
         // Get connection count
@@ -414,11 +392,7 @@ namespace Utils {
         // Получение количества входящих соединений для нейрона
         
         std::lock_guard<std::mutex> lock(connectionsMutex);
-        auto it = incomingConnections.find(neuronId);
-        if (it != incomingConnections.end()) {
-            return it->second.size();
-        }
-        return 0;
+        return connections.incomingCount(neuronId);
     }
 
     size_t WeightedConnectionManager::getOutgoingConnectionCount(int neuronId) const {
@@ -427,11 +401,7 @@ namespace Utils {
         // Получение количества исходящих соединений для нейрона
         
         std::lock_guard<std::mutex> lock(connectionsMutex);
-        auto it = outgoingConnections.find(neuronId);
-        if (it != outgoingConnections.end()) {
-            return it->second.size();
-        }
-        return 0;
+        return connections.outgoingCount(neuronId);
     }
 
     void WeightedConnectionManager::clearAllConnections() {
@@ -441,8 +411,21 @@ namespace Utils {
         
         std::lock_guard<std::mutex> lock(connectionsMutex);
         connections.clear();
-        incomingConnections.clear();
-        outgoingConnections.clear();
+        if (concurrencyMode == ConnectionConcurrencyMode::READ_OPTIMIZED) {
+            publishFullSnapshotLocked();
+        } else {
+            replaceReadSnapshotLocked(nullptr);
+        }
+        
+        weightRanking.clear();
+        usageCountRanking.clear();
+        usageTimeRanking.clear();
+        rankingHandles.clear();
+        freeRankingHandles.clear();
+        connectionCount.store(0);
+        activeConnectionCount.store(0);
+        weightSum.store(0.0);
+        usageSum.store(0);
     }
 
     WeightedConnectionManager::ConnectionStatistics WeightedConnectionManager::getStatistics() const {
@@ -450,7 +433,26 @@ namespace Utils {
         // Get connection statistics
         // Получение статистики соединений
         
-        std::lock_guard<std::mutex> lock(statisticsMutex);
+        ConnectionStatistics stats;
+        stats.totalConnections = connectionCount.load(std::memory_order_relaxed);
+        stats.activeConnections = activeConnectionCount.load(std::memory_order_relaxed);
+        stats.totalUsage = usageSum.load(std::memory_order_relaxed);
+        
+        // Агрегати читаються окремо, тому активних може на мить виявитися більше за загальну кількість
+        // Aggregates are read separately, so active may momentarily exceed the total
+        // Агрегаты читаются по отдельности, поэтому активных может на миг оказаться больше общего количества
+        if (stats.activeConnections > stats.totalConnections) {
+            stats.activeConnections = stats.totalConnections;
+        }
+        stats.inactiveConnections = stats.totalConnections - stats.activeConnections;
+        
+        if (stats.totalConnections > 0) {
+            stats.averageWeight = weightSum.load(std::memory_order_relaxed) / stats.totalConnections;
+            stats.averageUsagePerConnection = static_cast<double>(stats.totalUsage) / stats.totalConnections;
+        } else {
+            stats.averageWeight = 0.0;
+            stats.averageUsagePerConnection = 0.0;
+        }
         return stats;
     }
 
@@ -463,26 +465,67 @@ namespace Utils {
             return;
         }
         
-        // Генерація ключа з'єднання
-        // Generate connection key
-        // Генерация ключа соединения
-        std::string key = generateConnectionKey(sourceNeuronId, targetNeuronId);
-        
         std::lock_guard<std::mutex> lock(connectionsMutex);
         
         // Пошук з'єднання
         // Find connection
         // Поиск соединения
-        auto it = connections.find(key);
-        if (it != connections.end()) {
+        WeightedConnection* connection = connections.find(sourceNeuronId, targetNeuronId);
+        if (connection) {
             // Оновлення статистики використання
             // Update usage statistics
             // Обновление статистики использования
-            it->second.usageCount++;
-            it->second.lastUsedTime = getCurrentTimeMillis();
+            updateConnectionStatistics(*connection, -1);
+            connection->usageCount++;
+            connection->lastUsedTime = getCurrentTimeMillis();
+            updateConnectionStatistics(*connection, 1);
+            rankConnection(*connection);
+            if (ConnectionCell* cell = publishedCellLocked(sourceNeuronId, targetNeuronId)) {
+                cell->usageCount.store(connection->usageCount, std::memory_order_relaxed);
+                cell->lastUsedTime.store(connection->lastUsedTime, std::memory_order_relaxed);
+            }
         }
     }
 
+    std::vector<WeightedConnection> WeightedConnectionManager::getTopConnectionsByWeight(size_t limit) const {
+        // Отримання з'єднань з найбільшою вагою
+        // Get connections with the largest weight
+        // Получение соединений с наибольшим весом
+        
+        if (!initialized) {
+            return std::vector<WeightedConnection>();
+        }
+        
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        return collectConnectionsLocked(weightRanking.top(limit));
+    }
+
+    std::vector<WeightedConnection> WeightedConnectionManager::getTopConnectionsByUsageCount(size_t limit) const {
+        // Отримання найчастіше використовуваних з'єднань
+        // Get the most frequently used connections
+        // Получение наиболее часто используемых соединений
+        
+        if (!initialized) {
+            return std::vector<WeightedConnection>();
+        }
+        
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        return collectConnectionsLocked(usageCountRanking.top(limit));
+    }
+
+    std::vector<WeightedConnection> WeightedConnectionManager::getTopConnectionsByUsageTime(size_t limit) const {
+        // Отримання нещодавно використаних з'єднань
+        // Get the most recently used connections
+        // Получение недавно использованных соединений
+        
+        if (!initialized) {
+            return std::vector<WeightedConnection>();
+        }
+        
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        return collectConnectionsLocked(usageTimeRanking.top(limit));
+    }
+
     std::vector<WeightedConnection> WeightedConnectionManager::getConnectionsSortedByWeight(bool descending) const {
         // Отримання з'єднань, відсортованих за вагою
         // Get connections sorted by weight
@@ -499,9 +542,10 @@ namespace Utils {
         // Копіювання всіх з'єднань
         // Copy all connections
         // Копирование всех соединений
-        for (const auto& pair : connections) {
-            result.push_back(pair.second);
-        }
+        result.reserve(connections.size());
+        connections.forEach([&result](const WeightedConnection& connection) {
+            result.push_back(connection);
+        });
         
         // Сортування за вагою
         // Sort by weight
@@ -537,9 +581,10 @@ namespace Utils {
         // Копіювання всіх з'єднань
         // Copy all connections
         // Копирование всех соединений
-        for (const auto& pair : connections) {
-            result.push_back(pair.second);
-        }
+        result.reserve(connections.size());
+        connections.forEach([&result](const WeightedConnection& connection) {
+            result.push_back(connection);
+        });
         
         // Сортування за часом використання
         // Sort by usage time
@@ -575,9 +620,10 @@ namespace Utils {
         // Копіювання всіх з'єднань
         // Copy all connections
         // Копирование всех соединений
-        for (const auto& pair : connections) {
-            result.push_back(pair.second);
-        }
+        result.reserve(connections.size());
+        connections.forEach([&result](const WeightedConnection& connection) {
+            result.push_back(connection);
+        });
         
         // Сортування за кількістю використань
         // Sort by usage count
@@ -597,16 +643,6 @@ namespace Utils {
         return result;
     }
 
-    std::string WeightedConnectionManager::generateConnectionKey(int sourceNeuronId, int targetNeuronId) const {
-        // Генерація ключа з'єднання
-        // Generate connection key
-        // Генерация ключа соединения
-        
-        std::ostringstream keyStream;
-        keyStream << sourceNeuronId << "_" << targetNeuronId;
-        return keyStream.str();
-    }
-
     long long WeightedConnectionManager::getCurrentTimeMillis() const {
         // Отримання поточного часу в мілісекундах
         // Get current time in milliseconds
@@ -618,49 +654,200 @@ namespace Utils {
         return millis;
     }
 
-    void WeightedConnectionManager::updateConnectionStatistics(const WeightedConnection& connection) {
-        // Оновлення статистики з'єднання
-        // Update connection statistics
-        // Обновление статистики соединения
+    void WeightedConnectionManager::publishSourceLocked(int sourceNeuronId) {
+        // Новий знімок після зміни рядка джерела: база спільна з поточним знімком, а рядок джерела
+        // замінюється копією з упорядкованими цілями; комірки незмінених з'єднань переходять до нього
+        // New snapshot after a change of the source row: the base is shared with the current snapshot and the
+        // source row is replaced by a copy with ordered targets; cells of unchanged connections carry over
+        // Новый снимок после изменения строки источника: база общая с текущим снимком, а строка источника
+        // заменяется копией с упорядоченными целями; ячейки неизмененных соединений переходят в нее
+        
+        if (concurrencyMode != ConnectionConcurrencyMode::READ_OPTIMIZED) {
+            return;
+        }
         
-        std::lock_guard<std::mutex> lock(statisticsMutex);
-        stats.totalConnections++;
-        if (connection.active) {
-            stats.activeConnections++;
+        // Заміни накопичуються до ~sqrt(E) рядків: копіювання їхнього індексу і повна перебудова бази
+        // разом коштують O(sqrt(E)) на одну структурну зміну
+        // Replacements accumulate up to ~sqrt(E) rows: copying their index and the full base rebuild
+        // together cost O(sqrt(E)) per structural change
+        // Замены накапливаются до ~sqrt(E) строк: копирование их индекса и полная перестройка базы
+        // вместе стоят O(sqrt(E)) на одно структурное изменение
+        const ReadSnapshot* current = readSnapshot.load(std::memory_order_relaxed);
+        size_t overlayLimit = static_cast<size_t>(std::sqrt(static_cast<double>(connections.size())));
+        if (overlayLimit < MIN_OVERLAY_ROWS) {
+            overlayLimit = MIN_OVERLAY_ROWS;
+        }
+        if (!current || current->overlayRows.size() >= overlayLimit) {
+            publishFullSnapshotLocked();
+            return;
+        }
+        
+        std::shared_ptr<OverlayRow> row = std::make_shared<OverlayRow>();
+        ConnectionSlice outgoing = connections.outgoing(sourceNeuronId);
+        row->connections.assign(outgoing.begin(), outgoing.end());
+        std::sort(row->connections.begin(), row->connections.end(),
+                  [](const WeightedConnection& left, const WeightedConnection& right) {
+                      return left.targetNeuronId < right.targetNeuronId;
+                  });
+        
+        const OverlayRow* currentRow = current->overlayFor(sourceNeuronId);
+        row->cells.reserve(row->connections.size());
+        for (const WeightedConnection& connection : row->connections) {
+            std::shared_ptr<ConnectionCell> cell;
+            if (currentRow) {
+                size_t index = ReadSnapshot::findTarget(*currentRow, connection.targetNeuronId);
+                if (index < currentRow->connections.size()) {
+                    cell = currentRow->cells[index];
+                }
+            } else if (const WeightedConnection* stored = current->base->store.find(sourceNeuronId, connection.targetNeuronId)) {
+                cell = std::shared_ptr<ConnectionCell>(current->base, &current->base->cells[current->base->store.slotOf(*stored)]);
+            }
+            if (!cell) {
+                cell = std::make_shared<ConnectionCell>();
+                storeCell(*cell, connection);
+            }
+            row->cells.push_back(std::move(cell));
+        }
+        
+        std::unique_ptr<ReadSnapshot> snapshot(new ReadSnapshot(*current));
+        if (uint32_t* index = snapshot->overlayIndex.find(static_cast<uint32_t>(sourceNeuronId))) {
+            snapshot->overlayRows[*index] = std::move(row);
         } else {
-            stats.inactiveConnections++;
+            snapshot->overlayIndex.insert(static_cast<uint32_t>(sourceNeuronId), static_cast<uint32_t>(snapshot->overlayRows.size()));
+            snapshot->overlayRows.push_back(std::move(row));
         }
+        replaceReadSnapshotLocked(snapshot.release());
+    }
+    
+    void WeightedConnectionManager::publishFullSnapshotLocked() {
+        // Нова база: копія сховища з готовою суміжністю та комірки змінних полів
+        // New base: a copy of the store with prebuilt adjacency and the mutable field cells
+        // Новая база: копия хранилища с готовой смежностью и ячейки изменяемых полей
+        
+        std::shared_ptr<SnapshotBase> base = std::make_shared<SnapshotBase>();
+        base->store = connections;
+        base->cells.reset(new ConnectionCell[base->store.slotCount()]);
+        SnapshotBase* target = base.get();
+        target->store.forEach([target](const WeightedConnection& connection) {
+            storeCell(target->cells[target->store.slotOf(connection)], connection);
+        });
+        
+        std::unique_ptr<ReadSnapshot> snapshot(new ReadSnapshot());
+        snapshot->base = std::move(base);
+        replaceReadSnapshotLocked(snapshot.release());
+    }
+    
+    void WeightedConnectionManager::replaceReadSnapshotLocked(ReadSnapshot* snapshot) {
+        // Публікація нового знімка; старий звільняється після виходу читачів поточної епохи
+        // Publish the new snapshot; the old one is freed once readers of the current epoch have left
+        // Публикация нового снимка; старый освобождается после выхода читателей текущей эпохи
         
-        // Оновлення середньої ваги
-        // Update average weight
-        // Обновление среднего веса
-        stats.averageWeight = (stats.averageWeight * (stats.totalConnections - 1) + connection.weight) / stats.totalConnections;
+        ReadSnapshot* previous = readSnapshot.exchange(snapshot);
+        if (previous) {
+            retiredSnapshots.push_back(RetiredSnapshot{Core::Utils::EpochDomain::instance().advance(), previous});
+        }
+        reclaimReadSnapshotsLocked();
+    }
+    
+    void WeightedConnectionManager::reclaimReadSnapshotsLocked() {
+        // Звільнення знімків, які вже не може бачити жоден читач
+        // Free snapshots that no reader can see any more
+        // Освобождение снимков, которые уже не может видеть ни один читатель
+        
+        Core::Utils::EpochDomain& domain = Core::Utils::EpochDomain::instance();
+        auto reclaimable = std::partition(retiredSnapshots.begin(), retiredSnapshots.end(),
+                                          [&domain](const RetiredSnapshot& retired) {
+                                              return !domain.isQuiescent(retired.epoch);
+                                          });
+        for (auto it = reclaimable; it != retiredSnapshots.end(); ++it) {
+            delete it->snapshot;
+        }
+        retiredSnapshots.erase(reclaimable, retiredSnapshots.end());
+    }
+    
+    WeightedConnectionManager::ConnectionCell* WeightedConnectionManager::publishedCellLocked(int sourceNeuronId, int targetNeuronId) const {
+        ReadSnapshot* snapshot = readSnapshot.load(std::memory_order_relaxed);
+        return snapshot ? snapshot->cellFor(sourceNeuronId, targetNeuronId) : nullptr;
     }
 
-    void WeightedConnectionManager::removeConnectionFromMaps(int sourceNeuronId, int targetNeuronId) {
-        // Видалення з'єднання з карт
-        // Remove connection from maps
-        // Удаление соединения из карт
+    void WeightedConnectionManager::updateConnectionStatistics(const WeightedConnection& connection, int sign) {
+        // Оновлення агрегатів статистики (викликається під connectionsMutex, тому
+        // читання-зміна-запис атомарних лічильників не конкурує з іншими письменниками)
+        // Update statistics aggregates (called under connectionsMutex, so read-modify-write
+        // of the atomic counters does not race with other writers)
+        // Обновление агрегатов статистики (вызывается под connectionsMutex, поэтому
+        // чтение-изменение-запись атомарных счетчиков не конкурирует с другими писателями)
+        
+        if (sign > 0) {
+            connectionCount.fetch_add(1, std::memory_order_relaxed);
+            activeConnectionCount.fetch_add(connection.active ? 1 : 0, std::memory_order_relaxed);
+            usageSum.fetch_add(static_cast<size_t>(connection.usageCount), std::memory_order_relaxed);
+            weightSum.store(weightSum.load(std::memory_order_relaxed) + connection.weight, std::memory_order_relaxed);
+        } else {
+            connectionCount.fetch_sub(1, std::memory_order_relaxed);
+            activeConnectionCount.fetch_sub(connection.active ? 1 : 0, std::memory_order_relaxed);
+            usageSum.fetch_sub(static_cast<size_t>(connection.usageCount), std::memory_order_relaxed);
+            weightSum.store(weightSum.load(std::memory_order_relaxed) - connection.weight, std::memory_order_relaxed);
+        }
         
-        // Видалення з вхідних з'єднань
-        // Remove from incoming connections
-        // Удаление из входящих соединений
-        auto incomingIt = incomingConnections.find(targetNeuronId);
-        if (incomingIt != incomingConnections.end()) {
-            auto& keys = incomingIt->second;
-            std::string key = generateConnectionKey(sourceNeuronId, targetNeuronId);
-            keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+        // Без з'єднань сума ваг точно нульова (не накопичує похибку округлення)
+        // With no connections the weight sum is exactly zero (no accumulated rounding error)
+        // Без соединений сумма весов точно нулевая (не накапливает погрешность округления)
+        if (connectionCount.load(std::memory_order_relaxed) == 0) {
+            weightSum.store(0.0, std::memory_order_relaxed);
+        }
+    }
+
+    void WeightedConnectionManager::rankConnection(const WeightedConnection& connection) {
+        // Дескриптор видається при першому ранжуванні з'єднання
+        // A handle is issued the first time a connection is ranked
+        // Дескриптор выдается при первом ранжировании соединения
+        
+        uint64_t key = ConnectionStore::makeKey(connection.sourceNeuronId, connection.targetNeuronId);
+        const uint32_t* found = rankingHandles.find(key);
+        uint32_t handle;
+        if (found) {
+            handle = *found;
+        } else if (!freeRankingHandles.empty()) {
+            handle = freeRankingHandles.back();
+            freeRankingHandles.pop_back();
+            rankingHandles.insert(key, handle);
+        } else {
+            handle = static_cast<uint32_t>(rankingHandles.size());
+            rankingHandles.insert(key, handle);
+        }
+        
+        weightRanking.set(handle, key, connection.weight);
+        usageCountRanking.set(handle, key, connection.usageCount);
+        usageTimeRanking.set(handle, key, connection.lastUsedTime);
+    }
+
+    void WeightedConnectionManager::unrankConnection(int sourceNeuronId, int targetNeuronId) {
+        uint64_t key = ConnectionStore::makeKey(sourceNeuronId, targetNeuronId);
+        const uint32_t* found = rankingHandles.find(key);
+        if (!found) {
+            return;
         }
         
-        // Видалення з вихідних з'єднань
-        // Remove from outgoing connections
-        // Удаление из исходящих соединений
-        auto outgoingIt = outgoingConnections.find(sourceNeuronId);
-        if (outgoingIt != outgoingConnections.end()) {
-            auto& keys = outgoingIt->second;
-            std::string key = generateConnectionKey(sourceNeuronId, targetNeuronId);
-            keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+        uint32_t handle = *found;
+        weightRanking.erase(handle);
+        usageCountRanking.erase(handle);
+        usageTimeRanking.erase(handle);
+        rankingHandles.erase(key);
+        freeRankingHandles.push_back(handle);
+    }
+
+    std::vector<WeightedConnection> WeightedConnectionManager::collectConnectionsLocked(const std::vector<uint64_t>& keys) const {
+        std::vector<WeightedConnection> result;
+        result.reserve(keys.size());
+        for (uint64_t key : keys) {
+            const WeightedConnection* connection = connections.find(static_cast<int>(static_cast<uint32_t>(key >> 32)),
+                                                                    static_cast<int>(static_cast<uint32_t>(key)));
+            if (connection) {
+                result.push_back(*connection);
+            }
         }
+        return result;
     }
 
 } // namespace Utils
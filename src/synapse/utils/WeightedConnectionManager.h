@@ -1,11 +1,14 @@
 #ifndef WEIGHTED_CONNECTION_MANAGER_H
 #define WEIGHTED_CONNECTION_MANAGER_H
 
-#include <map>
+#include "ConnectionStore.h"
+#include "ConnectionRanking.h"
+#include "../../core/utils/EpochReclamation.h"
 #include <vector>
-#include <string>
+#include <memory>
 #include <mutex>
 #include <atomic>
+#include <algorithm>
 
 // WeightedConnectionManager.h
 // Менеджер зважених з'єднань для SynapseBus
@@ -16,17 +19,12 @@ namespace NeuroSync {
 namespace Synapse {
 namespace Utils {
 
-    // Структура зваженого з'єднання
-    // Weighted connection structure
-    // Структура взвешенного соединения
-    struct WeightedConnection {
-        int sourceNeuronId;     // ID вихідного нейрона / Source neuron ID / ID исходного нейрона
-        int targetNeuronId;     // ID цільового нейрона / Target neuron ID / ID целевого нейрона
-        double weight;          // Вага з'єднання / Connection weight / Вес соединения
-        long long creationTime;  // Час створення / Creation time / Время создания
-        long long lastUsedTime;  // Час останнього використання / Last used time / Время последнего использования
-        int usageCount;         // Кількість використань / Usage count / Количество использований
-        bool active;            // Активність з'єднання / Connection activity / Активность соединения
+    // Режим конкурентного доступу до з'єднань
+    // Connection concurrency mode
+    // Режим конкурентного доступа к соединениям
+    enum class ConnectionConcurrencyMode {
+        LOCKED,          // Читачі та письменники під одним м'ютексом / Readers and writers under one mutex / Читатели и писатели под одним мьютексом
+        READ_OPTIMIZED   // Читачі без блокувань над RCU-знімком / Lock-free readers over an RCU snapshot / Читатели без блокировок над RCU-снимком
     };
 
     // Менеджер зважених з'єднань
@@ -37,10 +35,27 @@ namespace Utils {
         WeightedConnectionManager();
         ~WeightedConnectionManager();
         
-        // Ініціалізація менеджера
-        // Initialize manager
-        // Инициализация менеджера
-        bool initialize();
+        // Ініціалізація менеджера.
+        // У режимі READ_OPTIMIZED читання йдуть з незмінного знімка структури, захищеного епохами,
+        // а вага, активність і використання лежать в атомарних комірках знімка, тому читачі не
+        // блокуються. Письменник сам публікує новий знімок у своїй критичній секції: спільна база
+        // плюс замінені рядки змінених джерел; база перебудовується, коли таких рядків стає забагато.
+        // Initialize manager.
+        // In READ_OPTIMIZED mode reads go to an immutable epoch-protected snapshot of the structure,
+        // while weight, activity and usage live in atomic cells of the snapshot, so readers never
+        // block. The writer publishes the new snapshot itself inside its critical section: a shared base
+        // plus replaced rows of changed sources; the base is rebuilt once there are too many such rows.
+        // Инициализация менеджера.
+        // В режиме READ_OPTIMIZED чтения идут из неизменяемого снимка структуры, защищенного эпохами,
+        // а вес, активность и использование лежат в атомарных ячейках снимка, поэтому читатели не
+        // блокируются. Писатель сам публикует новый снимок в своей критической секции: общая база
+        // плюс замененные строки измененных источников; база перестраивается, когда таких строк становится слишком много.
+        bool initialize(ConnectionConcurrencyMode mode = ConnectionConcurrencyMode::LOCKED);
+        
+        // Отримання режиму конкурентного доступу
+        // Get concurrency mode
+        // Получение режима конкурентного доступа
+        ConnectionConcurrencyMode getConcurrencyMode() const;
         
         // Створення зваженого з'єднання
         // Create weighted connection
@@ -92,6 +107,35 @@ namespace Utils {
         // Получение всех исходящих соединений для нейрона
         std::vector<WeightedConnection> getOutgoingConnections(int neuronId) const;
         
+        // Отримання вихідних з'єднань як неперервного зрізу без копіювання.
+        // Зріз дійсний, доки з'єднання не змінюються (для конкурентних читань - forEachOutgoingConnection).
+        // Get outgoing connections as a contiguous slice without copying.
+        // The slice stays valid while connections are not modified (for concurrent reads use forEachOutgoingConnection).
+        // Получение исходящих соединений как непрерывного среза без копирования.
+        // Срез действителен, пока соединения не изменяются (для конкурентных чтений - forEachOutgoingConnection).
+        ConnectionSlice getOutgoingConnectionSlice(int neuronId) const;
+        
+        // Обхід вихідних з'єднань нейрона без копіювання (у READ_OPTIMIZED - без блокувань)
+        // Visit outgoing connections of a neuron without copying (lock-free in READ_OPTIMIZED)
+        // Обход исходящих соединений нейрона без копирования (в READ_OPTIMIZED - без блокировок)
+        template<typename Visitor>
+        void forEachOutgoingConnection(int neuronId, Visitor&& visitor) const {
+            if (!initialized) {
+                return;
+            }
+            if (concurrencyMode == ConnectionConcurrencyMode::READ_OPTIMIZED) {
+                Core::Utils::EpochDomain::ReadGuard guard;
+                if (guard.active()) {
+                    acquireReadSnapshot()->forEachOutgoing(neuronId, visitor);
+                    return;
+                }
+            }
+            std::lock_guard<std::mutex> lock(connectionsMutex);
+            for (const WeightedConnection& connection : connections.outgoing(neuronId)) {
+                visitor(connection);
+            }
+        }
+        
         // Отримання кількості з'єднань
         // Get connection count
         // Получение количества соединений
@@ -112,9 +156,9 @@ namespace Utils {
         // Очистка всех соединений
         void clearAllConnections();
         
-        // Отримання статистики з'єднань
-        // Get connection statistics
-        // Получение статистики соединений
+        // Отримання статистики з'єднань (O(1) без блокувань: агрегати ведуться при кожній зміні)
+        // Get connection statistics (O(1) and lock-free: aggregates are kept on every mutation)
+        // Получение статистики соединений (O(1) без блокировок: агрегаты ведутся при каждом изменении)
         struct ConnectionStatistics {
             size_t totalConnections;        // Загальна кількість з'єднань / Total connections / Общее количество соединений
             size_t activeConnections;       // Кількість активних з'єднань / Active connections / Количество активных соединений
@@ -131,9 +175,24 @@ namespace Utils {
         // Обновление статистики использования
         void updateUsageStatistics(int sourceNeuronId, int targetNeuronId);
         
-        // Отримання з'єднань, відсортованих за вагою
-        // Get connections sorted by weight
-        // Получение соединений, отсортированных по весу
+        // Отримання limit з'єднань з найбільшою вагою, за спаданням (O(K log K))
+        // Get limit connections with the largest weight, descending (O(K log K))
+        // Получение limit соединений с наибольшим весом, по убыванию (O(K log K))
+        std::vector<WeightedConnection> getTopConnectionsByWeight(size_t limit) const;
+        
+        // Отримання limit з'єднань з найбільшою кількістю використань, за спаданням
+        // Get limit connections with the largest usage count, descending
+        // Получение limit соединений с наибольшим количеством использований, по убыванию
+        std::vector<WeightedConnection> getTopConnectionsByUsageCount(size_t limit) const;
+        
+        // Отримання limit нещодавно використаних з'єднань, за спаданням часу
+        // Get limit most recently used connections, by descending time
+        // Получение limit недавно использованных соединений, по убыванию времени
+        std::vector<WeightedConnection> getTopConnectionsByUsageTime(size_t limit) const;
+        
+        // Отримання з'єднань, відсортованих за вагою (повне сортування; для моніторингу - getTop*)
+        // Get connections sorted by weight (full sort; use getTop* for monitoring)
+        // Получение соединений, отсортированных по весу (полная сортировка; для мониторинга - getTop*)
         std::vector<WeightedConnection> getConnectionsSortedByWeight(bool descending = true) const;
         
         // Отримання з'єднань, відсортованих за часом використання
@@ -147,44 +206,204 @@ namespace Utils {
         std::vector<WeightedConnection> getConnectionsSortedByUsageCount(bool descending = true) const;
         
     private:
-        // Карта зважених з'єднань (ключ: sourceId_targetId, значення: з'єднання)
-        // Map of weighted connections (key: sourceId_targetId, value: connection)
-        // Карта взвешенных соединений (ключ: sourceId_targetId, значение: соединение)
-        std::map<std::string, WeightedConnection> connections;
+        // Змінні поля з'єднання у знімку READ_OPTIMIZED
+        // Mutable connection fields in a READ_OPTIMIZED snapshot
+        // Изменяемые поля соединения в снимке READ_OPTIMIZED
+        struct ConnectionCell {
+            std::atomic<double> weight{0.0};
+            std::atomic<long long> lastUsedTime{0};
+            std::atomic<int> usageCount{0};
+            std::atomic<bool> active{false};
+        };
+        
+        // Перенесення змінних полів між з'єднанням і коміркою
+        // Transfer of the mutable fields between a connection and a cell
+        // Перенос изменяемых полей между соединением и ячейкой
+        static void storeCell(ConnectionCell& cell, const WeightedConnection& connection) {
+            cell.weight.store(connection.weight, std::memory_order_relaxed);
+            cell.lastUsedTime.store(connection.lastUsedTime, std::memory_order_relaxed);
+            cell.usageCount.store(connection.usageCount, std::memory_order_relaxed);
+            cell.active.store(connection.active, std::memory_order_relaxed);
+        }
+        
+        static WeightedConnection loadCell(const WeightedConnection& connection, const ConnectionCell& cell) {
+            WeightedConnection result = connection;
+            result.weight = cell.weight.load(std::memory_order_relaxed);
+            result.lastUsedTime = cell.lastUsedTime.load(std::memory_order_relaxed);
+            result.usageCount = cell.usageCount.load(std::memory_order_relaxed);
+            result.active = cell.active.load(std::memory_order_relaxed);
+            return result;
+        }
+        
+        // База знімка: копія сховища та комірки за позиціями його з'єднань (спільна для кількох знімків)
+        // Snapshot base: a copy of the store and cells by its connection positions (shared by several snapshots)
+        // База снимка: копия хранилища и ячейки по позициям его соединений (общая для нескольких снимков)
+        struct SnapshotBase {
+            ConnectionStore store;
+            std::unique_ptr<ConnectionCell[]> cells;
+        };
+        
+        // Рядок джерела, змінений після побудови бази: з'єднання, впорядковані за ціллю, та їхні комірки
+        // (комірки з бази або нові; спільні з попередніми знімками, тож оновлення полів видно всім)
+        // A source row changed after the base was built: connections ordered by target and their cells
+        // (cells from the base or new ones; shared with earlier snapshots, so field updates are seen by all)
+        // Строка источника, измененная после построения базы: соединения, упорядоченные по цели, и их ячейки
+        // (ячейки из базы или новые; общие с предыдущими снимками, поэтому обновления полей видны всем)
+        struct OverlayRow {
+            std::vector<WeightedConnection> connections;
+            std::vector<std::shared_ptr<ConnectionCell>> cells;
+        };
         
-        // Карта вхідних з'єднань для кожного нейрона
-        // Map of incoming connections for each neuron
-        // Карта входящих соединений для каждого нейрона
-        std::map<int, std::vector<std::string>> incomingConnections;
+        // Незмінний знімок: база та рядки змінених джерел, що її перекривають
+        // Immutable snapshot: the base and the rows of changed sources that override it
+        // Неизменяемый снимок: база и строки измененных источников, перекрывающие ее
+        struct ReadSnapshot {
+            std::shared_ptr<const SnapshotBase> base;
+            FlatKeyIndex overlayIndex;
+            std::vector<std::shared_ptr<const OverlayRow>> overlayRows;
+            
+            const OverlayRow* overlayFor(int neuronId) const {
+                const uint32_t* row = overlayIndex.find(static_cast<uint32_t>(neuronId));
+                return row ? overlayRows[*row].get() : nullptr;
+            }
+            
+            // Позиція цілі в рядку (size(), якщо її немає)
+            // Position of the target in a row (size() if it is absent)
+            // Позиция цели в строке (size(), если ее нет)
+            static size_t findTarget(const OverlayRow& row, int targetNeuronId) {
+                auto it = std::lower_bound(row.connections.begin(), row.connections.end(), targetNeuronId,
+                                           [](const WeightedConnection& connection, int target) {
+                                               return connection.targetNeuronId < target;
+                                           });
+                size_t index = static_cast<size_t>(it - row.connections.begin());
+                return it != row.connections.end() && it->targetNeuronId == targetNeuronId ? index : row.connections.size();
+            }
+            
+            ConnectionCell* cellFor(int sourceNeuronId, int targetNeuronId) const {
+                if (const OverlayRow* row = overlayFor(sourceNeuronId)) {
+                    size_t index = findTarget(*row, targetNeuronId);
+                    return index < row->connections.size() ? row->cells[index].get() : nullptr;
+                }
+                const WeightedConnection* connection = base->store.find(sourceNeuronId, targetNeuronId);
+                return connection ? &base->cells[base->store.slotOf(*connection)] : nullptr;
+            }
+            
+            template<typename Visitor>
+            void forEachOutgoing(int neuronId, Visitor& visitor) const {
+                if (const OverlayRow* row = overlayFor(neuronId)) {
+                    for (size_t i = 0; i < row->connections.size(); ++i) {
+                        visitor(loadCell(row->connections[i], *row->cells[i]));
+                    }
+                    return;
+                }
+                for (const WeightedConnection& connection : base->store.outgoing(neuronId)) {
+                    visitor(loadCell(connection, base->cells[base->store.slotOf(connection)]));
+                }
+            }
+        };
+        
+        // Знятий з публікації знімок, що чекає на звільнення
+        // Unpublished snapshot waiting to be freed
+        // Снятый с публикации снимок, ожидающий освобождения
+        struct RetiredSnapshot {
+            uint64_t epoch;
+            ReadSnapshot* snapshot;
+        };
+        
+        // Поточний знімок для читача (викликається всередині ReadGuard; лише атомарне читання)
+        // Current snapshot for a reader (called inside a ReadGuard; just an atomic load)
+        // Текущий снимок для читателя (вызывается внутри ReadGuard; только атомарное чтение)
+        const ReadSnapshot* acquireReadSnapshot() const {
+            return readSnapshot.load();
+        }
         
-        // Карта вихідних з'єднань для кожного нейрона
-        // Map of outgoing connections for each neuron
-        // Карта исходящих соединений для каждого нейрона
-        std::map<int, std::vector<std::string>> outgoingConnections;
+        // Публікація знімка після структурної зміни джерела, повна перебудова бази, заміна
+        // опублікованого знімка та звільнення знятих (під connectionsMutex, лише в READ_OPTIMIZED)
+        // Publish a snapshot after a structural change of a source, full base rebuild, replacement
+        // of the published snapshot and freeing of retired ones (under connectionsMutex, READ_OPTIMIZED only)
+        // Публикация снимка после структурного изменения источника, полная перестройка базы, замена
+        // опубликованного снимка и освобождение снятых (под connectionsMutex, только в READ_OPTIMIZED)
+        static const size_t MIN_OVERLAY_ROWS = 64;
+        void publishSourceLocked(int sourceNeuronId);
+        void publishFullSnapshotLocked();
+        void replaceReadSnapshotLocked(ReadSnapshot* snapshot);
+        void reclaimReadSnapshotsLocked();
+        
+        // Комірка з'єднання в опублікованому знімку (nullptr, якщо знімка немає)
+        // Connection cell in the published snapshot (nullptr if there is no snapshot)
+        // Ячейка соединения в опубликованном снимке (nullptr, если снимка нет)
+        ConnectionCell* publishedCellLocked(int sourceNeuronId, int targetNeuronId) const;
+        
+        // Сховище з'єднань (ключ: (sourceId, targetId) як 64-бітне число)
+        // Connection store (key: (sourceId, targetId) as a 64-bit integer)
+        // Хранилище соединений (ключ: (sourceId, targetId) как 64-битное число)
+        ConnectionStore connections;
         
         // Мьютекс для синхронізації
         // Mutex for synchronization
         // Мьютекс для синхронизации
         mutable std::mutex connectionsMutex;
         
-        // Статистика
-        // Statistics
-        // Статистика
-        mutable std::mutex statisticsMutex;
-        ConnectionStatistics stats;
+        // Поточні агрегати статистики (пишуться під connectionsMutex, читаються без блокувань)
+        // Running statistics aggregates (written under connectionsMutex, read without locks)
+        // Текущие агрегаты статистики (пишутся под connectionsMutex, читаются без блокировок)
+        std::atomic<size_t> connectionCount;
+        std::atomic<size_t> activeConnectionCount;
+        std::atomic<double> weightSum;
+        std::atomic<size_t> usageSum;
+        
+        // Рейтинги з'єднань для top-K (під connectionsMutex)
+        // Connection rankings for top-K (under connectionsMutex)
+        // Рейтинги соединений для top-K (под connectionsMutex)
+        ConnectionRanking<double> weightRanking;
+        ConnectionRanking<long long> usageCountRanking;
+        ConnectionRanking<long long> usageTimeRanking;
+        
+        // Дескриптори з'єднань у рейтингах та вільні дескриптори для повторного використання
+        // Connection handles in the rankings and free handles for reuse
+        // Дескрипторы соединений в рейтингах и свободные дескрипторы для повторного использования
+        FlatKeyIndex rankingHandles;
+        std::vector<uint32_t> freeRankingHandles;
         
         // Флаг ініціалізації
         // Initialization flag
         // Флаг инициализации
         std::atomic<bool> initialized;
         
+        // Режим конкурентного доступу
+        // Concurrency mode
+        // Режим конкурентного доступа
+        ConnectionConcurrencyMode concurrencyMode;
+        
+        // Опублікований знімок для читачів та знімки, що чекають на звільнення
+        // Published snapshot for readers and snapshots waiting to be freed
+        // Опубликованный снимок для читателей и снимки, ожидающие освобождения
+        std::atomic<ReadSnapshot*> readSnapshot;
+        std::vector<RetiredSnapshot> retiredSnapshots;
+        
         // Внутрішні методи
         // Internal methods
         // Внутренние методы
-        std::string generateConnectionKey(int sourceNeuronId, int targetNeuronId) const;
         long long getCurrentTimeMillis() const;
-        void updateConnectionStatistics(const WeightedConnection& connection);
-        void removeConnectionFromMaps(int sourceNeuronId, int targetNeuronId);
+        
+        // Додавання (sign = 1) або вилучення (sign = -1) внеску з'єднання в агрегати;
+        // зміна поля - це вилучення старого стану та додавання нового
+        // Add (sign = 1) or remove (sign = -1) a connection's contribution to the aggregates;
+        // a field change is removing the old state and adding the new one
+        // Добавление (sign = 1) или изъятие (sign = -1) вклада соединения в агрегаты;
+        // изменение поля - это изъятие старого состояния и добавление нового
+        void updateConnectionStatistics(const WeightedConnection& connection, int sign);
+        
+        // Оновлення позицій з'єднання в рейтингах
+        // Update the connection's positions in the rankings
+        // Обновление позиций соединения в рейтингах
+        void rankConnection(const WeightedConnection& connection);
+        void unrankConnection(int sourceNeuronId, int targetNeuronId);
+        
+        // Перетворення ключів рейтингу на з'єднання (під connectionsMutex)
+        // Turn ranking keys into connections (under connectionsMutex)
+        // Преобразование ключей рейтинга в соединения (под connectionsMutex)
+        std::vector<WeightedConnection> collectConnectionsLocked(const std::vector<uint64_t>& keys) const;
     };
 
 } // namespace Utils
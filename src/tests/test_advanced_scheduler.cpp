@@ -0,0 +1,290 @@
+// test_advanced_scheduler.cpp
+// Тест для расширенного планировщика на пуле потоков / Advanced scheduler on a thread pool test / Тест для розширеного планувальника на пулі потоків
+// NeuroSync OS Sparky
+
+#include "../core/AdvancedScheduler.h"
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <stdexcept>
+#include <cassert>
+
+using namespace NeuroSync::Core;
+
+static std::atomic<int> executedTasks(0);
+static std::atomic<int> concurrentTasks(0);
+static std::atomic<int> maxObservedConcurrency(0);
+
+void countingTask() {
+    executedTasks.fetch_add(1);
+}
+
+void slowTask() {
+    int current = concurrentTasks.fetch_add(1) + 1;
+    int observed = maxObservedConcurrency.load();
+    while (current > observed && !maxObservedConcurrency.compare_exchange_weak(observed, current)) {
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    concurrentTasks.fetch_sub(1);
+    executedTasks.fetch_add(1);
+}
+
+static std::atomic<bool> blockingReleased(false);
+
+void blockingTask() {
+    while (!blockingReleased.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    executedTasks.fetch_add(1);
+}
+
+void failingTask() {
+    throw std::runtime_error("task failure");
+}
+
+void testManySmallTasks() {
+    std::cout << "Testing many small tasks on the worker pool...\n";
+
+    executedTasks = 0;
+    AdvancedScheduler scheduler;
+    assert(scheduler.initialize(SchedulingAlgorithmType::PRIORITY_BASED, 4));
+    assert(scheduler.getMaxConcurrentTasks() == 4);
+    scheduler.start();
+
+    for (int i = 0; i < 5000; ++i) {
+        assert(scheduler.addTask("small", Utils::TaskType::CUSTOM, i % 10, 1, countingTask) > 0);
+    }
+    scheduler.waitForAllTasks();
+
+    assert(executedTasks == 5000);
+    AdvancedScheduler::SchedulerStatistics stats = scheduler.getStatistics();
+    assert(stats.completedTasks == 5000);
+    assert(stats.runningTasks == 0);
+    assert(stats.pendingTasks == 0);
+
+    scheduler.stop();
+    std::cout << "Many small tasks test passed!\n";
+}
+
+void testConcurrencyLimit() {
+    std::cout << "Testing concurrency limit...\n";
+
+    executedTasks = 0;
+    maxObservedConcurrency = 0;
+    AdvancedScheduler scheduler;
+    assert(scheduler.initialize(SchedulingAlgorithmType::ROUND_ROBIN, 2));
+    scheduler.start();
+
+    for (int i = 0; i < 20; ++i) {
+        scheduler.addTask("slow", Utils::TaskType::CUSTOM, 1, 1, slowTask);
+    }
+    scheduler.waitForAllTasks();
+
+    assert(executedTasks == 20);
+    assert(maxObservedConcurrency.load() <= 2);
+
+    scheduler.stop();
+    std::cout << "Concurrency limit test passed!\n";
+}
+
+void testFailedTaskAndStatus() {
+    std::cout << "Testing failed task accounting...\n";
+
+    AdvancedScheduler scheduler;
+    assert(scheduler.initialize(SchedulingAlgorithmType::PRIORITY_BASED, 1));
+    scheduler.start();
+
+    int failedId = scheduler.addTask("failing", Utils::TaskType::CUSTOM, 1, 1, failingTask);
+    int completedId = scheduler.addTask("counting", Utils::TaskType::CUSTOM, 1, 1, countingTask);
+    scheduler.waitForAllTasks();
+
+    assert(scheduler.getTaskStatus(failedId) == Utils::TaskStatus::FAILED);
+    assert(scheduler.getTaskStatus(completedId) == Utils::TaskStatus::COMPLETED);
+    assert(scheduler.getStatistics().failedTasks == 1);
+
+    // Остановка с задачами в очереди не зависает
+    // Stopping with queued tasks does not hang
+    // Зупинка із завданнями в черзі не зависає
+    for (int i = 0; i < 10; ++i) {
+        scheduler.addTask("slow", Utils::TaskType::CUSTOM, 1, 1, slowTask);
+    }
+    scheduler.stop();
+    assert(scheduler.getRunningTaskCount() == 0);
+
+    std::cout << "Failed task accounting test passed!\n";
+}
+
+static std::atomic<int> stageOrder(0);
+static std::atomic<int> firstStage(0);
+static std::atomic<int> secondStage(0);
+
+void firstStageTask() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    firstStage = ++stageOrder;
+}
+
+void secondStageTask() {
+    secondStage = ++stageOrder;
+}
+
+void slowFailingTask() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    throw std::runtime_error("task failure");
+}
+
+void testDependencies() {
+    std::cout << "Testing task dependencies...\n";
+
+    AdvancedScheduler scheduler;
+    assert(scheduler.initialize(SchedulingAlgorithmType::PRIORITY_BASED, 4));
+    scheduler.start();
+
+    // Вторая стадия ждет первую, хотя ее приоритет выше и свободные потоки есть
+    // The second stage waits for the first even though its priority is higher and threads are free
+    // Друга стадія чекає на першу, хоча її пріоритет вищий і вільні потоки є
+    int first = scheduler.addTask("first", Utils::TaskType::CUSTOM, 1, 1, firstStageTask);
+    int second = scheduler.addTask("second", Utils::TaskType::CUSTOM, 10, 1, secondStageTask, {first});
+    assert(first > 0 && second > 0);
+    assert(scheduler.addTask("unknown", Utils::TaskType::CUSTOM, 1, 1, countingTask, {12345}) == -1);
+    scheduler.waitForAllTasks();
+
+    assert(firstStage == 1 && secondStage == 2);
+    assert(scheduler.getTaskStatus(second) == Utils::TaskStatus::COMPLETED);
+
+    // Неудача предшественника отменяет зависимую задачу
+    // A failed predecessor cancels the dependent task
+    // Невдача попередника скасовує залежне завдання
+    int failing = scheduler.addTask("failing", Utils::TaskType::CUSTOM, 1, 1, slowFailingTask);
+    int dependent = scheduler.addTask("dependent", Utils::TaskType::CUSTOM, 1, 1, countingTask, {failing});
+    scheduler.waitForAllTasks();
+
+    assert(scheduler.getTaskStatus(dependent) == Utils::TaskStatus::CANCELLED);
+    assert(scheduler.getStatistics().cancelledTasks == 1);
+
+    // Удаление незавершенного предшественника (выполняющегося или ожидающего) отменяет
+    // зависимые задачи: они не запускаются ни во время его выполнения, ни вместо него
+    // Removing an unfinished predecessor (running or pending) cancels the dependent
+    // tasks: they run neither while it executes nor in its place
+    // Видалення незавершеного попередника (виконуваного або очікуючого) скасовує
+    // залежні завдання: вони не запускаються ні під час його виконання, ні замість нього
+    blockingReleased = false;
+    int running = scheduler.addTask("blocking", Utils::TaskType::CUSTOM, 1, 1, blockingTask);
+    int runningDependent = scheduler.addTask("dependent", Utils::TaskType::CUSTOM, 1, 1, countingTask, {running});
+    int pending = scheduler.addTask("pending", Utils::TaskType::CUSTOM, 1, 1, countingTask, {running});
+    int pendingDependent = scheduler.addTask("dependent", Utils::TaskType::CUSTOM, 1, 1, countingTask, {pending});
+    while (scheduler.getTaskStatus(running) != Utils::TaskStatus::RUNNING) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    int executedBefore = executedTasks.load();
+
+    assert(scheduler.removeTask(pending));
+    assert(scheduler.getTaskStatus(pendingDependent) == Utils::TaskStatus::CANCELLED);
+    assert(scheduler.removeTask(running));
+    assert(scheduler.getTaskStatus(runningDependent) == Utils::TaskStatus::CANCELLED);
+
+    blockingReleased = true;
+    scheduler.waitForAllTasks();
+    assert(executedTasks == executedBefore + 1);
+    assert(scheduler.getTaskStatus(runningDependent) == Utils::TaskStatus::CANCELLED);
+    assert(scheduler.getTaskStatus(pendingDependent) == Utils::TaskStatus::CANCELLED);
+    assert(scheduler.getStatistics().cancelledTasks == 3);
+
+    scheduler.stop();
+    std::cout << "Task dependencies test passed!\n";
+}
+
+void testDeadlineScheduling() {
+    std::cout << "Testing deadline scheduling...\n";
+
+    executedTasks = 0;
+    AdvancedScheduler scheduler;
+    assert(scheduler.initialize(SchedulingAlgorithmType::EARLIEST_DEADLINE_FIRST, 1));
+    scheduler.start();
+
+    // Задача без срока выполняется как обычная задача с приоритетом
+    // A task without a deadline runs like an ordinary priority task
+    // Завдання без строку виконується як звичайне завдання з пріоритетом
+    assert(scheduler.addTask("plain", Utils::TaskType::CUSTOM, 1, 1, countingTask) > 0);
+    assert(scheduler.addDeadlineTask("due", Utils::TaskType::CUSTOM, 1, 10000, 1, countingTask) > 0);
+    assert(scheduler.addDeadlineTask("invalid", Utils::TaskType::CUSTOM, 1, 0, 1, countingTask) == -1);
+
+    // Оценка больше срока не проходит контроль допуска
+    // An estimate longer than the deadline fails admission control
+    // Оцінка, більша за строк, не проходить контроль допуску
+    assert(scheduler.addDeadlineTask("hopeless", Utils::TaskType::CUSTOM, 1, 10, 1000, countingTask) == -1);
+    scheduler.waitForAllTasks();
+
+    // Задача с заниженной оценкой опаздывает и попадает в счетчик пропусков
+    // A task with an underestimate runs late and is counted as a miss
+    // Завдання із заниженою оцінкою запізнюється і потрапляє до лічильника пропусків
+    assert(scheduler.addDeadlineTask("late", Utils::TaskType::CUSTOM, 1, 1, 0, slowTask) > 0);
+    scheduler.waitForAllTasks();
+
+    AdvancedScheduler::SchedulerStatistics stats = scheduler.getStatistics();
+    assert(executedTasks == 3);
+    assert(stats.deadlineTasks == 2);
+    assert(stats.rejectedTasks == 1);
+    assert(stats.deadlineMisses == 1);
+    assert(stats.maxLateness > 0);
+
+    scheduler.stop();
+    std::cout << "Deadline scheduling test passed!\n";
+}
+
+void testDeadlineAdmissionWithRunningTasks() {
+    std::cout << "Testing deadline admission with running and blocked tasks...\n";
+
+    executedTasks = 0;
+    blockingReleased = false;
+    AdvancedScheduler scheduler;
+    assert(scheduler.initialize(SchedulingAlgorithmType::EARLIEST_DEADLINE_FIRST, 1));
+    scheduler.start();
+
+    // Длинная задача занимает единственного исполнителя на свою оценку (1000 мс)
+    // A long task occupies the only executor for its estimate (1000 ms)
+    // Довге завдання займає єдиного виконавця на свою оцінку (1000 мс)
+    int longTask = scheduler.addDeadlineTask("long", Utils::TaskType::CUSTOM, 1, 10000, 1000, blockingTask);
+    assert(longTask > 0);
+    while (scheduler.getTaskStatus(longTask) != Utils::TaskStatus::RUNNING) {
+        std::this_thread::yield();
+    }
+
+    // Задача с коротким сроком не может начаться раньше, чем освободится исполнитель
+    // A task with a tight deadline cannot start before the executor frees up
+    // Завдання з коротким строком не може початися раніше, ніж звільниться виконавець
+    assert(scheduler.addDeadlineTask("tight", Utils::TaskType::CUSTOM, 1, 50, 10, countingTask) == -1);
+
+    // Задача, ждущая длинную, резервирует свою оценку: более срочная задача, которая сорвала бы ее, отклоняется
+    // A task waiting for the long one reserves its estimate: a more urgent task that would make it miss is rejected
+    // Завдання, що чекає на довге, резервує свою оцінку: терміновіше завдання, яке зірвало б його, відхиляється
+    int blocked = scheduler.addDeadlineTask("blocked", Utils::TaskType::CUSTOM, 1, 2500, 1000, countingTask, {longTask});
+    assert(blocked > 0);
+    assert(scheduler.getTaskStatus(blocked) == Utils::TaskStatus::PENDING);
+    assert(scheduler.addDeadlineTask("squeezed", Utils::TaskType::CUSTOM, 1, 2000, 700, countingTask) == -1);
+    assert(scheduler.addDeadlineTask("fits", Utils::TaskType::CUSTOM, 1, 2000, 300, countingTask) > 0);
+
+    blockingReleased = true;
+    scheduler.waitForAllTasks();
+
+    assert(scheduler.getTaskStatus(blocked) == Utils::TaskStatus::COMPLETED);
+    assert(executedTasks == 3);
+    assert(scheduler.getStatistics().rejectedTasks == 2);
+
+    scheduler.stop();
+    std::cout << "Deadline admission with running tasks test passed!\n";
+}
+
+int main() {
+    std::cout << "=== Running Advanced Scheduler Tests ===\n";
+
+    testManySmallTasks();
+    testConcurrencyLimit();
+    testFailedTaskAndStatus();
+    testDependencies();
+    testDeadlineScheduling();
+    testDeadlineAdmissionWithRunningTasks();
+
+    std::cout << "=== All Advanced Scheduler Tests Passed ===\n";
+    return 0;
+}
@@ -0,0 +1,319 @@
+// test_coroutines.cpp
+// Тест співпрограмних завдань на ThreadPool, Core::Scheduler та SynapseBus / Coroutine tasks on ThreadPool, Core::Scheduler and SynapseBus test / Тест сопрограммных задач на ThreadPool, Core::Scheduler и SynapseBus
+// NeuroSync OS Sparky
+
+#include "../coroutine/Task.h"
+#include "../coroutine/Awaitables.h"
+#include "../coroutine/MessageReceiver.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include <stdexcept>
+#include <cassert>
+#include <cstring>
+
+using namespace NeuroSync;
+using namespace NeuroSync::Coroutine;
+
+Coroutine::Task<int> add(int a, int b) {
+    co_return a + b;
+}
+
+Coroutine::Task<int> sumTo(int n) {
+    if (n == 0) {
+        co_return 0;
+    }
+    int rest = co_await sumTo(n - 1);
+    co_return n + rest;
+}
+
+Coroutine::Task<void> failing() {
+    throw std::runtime_error("coroutine failure");
+    co_return;
+}
+
+Coroutine::Task<int> catchFailure() {
+    try {
+        co_await failing();
+    } catch (const std::runtime_error&) {
+        co_return -1;
+    }
+    co_return 0;
+}
+
+// Очікування лічильника з обмеженням часу
+// Wait for a counter with a time limit
+// Ожидание счетчика с ограничением времени
+static bool waitForCount(const std::atomic<int>& counter, int expected, std::chrono::seconds limit) {
+    auto deadline = std::chrono::steady_clock::now() + limit;
+    while (counter.load() < expected) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+void testTaskResults() {
+    std::cout << "Testing task results and exceptions...\n";
+
+    assert(syncWait(add(2, 3)) == 5);
+    assert(syncWait(sumTo(2000)) == 2000 * 2001 / 2);
+    assert(syncWait(catchFailure()) == -1);
+
+    bool thrown = false;
+    try {
+        syncWait(failing());
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // Ліниве завдання не виконується до co_await
+    // A lazy task does not run before co_await
+    // Ленивая задача не выполняется до co_await
+    Coroutine::Task<int> lazy = add(1, 1);
+    assert(!lazy.isReady());
+    assert(syncWait(std::move(lazy)) == 2);
+
+    std::cout << "Task results test passed!\n";
+}
+
+static std::atomic<int> finishedSleepers(0);
+
+Coroutine::Task<void> sleeper(ThreadPool& pool, ::Core::Scheduler& scheduler) {
+    co_await schedule(pool);
+    co_await sleepFor(scheduler, std::chrono::milliseconds(20));
+    co_await schedule(pool);
+    finishedSleepers++;
+}
+
+void testSuspendedTasksDoNotOccupyWorkers() {
+    std::cout << "Testing suspended tasks on a small pool...\n";
+
+    // 10000 співпрограм по 20 мс сну на двох потоках пулу: із блокуванням це зайняло б 100 с
+    // 10000 coroutines sleeping 20 ms each on two pool threads: blocking would take 100 s
+    // 10000 сопрограмм по 20 мс сна на двух потоках пула: с блокировкой это заняло бы 100 с
+    const int coroutineCount = 10000;
+    finishedSleepers = 0;
+    ThreadPool pool(2);
+    ::Core::Scheduler scheduler;
+    scheduler.start();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < coroutineCount; ++i) {
+        spawn(pool, sleeper(pool, scheduler));
+    }
+    assert(waitForCount(finishedSleepers, coroutineCount, std::chrono::seconds(20)));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    assert(elapsed < std::chrono::seconds(10));
+
+    scheduler.stop();
+    std::cout << "Suspended tasks test passed!\n";
+}
+
+Coroutine::Task<int> priorityHop(::Core::Scheduler& scheduler, int value) {
+    co_await schedule(scheduler, 5);
+    co_return value * 2;
+}
+
+void testSchedulerExecutor() {
+    std::cout << "Testing Core::Scheduler as an executor...\n";
+
+    ::Core::Scheduler scheduler;
+    scheduler.start();
+    assert(syncWait(priorityHop(scheduler, 21)) == 42);
+    scheduler.stop();
+
+    // Зупинений планувальник повертає виняток у співпрограму
+    // A stopped scheduler reports an exception into the coroutine
+    // Остановленный планировщик возвращает исключение в сопрограмму
+    bool thrown = false;
+    try {
+        syncWait(priorityHop(scheduler, 1));
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "Scheduler executor test passed!\n";
+}
+
+Coroutine::Task<int> longSleeper(::Core::Scheduler& scheduler) {
+    co_await sleepFor(scheduler, std::chrono::hours(1));
+    co_return 1;
+}
+
+void testSchedulerStopResumesSleepers() {
+    std::cout << "Testing Scheduler::stop with suspended coroutines...\n";
+
+    // stop() відкидає таймер і відновлює співпрограму з винятком, тож syncWait не зависає
+    // stop() discards the timer and resumes the coroutine with an exception, so syncWait does not hang
+    // stop() отбрасывает таймер и возобновляет сопрограмму с исключением, так что syncWait не зависает
+    ::Core::Scheduler scheduler;
+    scheduler.start();
+    std::atomic<bool> thrown(false);
+    std::thread waiter([&scheduler, &thrown]() {
+        try {
+            syncWait(longSleeper(scheduler));
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+    });
+    while (scheduler.getTaskCount() == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    scheduler.stop();
+    waiter.join();
+    assert(thrown);
+
+    // Запущена через spawn співпрограма теж завершується, і її кадр звільняється
+    // A coroutine started through spawn finishes too, and its frame is freed
+    // Запущенная через spawn сопрограмма тоже завершается, и ее кадр освобождается
+    ::Core::Scheduler detachedScheduler;
+    detachedScheduler.start();
+    std::atomic<int> started(0);
+    std::atomic<int> finished(0);
+    spawn(detachedScheduler, [](::Core::Scheduler& scheduler, std::atomic<int>& started,
+                                std::atomic<int>& finished) -> Coroutine::Task<void> {
+        started++;
+        try {
+            co_await sleepFor(scheduler, std::chrono::hours(1));
+        } catch (const std::runtime_error&) {
+            finished++;
+        }
+    }(detachedScheduler, started, finished));
+    assert(waitForCount(started, 1, std::chrono::seconds(5)));
+    while (detachedScheduler.getTaskCount() == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    detachedScheduler.stop();
+    assert(finished == 1);
+
+    std::cout << "Scheduler stop test passed!\n";
+}
+
+Coroutine::Task<int> hopUntilStopped(::Core::Scheduler& scheduler) {
+    int hops = 0;
+    try {
+        for (;;) {
+            co_await schedule(scheduler);
+            hops++;
+        }
+    } catch (const std::runtime_error&) {
+    }
+    co_return hops;
+}
+
+void testScheduleRacingStop() {
+    std::cout << "Testing schedule(scheduler) racing Scheduler::stop...\n";
+
+    // Співпрограми безперервно переходять на робітників, поки stop() не зупинить планувальник:
+    // продовження, поставлене під час зупинки, виконується або скасовується, і syncWait не зависає
+    // Coroutines keep hopping onto workers until stop() halts the scheduler: a continuation
+    // added while stopping is either run or cancelled, and syncWait does not hang
+    // Сопрограммы непрерывно переходят на рабочих, пока stop() не остановит планировщик:
+    // продолжение, поставленное во время остановки, выполняется или отменяется, и syncWait не зависает
+    for (int round = 0; round < 1000; ++round) {
+        ::Core::Scheduler scheduler(std::chrono::microseconds(1000), 2);
+        scheduler.start();
+        std::atomic<int> finished(0);
+        std::vector<std::thread> waiters;
+        for (int i = 0; i < 3; ++i) {
+            waiters.emplace_back([&scheduler, &finished]() {
+                syncWait(hopUntilStopped(scheduler));
+                finished++;
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100 * (round % 10)));
+        scheduler.stop();
+        for (std::thread& waiter : waiters) {
+            waiter.join();
+        }
+        assert(finished == 3);
+    }
+
+    std::cout << "Schedule racing stop test passed!\n";
+}
+
+static std::atomic<int> finishedConversations(0);
+
+Coroutine::Task<void> pinger(Synapse::SynapseBus& bus, MessageReceiver& receiver, int self, int peer, int rounds) {
+    for (int round = 0; round < rounds; ++round) {
+        bool sent = bus.sendMessage(self, peer, &round, sizeof(round));
+        assert(sent);
+        (void)sent;
+        MessageReceiver::Message reply = co_await receiver.receive(self);
+        int value;
+        std::memcpy(&value, reply.payload.data(), sizeof(value));
+        assert(reply.senderId == peer && value == round + 1);
+    }
+    finishedConversations++;
+}
+
+Coroutine::Task<void> ponger(Synapse::SynapseBus& bus, MessageReceiver& receiver, int self, int peer, int rounds) {
+    for (int round = 0; round < rounds; ++round) {
+        MessageReceiver::Message request = co_await receiver.receive(self);
+        int value;
+        std::memcpy(&value, request.payload.data(), sizeof(value));
+        value++;
+        bool sent = bus.sendMessage(self, peer, &value, sizeof(value));
+        assert(sent);
+        (void)sent;
+    }
+}
+
+void testSynapseConversations() {
+    std::cout << "Testing neuron conversations over SynapseBus...\n";
+
+    // 2000 нейронів ведуть 1000 розмов по 10 обмінів на двох потоках пулу та двох потоках шини
+    // 2000 neurons hold 1000 conversations of 10 exchanges on two pool threads and two bus threads
+    // 2000 нейронов ведут 1000 разговоров по 10 обменов на двух потоках пула и двух потоках шины
+    const int conversations = 1000;
+    const int rounds = 10;
+    finishedConversations = 0;
+
+    ThreadPool pool(2);
+    Synapse::SynapseBus bus;
+    bool initialized = bus.initialize(Synapse::Priority::MessageQueueType::PRIORITY_HEAP,
+                                      Synapse::SynapseBus::DEFAULT_PROCESSING_BATCH_SIZE, 2);
+    assert(initialized);
+    (void)initialized;
+    {
+        MessageReceiver receiver(bus, &pool);
+        bus.start();
+
+        // Спершу всі отримувачі, щоб частина повідомлень чекала в скриньках, а частина - у призупинених співпрограмах
+        // Receivers first, so some messages wait in mailboxes and some in suspended coroutines
+        // Сначала все получатели, чтобы часть сообщений ждала в ящиках, а часть - в приостановленных сопрограммах
+        for (int i = 0; i < conversations; ++i) {
+            spawn(pool, ponger(bus, receiver, 2 * i + 1, 2 * i, rounds));
+        }
+        for (int i = 0; i < conversations; ++i) {
+            spawn(pool, pinger(bus, receiver, 2 * i, 2 * i + 1, rounds));
+        }
+        assert(waitForCount(finishedConversations, conversations, std::chrono::seconds(30)));
+        assert(receiver.getPendingMessageCount() == 0);
+
+        bus.stop();
+    }
+
+    std::cout << "SynapseBus conversations test passed!\n";
+}
+
+int main() {
+    std::cout << "=== Running Coroutine Tests ===\n";
+
+    testTaskResults();
+    testSuspendedTasksDoNotOccupyWorkers();
+    testSchedulerExecutor();
+    testSchedulerStopResumesSleepers();
+    testScheduleRacingStop();
+    testSynapseConversations();
+
+    std::cout << "=== All Coroutine Tests Passed ===\n";
+    return 0;
+}
@@ -1,8 +1,18 @@
 #include "../memory/MemoryCore.h"
+#include "../memory/Arena.h"
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <thread>
 #include <vector>
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
 using namespace NeuroSync::Memory;
 
 void testMemoryPoolAllocation() {
@@ -138,6 +148,716 @@ void testPoolTypes() {
     std::cout << "Тестування типів пулу пройдено успішно!" << std::endl;
 }
 
+void testTlsfCoalescing() {
+    std::cout << "Тестування об'єднання блоків TLSF..." << std::endl;
+    
+    MemoryPool pool(1024 * 1024);
+    FragmentationReport initial = pool.getFragmentationReport();
+    assert(initial.freeBlocks == 1 && initial.usedBlocks == 0);
+    assert(initial.fragmentation == 0.0);
+    
+    // Блоки вирівняні, а розмір округлюється до вирівнювання
+    // Blocks are aligned and the size is rounded up to the alignment
+    // Блоки вирівняні, а розмір округлюється до вирівнювання
+    void* a = pool.allocate(1000);
+    void* b = pool.allocate(1000);
+    void* c = pool.allocate(1000);
+    assert(a && b && c);
+    assert(reinterpret_cast<uintptr_t>(a) % MemoryPool::ALIGNMENT == 0);
+    assert(reinterpret_cast<uintptr_t>(b) % MemoryPool::ALIGNMENT == 0);
+    assert(pool.getUsedSize() == 3 * 1008);
+    assert(pool.getBlockCount() == 4);
+    
+    // Звільнення середнього, потім сусідів: граничні теги зливають усе назад в один блок
+    // Free the middle one, then its neighbours: the boundary tags merge everything back into one block
+    // Звільнення середнього, потім сусідів: граничні теги зливають усе назад в один блок
+    pool.deallocate(b);
+    assert(pool.getFragmentationReport().freeBlocks == 2);
+    pool.deallocate(a);
+    assert(pool.getFragmentationReport().freeBlocks == 2);
+    pool.deallocate(c);
+    FragmentationReport merged = pool.getFragmentationReport();
+    assert(merged.freeBlocks == 1 && merged.usedBlocks == 0);
+    assert(merged.largestFreeBlock == initial.largestFreeBlock);
+    assert(pool.getBlockCount() == 1 && pool.getUsedSize() == 0);
+    
+    // Повторне звільнення та чужі вказівники ігноруються
+    // Double frees and foreign pointers are ignored
+    // Повторне звільнення та чужі вказівники ігноруються
+    int outside = 0;
+    pool.deallocate(a);
+    pool.deallocate(&outside);
+    assert(pool.getFragmentationReport().freeBlocks == 1);
+    
+    // Обробник звільненої пам'яті обнуляє байти (як MADV_DONTNEED), зокрема застарілий заголовок
+    // блоку, злитого з попереднім: повторне звільнення та вказівник усередину блоку все одно ігноруються
+    // The freed memory handler zeroes the bytes (as MADV_DONTNEED does), including the stale header
+    // of a block merged into its predecessor: a double free and a pointer into a block are still ignored
+    // Обробник звільненої пам'яті обнуляє байти (як MADV_DONTNEED), зокрема застарілий заголовок
+    // блоку, злитого з попереднім: повторне звільнення та вказівник усередину блоку все одно ігноруються
+    MemoryPool zeroing(64 * 1024);
+    zeroing.setReleaseHandler([](void* begin, size_t size) { std::memset(begin, 0, size); }, 4096);
+    void* first = zeroing.allocate(256);
+    void* second = zeroing.allocate(256);
+    char* third = static_cast<char*>(zeroing.allocate(256));
+    zeroing.deallocate(first);
+    zeroing.deallocate(second);
+    zeroing.deallocate(second);
+    
+    // Правдоподібний підроблений заголовок у корисних даних третього блоку
+    // A plausible forged header in the third block's payload
+    // Правдоподібний підроблений заголовок у корисних даних третього блоку
+    std::memset(third, 0, 256);
+    void* thirdHeader = third - MemoryPool::ALIGNMENT;
+    std::memcpy(third + 16, &thirdHeader, sizeof(thirdHeader));
+    size_t forgedSize = 32;
+    std::memcpy(third + 16 + sizeof(void*), &forgedSize, sizeof(forgedSize));
+    zeroing.deallocate(third + 32);
+    
+    FragmentationReport zeroed = zeroing.getFragmentationReport();
+    assert(zeroed.usedBlocks == 1 && zeroed.freeBlocks == 2);
+    assert(zeroing.getUsedSize() == 256);
+    void* reused = zeroing.allocate(512);
+    assert(reused == first);
+    zeroing.deallocate(third);
+    zeroing.deallocate(reused);
+    assert(zeroing.getFragmentationReport().freeBlocks == 1 && zeroing.getUsedSize() == 0);
+    
+    // Об'єднаний блок знову вміщує великий запит; запит, більший за пул, не вміщується
+    // The merged block fits a large request again; a request larger than the pool does not fit
+    // Об'єднаний блок знову вміщує великий запит; запит, більший за пул, не вміщується
+    void* large = pool.allocate(initial.largestFreeBlock * 3 / 4);
+    assert(large != nullptr);
+    assert(pool.allocate(initial.largestFreeBlock * 3 / 4) == nullptr);
+    pool.deallocate(large);
+    assert(pool.allocate(2 * 1024 * 1024) == nullptr);
+    
+    std::cout << "Тестування об'єднання блоків TLSF пройдено успішно!" << std::endl;
+}
+
+void testTlsfFragmentationReport() {
+    std::cout << "Тестування звіту про фрагментацію..." << std::endl;
+    
+    MemoryPool pool(1024 * 1024);
+    FragmentationReport initial = pool.getFragmentationReport();
+    size_t capacity = initial.freeBytes + initial.headerBytes;
+    
+    // Звільнення кожного другого блоку залишає діри, які видно у звіті
+    // Freeing every other block leaves holes that show up in the report
+    // Звільнення кожного другого блоку залишає діри, які видно у звіті
+    std::vector<void*> blocks;
+    for (size_t i = 0; i < 100; ++i) {
+        blocks.push_back(pool.allocate(1024));
+    }
+    for (size_t i = 0; i < blocks.size(); i += 2) {
+        pool.deallocate(blocks[i]);
+    }
+    FragmentationReport holes = pool.getFragmentationReport();
+    assert(holes.freeBlocks == 51 && holes.usedBlocks == 50);
+    assert(holes.fragmentation > 0.0 && holes.fragmentation < 1.0);
+    assert(holes.freeBytes + holes.headerBytes + pool.getUsedSize() == capacity);
+    
+    // Блок того ж розміру займає діру, а не хвіст пулу
+    // A block of the same size takes a hole rather than the tail of the pool
+    // Блок того ж розміру займає діру, а не хвіст пулу
+    void* reused = pool.allocate(1024);
+    assert(reused >= blocks.front() && reused <= blocks.back());
+    pool.deallocate(reused);
+    
+    // Випадкова зміна блоків середнього розміру зберігає облік
+    // Random churn of medium blocks keeps the accounting
+    // Випадкова зміна блоків середнього розміру зберігає облік
+    uint32_t state = 12345;
+    for (size_t i = 0; i < 20000; ++i) {
+        state = state * 1664525u + 1013904223u;
+        size_t slot = (state >> 8) % blocks.size();
+        if (slot % 2 == 0) {
+            continue;
+        }
+        pool.deallocate(blocks[slot]);
+        blocks[slot] = pool.allocate(256 + (state >> 16) % 3841);
+        assert(blocks[slot] != nullptr);
+    }
+    FragmentationReport churned = pool.getFragmentationReport();
+    assert(churned.usedBlocks == 50);
+    assert(churned.freeBytes + churned.headerBytes + pool.getUsedSize() == capacity);
+    for (size_t i = 1; i < blocks.size(); i += 2) {
+        pool.deallocate(blocks[i]);
+    }
+    FragmentationReport drained = pool.getFragmentationReport();
+    assert(drained.freeBlocks == 1 && drained.fragmentation == 0.0);
+    
+    // Звіт доступний і через MemoryCore
+    // The report is available through MemoryCore too
+    // Звіт доступний і через MemoryCore
+    MemoryCore memoryCore;
+    void* ptr = memoryCore.allocate(2048);
+    assert(memoryCore.getPoolFragmentation(MemoryCore::PoolType::MEDIUM).usedBlocks == 1);
+    memoryCore.deallocate(ptr);
+    assert(memoryCore.getPoolFragmentation(MemoryCore::PoolType::MEDIUM).usedBlocks == 0);
+    
+    std::cout << "Тестування звіту про фрагментацію пройдено успішно!" << std::endl;
+}
+
+void testSlabSizeClasses() {
+    std::cout << "Тестування класів розмірів SlabAllocator..." << std::endl;
+    
+    // Кожен розмір потрапляє до найменшого класу, що його вміщує
+    // Every size maps to the smallest class that fits it
+    // Кожен розмір потрапляє до найменшого класу, що його вміщує
+    size_t previous = 0;
+    for (size_t size = 1; size <= SlabAllocator::MAX_SLAB_SIZE; ++size) {
+        size_t sizeClass = SlabAllocator::sizeClassOf(size);
+        assert(sizeClass < SlabAllocator::SIZE_CLASS_COUNT);
+        assert(SlabAllocator::classSize(sizeClass) >= size);
+        assert(sizeClass == 0 || SlabAllocator::classSize(sizeClass - 1) < size);
+        assert(sizeClass >= previous);
+        previous = sizeClass;
+    }
+    assert(SlabAllocator::classSize(SlabAllocator::sizeClassOf(16)) == 16);
+    assert(SlabAllocator::classSize(SlabAllocator::sizeClassOf(129)) == 160);
+    assert(SlabAllocator::classSize(SlabAllocator::sizeClassOf(SlabAllocator::SMALL_OBJECT_LIMIT)) == 256);
+    assert(SlabAllocator::classSize(SlabAllocator::SIZE_CLASS_COUNT - 1) == SlabAllocator::MAX_SLAB_SIZE);
+    
+    std::cout << "Тестування класів розмірів SlabAllocator пройдено успішно!" << std::endl;
+}
+
+void testSlabAllocatorMode() {
+    std::cout << "Тестування режиму SLAB..." << std::endl;
+    
+    MemoryCore memoryCore(MemoryCore::AllocatorMode::SLAB);
+    assert(memoryCore.getAllocatorMode() == MemoryCore::AllocatorMode::SLAB);
+    assert(memoryCore.getPoolTotalMemory(MemoryCore::PoolType::SMALL) == 16 * 1024 * 1024);
+    assert(memoryCore.getPoolTotalMemory(MemoryCore::PoolType::MEDIUM) == 64 * 1024 * 1024);
+    assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::SMALL) == 0);
+    
+    // Облік ведеться за розміром класу в пулі відповідного типу
+    // Accounting uses the class size in the pool of the matching type
+    // Облік ведеться за розміром класу в пулі відповідного типу
+    void* smallPtr = memoryCore.allocate(100);
+    void* mediumPtr = memoryCore.allocate(1000);
+    void* largePtr = memoryCore.allocate(8192);
+    assert(smallPtr && mediumPtr && largePtr);
+    std::memset(smallPtr, 0xAB, 100);
+    std::memset(mediumPtr, 0xCD, 1000);
+    assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::SMALL) == 112);
+    assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::MEDIUM) == 1024);
+    assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::LARGE) >= 8192);
+    assert(memoryCore.getPoolFreeMemory(MemoryCore::PoolType::SMALL) == 16 * 1024 * 1024 - 112);
+    
+    // Звільнений об'єкт повертається з магазину потоку першим
+    // A freed object comes back first from the thread's magazine
+    // Звільнений об'єкт повертається з магазину потоку першим
+    memoryCore.deallocate(smallPtr);
+    assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::SMALL) == 0);
+    void* reused = memoryCore.allocate(112);
+    assert(reused == smallPtr);
+    
+    memoryCore.deallocate(reused);
+    memoryCore.deallocate(mediumPtr);
+    memoryCore.deallocate(largePtr);
+    assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::MEDIUM) == 0);
+    
+    std::cout << "Тестування режиму SLAB пройдено успішно!" << std::endl;
+}
+
+void testSlabCrossThread() {
+    std::cout << "Тестування звільнення з інших потоків..." << std::endl;
+    
+    MemoryCore memoryCore(MemoryCore::AllocatorMode::SLAB);
+    const size_t threadCount = 4;
+    const size_t objectsPerThread = 5000;
+    
+    // Кожен потік звільняє об'єкти, виділені сусіднім потоком, потім потоки завершуються
+    // Every thread frees objects allocated by its neighbour, then the threads exit
+    // Кожен потік звільняє об'єкти, виділені сусіднім потоком, потім потоки завершуються
+    std::vector<std::vector<void*>> objects(threadCount);
+    std::atomic<size_t> allocated(0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < objectsPerThread; ++i) {
+                size_t size = 16 + (i * 37 + t * 11) % 4000;
+                void* ptr = memoryCore.allocate(size);
+                assert(ptr != nullptr);
+                *static_cast<size_t*>(ptr) = t;
+                objects[t].push_back(ptr);
+            }
+            allocated.fetch_add(1);
+            while (allocated.load() < threadCount) {
+                std::this_thread::yield();
+            }
+            for (void* ptr : objects[(t + 1) % threadCount]) {
+                assert(*static_cast<size_t*>(ptr) == (t + 1) % threadCount);
+                memoryCore.deallocate(ptr);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    // Облік зводиться до нуля, а кеші завершених потоків повернуто до центральних списків
+    // Accounting comes back to zero and the caches of exited threads went back to the central lists
+    // Облік зводиться до нуля, а кеші завершених потоків повернуто до центральних списків
+    assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::SMALL) == 0);
+    assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::MEDIUM) == 0);
+    void* ptr = memoryCore.allocate(64);
+    assert(ptr != nullptr);
+    memoryCore.deallocate(ptr);
+    
+    std::cout << "Тестування звільнення з інших потоків пройдено успішно!" << std::endl;
+}
+
+void testSlabExhaustion() {
+    std::cout << "Тестування вичерпання області SlabAllocator..." << std::endl;
+    
+    // Мала область з одного прольоту: другий клас уже не отримує прольоту
+    // A small region of a single span: the second class gets no span
+    // Мала область з одного прольоту: другий клас уже не отримує прольоту
+    SlabAllocator allocator(SlabAllocator::SPAN_SIZE, SlabAllocator::SPAN_SIZE);
+    std::vector<void*> objects;
+    for (size_t i = 0; i < SlabAllocator::SPAN_SIZE / 16; ++i) {
+        void* ptr = allocator.allocate(16);
+        assert(ptr != nullptr && allocator.contains(ptr));
+        objects.push_back(ptr);
+    }
+    assert(allocator.allocate(16) == nullptr);
+    assert(allocator.allocate(32) == nullptr);
+    assert(allocator.allocate(SlabAllocator::MAX_SLAB_SIZE + 1) == nullptr);
+    assert(allocator.getSmallStatistics().spansInUse == 1);
+    
+    int outside = 0;
+    assert(!allocator.deallocate(&outside));
+    for (void* ptr : objects) {
+        assert(allocator.deallocate(ptr));
+    }
+    assert(allocator.getSmallStatistics().usedSize == 0);
+    assert(allocator.allocate(16) != nullptr);
+    
+    std::cout << "Тестування вичерпання області SlabAllocator пройдено успішно!" << std::endl;
+}
+
+void testSlabDestroyedBeforeThread() {
+    std::cout << "Тестування знищення SlabAllocator до завершення потоку..." << std::endl;
+    
+    // Потік тримає кеш розподільника, який знищується раніше за потік
+    // A thread holds a cache of an allocator that is destroyed before the thread
+    // Потік тримає кеш розподільника, який знищується раніше за потік
+    std::unique_ptr<SlabAllocator> allocator(new SlabAllocator(1024 * 1024, 1024 * 1024));
+    std::atomic<int> stage(0);
+    std::thread worker([&]() {
+        void* ptr = allocator->allocate(48);
+        assert(ptr != nullptr);
+        allocator->deallocate(ptr);
+        stage.store(1);
+        while (stage.load() != 2) {
+            std::this_thread::yield();
+        }
+        
+        // Новий розподільник у тому ж потоці не плутає свій кеш із кешем знищеного
+        // A new allocator in the same thread does not confuse its cache with the destroyed one's
+        // Новий розподільник у тому ж потоці не плутає свій кеш із кешем знищеного
+        SlabAllocator second(1024 * 1024, 1024 * 1024);
+        void* other = second.allocate(48);
+        assert(other != nullptr && second.contains(other));
+        second.deallocate(other);
+    });
+    while (stage.load() != 1) {
+        std::this_thread::yield();
+    }
+    allocator.reset();
+    stage.store(2);
+    worker.join();
+    
+    std::cout << "Тестування знищення SlabAllocator до завершення потоку пройдено успішно!" << std::endl;
+}
+
+void testArenaAllocation() {
+    std::cout << "Тестування арени..." << std::endl;
+    
+    Arena arena(4096);
+    assert(arena.getBlockCount() == 0);
+    
+    // Послідовні виділення йдуть підряд з урахуванням вирівнювання
+    // Consecutive allocations are contiguous apart from alignment
+    // Послідовні виділення йдуть підряд з урахуванням вирівнювання
+    char* first = static_cast<char*>(arena.allocate(10, 1));
+    char* second = static_cast<char*>(arena.allocate(10, 1));
+    assert(second == first + 10);
+    void* aligned = arena.allocate(24, 64);
+    assert(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+    assert(arena.getBlockCount() == 1 && arena.getUsedBytes() == 44);
+    
+    // Запит, більший за блок, отримує власний блок
+    // A request larger than a block gets its own block
+    // Запит, більший за блок, отримує власний блок
+    void* large = arena.allocate(10000);
+    memset(large, 0xAB, 10000);
+    assert(arena.getBlockCount() == 2 && arena.getCapacity() >= 4096 + 10000);
+    
+    // Після reset() ті самі блоки використовуються повторно
+    // After reset() the same blocks are reused
+    // Після reset() ті самі блоки використовуються повторно
+    size_t capacity = arena.getCapacity();
+    for (int cycle = 0; cycle < 10; ++cycle) {
+        arena.reset();
+        assert(arena.getUsedBytes() == 0);
+        assert(arena.allocate(10, 1) == first);
+        for (int i = 0; i < 50; ++i) {
+            arena.allocate(64);
+        }
+        arena.allocate(10000);
+        assert(arena.getCapacity() == capacity && arena.getBlockCount() == 2);
+    }
+    
+    arena.release();
+    assert(arena.getBlockCount() == 0 && arena.getCapacity() == 0);
+    
+    // Контейнери std::pmr розміщують дані в арені
+    // std::pmr containers place their data in the arena
+    // Контейнери std::pmr розміщують дані в арені
+    ArenaResource resource(arena);
+    {
+        std::pmr::vector<int> values(&resource);
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(i);
+        }
+        assert(values[999] == 999);
+        assert(arena.getUsedBytes() >= 1000 * sizeof(int));
+    }
+    assert(resource.is_equal(resource));
+    ArenaResource other(arena);
+    assert(!resource.is_equal(other));
+    arena.reset();
+    assert(arena.getUsedBytes() == 0);
+    
+    std::cout << "Тестування арени пройдено успішно!" << std::endl;
+}
+
+void testGcTracing() {
+    std::cout << "Тестування трасування графа об'єктів..." << std::endl;
+    
+    GarbageCollector gc;
+    auto make = [&gc]() {
+        void* address = malloc(64);
+        gc.registerObject(address, 64);
+        return address;
+    };
+    
+    // root -> a -> b; c - без посилань; d <-> e - недосяжний цикл
+    // root -> a -> b; c has no references; d <-> e is an unreachable cycle
+    // root -> a -> b; c - без посилань; d <-> e - недосяжний цикл
+    void* root = make();
+    void* a = make();
+    void* b = make();
+    void* c = make();
+    void* d = make();
+    void* e = make();
+    gc.addObjectReference(root, a);
+    gc.addObjectReference(a, b);
+    gc.addObjectReference(d, e);
+    gc.addObjectReference(e, d);
+    for (void* address : {a, b, c, d, e}) {
+        gc.removeReference(address);
+    }
+    
+    gc.collect();
+    assert(gc.getCollectedObjects() == 3);
+    assert(gc.getTotalMemoryFreed() == 3 * 64);
+    assert(gc.getTotalObjects() == 3);
+    
+    // Після видалення посилання root -> a ланцюжок a -> b стає сміттям
+    // After the root -> a reference is removed the a -> b chain becomes garbage
+    // Після видалення посилання root -> a ланцюжок a -> b стає сміттям
+    gc.removeObjectReference(root, a);
+    gc.collect();
+    assert(gc.getCollectedObjects() == 5 && gc.getTotalObjects() == 1);
+    
+    // Позначений поза циклом об'єкт переживає наступний збір
+    // An object marked outside a cycle survives the next collection
+    // Позначений поза циклом об'єкт переживає наступний збір
+    void* marked = make();
+    gc.removeReference(marked);
+    gc.markObject(marked);
+    gc.collect();
+    assert(gc.getTotalObjects() == 2);
+    gc.collect();
+    assert(gc.getTotalObjects() == 1);
+    
+    gc.removeReference(root);
+    gc.collect();
+    assert(gc.getTotalObjects() == 0 && gc.getCollectedObjects() == 7);
+    
+    std::cout << "Тестування трасування графа об'єктів пройдено успішно!" << std::endl;
+}
+
+void testGcIncrementalBarrier() {
+    std::cout << "Тестування інкрементального збору з бар'єром запису..." << std::endl;
+    
+    GarbageCollector gc;
+    gc.setPauseBudget(std::chrono::microseconds(0));
+    auto make = [&gc]() {
+        void* address = malloc(16);
+        gc.registerObject(address, 16);
+        return address;
+    };
+    
+    // Довгий ланцюжок від кореня: позначення займає багато квантів
+    // A long chain from a root: marking takes many slices
+    // Довгий ланцюжок від кореня: позначення займає багато квантів
+    const size_t chainLength = 4096;
+    void* otherRoot = make();
+    void* head = make();
+    void* previous = head;
+    for (size_t i = 1; i < chainLength; ++i) {
+        void* next = make();
+        gc.addObjectReference(previous, next);
+        gc.removeReference(next);
+        previous = next;
+    }
+    void* tail = previous;
+    
+    // Об'єкт, досяжний лише через holder; holder сам не корінь, на нього посилається хвіст ланцюжка
+    // An object reachable only through holder; holder is not a root, the chain's tail points to it
+    // Об'єкт, досяжний лише через holder; holder сам не корінь, на нього посилається хвіст ланцюжка
+    void* holder = make();
+    void* moved = make();
+    gc.addObjectReference(tail, holder);
+    gc.addObjectReference(holder, moved);
+    gc.removeReference(holder);
+    gc.removeReference(moved);
+    
+    assert(!gc.collectStep());
+    
+    // Перший квант уже просканував otherRoot (він перший серед коренів), але не дійшов до holder.
+    // Посилання переноситься з ще не просканованого holder у вже позначений корінь:
+    // без бар'єру запису moved залишився б білим і був би зібраний
+    // The first slice has already scanned otherRoot (it is first among the roots) but has not reached holder.
+    // The reference moves from the not yet scanned holder into an already marked root:
+    // without the write barrier moved would stay white and be collected
+    // Перший квант уже просканував otherRoot (він перший серед коренів), але не дійшов до holder.
+    // Посилання переноситься з ще не просканованого holder у вже позначений корінь:
+    // без бар'єру запису moved залишився б білим і був би зібраний
+    gc.addObjectReference(otherRoot, moved);
+    gc.removeObjectReference(holder, moved);
+    
+    // Об'єкт, створений під час циклу, теж переживає цикл
+    // An object created during the cycle survives it too
+    // Об'єкт, створений під час циклу, теж переживає цикл
+    void* created = make();
+    gc.addObjectReference(otherRoot, created);
+    gc.removeReference(created);
+    
+    size_t steps = 1;
+    while (!gc.collectStep()) {
+        steps++;
+    }
+    assert(steps > 2);
+    assert(gc.getCollectedObjects() == 0);
+    assert(gc.getTotalObjects() == chainLength + 4);
+    
+    // Без кореня head весь ланцюжок разом з holder зібраний наступним циклом
+    // Without the head root the whole chain together with holder is collected by the next cycle
+    // Без кореня head весь ланцюжок разом з holder зібраний наступним циклом
+    gc.removeReference(head);
+    gc.collect();
+    assert(gc.getCollectedObjects() == chainLength + 1);
+    assert(gc.getTotalObjects() == 3);
+    
+    GCPauseStatistics pauses = gc.getPauseStatistics();
+    assert(pauses.slices > steps && pauses.cycles == 2);
+    assert(pauses.p50Nanos <= pauses.p99Nanos && pauses.p99Nanos <= pauses.maxNanos);
+    
+    gc.removeReference(otherRoot);
+    gc.collect();
+    assert(gc.getTotalObjects() == 0);
+    
+    std::cout << "Тестування інкрементального збору з бар'єром запису пройдено успішно!" << std::endl;
+}
+
+void testGcConcurrentMutator() {
+    std::cout << "Тестування збору під час роботи програми..." << std::endl;
+    
+    GarbageCollector gc;
+    gc.setPauseBudget(std::chrono::microseconds(50));
+    gc.startAutoCollection(std::chrono::milliseconds(1));
+    
+    // Програма постійно перебудовує список від кореня; зібрано може бути лише відчеплене
+    // The program keeps rebuilding a list from a root; only detached nodes may be collected
+    // Програма постійно перебудовує список від кореня; зібрано може бути лише відчеплене
+    void* root = malloc(16);
+    gc.registerObject(root, 16);
+    std::vector<void*> live;
+    uint32_t state = 7;
+    for (size_t i = 0; i < 20000; ++i) {
+        state = state * 1664525u + 1013904223u;
+        if (live.size() < 64 || (state >> 16) % 2 == 0) {
+            void* node = malloc(16);
+            gc.registerObject(node, 16);
+            gc.addObjectReference(live.empty() ? root : live.back(), node);
+            gc.removeReference(node);
+            live.push_back(node);
+        } else {
+            size_t cut = (state >> 8) % live.size();
+            gc.removeObjectReference(cut == 0 ? root : live[cut - 1], live[cut]);
+            live.resize(cut);
+        }
+    }
+    gc.stopAutoCollection();
+    gc.collect();
+    assert(gc.getTotalObjects() == live.size() + 1);
+    for (void* node : live) {
+        gc.markObject(node);
+    }
+    
+    gc.removeReference(root);
+    gc.collect();
+    gc.collect();
+    assert(gc.getTotalObjects() == 0);
+    
+    std::cout << "Тестування збору під час роботи програми пройдено успішно!" << std::endl;
+}
+
+void testGcReturnsPoolMemory() {
+    std::cout << "Тестування повернення зібраної пам'яті в пул..." << std::endl;
+    
+    MemoryCore memoryCore;
+    void* parent = memoryCore.allocate(128);
+    void* child = memoryCore.allocate(2048);
+    memoryCore.registerForGC(parent, 128);
+    memoryCore.registerForGC(child, 2048);
+    memoryCore.addObjectReference(parent, child);
+    memoryCore.removeReference(child);
+    memoryCore.setGCPauseBudget(std::chrono::microseconds(100));
+    
+    memoryCore.collectGarbage();
+    assert(memoryCore.getGCCollectedObjects() == 0);
+    assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::MEDIUM) > 0);
+    
+    // Зібрані об'єкти повертаються в пули, а не у free()
+    // Collected objects go back to the pools rather than to free()
+    // Зібрані об'єкти повертаються в пули, а не у free()
+    memoryCore.removeReference(parent);
+    memoryCore.collectGarbage();
+    assert(memoryCore.getGCCollectedObjects() == 2);
+    assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::SMALL) == 0);
+    assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::MEDIUM) == 0);
+    assert(memoryCore.getGCPauseStatistics().cycles == 2);
+    
+    std::cout << "Тестування повернення зібраної пам'яті в пул пройдено успішно!" << std::endl;
+}
+
+// Кількість сторінок області, що зараз займають фізичну пам'ять
+// Number of pages of a range that currently take physical memory
+// Кількість сторінок області, що зараз займають фізичну пам'ять
+static size_t residentPages(void* begin, size_t size) {
+#ifndef _WIN32
+    size_t pageSize = VirtualRegion::getSystemPageSize();
+    std::vector<unsigned char> residency((size + pageSize - 1) / pageSize);
+    if (mincore(begin, size, residency.data()) != 0) {
+        return 0;
+    }
+    size_t resident = 0;
+    for (unsigned char page : residency) {
+        resident += page & 1;
+    }
+    return resident;
+#else
+    (void)begin;
+    (void)size;
+    return 0;
+#endif
+}
+
+void testVirtualRegion() {
+    std::cout << "Тестування області віртуальної пам'яті..." << std::endl;
+    
+    size_t pageSize = VirtualRegion::getSystemPageSize();
+    VirtualRegion region(8 * 1024 * 1024, HugePageMode::NONE);
+    assert(region.getHugePageMode() == HugePageMode::NONE);
+    assert(region.getPageSize() == pageSize && region.getSize() == 8 * 1024 * 1024);
+    
+    // Сторінки з'являються лише після звернення і зникають після decommit()
+    // Pages appear only after a touch and go away after decommit()
+    // Сторінки з'являються лише після звернення і зникають після decommit()
+    char* base = region.getBase();
+    assert(residentPages(base, region.getSize()) == 0);
+    memset(base, 0x5A, 64 * pageSize);
+#ifndef _WIN32
+    assert(residentPages(base, region.getSize()) == 64);
+#endif
+    
+    // Межі вирівнюються всередину: неповні сторінки на краях залишаються
+    // The bounds are aligned inwards: partial pages at the edges stay
+    // Межі вирівнюються всередину: неповні сторінки на краях залишаються
+    assert(region.decommit(base + 1, 2 * pageSize - 2) == 0);
+    assert(region.decommit(base + pageSize / 2, 63 * pageSize) == 62 * pageSize);
+    assert(region.getDecommittedBytes() == 62 * pageSize);
+#ifndef _WIN32
+    assert(residentPages(base, region.getSize()) == 2);
+    assert(base[0] == 0x5A && base[pageSize] == 0 && base[63 * pageSize] == 0x5A);
+#endif
+    
+    // Запит явних великих сторінок без налаштованого hugetlbfs понижується, а не завершується помилкою
+    // A request for explicit huge pages without configured hugetlbfs is downgraded rather than failing
+    // Запит явних великих сторінок без налаштованого hugetlbfs понижується, а не завершується помилкою
+    VirtualRegion huge(16 * 1024 * 1024, HugePageMode::EXPLICIT);
+    assert(huge.getSize() % VirtualRegion::HUGE_PAGE_SIZE == 0);
+    if (huge.getHugePageMode() == HugePageMode::EXPLICIT) {
+        assert(huge.getPageSize() == VirtualRegion::HUGE_PAGE_SIZE);
+    } else {
+        assert(huge.getPageSize() == pageSize);
+        assert(reinterpret_cast<uintptr_t>(huge.getBase()) % VirtualRegion::HUGE_PAGE_SIZE == 0);
+    }
+    huge.getBase()[huge.getSize() - 1] = 1;
+    
+    std::cout << "Тестування області віртуальної пам'яті пройдено успішно!" << std::endl;
+}
+
+void testLargeObjectRelease() {
+    std::cout << "Тестування повернення сторінок великих об'єктів..." << std::endl;
+    
+    for (MemoryCore::AllocatorMode mode : {MemoryCore::AllocatorMode::POOLS, MemoryCore::AllocatorMode::SLAB}) {
+        MemoryCore memoryCore(mode);
+        assert(memoryCore.getPoolTotalMemory(MemoryCore::PoolType::LARGE) == 256 * 1024 * 1024);
+        
+        // Звільнений об'єкт повертає свої сторінки системі
+        // A freed object returns its pages to the system
+        // Звільнений об'єкт повертає свої сторінки системі
+        const size_t size = 1024 * 1024;
+        char* first = static_cast<char*>(memoryCore.allocate(size));
+        memset(first, 1, size);
+        memoryCore.deallocate(first);
+        assert(memoryCore.getLargeObjectDecommittedBytes() >= size - 2 * VirtualRegion::getSystemPageSize());
+#ifndef _WIN32
+        assert(residentPages(first + 64, size - 128) <= 2);
+#endif
+        
+        // Сусідні блоки: звільнення одного не чіпає даних іншого
+        // Neighbouring blocks: freeing one does not touch the other's data
+        // Сусідні блоки: звільнення одного не чіпає даних іншого
+        std::vector<char*> blocks;
+        for (size_t i = 0; i < 16; ++i) {
+            blocks.push_back(static_cast<char*>(memoryCore.allocate(5000 + i * 1000)));
+            memset(blocks.back(), static_cast<int>(i + 1), 5000 + i * 1000);
+        }
+        for (size_t i = 0; i < blocks.size(); i += 2) {
+            memoryCore.deallocate(blocks[i]);
+        }
+        for (size_t i = 1; i < blocks.size(); i += 2) {
+            for (size_t j = 0; j < 5000 + i * 1000; ++j) {
+                assert(blocks[i][j] == static_cast<char>(i + 1));
+            }
+            memoryCore.deallocate(blocks[i]);
+        }
+        assert(memoryCore.getPoolUsedMemory(MemoryCore::PoolType::LARGE) == 0);
+        assert(memoryCore.getPoolFragmentation(MemoryCore::PoolType::LARGE).freeBlocks == 1);
+    }
+    
+    std::cout << "Тестування повернення сторінок великих об'єктів пройдено успішно!" << std::endl;
+}
+
 int main() {
     std::cout << "=== Запуск тестів управління пам'яттю ===" << std::endl;
     
@@ -146,6 +866,20 @@ int main() {
         testGarbageCollection();
         testMemoryStatistics();
         testPoolTypes();
+        testTlsfCoalescing();
+        testTlsfFragmentationReport();
+        testSlabSizeClasses();
+        testSlabAllocatorMode();
+        testSlabCrossThread();
+        testSlabExhaustion();
+        testSlabDestroyedBeforeThread();
+        testArenaAllocation();
+        testGcTracing();
+        testGcIncrementalBarrier();
+        testGcConcurrentMutator();
+        testGcReturnsPoolMemory();
+        testVirtualRegion();
+        testLargeObjectRelease();
         
         std::cout << "\n=== Усі тести управління пам'яттю пройдено успішно! ===" << std::endl;
         return 0;
@@ -0,0 +1,253 @@
+#include "../threadpool/ParallelAlgorithms.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <vector>
+#include <numeric>
+#include <stdexcept>
+#include <cstdint>
+#include <string>
+
+// Тести паралельних алгоритмів на пулі потоків
+// Parallel algorithms on the thread pool tests
+// Тесты параллельных алгоритмов на пуле потоков
+
+using namespace NeuroSync;
+
+void testParallelFor() {
+    std::cout << "Testing parallelFor..." << std::endl;
+
+    const ThreadPoolMode modes[] = {ThreadPoolMode::SHARED_QUEUE, ThreadPoolMode::WORK_STEALING};
+    for (ThreadPoolMode mode : modes) {
+        ThreadPool pool(4, mode);
+
+        // Кожен індекс відвідується рівно один раз - з автоматичною та заданою порцією
+        // Every index is visited exactly once - with automatic and given grain
+        // Каждый индекс посещается ровно один раз - с автоматической и заданной порцией
+        const size_t grains[] = {AUTO_GRAIN, 1, 7, 1000, 100000};
+        for (size_t grain : grains) {
+            std::vector<std::atomic<int>> visits(10000);
+            for (auto& visit : visits) {
+                visit = 0;
+            }
+            parallelFor(pool, size_t(0), visits.size(), [&visits](size_t i) { visits[i]++; }, grain);
+            for (auto& visit : visits) {
+                assert(visit.load() == 1);
+            }
+        }
+
+        // Порції покривають діапазон із ненульовим початком без перекриттів
+        // Chunks cover a range with a non-zero start without overlaps
+        // Порции покрывают диапазон с ненулевым началом без перекрытий
+        std::atomic<long long> covered(0);
+        parallelForRange(pool, -500, 1500, [&covered](int begin, int end) {
+            assert(-500 <= begin && begin < end && end <= 1500);
+            covered += end - begin;
+        }, 33);
+        assert(covered.load() == 2000);
+
+        // Порожній діапазон не викликає тіло
+        // An empty range does not call the body
+        // Пустой диапазон не вызывает тело
+        bool called = false;
+        parallelFor(pool, 10, 10, [&called](int) { called = true; });
+        parallelFor(pool, 10, 5, [&called](int) { called = true; });
+        assert(!called);
+    }
+
+    std::cout << "parallelFor test passed!" << std::endl;
+}
+
+void testParallelReduce() {
+    std::cout << "Testing parallelReduce..." << std::endl;
+
+    ThreadPool pool(4, ThreadPoolMode::WORK_STEALING);
+
+    std::vector<uint64_t> values(100000);
+    std::iota(values.begin(), values.end(), uint64_t(1));
+    uint64_t sum = parallelReduce(pool, size_t(0), values.size(), uint64_t(0),
+        [&values](size_t begin, size_t end, uint64_t init) {
+            return std::accumulate(values.begin() + begin, values.begin() + end, init);
+        },
+        [](uint64_t a, uint64_t b) { return a + b; });
+    assert(sum == uint64_t(100000) * 100001 / 2);
+
+    // Результати порцій об'єднуються в порядку порцій: при тій самій порції сума double відтворювана
+    // Chunk results are merged in chunk order: with the same grain the double sum is reproducible
+    // Результаты порций объединяются в порядке порций: при той же порции сумма double воспроизводима
+    std::vector<double> samples(50000);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = 1.0 / static_cast<double>(i + 1) * ((i % 3 == 0) ? -1e8 : 1.0);
+    }
+    auto reduceSamples = [&pool, &samples]() {
+        return parallelReduce(pool, size_t(0), samples.size(), 0.0,
+            [&samples](size_t begin, size_t end, double init) {
+                for (size_t i = begin; i < end; ++i) {
+                    init += samples[i];
+                }
+                return init;
+            },
+            [](double a, double b) { return a + b; }, 64);
+    };
+    double first = reduceSamples();
+    for (int run = 0; run < 20; ++run) {
+        assert(reduceSamples() == first);
+    }
+
+    // Некомутативна згортка: рядок збирається зліва направо
+    // Non-commutative reduction: the string is assembled left to right
+    // Некоммутативная свертка: строка собирается слева направо
+    std::string letters = parallelReduce(pool, 0, 26, std::string(),
+        [](int begin, int end, std::string init) {
+            for (int i = begin; i < end; ++i) {
+                init.push_back(static_cast<char>('a' + i));
+            }
+            return init;
+        },
+        [](std::string a, const std::string& b) { return a + b; }, 3);
+    assert(letters == "abcdefghijklmnopqrstuvwxyz");
+
+    // bool-згортка з порцією 1: кожна порція пише свій результат з іншого потоку, і жоден не губиться
+    // A bool reduction with grain 1: every chunk writes its result from another thread, and none is lost
+    // bool-свертка с порцией 1: каждая порция пишет свой результат из другого потока, и ни один не теряется
+    for (int marked = 0; marked < 64; ++marked) {
+        bool found = parallelReduce(pool, 0, 64, false,
+            [marked](int begin, int end, bool init) { return init || (begin <= marked && marked < end); },
+            [](bool a, bool b) { return a || b; }, 1);
+        assert(found);
+    }
+
+    // Порожній діапазон повертає нейтральний елемент
+    // An empty range returns the identity
+    // Пустой диапазон возвращает нейтральный элемент
+    int empty = parallelReduce(pool, 0, 0, 42,
+        [](int, int, int init) { return init + 1; }, [](int a, int b) { return a + b; });
+    assert(empty == 42);
+
+    std::cout << "parallelReduce test passed!" << std::endl;
+}
+
+void testParallelTransform() {
+    std::cout << "Testing parallelTransform..." << std::endl;
+
+    ThreadPool pool(3);
+
+    std::vector<int> input(12345);
+    std::iota(input.begin(), input.end(), 0);
+    std::vector<long long> output(input.size(), -1);
+    auto end = parallelTransform(pool, input.begin(), input.end(), output.begin(),
+                                 [](int value) { return static_cast<long long>(value) * value; });
+    assert(end == output.end());
+    for (size_t i = 0; i < input.size(); ++i) {
+        assert(output[i] == static_cast<long long>(i) * static_cast<long long>(i));
+    }
+
+    // Перетворення на місці
+    // In-place transform
+    // Преобразование на месте
+    parallelTransform(pool, input.begin(), input.end(), input.begin(), [](int value) { return -value; }, 100);
+    for (size_t i = 0; i < input.size(); ++i) {
+        assert(input[i] == -static_cast<int>(i));
+    }
+
+    std::cout << "parallelTransform test passed!" << std::endl;
+}
+
+void testNestedParallelism() {
+    std::cout << "Testing nested parallelism..." << std::endl;
+
+    // Вкладені цикли з робітників не чекають на завдання-помічників, що стоять у черзі,
+    // тому не блокуються навіть на пулі з одним потоком
+    // Nested loops from workers do not wait for helper tasks sitting in the queue,
+    // so they do not deadlock even on a single-thread pool
+    // Вложенные циклы из рабочих не ждут задачи-помощники, стоящие в очереди,
+    // поэтому не блокируются даже на пуле с одним потоком
+    const ThreadPoolMode modes[] = {ThreadPoolMode::SHARED_QUEUE, ThreadPoolMode::WORK_STEALING};
+    const size_t threadCounts[] = {1, 2, 4};
+    for (ThreadPoolMode mode : modes) {
+        for (size_t threads : threadCounts) {
+            ThreadPool pool(threads, mode);
+            std::atomic<int> cells(0);
+            parallelFor(pool, 0, 32, [&pool, &cells](int) {
+                parallelFor(pool, 0, 32, [&pool, &cells](int) {
+                    parallelFor(pool, 0, 8, [&cells](int) { cells++; }, 1);
+                }, 1);
+            }, 1);
+            assert(cells.load() == 32 * 32 * 8);
+
+            // Цикл із завдання пулу
+            // A loop from a pool task
+            // Цикл из задачи пула
+            auto future = pool.enqueue([&pool]() {
+                return parallelReduce(pool, 0, 1000, 0,
+                    [](int begin, int end, int init) { return init + (end - begin); },
+                    [](int a, int b) { return a + b; }, 10);
+            });
+            assert(future.get() == 1000);
+        }
+    }
+
+    std::cout << "Nested parallelism test passed!" << std::endl;
+}
+
+void testExceptions() {
+    std::cout << "Testing exception propagation..." << std::endl;
+
+    ThreadPool pool(4, ThreadPoolMode::WORK_STEALING);
+
+    // Перший виняток передається викликачу, решта порцій пропускається
+    // The first exception reaches the caller, the remaining chunks are skipped
+    // Первое исключение передается вызывающему, остальные порции пропускаются
+    std::atomic<int> executed(0);
+    bool thrown = false;
+    try {
+        parallelFor(pool, 0, 100000, [&executed](int i) {
+            executed++;
+            if (i == 10) {
+                throw std::runtime_error("chunk failure");
+            }
+        }, 10);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(executed.load() < 100000);
+
+    // Після винятку пул залишається робочим
+    // The pool keeps working after an exception
+    // После исключения пул остается рабочим
+    std::atomic<int> counter(0);
+    parallelFor(pool, 0, 1000, [&counter](int) { counter++; });
+    assert(counter.load() == 1000);
+
+    std::cout << "Exception propagation test passed!" << std::endl;
+}
+
+void testStoppedPool() {
+    std::cout << "Testing stopped pool fallback..." << std::endl;
+
+    // Зупинений пул відхиляє помічників, і цикл виконується у викликачі
+    // A stopped pool rejects helpers, and the loop runs on the caller
+    // Остановленный пул отклоняет помощников, и цикл выполняется в вызывающем
+    ThreadPool pool(2);
+    pool.stop();
+    std::vector<int> values(1000, 0);
+    parallelFor(pool, size_t(0), values.size(), [&values](size_t i) { values[i] = 1; }, 10);
+    assert(std::accumulate(values.begin(), values.end(), 0) == 1000);
+
+    std::cout << "Stopped pool fallback test passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Running Parallel Algorithms Tests ===" << std::endl;
+
+    testParallelFor();
+    testParallelReduce();
+    testParallelTransform();
+    testNestedParallelism();
+    testExceptions();
+    testStoppedPool();
+
+    std::cout << "=== All Parallel Algorithms Tests Passed ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,435 @@
+#include "../synapse/priority/PriorityMessageQueue.h"
+#include "../synapse/priority/LockFreePriorityMessageQueue.h"
+#include "../synapse/SynapseBus.h"
+#include "../memory/Arena.h"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <mutex>
+
+// Тести для черг повідомлень SynapseBus
+// Tests for SynapseBus message queues
+// Тесты для очередей сообщений SynapseBus
+
+using namespace NeuroSync::Synapse::Priority;
+
+static PriorityMessage makeMessage(int senderId, MessagePriority priority) {
+    PriorityMessage message{};
+    message.senderId = senderId;
+    message.receiverId = senderId + 1;
+    message.priority = priority;
+    message.weight = 1;
+    message.dataSize = 0;
+    return message;
+}
+
+void testPriorityOrder(MessageQueue& queue) {
+    std::cout << "Testing priority order..." << std::endl;
+
+    assert(queue.initialize());
+    assert(queue.enqueue(makeMessage(1, MessagePriority::LOW)));
+    assert(queue.enqueue(makeMessage(2, MessagePriority::CRITICAL)));
+    assert(queue.enqueue(makeMessage(3, MessagePriority::NORMAL)));
+    assert(queue.enqueue(makeMessage(4, MessagePriority::HIGH)));
+    assert(queue.size() == 4);
+
+    PriorityMessage message;
+    assert(queue.dequeue(message) && message.senderId == 2);
+    assert(queue.dequeue(message) && message.senderId == 4);
+    assert(queue.dequeue(message) && message.senderId == 3);
+    assert(queue.dequeue(message) && message.senderId == 1);
+    assert(queue.isEmpty());
+
+    std::cout << "Priority order test passed!" << std::endl;
+}
+
+void testBatchOperations(MessageQueue& queue) {
+    std::cout << "Testing batch enqueue/dequeue..." << std::endl;
+
+    queue.setMaxSize(8);
+    assert(queue.initialize());
+    queue.clear();
+
+    PriorityMessage batch[4] = {
+        makeMessage(1, MessagePriority::LOW),
+        makeMessage(2, MessagePriority::CRITICAL),
+        makeMessage(3, MessagePriority::NORMAL),
+        makeMessage(4, MessagePriority::HIGH)
+    };
+    assert(queue.enqueueBatch(batch, 4) == 4);
+    assert(queue.size() == 4);
+
+    // Пакет вилучається у порядку пріоритету
+    // The batch is dequeued in priority order
+    // Пакет извлекается в порядке приоритета
+    PriorityMessage out[3];
+    assert(queue.dequeueBatch(out, 3) == 3);
+    assert(out[0].senderId == 2 && out[1].senderId == 4 && out[2].senderId == 3);
+    assert(queue.dequeueBatch(out, 3) == 1 && out[0].senderId == 1);
+    assert(queue.isEmpty());
+
+    // Порожня черга: dequeueBatch повертає 0 після таймауту
+    // Empty queue: dequeueBatch returns 0 after the timeout
+    // Пустая очередь: dequeueBatch возвращает 0 после таймаута
+    assert(queue.dequeueBatch(out, 3) == 0);
+
+    std::cout << "Batch enqueue/dequeue test passed!" << std::endl;
+}
+
+void testLockFreeOverflow() {
+    std::cout << "Testing lock-free queue overflow..." << std::endl;
+
+    LockFreePriorityMessageQueue queue;
+    queue.setMaxSize(8);
+    assert(queue.initialize());
+
+    size_t accepted = 0;
+    for (int i = 0; i < 20; ++i) {
+        if (queue.enqueue(makeMessage(i, MessagePriority::NORMAL))) {
+            accepted++;
+        }
+    }
+    assert(accepted == 8);
+
+    MessageQueue::QueueStatistics stats = queue.getStatistics();
+    assert(stats.totalMessages == 20);
+    assert(stats.droppedMessages == 12);
+    assert(stats.normalPriorityMessages == 20);
+
+    // Ємність живої черги не змінюється
+    // The capacity of a live queue does not change
+    // Емкость живой очереди не меняется
+    queue.setMaxSize(64);
+    assert(queue.getMaxSize() == 8);
+    assert(!queue.enqueue(makeMessage(20, MessagePriority::NORMAL)));
+
+    std::cout << "Lock-free queue overflow test passed!" << std::endl;
+}
+
+void testLockFreeConcurrent() {
+    std::cout << "Testing lock-free queue with concurrent producers and consumers..." << std::endl;
+
+    LockFreePriorityMessageQueue queue;
+    queue.setMaxSize(1024);
+    assert(queue.initialize());
+
+    const int producers = 4;
+    const int messagesPerProducer = 10000;
+    std::atomic<int> received(0);
+    std::atomic<long long> senderSum(0);
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p]() {
+            for (int i = 0; i < messagesPerProducer; ++i) {
+                while (!queue.enqueue(makeMessage(p, static_cast<MessagePriority>(i % 4)))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < producers; ++c) {
+        threads.emplace_back([&queue, &received, &senderSum]() {
+            PriorityMessage message;
+            while (received.load() < producers * messagesPerProducer) {
+                if (queue.tryDequeue(message)) {
+                    senderSum.fetch_add(message.senderId);
+                    received.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    assert(received.load() == producers * messagesPerProducer);
+    assert(senderSum.load() == static_cast<long long>(messagesPerProducer) * (0 + 1 + 2 + 3));
+
+    // Лічильники всіх потоків зводяться при читанні
+    // Counters of all threads are merged on read
+    // Счетчики всех потоков сводятся при чтении
+    MessageQueue::QueueStatistics stats = queue.getStatistics();
+    assert(stats.totalMessages - stats.droppedMessages == static_cast<size_t>(producers * messagesPerProducer));
+    assert(queue.isEmpty());
+
+    std::cout << "Lock-free concurrent test passed!" << std::endl;
+}
+
+void testSynapseBusQueueSelection() {
+    std::cout << "Testing SynapseBus queue selection..." << std::endl;
+
+    NeuroSync::Synapse::SynapseBus bus;
+    assert(bus.initialize(MessageQueueType::LOCK_FREE));
+    assert(bus.getMessageQueueType() == MessageQueueType::LOCK_FREE);
+
+    int payload = 42;
+    assert(bus.sendMessage(1, 2, &payload, sizeof(payload), MessagePriority::HIGH, 1));
+    assert(bus.getMessageQueueSize() == 1);
+
+    int senderId, receiverId, weight;
+    void* data = nullptr;
+    size_t dataSize = 0;
+    MessagePriority priority;
+    assert(bus.receiveMessage(senderId, receiverId, data, dataSize, priority, weight));
+    assert(senderId == 1 && receiverId == 2 && priority == MessagePriority::HIGH);
+    assert(dataSize == sizeof(payload) && *static_cast<int*>(data) == 42);
+    delete[] static_cast<char*>(data);
+
+    std::cout << "SynapseBus queue selection test passed!" << std::endl;
+}
+
+void testSynapseBusBatchProcessing() {
+    std::cout << "Testing SynapseBus batch processing loop..." << std::endl;
+
+    for (MessageQueueType queueType : {MessageQueueType::PRIORITY_HEAP, MessageQueueType::LOCK_FREE}) {
+        NeuroSync::Synapse::SynapseBus bus;
+        assert(bus.initialize(queueType, 4));
+        assert(bus.getProcessingBatchSize() == 4);
+
+        const int messageCount = 100;
+        std::atomic<int> processed(0);
+        bus.setMessageCallback([&processed](const PriorityMessage&) {
+            processed.fetch_add(1);
+        });
+        bus.start();
+
+        int payload = 7;
+        for (int i = 0; i < messageCount; ++i) {
+            assert(bus.sendMessage(i, i + 1, &payload, sizeof(payload)));
+        }
+
+        // Цикл обробки блокується на черзі і прокидається без опитування
+        // The processing loop blocks on the queue and wakes without polling
+        // Цикл обработки блокируется на очереди и просыпается без опроса
+        for (int attempt = 0; attempt < 200 && processed.load() < messageCount; ++attempt) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        bus.stop();
+        assert(processed.load() == messageCount);
+    }
+
+    std::cout << "SynapseBus batch processing test passed!" << std::endl;
+}
+
+void testSynapseBusShardedWorkers() {
+    std::cout << "Testing SynapseBus receiver-sharded workers..." << std::endl;
+
+    NeuroSync::Synapse::SynapseBus bus;
+    assert(bus.initialize(MessageQueueType::LOCK_FREE, 8, 4));
+    assert(bus.getWorkerCount() == 4);
+
+    // Порядок перевіряється на lock-free черзі: у межах рівня вона FIFO
+    // Order is checked on the lock-free queue: it is FIFO within a level
+    // Порядок проверяется на lock-free очереди: в пределах уровня она FIFO
+    const int receivers = 16;
+    const int messagesPerReceiver = 500;
+    std::mutex orderMutex;
+    std::vector<int> lastSequence(receivers, -1);
+    std::atomic<int> processed(0);
+    std::atomic<bool> ordered(true);
+    bus.setMessageCallback([&](const PriorityMessage& message) {
+        int sequence = *reinterpret_cast<const int*>(message.payload.data());
+        std::lock_guard<std::mutex> lock(orderMutex);
+        if (sequence != lastSequence[message.receiverId] + 1) {
+            ordered = false;
+        }
+        lastSequence[message.receiverId] = sequence;
+        processed.fetch_add(1);
+    });
+    bus.start();
+
+    for (int sequence = 0; sequence < messagesPerReceiver; ++sequence) {
+        for (int receiver = 0; receiver < receivers; ++receiver) {
+            while (!bus.sendMessage(0, receiver, &sequence, sizeof(sequence))) {
+                std::this_thread::yield();
+            }
+        }
+    }
+    for (int attempt = 0; attempt < 500 && processed.load() < receivers * messagesPerReceiver; ++attempt) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    bus.stop();
+
+    assert(processed.load() == receivers * messagesPerReceiver);
+    assert(ordered.load());
+
+    // Статистика потоків зводиться в getStatistics()
+    // Worker statistics are rolled up in getStatistics()
+    // Статистика потоков сводится в getStatistics()
+    NeuroSync::Synapse::SynapseBus::BusStatistics stats = bus.getStatistics();
+    assert(stats.workerStats.size() == 4);
+    size_t totalProcessed = 0;
+    for (const auto& workerStats : stats.workerStats) {
+        totalProcessed += workerStats.processedMessages;
+        assert(workerStats.stolenMessages <= workerStats.processedMessages);
+    }
+    assert(totalProcessed == static_cast<size_t>(receivers * messagesPerReceiver));
+    assert(stats.messageStats.totalMessages - stats.messageStats.droppedMessages == totalProcessed);
+
+    std::cout << "SynapseBus sharded workers test passed!" << std::endl;
+}
+
+void testSynapseBusIdleWorkerSteals() {
+    std::cout << "Testing SynapseBus idle worker picks up another shard at once..." << std::endl;
+
+    NeuroSync::Synapse::SynapseBus bus;
+    assert(bus.initialize(MessageQueueType::LOCK_FREE, 1, 2));
+
+    // Повідомлення для отримувача 1 тримає свій потік 500 мс; повідомлення для отримувача 0,
+    // надіслане в цей час, має обробити інший потік, не чекаючи ні на повільне, ні на тайм-аут черги
+    // A message for receiver 1 holds its worker for 500 ms; a message for receiver 0 sent meanwhile
+    // must be processed by the other worker without waiting for the slow one or for a queue timeout
+    // Сообщение для получателя 1 держит свой поток 500 мс; сообщение для получателя 0,
+    // отправленное в это время, должен обработать другой поток, не дожидаясь ни медленного, ни тайм-аута очереди
+    std::atomic<bool> slowStarted(false);
+    std::atomic<bool> fastDone(false);
+    bus.setMessageCallback([&](const PriorityMessage& message) {
+        if (message.receiverId == 1) {
+            slowStarted = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        } else {
+            fastDone = true;
+        }
+    });
+    bus.start();
+
+    for (int round = 0; round < 3; ++round) {
+        slowStarted = false;
+        fastDone = false;
+        assert(bus.sendMessage(0, 1, nullptr, 0));
+        while (!slowStarted.load()) {
+            std::this_thread::yield();
+        }
+        auto sent = std::chrono::steady_clock::now();
+        assert(bus.sendMessage(0, 0, nullptr, 0));
+        while (!fastDone.load() && std::chrono::steady_clock::now() - sent < std::chrono::milliseconds(400)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        assert(fastDone.load());
+        assert(std::chrono::steady_clock::now() - sent < std::chrono::milliseconds(80));
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    }
+    bus.stop();
+
+    std::cout << "SynapseBus idle worker test passed!" << std::endl;
+}
+
+void testMessagePayload() {
+    std::cout << "Testing message payload reference counting..." << std::endl;
+
+    MessagePayload payload = MessagePayload::allocate(3000);
+    assert(payload.size() == 3000 && payload.capacity() >= 3000);
+    assert(payload.useCount() == 1);
+
+    MessagePayload copy = payload;
+    assert(copy.data() == payload.data());
+    assert(payload.useCount() == 2);
+
+    // Шлях C API: detach/adopt не змінюють лічильник
+    // C API path: detach/adopt do not change the count
+    // Путь C API: detach/adopt не меняют счетчик
+    void* raw = copy.detach();
+    assert(copy.empty() && payload.useCount() == 2);
+    MessagePayload::releaseRaw(raw);
+    assert(payload.useCount() == 1);
+
+    MessagePayload large = MessagePayload::allocate(1 << 20);
+    assert(large.size() == (1u << 20));
+    assert(large.setSize(10) && large.size() == 10);
+    assert(!large.setSize(2u << 20));
+
+    std::cout << "Message payload test passed!" << std::endl;
+}
+
+void testSynapseBusZeroCopy() {
+    std::cout << "Testing SynapseBus zero-copy send/receive..." << std::endl;
+
+    NeuroSync::Synapse::SynapseBus bus;
+    assert(bus.initialize(MessageQueueType::LOCK_FREE));
+
+    MessagePayload payload = MessagePayload::allocate(4096);
+    for (size_t i = 0; i < payload.size(); ++i) {
+        payload.data()[i] = static_cast<char>(i);
+    }
+    const char* sentData = payload.data();
+    assert(bus.sendMessage(5, 6, std::move(payload), MessagePriority::NORMAL, 1));
+
+    int senderId, receiverId, weight;
+    MessagePriority priority;
+    MessagePayload received;
+    assert(bus.receiveMessage(senderId, receiverId, received, priority, weight));
+    assert(senderId == 5 && receiverId == 6);
+
+    // Ті самі байти, без копіювання
+    // The same bytes, no copy
+    // Те же байты, без копирования
+    assert(received.data() == sentData);
+    assert(received.size() == 4096 && received.useCount() == 1);
+
+    std::cout << "SynapseBus zero-copy test passed!" << std::endl;
+}
+
+void testSynapseBusArenaBatch() {
+    std::cout << "Testing SynapseBus batch receive into an arena..." << std::endl;
+
+    NeuroSync::Synapse::SynapseBus bus;
+    assert(bus.initialize(MessageQueueType::LOCK_FREE));
+
+    NeuroSync::Memory::Arena arena(16 * 1024);
+    NeuroSync::Memory::ArenaResource resource(arena);
+    for (int cycle = 0; cycle < 3; ++cycle) {
+        for (int i = 0; i < 50; ++i) {
+            assert(bus.sendMessage(i, i + 1, nullptr, 0, MessagePriority::NORMAL, 1));
+        }
+
+        // Вектор пакета живе в арені і зникає разом з reset()
+        // The batch vector lives in the arena and goes away with reset()
+        // Вектор пакета живет в арене и исчезает вместе с reset()
+        {
+            std::pmr::vector<PriorityMessage> batch(&resource);
+            assert(bus.receiveMessages(batch, 32) == 32);
+            assert(bus.receiveMessages(batch, 32) == 18);
+            assert(batch.size() == 50);
+            assert(bus.receiveMessages(batch, 32) == 0);
+        }
+        assert(arena.getUsedBytes() > 0);
+        arena.reset();
+        assert(arena.getBlockCount() == 1);
+    }
+
+    std::cout << "SynapseBus arena batch test passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running message queue tests..." << std::endl;
+
+    PriorityMessageQueue heapQueue;
+    testPriorityOrder(heapQueue);
+
+    LockFreePriorityMessageQueue lockFreeQueue;
+    testPriorityOrder(lockFreeQueue);
+
+    PriorityMessageQueue heapBatchQueue;
+    testBatchOperations(heapBatchQueue);
+
+    LockFreePriorityMessageQueue lockFreeBatchQueue;
+    testBatchOperations(lockFreeBatchQueue);
+
+    testLockFreeOverflow();
+    testLockFreeConcurrent();
+    testSynapseBusQueueSelection();
+    testSynapseBusBatchProcessing();
+    testSynapseBusShardedWorkers();
+    testSynapseBusIdleWorkerSteals();
+    testMessagePayload();
+    testSynapseBusZeroCopy();
+    testSynapseBusArenaBatch();
+
+    std::cout << "All message queue tests passed!" << std::endl;
+    return 0;
+}
@@ -3,10 +3,15 @@
 // NeuroSync OS Sparky
 
 #include "../core/Scheduler.h"
+#include "../core/utils/TimerWheel.h"
+#include "../core/utils/MultiLevelQueue.h"
 #include <iostream>
 #include <thread>
 #include <chrono>
 #include <atomic>
+#include <mutex>
+#include <random>
+#include <vector>
 #include <cassert>
 
 using namespace Core;
@@ -58,6 +63,16 @@ void testPriorityScheduler() {
     // Запуск планувальника
     scheduler.start();
     
+    // Перша задача тримає потік планувальника, доки решту не додано до черги
+    // The first task holds the scheduler thread until the rest are queued
+    // Перше завдання тримає потік планувальника, доки решту не додано до черги
+    std::atomic<bool> released(false);
+    scheduler.addTask([&released]() {
+        while (!released) {
+            std::this_thread::yield();
+        }
+    }, 0);
+    
     // Додавання задач з різними пріоритетами
     // Add tasks with different priorities
     // Додавання завдань з різними пріоритетами
@@ -78,6 +93,7 @@ void testPriorityScheduler() {
         executionOrder.push_back(2); // Середній пріоритет / Medium priority / Середній пріоритет
         std::this_thread::sleep_for(std::chrono::milliseconds(5));
     }, 2);
+    released = true;
     
     // Очікування завершення задач
     // Wait for tasks to complete
@@ -183,6 +199,427 @@ void testSchedulerStatistics() {
     std::cout << "Scheduler statistics test passed!\n";
 }
 
+void testTimerWheel() {
+    std::cout << "Testing timer wheel...\n";
+    
+    NeuroSync::Core::Utils::TimerWheel<int> wheel;
+    std::mt19937 random(11);
+    std::vector<uint64_t> expiries;
+    std::vector<uint32_t> handles;
+    
+    // Строки на всіх рівнях колеса та за його межами
+    // Expiries on every wheel level and beyond its range
+    // Строки на всіх рівнях колеса та за його межами
+    for (int i = 0; i < 2000; ++i) {
+        uint64_t expiry = random() % (1u << (i % 5 == 0 ? 26 : 12));
+        expiries.push_back(expiry);
+        handles.push_back(wheel.insert(expiry, i));
+    }
+    
+    // Скасування кожного третього
+    // Cancel every third one
+    // Скасування кожного третього
+    for (size_t i = 0; i < handles.size(); i += 3) {
+        assert(wheel.cancel(handles[i]));
+        assert(!wheel.cancel(handles[i]));
+    }
+    
+    std::vector<int> due;
+    uint64_t previousExpiry = 0;
+    size_t released = 0;
+    uint64_t tick = 0;
+    while (!wheel.empty()) {
+        uint64_t previousTick = tick;
+        tick = std::max(tick + 1, wheel.nextEventTick());
+        due.clear();
+        released += wheel.advance(tick, due);
+        for (int value : due) {
+            // Запис не спрацьовує раніше строку й не пізніше за поточний тик
+            // An entry never fires before its expiry nor after the current tick
+            // Запис не спрацьовує раніше строку й не пізніше за поточний тик
+            assert(value % 3 != 0);
+            assert(expiries[value] <= tick);
+            assert(expiries[value] > previousTick || previousTick == 0);
+            assert(expiries[value] >= previousExpiry);
+            previousExpiry = expiries[value];
+        }
+    }
+    assert(released == 2000 - 667);
+    
+    std::cout << "Timer wheel test passed!\n";
+}
+
+void testCancelDelayedTask() {
+    std::cout << "Testing delayed task cancellation...\n";
+    
+    Scheduler scheduler;
+    std::atomic<int> counter(0);
+    std::atomic<int> cancelHandlers(0);
+    scheduler.start();
+    
+    int cancelled = scheduler.addDelayedTask([&counter]() {
+        counter.fetch_add(10);
+    }, [&cancelHandlers]() {
+        cancelHandlers.fetch_add(1);
+    }, std::chrono::milliseconds(30));
+    int kept = scheduler.addDelayedTask([&counter]() {
+        counter.fetch_add(1);
+    }, std::chrono::milliseconds(30));
+    assert(cancelled >= 0 && kept >= 0);
+    assert(scheduler.getTaskCount() == 2);
+    
+    assert(scheduler.cancelTask(cancelled));
+    assert(!scheduler.cancelTask(cancelled));
+    assert(scheduler.getTaskCount() == 1);
+    assert(cancelHandlers == 1);
+    
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    assert(counter == 1);
+    assert(!scheduler.cancelTask(kept)); // Вже виконано / Already executed / Вже виконано
+    
+    // Зупинка скасовує таймери, строк яких не настав, і викликає їхні обробники скасування
+    // Stopping cancels timers that are not due yet and runs their cancel handlers
+    // Зупинка скасовує таймери, строк яких не настав, і викликає їхні обробники скасування
+    scheduler.addDelayedTask([&counter]() {
+        counter.fetch_add(100);
+    }, [&cancelHandlers]() {
+        cancelHandlers.fetch_add(1);
+    }, std::chrono::hours(1));
+    scheduler.stop();
+    
+    auto stats = scheduler.getStatistics();
+    assert(counter == 1);
+    assert(cancelHandlers == 2);
+    assert(stats.tasksCancelled == 2);
+    assert(stats.timersFired == 1);
+    assert(scheduler.addDelayedTask([]() {}, std::chrono::milliseconds(1)) == -1);
+    
+    std::cout << "Delayed task cancellation test passed!\n";
+}
+
+void testManyDelayedTasks() {
+    std::cout << "Testing many delayed tasks...\n";
+    
+    Scheduler scheduler(std::chrono::microseconds(500));
+    std::atomic<int> counter(0);
+    std::atomic<int> earlyTasks(0);
+    scheduler.start();
+    
+    for (int i = 0; i < 1000; ++i) {
+        auto delay = std::chrono::milliseconds(i % 50);
+        auto due = std::chrono::high_resolution_clock::now() + delay;
+        scheduler.addDelayedTask([&counter, &earlyTasks, due]() {
+            if (std::chrono::high_resolution_clock::now() < due) {
+                earlyTasks.fetch_add(1);
+            }
+            counter.fetch_add(1);
+        }, delay, i % 3);
+    }
+    
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    auto stats = scheduler.getStatistics();
+    scheduler.stop();
+    
+    assert(counter == 1000);
+    assert(earlyTasks == 0);
+    assert(stats.timersFired == 1000);
+    assert(stats.averageTimerLatency >= 0.0);
+    assert(stats.maxTimerLatency.count() >= 0);
+    std::cout << "Average timer latency: " << stats.averageTimerLatency << " us, max: "
+              << stats.maxTimerLatency.count() << " us\n";
+    
+    std::cout << "Many delayed tasks test passed!\n";
+}
+
+void testShardedScheduler() {
+    std::cout << "Testing sharded scheduler...\n";
+    
+    Scheduler scheduler(std::chrono::milliseconds(1), 4, true);
+    assert(scheduler.getWorkerCount() == 4);
+    std::atomic<int> counter(0);
+    scheduler.start();
+    
+    // Задачі без підказки, з підказкою вузла та з неіснуючим вузлом
+    // Tasks without a hint, with a node hint and with a non-existent node
+    // Завдання без підказки, з підказкою вузла та з неіснуючим вузлом
+    for (int i = 0; i < 3000; ++i) {
+        int node = i % 3 == 0 ? -1 : (i % 3 == 1 ? 0 : 999);
+        scheduler.addTask([&counter, i]() {
+            if (i % 100 == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            counter.fetch_add(1);
+        }, i % 5, node);
+    }
+    for (int i = 0; i < 100; ++i) {
+        scheduler.addDelayedTask([&counter]() {
+            counter.fetch_add(1);
+        }, std::chrono::milliseconds(i % 10), 0, 0);
+    }
+    
+    for (int i = 0; i < 200 && counter < 3100; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    scheduler.stop();
+    assert(counter == 3100);
+    
+    // Загальна статистика - сума статистики робочих потоків
+    // Aggregated statistics are the sum of the per-worker statistics
+    // Загальна статистика - сума статистики робочих потоків
+    auto stats = scheduler.getStatistics();
+    auto workers = scheduler.getWorkerStatistics();
+    assert(workers.size() == 4);
+    size_t completed = 0;
+    size_t stolen = 0;
+    for (const auto& worker : workers) {
+        assert(worker.cpu >= 0);
+        assert(worker.numaNode >= 0 && static_cast<size_t>(worker.numaNode) < scheduler.getNumaNodeCount());
+        assert(worker.queuedTasks == 0);
+        completed += worker.tasksCompleted;
+        stolen += worker.tasksStolen;
+    }
+    assert(stats.tasksAdded == 3100);
+    assert(stats.tasksCompleted == 3100 && completed == 3100);
+    assert(stats.tasksStolen == stolen);
+    assert(stats.timersFired == 100);
+    
+    std::cout << "Sharded scheduler test passed!\n";
+}
+
+void testShardedPriority() {
+    std::cout << "Testing priority across shards...\n";
+    
+    Scheduler scheduler(std::chrono::milliseconds(1), 2);
+    std::vector<int> executionOrder;
+    std::mutex orderMutex;
+    std::atomic<bool> released(false);
+    std::atomic<int> blockersStarted(0);
+    scheduler.start();
+    
+    // Обидва потоки зайняті, поки до їхніх черг додаються задачі з різними пріоритетами
+    // Both workers are busy while tasks of different priorities are added to their queues
+    // Обидва потоки зайняті, поки до їхніх черг додаються завдання з різними пріоритетами
+    for (int i = 0; i < 2; ++i) {
+        scheduler.addTask([&released, &blockersStarted]() {
+            blockersStarted.fetch_add(1);
+            while (!released) {
+                std::this_thread::yield();
+            }
+        }, 0);
+    }
+    while (blockersStarted < 2) {
+        std::this_thread::yield();
+    }
+    for (int priority = 10; priority >= 1; --priority) {
+        scheduler.addTask([&executionOrder, &orderMutex, priority]() {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            executionOrder.push_back(priority);
+        }, priority);
+    }
+    released = true;
+    
+    for (int i = 0; i < 100; ++i) {
+        {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            if (executionOrder.size() == 10) {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    scheduler.stop();
+    
+    // Кожен потік бере найкращу задачу з усіх черг, тож першою завершується одна з двох найкращих,
+    // а найгірша - однією з двох останніх
+    // Every worker takes the best task of all queues, so one of the two best finishes first
+    // and the worst one is among the last two
+    // Кожен потік бере найкраще завдання з усіх черг, тож першим завершується одне з двох найкращих,
+    // а найгірше - одним з двох останніх
+    assert(executionOrder.size() == 10);
+    assert(executionOrder[0] <= 2);
+    assert(executionOrder[8] == 10 || executionOrder[9] == 10);
+    
+    std::cout << "Priority across shards test passed!\n";
+}
+void testMultiLevelQueue() {
+    std::cout << "Testing multi-level queue...\n";
+    
+    // Смуги виходять від найкращої, усередині смуги - FIFO, навіть коли кільце переповнене
+    // Bands come out best first, FIFO within a band, even when the ring overflows
+    // Смуги виходять від найкращої, усередині смуги - FIFO, навіть коли кільце переповнене
+    NeuroSync::Core::Utils::MultiLevelQueue<int> queue(4);
+    for (int i = 0; i < 20; ++i) {
+        queue.push(7, 700 + i);
+        queue.push(2, 200 + i);
+    }
+    queue.push(1000, 9999);
+    assert(queue.topBand() == 2);
+    assert(queue.sizeApprox() == 41);
+    
+    int value = 0;
+    for (int i = 0; i < 20; ++i) {
+        assert(queue.tryPop(value) && value == 200 + i);
+    }
+    for (int i = 0; i < 20; ++i) {
+        assert(queue.tryPop(value) && value == 700 + i);
+    }
+    assert(queue.tryPop(value) && value == 9999);
+    assert(!queue.tryPop(value));
+    assert(queue.emptyApprox() && queue.sizeApprox() == 0);
+    assert(queue.topBand() == NeuroSync::Core::Utils::MultiLevelQueue<int>::BANDS);
+    
+    // Кілька виробників і споживачів: кожен елемент виходить рівно один раз
+    // Several producers and consumers: every element comes out exactly once
+    // Кілька виробників і споживачів: кожен елемент виходить рівно один раз
+    const int producers = 4;
+    const int perProducer = 20000;
+    NeuroSync::Core::Utils::MultiLevelQueue<int> shared(64);
+    std::vector<std::atomic<int>> seen(producers * perProducer);
+    for (auto& count : seen) {
+        count = 0;
+    }
+    std::atomic<int> consumed(0);
+    std::atomic<bool> producing(true);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&shared, p]() {
+            for (int i = 0; i < perProducer; ++i) {
+                int item = p * perProducer + i;
+                shared.push(static_cast<size_t>(item % 5), item);
+            }
+        });
+    }
+    for (int c = 0; c < 3; ++c) {
+        threads.emplace_back([&]() {
+            int item;
+            while (producing || !shared.emptyApprox()) {
+                if (shared.tryPop(item)) {
+                    seen[item]++;
+                    consumed++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int p = 0; p < producers; ++p) {
+        threads[p].join();
+    }
+    producing = false;
+    for (size_t t = producers; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+    assert(consumed == producers * perProducer);
+    for (auto& count : seen) {
+        assert(count == 1);
+    }
+    
+    std::cout << "Multi-level queue test passed!\n";
+}
+
+void testConcurrentProducers() {
+    std::cout << "Testing concurrent producers and task timestamps...\n";
+    
+    Scheduler scheduler(std::chrono::milliseconds(1), 2);
+    assert(!scheduler.getTaskTimestamps());
+    scheduler.start();
+    
+    // Без міток часу затримка в черзі не рахується
+    // Without timestamps the queue latency is not counted
+    // Без міток часу затримка в черзі не рахується
+    std::atomic<int> counter(0);
+    const int producers = 4;
+    const int perProducer = 5000;
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&scheduler, &counter, p]() {
+            for (int i = 0; i < perProducer; ++i) {
+                int id = scheduler.addTask([&counter]() { counter.fetch_add(1); }, (p + i) % 8);
+                assert(id >= 0);
+                (void)id;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int i = 0; i < 500 && counter < producers * perProducer; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    assert(counter == producers * perProducer);
+    assert(scheduler.getStatistics().timestampedTasks == 0);
+    
+    // З мітками часу кожна задача додає свою затримку в черзі
+    // With timestamps every task contributes its queue latency
+    // З мітками часу кожне завдання додає свою затримку в черзі
+    scheduler.setTaskTimestamps(true);
+    std::atomic<bool> released(false);
+    scheduler.addTask([&released]() {
+        while (!released) {
+            std::this_thread::yield();
+        }
+    });
+    for (int i = 0; i < 2; ++i) {
+        scheduler.addTask([&counter]() { counter.fetch_add(1); });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    released = true;
+    for (int i = 0; i < 100 && counter < producers * perProducer + 2; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    scheduler.stop();
+    
+    auto stats = scheduler.getStatistics();
+    assert(stats.tasksAdded == static_cast<size_t>(producers * perProducer + 3));
+    assert(stats.tasksCompleted == stats.tasksAdded);
+    assert(stats.timestampedTasks == 3);
+    assert(stats.averageQueueLatency > 0.0);
+    
+    std::cout << "Concurrent producers test passed!\n";
+}
+
+void testTimersWithBusyWorkers() {
+    std::cout << "Testing timers while every worker is busy...\n";
+    
+    Scheduler scheduler(std::chrono::milliseconds(1), 2);
+    std::atomic<int> counter(0);
+    scheduler.start();
+    
+    // Обидва робочі потоки зайняті довгими задачами; відкладена задача все одно випускається вчасно
+    // Both workers are busy with long tasks; the delayed task is still released on time
+    // Обидва робочі потоки зайняті довгими завданнями; відкладене завдання все одно випускається вчасно
+    std::atomic<int> started(0);
+    for (int i = 0; i < 2; ++i) {
+        scheduler.addTask([&started]() {
+            started.fetch_add(1);
+            std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        });
+    }
+    while (started < 2) {
+        std::this_thread::yield();
+    }
+    scheduler.addDelayedTask([&counter]() {
+        counter.fetch_add(1);
+    }, std::chrono::milliseconds(20));
+    
+    std::this_thread::sleep_for(std::chrono::milliseconds(120));
+    auto stats = scheduler.getStatistics();
+    assert(stats.timersFired == 1);
+    assert(stats.maxTimerLatency < std::chrono::milliseconds(80));
+    assert(counter == 0);
+    
+    // Випущена задача виконується, щойно звільняється потік
+    // The released task runs as soon as a worker frees up
+    // Випущене завдання виконується, щойно звільняється потік
+    for (int i = 0; i < 100 && counter == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    assert(counter == 1);
+    scheduler.stop();
+    
+    std::cout << "Busy worker timer test passed!\n";
+}
+
 int main() {
     std::cout << "=== Running Scheduler Tests ===\n";
     
@@ -191,6 +628,14 @@ int main() {
         testPriorityScheduler();
         testDelayedScheduler();
         testSchedulerStatistics();
+        testTimerWheel();
+        testCancelDelayedTask();
+        testManyDelayedTasks();
+        testTimersWithBusyWorkers();
+        testShardedScheduler();
+        testShardedPriority();
+        testMultiLevelQueue();
+        testConcurrentProducers();
         
         std::cout << "\nAll scheduler tests passed!\n";
         return 0;
@@ -0,0 +1,321 @@
+// test_scheduling_algorithms.cpp
+// Тест для индексированной кучи и алгоритмов планирования / Indexed heap and scheduling algorithms test / Тест для індексованої купи та алгоритмів планування
+// NeuroSync OS Sparky
+
+#include "../core/algorithms/IndexedDaryHeap.h"
+#include "../core/algorithms/PriorityBasedScheduling.h"
+#include "../core/algorithms/RoundRobinScheduling.h"
+#include "../core/algorithms/WeightedFairQueuingScheduling.h"
+#include "../core/algorithms/EarliestDeadlineFirstScheduling.h"
+#include "../core/algorithms/CalendarFairQueuingScheduling.h"
+#include <iostream>
+#include <map>
+#include <random>
+#include <cassert>
+#include <cstdlib>
+
+using namespace NeuroSync::Core::Algorithms;
+
+void testIndexedHeapAgainstModel() {
+    std::cout << "Testing indexed heap against a reference model...\n";
+
+    // Случайные вставки, смена ключей, удаления и извлечения сверяются с std::map
+    // Random inserts, key changes, erases and pops are checked against std::map
+    // Випадкові вставки, зміни ключів, видалення та вилучення звіряються з std::map
+    IndexedDaryHeap<long long, std::greater<long long>, 3> heap;
+    std::map<int, long long> model;
+    std::mt19937 random(42);
+    int nextId = 0;
+
+    for (int step = 0; step < 20000; ++step) {
+        int operation = random() % 4;
+        if (operation == 0 || model.empty()) {
+            long long key = static_cast<long long>(random() % 1000) * 100000 + nextId;
+            assert(heap.push(nextId, key));
+            assert(!heap.push(nextId, key));
+            model[nextId++] = key;
+        } else {
+            auto it = model.begin();
+            std::advance(it, random() % model.size());
+            if (operation == 1) {
+                long long key = static_cast<long long>(random() % 1000) * 100000 + it->first;
+                assert(heap.update(it->first, key));
+                it->second = key;
+            } else if (operation == 2) {
+                assert(heap.erase(it->first));
+                assert(!heap.contains(it->first));
+                model.erase(it);
+            } else {
+                auto smallest = model.begin();
+                for (auto candidate = model.begin(); candidate != model.end(); ++candidate) {
+                    if (candidate->second < smallest->second) {
+                        smallest = candidate;
+                    }
+                }
+                assert(heap.top() == smallest->second);
+                assert(heap.pop() == smallest->first);
+                model.erase(smallest);
+            }
+        }
+        assert(heap.size() == model.size());
+    }
+
+    assert(!heap.erase(-1));
+    assert(heap.find(-1) == nullptr);
+    std::cout << "Indexed heap model test passed!\n";
+}
+
+void testPriorityBasedScheduling() {
+    std::cout << "Testing priority-based scheduling...\n";
+
+    PriorityBasedScheduling scheduling;
+    scheduling.initialize();
+    scheduling.addTask(1, 5);
+    scheduling.addTask(2, 9);
+    scheduling.addTask(3, 5);
+    scheduling.addTask(4, 1);
+    scheduling.addTask(2, 100); // Повторный ID игнорируется / Duplicate ID is ignored / Повторний ID ігнорується
+    assert(scheduling.getTaskCount() == 4);
+
+    // Смена приоритета и удаление без перестройки очереди
+    // Priority change and removal without rebuilding the queue
+    // Зміна пріоритету та видалення без перебудови черги
+    scheduling.updateTaskPriority(4, 7);
+    scheduling.removeTask(2);
+    scheduling.removeTask(42);
+    assert(scheduling.getTaskCount() == 3);
+
+    assert(scheduling.selectNextTask() == 4);
+    assert(scheduling.selectNextTask() == 1); // FIFO при равном приоритете / FIFO on equal priority / FIFO при рівному пріоритеті
+    assert(scheduling.selectNextTask() == 3);
+    assert(scheduling.selectNextTask() == -1);
+    assert(scheduling.isEmpty());
+
+    std::cout << "Priority-based scheduling test passed!\n";
+}
+
+void testRoundRobinScheduling() {
+    std::cout << "Testing round robin scheduling...\n";
+
+    RoundRobinScheduling scheduling;
+    scheduling.initialize();
+    for (int taskId = 1; taskId <= 4; ++taskId) {
+        scheduling.addTask(taskId, 1);
+    }
+
+    // Выбранная задача остается в очереди и уходит в конец круга
+    // The selected task stays queued and moves to the back of the rotation
+    // Вибране завдання лишається в черзі та йде в кінець кола
+    assert(scheduling.selectNextTask() == 1);
+    assert(scheduling.selectNextTask() == 2);
+    scheduling.removeTask(3);
+    scheduling.updateTaskPriority(4, 10);
+    assert(scheduling.selectNextTask() == 4);
+    assert(scheduling.selectNextTask() == 1);
+    assert(scheduling.selectNextTask() == 2);
+    assert(scheduling.getTaskCount() == 3);
+
+    scheduling.removeTask(4);
+    scheduling.removeTask(1);
+    scheduling.removeTask(2);
+    assert(scheduling.isEmpty());
+    assert(scheduling.selectNextTask() == -1);
+
+    std::cout << "Round robin scheduling test passed!\n";
+}
+
+void testWeightedFairQueuingScheduling() {
+    std::cout << "Testing weighted fair queuing scheduling...\n";
+
+    WeightedFairQueuingScheduling scheduling;
+    scheduling.initialize();
+    scheduling.addTask(1, 1);
+    scheduling.addTask(2, 1);
+    scheduling.addTask(3, 1);
+
+    // Больший вес сокращает виртуальное время завершения
+    // A larger weight shortens the virtual finish time
+    // Більша вага скорочує віртуальний час завершення
+    scheduling.setTaskWeight(3, 4);
+    scheduling.removeTask(1);
+    assert(scheduling.selectNextTask() == 3);
+    assert(scheduling.selectNextTask() == 2);
+    assert(scheduling.isEmpty());
+
+    std::cout << "Weighted fair queuing scheduling test passed!\n";
+}
+
+void testCalendarFairQueuingScheduling() {
+    std::cout << "Testing calendar fair queuing scheduling...\n";
+
+    CalendarFairQueuingScheduling scheduling;
+    scheduling.initialize();
+    scheduling.addTask(1, 1);
+    scheduling.addTask(2, 1);
+    scheduling.addTask(3, 1);
+    scheduling.addTask(2, 5); // Повторный ID игнорируется / Duplicate ID is ignored / Повторний ID ігнорується
+
+    // Больший вес сокращает виртуальное время завершения; при равном времени - FIFO
+    // A larger weight shortens the virtual finish time; equal times are FIFO
+    // Більша вага скорочує віртуальний час завершення; при рівному часі - FIFO
+    scheduling.setTaskWeight(3, 4);
+    scheduling.removeTask(1);
+    scheduling.removeTask(42);
+    scheduling.addTask(4, 1);
+    assert(scheduling.getTaskCount() == 3);
+    assert(scheduling.selectNextTask() == 3);
+    assert(scheduling.getVirtualTime() == CalendarFairQueuingScheduling::VIRTUAL_TIME_SCALE / 4);
+    assert(scheduling.selectNextTask() == 2);
+    assert(scheduling.selectNextTask() == 4);
+    assert(scheduling.isEmpty());
+    assert(scheduling.selectNextTask() == -1);
+
+    // Два потока с весами 4 и 1 делят обслуживание 4:1, в том числе после многих оборотов кольца
+    // Two flows with weights 4 and 1 share service 4:1, including after many turns of the ring
+    // Два потоки з вагами 4 та 1 ділять обслуговування 4:1, зокрема після багатьох обертів кільця
+    std::map<int, int> flowByTask;
+    int nextTaskId = 100;
+    int served[2] = {0, 0};
+    const int weights[2] = {4, 1};
+    for (int flow = 0; flow < 2; ++flow) {
+        scheduling.addTask(nextTaskId, 0);
+        scheduling.setTaskWeight(nextTaskId, weights[flow]);
+        flowByTask[nextTaskId++] = flow;
+    }
+    for (int i = 0; i < 5000; ++i) {
+        int taskId = scheduling.selectNextTask();
+        int flow = flowByTask[taskId];
+        served[flow]++;
+        scheduling.addTask(nextTaskId, 0);
+        scheduling.setTaskWeight(nextTaskId, weights[flow]);
+        flowByTask[nextTaskId++] = flow;
+        assert(std::abs(served[0] - 4 * served[1]) <= 4);
+    }
+    assert(scheduling.getVirtualTime() > 2 * CalendarFairQueuingScheduling::VIRTUAL_TIME_SCALE * 100);
+
+    // Смена приоритета ставит задачу в конец ее корзины
+    // A priority change moves the task to the back of its bucket
+    // Зміна пріоритету ставить завдання в кінець його кошика
+    scheduling.initialize();
+    scheduling.addTask(1, 1);
+    scheduling.addTask(2, 1);
+    scheduling.updateTaskPriority(1, 9);
+    assert(scheduling.selectNextTask() == 2);
+    assert(scheduling.selectNextTask() == 1);
+
+    std::cout << "Calendar fair queuing scheduling test passed!\n";
+}
+
+void testEarliestDeadlineFirstScheduling() {
+    std::cout << "Testing earliest-deadline-first scheduling...\n";
+
+    EarliestDeadlineFirstScheduling scheduling;
+    scheduling.initialize();
+
+    // Допуск по накопленной нагрузке в порядке сроков (время 0, один исполнитель)
+    // Admission by accumulated load in deadline order (time 0, one executor)
+    // Допуск за накопиченим навантаженням у порядку строків (час 0, один виконавець)
+    assert(scheduling.canAdmit(100, 50, 0));
+    scheduling.addTask(1, 0, 100, 50);
+    assert(scheduling.canAdmit(80, 40, 0));
+    scheduling.addTask(2, 0, 80, 40);
+    assert(!scheduling.canAdmit(90, 30, 0));  // Сорвала бы задачу 1 / Would make task 1 miss / Зірвало б завдання 1
+    assert(!scheduling.canAdmit(200, 200, 0)); // Сама не успевает / Cannot make it itself / Само не встигає
+    assert(scheduling.canAdmit(300, 200, 0));
+    assert(scheduling.canAdmit(0, 1000, 0));   // Задача без срока / Task without a deadline / Завдання без строку
+
+    // Удаление освобождает нагрузку
+    // Removal frees the load
+    // Видалення звільняє навантаження
+    scheduling.removeTask(2);
+    assert(scheduling.canAdmit(90, 30, 0));
+    scheduling.addTask(2, 0, 80, 40);
+
+    // Задачи без срока идут после задач со сроком в порядке приоритетов
+    // Tasks without a deadline follow the deadline tasks in priority order
+    // Завдання без строку йдуть після завдань зі строком у порядку пріоритетів
+    scheduling.addTask(3, 9);
+    scheduling.addTask(4, 1);
+    scheduling.addTask(5, 9);
+    scheduling.updateTaskPriority(4, 10);
+    assert(scheduling.getTaskCount() == 5);
+
+    assert(scheduling.selectNextTask() == 2);
+    assert(scheduling.selectNextTask() == 1);
+    assert(scheduling.canAdmit(100, 100, 0)); // Выбранные задачи больше не учитываются / Selected tasks no longer count / Вибрані завдання більше не враховуються
+    assert(scheduling.selectNextTask() == 4);
+    assert(scheduling.selectNextTask() == 3);
+    assert(scheduling.selectNextTask() == 5);
+    assert(scheduling.isEmpty());
+
+    // Нагрузка делится между исполнителями
+    // The load is split across executors
+    // Навантаження ділиться між виконавцями
+    EarliestDeadlineFirstScheduling parallel(2);
+    parallel.initialize();
+    assert(parallel.getProcessorCount() == 2);
+    assert(parallel.canAdmit(100, 150, 0));
+    assert(!scheduling.canAdmit(100, 150, 0));
+
+    std::cout << "Earliest-deadline-first scheduling test passed!\n";
+}
+
+void testEarliestDeadlineFirstRunningTasks() {
+    std::cout << "Testing earliest-deadline-first admission with running and reserved tasks...\n";
+
+    // Выполняющаяся задача занимает исполнителя до конца своей оценки
+    // A running task occupies its executor until its estimate runs out
+    // Завдання, що виконується, займає виконавця до кінця своєї оцінки
+    EarliestDeadlineFirstScheduling scheduling;
+    scheduling.initialize();
+    scheduling.addTask(1, 0, 1000, 500);
+    assert(scheduling.selectNextTask() == 1);
+    scheduling.startTask(1, 500, 0);
+    assert(!scheduling.canAdmit(100, 10, 0));  // Исполнитель занят до 500 / Executor busy until 500 / Виконавець зайнятий до 500
+    assert(!scheduling.canAdmit(450, 10, 100));
+    assert(scheduling.canAdmit(600, 10, 100));  // Остаток 400 + 10 / Remainder 400 + 10 / Залишок 400 + 10
+    assert(scheduling.canAdmit(700, 10, 600));  // Оценка исчерпана / Estimate used up / Оцінку вичерпано
+    scheduling.finishTask(1);
+    assert(scheduling.canAdmit(100, 10, 0));
+
+    // Резерв задачи, ждущей зависимостей, учитывается до постановки в очередь или снятия
+    // A reservation of a task waiting for dependencies counts until it is queued or dropped
+    // Резерв завдання, що чекає залежностей, враховується до постановки в чергу або зняття
+    scheduling.reserveTask(2, 200, 150);
+    assert(!scheduling.canAdmit(100, 60, 0));   // Сорвала бы задачу 2 / Would make task 2 miss / Зірвало б завдання 2
+    scheduling.addTask(2, 0, 200, 150);
+    assert(!scheduling.canAdmit(100, 60, 0));
+    assert(scheduling.selectNextTask() == 2);
+    assert(scheduling.canAdmit(100, 60, 0));
+    scheduling.reserveTask(3, 200, 150);
+    scheduling.removeTask(3);
+    assert(scheduling.canAdmit(100, 60, 0));
+
+    // Занятый исполнитель не мешает свободному
+    // A busy executor does not hold up a free one
+    // Зайнятий виконавець не заважає вільному
+    EarliestDeadlineFirstScheduling parallel(2);
+    parallel.initialize();
+    parallel.startTask(7, 500, 0);
+    assert(parallel.canAdmit(100, 90, 0));
+    parallel.addTask(8, 0, 100, 50);
+    assert(!parallel.canAdmit(100, 60, 0));
+    assert(parallel.canAdmit(600, 60, 0));
+
+    std::cout << "Earliest-deadline-first running task test passed!\n";
+}
+
+int main() {
+    std::cout << "=== Running Scheduling Algorithm Tests ===\n";
+
+    testIndexedHeapAgainstModel();
+    testPriorityBasedScheduling();
+    testRoundRobinScheduling();
+    testWeightedFairQueuingScheduling();
+    testCalendarFairQueuingScheduling();
+    testEarliestDeadlineFirstScheduling();
+    testEarliestDeadlineFirstRunningTasks();
+
+    std::cout << "=== All Scheduling Algorithm Tests Passed ===\n";
+    return 0;
+}
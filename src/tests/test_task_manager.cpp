@@ -0,0 +1,156 @@
+// test_task_manager.cpp
+// Тест для менеджера задач с графом зависимостей / Task manager with dependency graph test / Тест для менеджера завдань із графом залежностей
+// NeuroSync OS Sparky
+
+#include "../core/utils/TaskManager.h"
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+using namespace NeuroSync::Core::Utils;
+
+static int createTask(TaskManager& manager, TaskType type = TaskType::CUSTOM) {
+    return manager.createTask("task", type, 1, 1, nullptr);
+}
+
+void testIndexAndLists() {
+    std::cout << "Testing ID index and status/type lists...\n";
+
+    TaskManager manager;
+    int first = createTask(manager, TaskType::DIAGNOSTICS);
+    int second = createTask(manager);
+    int third = createTask(manager, TaskType::DIAGNOSTICS);
+    assert(manager.getTaskCount() == 3);
+    assert(manager.getTask(second)->id == second);
+
+    assert(manager.updateTaskStatus(second, TaskStatus::RUNNING));
+    assert(manager.getTaskCountByStatus(TaskStatus::PENDING) == 2);
+    assert(manager.getTaskCountByStatus(TaskStatus::RUNNING) == 1);
+    assert(manager.getTasksByStatus(TaskStatus::RUNNING)[0]->id == second);
+
+    std::vector<std::shared_ptr<Task>> diagnostics = manager.getTasksByType(TaskType::DIAGNOSTICS);
+    assert(diagnostics.size() == 2);
+    assert(diagnostics[0]->id == first && diagnostics[1]->id == third);
+
+    // Удаление из середины: остальные задачи доступны по ID
+    // Deleting from the middle: the other tasks stay reachable by ID
+    // Видалення із середини: інші завдання доступні за ID
+    assert(manager.deleteTask(first));
+    assert(!manager.deleteTask(first));
+    assert(manager.getTask(first) == nullptr);
+    assert(manager.getTask(third)->id == third);
+    assert(manager.getTaskCount() == 2);
+    assert(manager.getTasksByType(TaskType::DIAGNOSTICS).size() == 1);
+    assert(manager.getTaskCountByStatus(TaskStatus::PENDING) == 1);
+
+    std::cout << "ID index and lists test passed!\n";
+}
+
+void testDependencyRelease() {
+    std::cout << "Testing dependency release...\n";
+
+    TaskManager manager;
+    int a = createTask(manager);
+    int b = createTask(manager);
+    int c = createTask(manager);
+    int d = createTask(manager);
+
+    // Ромб: b и c ждут a, d ждет b и c
+    // Diamond: b and c wait for a, d waits for b and c
+    // Ромб: b і c чекають на a, d чекає на b і c
+    assert(manager.addTaskDependency(b, a));
+    assert(manager.addTaskDependency(c, a));
+    assert(manager.addTaskDependency(d, b));
+    assert(manager.addTaskDependency(d, c));
+    assert(!manager.addTaskDependency(d, c));
+    assert(!manager.addTaskDependency(a, d)); // Цикл / Cycle / Цикл
+    assert(!manager.addTaskDependency(a, a));
+    assert(manager.getUnmetDependencyCount(d) == 2);
+
+    std::vector<int> ready;
+    assert(manager.takeReadyTasks(ready) == 1 && ready[0] == a);
+    assert(!manager.addTaskDependency(a, b)); // Уже выдана / Already handed out / Вже видане
+
+    ready.clear();
+    manager.updateTaskStatus(a, TaskStatus::RUNNING);
+    assert(manager.takeReadyTasks(ready) == 0);
+    manager.updateTaskStatus(a, TaskStatus::COMPLETED);
+    assert(manager.takeReadyTasks(ready) == 2 && ready[0] == b && ready[1] == c);
+
+    ready.clear();
+    manager.updateTaskStatus(b, TaskStatus::COMPLETED);
+    assert(manager.takeReadyTasks(ready) == 0);
+    assert(!manager.isTaskReady(d));
+    manager.updateTaskStatus(c, TaskStatus::COMPLETED);
+    assert(manager.takeReadyTasks(ready) == 1 && ready[0] == d);
+    assert(manager.isTaskReady(d));
+
+    // Удаление незавершенного предшественника отменяет последователя вместо его освобождения
+    // Deleting an unfinished predecessor cancels the successor instead of releasing it
+    // Видалення незавершеного попередника скасовує наступника замість його звільнення
+    int e = createTask(manager);
+    int f = createTask(manager);
+    assert(manager.addTaskDependency(f, e));
+    ready.clear();
+    assert(manager.takeReadyTasks(ready) == 1 && ready[0] == e);
+    std::vector<int> cancelled;
+    assert(manager.deleteTask(e, &cancelled));
+    assert(manager.getTask(f)->dependencies.empty());
+    assert(manager.getTask(f)->status == TaskStatus::CANCELLED);
+    assert(cancelled.size() == 1 && cancelled[0] == f);
+    ready.clear();
+    assert(manager.takeReadyTasks(ready) == 0);
+
+    // Удаление завершенного предшественника последователя не трогает
+    // Deleting a completed predecessor leaves the successor alone
+    // Видалення завершеного попередника наступника не чіпає
+    int g = createTask(manager);
+    int h = createTask(manager);
+    assert(manager.addTaskDependency(h, g));
+    ready.clear();
+    assert(manager.takeReadyTasks(ready) == 1 && ready[0] == g);
+    assert(manager.updateTaskStatus(g, TaskStatus::COMPLETED));
+    cancelled.clear();
+    assert(manager.deleteTask(g, &cancelled));
+    assert(cancelled.empty());
+    ready.clear();
+    assert(manager.takeReadyTasks(ready) == 1 && ready[0] == h);
+
+    std::cout << "Dependency release test passed!\n";
+}
+
+void testFailureCancelsDependents() {
+    std::cout << "Testing cancellation of dependents...\n";
+
+    TaskManager manager;
+    int a = createTask(manager);
+    int b = createTask(manager);
+    int c = createTask(manager);
+    int other = createTask(manager);
+    assert(manager.addTaskDependency(b, a));
+    assert(manager.addTaskDependency(c, b));
+
+    std::vector<int> ready;
+    manager.takeReadyTasks(ready);
+
+    std::vector<int> cancelled;
+    manager.updateTaskStatus(a, TaskStatus::FAILED, &cancelled);
+    assert(cancelled.size() == 2 && cancelled[0] == b && cancelled[1] == c);
+    assert(manager.getTask(c)->status == TaskStatus::CANCELLED);
+    assert(manager.getTask(other)->status == TaskStatus::PENDING);
+    assert(!manager.addTaskDependency(other, a));
+    assert(manager.getTaskCountByStatus(TaskStatus::CANCELLED) == 2);
+
+    std::cout << "Cancellation of dependents test passed!\n";
+}
+
+int main() {
+    std::cout << "=== Running Task Manager Tests ===\n";
+
+    testIndexAndLists();
+    testDependencyRelease();
+    testFailureCancelsDependents();
+
+    std::cout << "=== All Task Manager Tests Passed ===\n";
+    return 0;
+}
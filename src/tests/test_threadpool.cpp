@@ -3,6 +3,13 @@
 #include <cassert>
 #include <chrono>
 #include <thread>
+#include <atomic>
+#include <vector>
+#include <string>
+#include <memory>
+#include <array>
+#include <cstdint>
+#include <future>
 
 // Тести для пулу потоків
 // Thread pool tests
@@ -165,6 +172,436 @@ void testExceptionHandling() {
     std::cout << "Exception handling test passed!" << std::endl;
 }
 
+void testWorkStealingManyTasks() {
+    std::cout << "Testing work-stealing mode with many tasks..." << std::endl;
+    
+    NeuroSync::ThreadPool pool(4, NeuroSync::ThreadPoolMode::WORK_STEALING);
+    assert(pool.getMode() == NeuroSync::ThreadPoolMode::WORK_STEALING);
+    assert(pool.getThreadCount() == 4);
+    
+    // Завдання від зовнішнього потоку йдуть через чергу впровадження
+    // Tasks from an external thread go through the injection queue
+    // Задачи от внешнего потока идут через очередь внедрения
+    const int taskCount = 10000;
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < taskCount; ++i) {
+        futures.push_back(pool.enqueue([i]() {
+            return i * 2;
+        }));
+    }
+    
+    for (int i = 0; i < taskCount; ++i) {
+        assert(futures[i].get() == i * 2);
+    }
+    
+    std::cout << "Work-stealing many tasks test passed!" << std::endl;
+}
+
+// Рекурсивне породження: кожен вузол додає дочірні завдання зсередини робітника
+// Recursive spawning: each node submits child tasks from inside a worker
+// Рекурсивное порождение: каждый узел добавляет дочерние задачи изнутри рабочего
+static void spawnTree(NeuroSync::ThreadPool& pool, int depth, std::atomic<int>& visited) {
+    visited.fetch_add(1);
+    if (depth == 0) {
+        return;
+    }
+    for (int child = 0; child < 2; ++child) {
+        pool.enqueue([&pool, depth, &visited]() {
+            spawnTree(pool, depth - 1, visited);
+        });
+    }
+}
+
+void testWorkStealingRecursiveSpawn() {
+    std::cout << "Testing work-stealing recursive spawning..." << std::endl;
+    
+    std::atomic<int> visited(0);
+    const int depth = 14;
+    const int expected = (1 << (depth + 1)) - 1;
+    {
+        NeuroSync::ThreadPool pool(4, NeuroSync::ThreadPoolMode::WORK_STEALING);
+        pool.enqueue([&pool, &visited]() {
+            spawnTree(pool, depth, visited);
+        });
+        
+        // Очікування, доки дерево не буде повністю обійдено
+        // Waiting until the tree has been fully visited
+        // Ожидание, пока дерево не будет полностью обойдено
+        while (visited.load() < expected) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    assert(visited.load() == expected);
+    
+    std::cout << "Work-stealing recursive spawn test passed!" << std::endl;
+}
+
+void testWorkStealingStopDrains() {
+    std::cout << "Testing work-stealing stop drains queued tasks..." << std::endl;
+    
+    std::atomic<int> executed(0);
+    std::atomic<int> spawned(0);
+    {
+        NeuroSync::ThreadPool pool(2, NeuroSync::ThreadPoolMode::WORK_STEALING);
+        
+        // Дочірні завдання, що лежать у деках робітників на момент зупинки, все одно виконуються
+        // Child tasks still sitting in worker deques at stop time are still executed
+        // Дочерние задачи, лежащие в деках рабочих на момент остановки, все равно выполняются
+        for (int i = 0; i < 100; ++i) {
+            pool.enqueue([&pool, &executed, &spawned]() {
+                for (int child = 0; child < 10; ++child) {
+                    pool.enqueue([&executed]() {
+                        std::this_thread::sleep_for(std::chrono::microseconds(50));
+                        executed.fetch_add(1);
+                    });
+                }
+                spawned.fetch_add(1);
+            });
+        }
+        while (spawned.load() < 100) {
+            std::this_thread::yield();
+        }
+        pool.stop();
+    }
+    assert(executed.load() == 1000);
+    
+    // Після зупинки нові завдання відхиляються
+    // New tasks are rejected after stop
+    // После остановки новые задачи отклоняются
+    NeuroSync::ThreadPool stopped(1, NeuroSync::ThreadPoolMode::WORK_STEALING);
+    stopped.stop();
+    bool rejected = false;
+    try {
+        stopped.enqueue([]() {});
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    assert(rejected);
+    
+    std::cout << "Work-stealing stop test passed!" << std::endl;
+}
+
+void testWorkStealingRestart() {
+    std::cout << "Testing work-stealing restart..." << std::endl;
+    
+    NeuroSync::ThreadPool pool(3, NeuroSync::ThreadPoolMode::WORK_STEALING);
+    assert(pool.enqueue([]() { return 1; }).get() == 1);
+    
+    pool.restart();
+    assert(pool.getThreadCount() == 3);
+    
+    std::atomic<int> executed(0);
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < 1000; ++i) {
+        futures.push_back(pool.enqueue([&executed]() {
+            executed.fetch_add(1);
+        }));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+    assert(executed.load() == 1000);
+    
+    std::cout << "Work-stealing restart test passed!" << std::endl;
+}
+
+void testPostAndMoveOnlyTasks() {
+    std::cout << "Testing post and move-only tasks..." << std::endl;
+    
+    const NeuroSync::ThreadPoolMode modes[] = {NeuroSync::ThreadPoolMode::SHARED_QUEUE,
+                                               NeuroSync::ThreadPoolMode::WORK_STEALING};
+    for (NeuroSync::ThreadPoolMode mode : modes) {
+        NeuroSync::ThreadPool pool(2, mode);
+        
+        // post без результату, у тому числі з завданням, що кидає виняток
+        // post without a result, including a task that throws
+        // post без результата, в том числе с задачей, бросающей исключение
+        std::atomic<int> posted(0);
+        for (int i = 0; i < 1000; ++i) {
+            pool.post([&posted](int amount) { posted.fetch_add(amount); }, 2);
+        }
+        pool.post([]() { throw std::runtime_error("ignored"); });
+        
+        // Переміщуваний аргумент, який не можна скопіювати в std::function
+        // A move-only argument that could not be copied into std::function
+        // Перемещаемый аргумент, который нельзя скопировать в std::function
+        std::unique_ptr<int> owned(new int(7));
+        auto ownedFuture = pool.enqueue([](std::unique_ptr<int> value) { return *value * 6; }, std::move(owned));
+        assert(ownedFuture.get() == 42);
+        
+        // Захоплення, більше за вбудований буфер TaskFunction, розміщується в пулі блоків
+        // A capture larger than the TaskFunction inline buffer is placed in the block pool
+        // Захват, больший встроенного буфера TaskFunction, размещается в пуле блоков
+        std::array<int, 64> large;
+        for (size_t i = 0; i < large.size(); ++i) {
+            large[i] = static_cast<int>(i);
+        }
+        auto largeFuture = pool.enqueue([large]() {
+            int sum = 0;
+            for (int value : large) {
+                sum += value;
+            }
+            return sum;
+        });
+        assert(largeFuture.get() == 63 * 64 / 2);
+        
+        pool.enqueue([]() {}).get();
+        while (posted.load() < 2000) {
+            std::this_thread::yield();
+        }
+        assert(posted.load() == 2000);
+    }
+    
+    std::cout << "Post and move-only tasks test passed!" << std::endl;
+}
+
+void testTaskFunction() {
+    std::cout << "Testing TaskFunction storage..." << std::endl;
+    
+    // Вбудований та пульований виклик переживають переміщення і звільняють захоплений стан
+    // Inline and pooled callables survive moves and release captured state
+    // Встроенный и пулированный вызов переживают перемещение и освобождают захваченное состояние
+    std::shared_ptr<int> counter = std::make_shared<int>(0);
+    {
+        NeuroSync::TaskFunction small([counter]() { (*counter)++; });
+        std::array<char, 200> padding = {};
+        NeuroSync::TaskFunction big([counter, padding]() { (*counter) += 10 + padding[0]; });
+        assert(counter.use_count() == 3);
+        
+        NeuroSync::TaskFunction moved(std::move(small));
+        assert(!small);
+        moved();
+        
+        NeuroSync::TaskFunction assigned;
+        assigned = std::move(big);
+        assert(!big);
+        assigned();
+        assert(*counter == 11);
+    }
+    assert(counter.use_count() == 1);
+    
+    std::cout << "TaskFunction storage test passed!" << std::endl;
+}
+
+void testResize() {
+    std::cout << "Testing runtime resize..." << std::endl;
+    
+    const NeuroSync::ThreadPoolMode modes[] = {NeuroSync::ThreadPoolMode::SHARED_QUEUE,
+                                               NeuroSync::ThreadPoolMode::WORK_STEALING};
+    for (NeuroSync::ThreadPoolMode mode : modes) {
+        NeuroSync::ThreadPool pool(2, mode);
+        std::atomic<int> executed(0);
+        
+        // Завдання продовжують виконуватися, поки пул росте та зменшується
+        // Tasks keep running while the pool grows and shrinks
+        // Задачи продолжают выполняться, пока пул растет и уменьшается
+        std::vector<std::future<void>> futures;
+        const size_t sizes[] = {6, 1, 4, 2, 8, 3};
+        for (size_t size : sizes) {
+            for (int i = 0; i < 500; ++i) {
+                futures.push_back(pool.enqueue([&pool, &executed, mode]() {
+                    if (mode == NeuroSync::ThreadPoolMode::WORK_STEALING) {
+                        pool.post([&executed]() { executed.fetch_add(1); });
+                    }
+                    executed.fetch_add(1);
+                }));
+            }
+            pool.resize(size);
+            assert(pool.getThreadCount() == size);
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+        
+        // Дочірні завдання зменшених робітників теж виконуються
+        // Child tasks of resized-away workers run as well
+        // Дочерние задачи сокращенных рабочих тоже выполняются
+        int expected = mode == NeuroSync::ThreadPoolMode::WORK_STEALING ? 6000 : 3000;
+        while (executed.load() < expected) {
+            std::this_thread::yield();
+        }
+        assert(executed.load() == expected);
+        
+        // Зменшення до одного потоку не губить завдань, що лишилися в черзі
+        // Shrinking to one thread loses none of the tasks left in the queue
+        // Уменьшение до одного потока не теряет задач, оставшихся в очереди
+        std::atomic<int> late(0);
+        for (int i = 0; i < 200; ++i) {
+            pool.post([&late]() { late.fetch_add(1); });
+        }
+        pool.resize(1);
+        assert(pool.enqueue([]() { return 5; }).get() == 5);
+        while (late.load() < 200) {
+            std::this_thread::yield();
+        }
+        
+        // Недопустимі розміри та виклик з робітника відхиляються
+        // Invalid sizes and calls from a worker are rejected
+        // Недопустимые размеры и вызов из рабочего отклоняются
+        bool rejected = false;
+        try {
+            pool.resize(0);
+        } catch (const std::invalid_argument&) {
+            rejected = true;
+        }
+        assert(rejected);
+        
+        bool rejectedInside = pool.enqueue([&pool]() {
+            try {
+                pool.resize(4);
+            } catch (const std::runtime_error&) {
+                return true;
+            }
+            return false;
+        }).get();
+        assert(rejectedInside);
+        assert(pool.getThreadCount() == 1);
+        
+        // Після restart пул відновлює поточний розмір
+        // After restart the pool comes back at its current size
+        // После restart пул восстанавливается с текущим размером
+        pool.resize(3);
+        pool.restart();
+        assert(pool.getThreadCount() == 3);
+        assert(pool.enqueue([]() { return 9; }).get() == 9);
+    }
+    
+    std::cout << "Runtime resize test passed!" << std::endl;
+}
+
+void testStatistics() {
+    std::cout << "Testing pool statistics..." << std::endl;
+    
+    const NeuroSync::ThreadPoolMode modes[] = {NeuroSync::ThreadPoolMode::SHARED_QUEUE,
+                                               NeuroSync::ThreadPoolMode::WORK_STEALING};
+    for (NeuroSync::ThreadPoolMode mode : modes) {
+        NeuroSync::ThreadPool pool(2, mode);
+        
+        // Примусовий спін, щоб він працював і на одноядерній машині
+        // Forced spinning, so it is exercised on a single-core machine too
+        // Принудительный спин, чтобы он работал и на одноядерной машине
+        pool.setSpinCount(64);
+        assert(pool.getSpinCount() == 64);
+        
+        std::vector<std::future<void>> futures;
+        for (int i = 0; i < 200; ++i) {
+            futures.push_back(pool.enqueue([]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }));
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+        
+        // Робітник оновлює лічильники після того, як завдання віддало результат
+        // The worker updates its counters after the task has delivered its result
+        // Рабочий обновляет счетчики после того, как задача отдала результат
+        NeuroSync::ThreadPoolStatistics stats = pool.getStatistics();
+        while (stats.tasksExecuted < 200) {
+            std::this_thread::yield();
+            stats = pool.getStatistics();
+        }
+        assert(stats.tasksExecuted == 200);
+        assert(stats.threadCount == 2);
+        assert(stats.totalRunTime >= std::chrono::microseconds(200 * 200));
+        assert(stats.totalWaitTime.count() > 0);
+        assert(stats.utilization > 0.0 && stats.utilization <= 1.0);
+        
+        // Кожне завдання потрапляє рівно в один кошик гістограми; 200 завдань, поставлених разом, бачили чергу
+        // Every task lands in exactly one histogram bucket; 200 tasks submitted together saw a queue
+        // Каждая задача попадает ровно в одну корзину гистограммы; 200 задач, поставленных вместе, видели очередь
+        uint64_t histogramTotal = 0;
+        for (uint64_t count : stats.queueDepthHistogram) {
+            histogramTotal += count;
+        }
+        assert(histogramTotal == 200);
+        assert(stats.queueDepthHistogram[0] < 200);
+        
+        // Після скидання вікно починається з нуля
+        // After a reset the window starts from zero
+        // После сброса окно начинается с нуля
+        pool.resetStatistics();
+        stats = pool.getStatistics();
+        assert(stats.tasksExecuted == 0);
+        assert(stats.totalRunTime.count() == 0);
+        assert(stats.stealCount == 0);
+    }
+    
+    // Крадіжки рахуються в режимі WORK_STEALING
+    // Steals are counted in WORK_STEALING mode
+    // Кражи считаются в режиме WORK_STEALING
+    std::atomic<int> visited(0);
+    const int depth = 12;
+    const int expected = (1 << (depth + 1)) - 1;
+    NeuroSync::ThreadPool pool(4, NeuroSync::ThreadPoolMode::WORK_STEALING);
+    pool.enqueue([&pool, &visited]() {
+        spawnTree(pool, depth, visited);
+    });
+    while (visited.load() < expected) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    NeuroSync::ThreadPoolStatistics stats = pool.getStatistics();
+    assert(stats.stealCount <= stats.tasksExecuted);
+    assert(stats.tasksExecuted <= static_cast<uint64_t>(expected));
+    
+    std::cout << "Pool statistics test passed!" << std::endl;
+}
+
+// Тип з вирівнюванням більшим за вирівнювання блоків пулу
+// Type aligned beyond the pool's block alignment
+// Тип с выравниванием больше выравнивания блоков пула
+struct alignas(128) OverAlignedResult {
+    int value;
+};
+
+void testPooledAllocatorAlignment() {
+    std::cout << "Testing pooled allocator alignment..." << std::endl;
+
+    // Пряме виділення: кожен блок вирівняний до alignof(T), зокрема після повернення в обіг
+    // Direct allocation: every block is aligned to alignof(T), including after reuse
+    // Прямое выделение: каждый блок выровнен до alignof(T), в том числе после возврата в оборот
+    NeuroSync::PooledAllocator<OverAlignedResult> allocator;
+    for (int round = 0; round < 2; ++round) {
+        std::vector<OverAlignedResult*> blocks;
+        for (int i = 0; i < 100; ++i) {
+            blocks.push_back(allocator.allocate(1));
+            assert(reinterpret_cast<uintptr_t>(blocks.back()) % alignof(OverAlignedResult) == 0);
+        }
+        for (OverAlignedResult* block : blocks) {
+            allocator.deallocate(block, 1);
+        }
+    }
+
+    // Спільний стан future з вирівняним результатом
+    // Future shared state holding an over-aligned result
+    // Общее состояние future с выровненным результатом
+    NeuroSync::ThreadPool pool(2);
+    std::vector<std::future<OverAlignedResult>> futures;
+    for (int i = 0; i < 100; ++i) {
+        futures.push_back(pool.enqueue([i]() { return OverAlignedResult{i}; }));
+    }
+    for (int i = 0; i < 100; ++i) {
+        assert(futures[i].get().value == i);
+    }
+
+    // Вирівняний виклик, що не вміщується у вбудований буфер TaskFunction
+    // Over-aligned callable that does not fit the TaskFunction inline buffer
+    // Выровненный вызов, не помещающийся во встроенный буфер TaskFunction
+    std::vector<std::future<bool>> alignedCalls;
+    for (int i = 0; i < 100; ++i) {
+        OverAlignedResult captured{i};
+        alignedCalls.push_back(pool.enqueue([captured]() {
+            return reinterpret_cast<uintptr_t>(&captured) % alignof(OverAlignedResult) == 0;
+        }));
+    }
+    for (std::future<bool>& call : alignedCalls) {
+        assert(call.get());
+    }
+    pool.stop();
+
+    std::cout << "Pooled allocator alignment test passed!" << std::endl;
+}
+
 int main() {
     std::cout << "=== ThreadPool Tests ===" << std::endl;
     
@@ -175,6 +612,15 @@ int main() {
         testThreadPoolStop();
         testThreadPoolRestart();
         testExceptionHandling();
+        testWorkStealingManyTasks();
+        testWorkStealingRecursiveSpawn();
+        testWorkStealingStopDrains();
+        testWorkStealingRestart();
+        testPostAndMoveOnlyTasks();
+        testTaskFunction();
+        testResize();
+        testStatistics();
+        testPooledAllocatorAlignment();
         
         std::cout << "\nAll ThreadPool tests passed!" << std::endl;
     } catch (const std::exception& e) {
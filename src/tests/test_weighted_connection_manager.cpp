@@ -0,0 +1,463 @@
+#include "../synapse/utils/WeightedConnectionManager.h"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <iterator>
+#include <atomic>
+#include <cmath>
+#include <map>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Тести для менеджера зважених з'єднань
+// Tests for weighted connection manager
+// Тесты для менеджера взвешенных соединений
+
+using namespace NeuroSync::Synapse::Utils;
+
+void testBasicOperations() {
+    std::cout << "Testing basic connection operations..." << std::endl;
+
+    WeightedConnectionManager manager;
+    assert(manager.initialize());
+
+    assert(manager.createConnection(1, 2, 0.5));
+    assert(!manager.createConnection(1, 2, 0.7));
+    assert(manager.createConnection(1, 3, 0.25));
+    assert(manager.createConnection(-4, 1, 0.75));
+    assert(manager.createConnection(1, 1, 1.0));
+    assert(manager.getConnectionCount() == 4);
+
+    assert(manager.connectionExists(-4, 1));
+    assert(!manager.connectionExists(2, 1));
+    assert(manager.getConnectionWeight(1, 3) == 0.25);
+    assert(manager.updateConnectionWeight(1, 3, 0.3));
+    assert(manager.getConnectionWeight(1, 3) == 0.3);
+    assert(manager.deactivateConnection(1, 2));
+    assert(!manager.updateConnectionWeight(3, 1, 0.1));
+
+    assert(manager.getOutgoingConnectionCount(1) == 3);
+    assert(manager.getIncomingConnectionCount(1) == 2);
+    assert(manager.getOutgoingConnections(1).size() == 3);
+    assert(manager.getIncomingConnections(1).size() == 2);
+
+    // Петля 1->1 повертається лише один раз
+    // Self-loop 1->1 is returned only once
+    // Петля 1->1 возвращается только один раз
+    assert(manager.getConnectionsForNeuron(1).size() == 4);
+
+    assert(manager.removeConnection(1, 2));
+    assert(!manager.removeConnection(1, 2));
+    assert(!manager.connectionExists(1, 2));
+    assert(manager.getConnectionWeight(1, 3) == 0.3);
+    assert(manager.getOutgoingConnectionCount(1) == 2);
+    assert(manager.getIncomingConnectionCount(2) == 0);
+
+    std::cout << "Basic connection operations test passed!" << std::endl;
+}
+
+void testOutgoingSlice() {
+    std::cout << "Testing outgoing connection slices..." << std::endl;
+
+    WeightedConnectionManager manager;
+    assert(manager.initialize());
+
+    for (int source = 0; source < 50; ++source) {
+        for (int target = 0; target < source % 7; ++target) {
+            assert(manager.createConnection(source, 1000 + target, source + target * 0.5));
+        }
+    }
+
+    for (int source = 0; source < 50; ++source) {
+        ConnectionSlice slice = manager.getOutgoingConnectionSlice(source);
+        assert(slice.size() == static_cast<size_t>(source % 7));
+        std::set<int> targets;
+        for (const WeightedConnection& connection : slice) {
+            assert(connection.sourceNeuronId == source);
+            assert(connection.weight == source + (connection.targetNeuronId - 1000) * 0.5);
+            targets.insert(connection.targetNeuronId);
+        }
+        assert(targets.size() == slice.size());
+    }
+
+    // Оновлення ваги видно у зрізі без перебудови
+    // A weight update is visible in the slice without a rebuild
+    // Обновление веса видно в срезе без перестройки
+    assert(manager.updateConnectionWeight(6, 1003, 42.0));
+    bool found = false;
+    for (const WeightedConnection& connection : manager.getOutgoingConnectionSlice(6)) {
+        if (connection.targetNeuronId == 1003) {
+            found = connection.weight == 42.0;
+        }
+    }
+    assert(found);
+    assert(manager.getOutgoingConnectionSlice(7).empty());
+
+    std::cout << "Outgoing connection slice test passed!" << std::endl;
+}
+
+void testAgainstReference() {
+    std::cout << "Testing connection store against a reference map..." << std::endl;
+
+    WeightedConnectionManager manager;
+    assert(manager.initialize());
+    std::map<std::pair<int, int>, double> reference;
+
+    // Змішані вставки та видалення перевіряють видалення зсувом у хеш-таблиці
+    // Mixed inserts and erases exercise backward-shift deletion in the hash table
+    // Смешанные вставки и удаления проверяют удаление сдвигом в хеш-таблице
+    unsigned int state = 7;
+    for (int step = 0; step < 20000; ++step) {
+        state = state * 1103515245u + 12345u;
+        int source = static_cast<int>((state >> 8) % 64) - 32;
+        int target = static_cast<int>((state >> 16) % 64);
+        std::pair<int, int> key(source, target);
+        if ((state >> 4) % 3 == 0) {
+            assert(manager.removeConnection(source, target) == (reference.erase(key) == 1));
+        } else {
+            bool inserted = reference.emplace(key, step).second;
+            assert(manager.createConnection(source, target, step) == inserted);
+        }
+        if (step % 1000 == 0) {
+            manager.getOutgoingConnectionSlice(source);
+        }
+    }
+
+    assert(manager.getConnectionCount() == reference.size());
+    for (const auto& entry : reference) {
+        assert(manager.getConnectionWeight(entry.first.first, entry.first.second) == entry.second);
+    }
+
+    size_t outgoingTotal = 0;
+    size_t incomingTotal = 0;
+    for (int neuron = -32; neuron < 64; ++neuron) {
+        outgoingTotal += manager.getOutgoingConnectionSlice(neuron).size();
+        incomingTotal += manager.getIncomingConnections(neuron).size();
+        assert(manager.getOutgoingConnectionSlice(neuron).size() == manager.getOutgoingConnectionCount(neuron));
+        assert(manager.getIncomingConnections(neuron).size() == manager.getIncomingConnectionCount(neuron));
+    }
+    assert(outgoingTotal == reference.size());
+    assert(incomingTotal == reference.size());
+
+    std::cout << "Reference map test passed!" << std::endl;
+}
+
+void testInterleavedAdjacency() {
+    std::cout << "Testing adjacency queries interleaved with inserts and removals..." << std::endl;
+
+    WeightedConnectionManager manager;
+    assert(manager.initialize());
+    std::map<int, std::set<int>> outgoing;
+    std::map<int, std::set<int>> incoming;
+
+    // Запит суміжності після кожної зміни: рядки переносяться й ущільнюються, але завжди збігаються з еталоном
+    // An adjacency query after every change: rows move and get compacted but always match the reference
+    // Запрос смежности после каждого изменения: строки переносятся и уплотняются, но всегда совпадают с эталоном
+    unsigned int state = 29;
+    for (int step = 0; step < 60000; ++step) {
+        state = state * 1103515245u + 12345u;
+        int source = static_cast<int>((state >> 8) % 256);
+        int target = static_cast<int>((state >> 16) % 256);
+        if ((state >> 4) % 5 < 2) {
+            bool removed = outgoing[source].erase(target) == 1;
+            incoming[target].erase(source);
+            assert(manager.removeConnection(source, target) == removed);
+        } else {
+            bool inserted = outgoing[source].insert(target).second;
+            incoming[target].insert(source);
+            assert(manager.createConnection(source, target, source * 1000.0 + target) == inserted);
+        }
+
+        ConnectionSlice slice = manager.getOutgoingConnectionSlice(source);
+        assert(slice.size() == outgoing[source].size());
+        for (const WeightedConnection& connection : slice) {
+            assert(connection.sourceNeuronId == source);
+            assert(connection.weight == source * 1000.0 + connection.targetNeuronId);
+            assert(outgoing[source].count(connection.targetNeuronId) == 1);
+        }
+        if (step % 97 == 0) {
+            std::vector<WeightedConnection> in = manager.getIncomingConnections(target);
+            assert(in.size() == incoming[target].size());
+            for (const WeightedConnection& connection : in) {
+                assert(connection.targetNeuronId == target);
+                assert(incoming[target].count(connection.sourceNeuronId) == 1);
+            }
+        }
+    }
+
+    size_t total = 0;
+    for (const auto& entry : outgoing) {
+        total += entry.second.size();
+        assert(manager.getOutgoingConnectionCount(entry.first) == entry.second.size());
+    }
+    assert(manager.getConnectionCount() == total);
+    assert(manager.getConnectionsSortedByWeight().size() == total);
+
+    std::cout << "Interleaved adjacency test passed!" << std::endl;
+}
+
+void testStatisticsAndRankings() {
+    std::cout << "Testing incremental statistics and top-K rankings..." << std::endl;
+
+    WeightedConnectionManager manager;
+    assert(manager.initialize());
+    std::map<std::pair<int, int>, WeightedConnection> reference;
+
+    // Після кожної серії змін агрегати та top-K порівнюються з повним перерахунком
+    // After every batch of changes the aggregates and top-K are compared with a full recount
+    // После каждой серии изменений агрегаты и top-K сравниваются с полным пересчетом
+    unsigned int state = 11;
+    for (int step = 0; step < 6000; ++step) {
+        state = state * 1103515245u + 12345u;
+        int source = static_cast<int>((state >> 8) % 24);
+        int target = static_cast<int>((state >> 16) % 24);
+        std::pair<int, int> key(source, target);
+        double weight = ((state >> 4) % 50) / 10.0;
+        switch ((state >> 24) % 6) {
+            case 0:
+                manager.removeConnection(source, target);
+                reference.erase(key);
+                break;
+            case 1:
+                if (manager.updateConnectionWeight(source, target, weight)) {
+                    reference[key].weight = weight;
+                }
+                break;
+            case 2:
+                if (manager.deactivateConnection(source, target)) {
+                    reference[key].active = false;
+                }
+                break;
+            case 3:
+                manager.updateUsageStatistics(source, target);
+                if (reference.count(key)) {
+                    reference[key].usageCount++;
+                }
+                break;
+            default:
+                if (manager.createConnection(source, target, weight)) {
+                    reference[key] = WeightedConnection{source, target, weight, 0, 0, 0, true};
+                }
+                break;
+        }
+
+        if (step % 200 != 0) {
+            continue;
+        }
+
+        size_t active = 0;
+        size_t usage = 0;
+        double weightSum = 0.0;
+        std::vector<std::pair<double, int>> byWeight;
+        std::vector<std::pair<int, int>> byUsage;
+        for (const auto& entry : reference) {
+            active += entry.second.active ? 1 : 0;
+            usage += entry.second.usageCount;
+            weightSum += entry.second.weight;
+            byWeight.emplace_back(entry.second.weight, entry.first.first);
+            byUsage.emplace_back(entry.second.usageCount, entry.first.first);
+        }
+
+        WeightedConnectionManager::ConnectionStatistics stats = manager.getStatistics();
+        assert(stats.totalConnections == reference.size());
+        assert(stats.activeConnections == active);
+        assert(stats.inactiveConnections == reference.size() - active);
+        assert(stats.totalUsage == usage);
+        if (!reference.empty()) {
+            assert(std::fabs(stats.averageWeight - weightSum / reference.size()) < 1e-9);
+        }
+
+        std::sort(byWeight.rbegin(), byWeight.rend());
+        std::sort(byUsage.rbegin(), byUsage.rend());
+        std::vector<WeightedConnection> topWeight = manager.getTopConnectionsByWeight(10);
+        std::vector<WeightedConnection> topUsage = manager.getTopConnectionsByUsageCount(10);
+        assert(topWeight.size() == std::min<size_t>(10, reference.size()));
+        assert(topUsage.size() == topWeight.size());
+        for (size_t i = 0; i < topWeight.size(); ++i) {
+            assert(topWeight[i].weight == byWeight[i].first);
+            assert(topUsage[i].usageCount == byUsage[i].first);
+        }
+    }
+
+    // Найновіше використане з'єднання - перше за часом використання
+    // The most recently used connection comes first by usage time
+    // Последнее использованное соединение - первое по времени использования
+    std::vector<WeightedConnection> recent = manager.getTopConnectionsByUsageTime(reference.size());
+    assert(recent.size() == reference.size());
+    for (size_t i = 1; i < recent.size(); ++i) {
+        assert(recent[i - 1].lastUsedTime >= recent[i].lastUsedTime);
+    }
+
+    manager.clearAllConnections();
+    assert(manager.getStatistics().totalConnections == 0);
+    assert(manager.getStatistics().averageWeight == 0.0);
+    assert(manager.getTopConnectionsByWeight(5).empty());
+
+    std::cout << "Incremental statistics and top-K ranking test passed!" << std::endl;
+}
+
+void testReadOptimizedMode() {
+    std::cout << "Testing read-optimized connection snapshots..." << std::endl;
+
+    WeightedConnectionManager manager;
+    assert(manager.initialize(ConnectionConcurrencyMode::READ_OPTIMIZED));
+    assert(manager.getConcurrencyMode() == ConnectionConcurrencyMode::READ_OPTIMIZED);
+
+    for (int target = 0; target < 10; ++target) {
+        assert(manager.createConnection(1, target, target * 0.1));
+    }
+    assert(manager.getConnectionWeight(1, 4) == 0.4);
+    assert(manager.getOutgoingConnections(1).size() == 10);
+
+    // Оновлення полів видно в опублікованому знімку без його перебудови
+    // Field updates are visible in the published snapshot without a rebuild
+    // Обновления полей видны в опубликованном снимке без его перестройки
+    assert(manager.updateConnectionWeight(1, 4, 4.0));
+    assert(manager.deactivateConnection(1, 5));
+    manager.updateUsageStatistics(1, 6);
+    assert(manager.getConnectionWeight(1, 4) == 4.0);
+    size_t visited = 0;
+    manager.forEachOutgoingConnection(1, [&visited](const WeightedConnection& connection) {
+        assert(connection.active == (connection.targetNeuronId != 5));
+        assert(connection.usageCount == (connection.targetNeuronId == 6 ? 1 : 0));
+        visited++;
+    });
+    assert(visited == 10);
+
+    // Структурні зміни видно після повторної публікації
+    // Structural changes are visible after republishing
+    // Структурные изменения видны после повторной публикации
+    assert(manager.removeConnection(1, 4));
+    assert(!manager.connectionExists(1, 4));
+    assert(manager.getConnectionWeight(1, 4) == 0.0);
+    assert(manager.createConnection(1, 42, 2.5));
+    assert(manager.getConnectionWeight(1, 42) == 2.5);
+    assert(manager.getOutgoingConnections(1).size() == 10);
+
+    std::cout << "Read-optimized connection snapshot test passed!" << std::endl;
+}
+
+void testReadOptimizedStructuralChanges() {
+    std::cout << "Testing read-optimized snapshots across structural changes..." << std::endl;
+
+    WeightedConnectionManager manager;
+    assert(manager.initialize(ConnectionConcurrencyMode::READ_OPTIMIZED));
+    std::map<std::pair<int, int>, double> reference;
+
+    // 128 джерел перевищують поріг замінених рядків, тому знімок чергує часткові та повні публікації
+    // 128 sources exceed the replaced-row limit, so the snapshot alternates partial and full publications
+    // 128 источников превышают порог замененных строк, поэтому снимок чередует частичные и полные публикации
+    unsigned int state = 11;
+    for (int step = 0; step < 20000; ++step) {
+        state = state * 1103515245u + 12345u;
+        int source = static_cast<int>((state >> 8) % 128);
+        int target = static_cast<int>((state >> 16) % 32);
+        std::pair<int, int> key(source, target);
+        unsigned int action = (state >> 4) % 4;
+        if (action == 0) {
+            assert(manager.removeConnection(source, target) == (reference.erase(key) == 1));
+        } else if (action == 1 && reference.count(key)) {
+            assert(manager.updateConnectionWeight(source, target, step));
+            reference[key] = step;
+        } else {
+            bool inserted = reference.emplace(key, step).second;
+            assert(manager.createConnection(source, target, step) == inserted);
+        }
+
+        // Рядок зміненого джерела у знімку збігається з еталоном
+        // The changed source's row in the snapshot matches the reference
+        // Строка измененного источника в снимке совпадает с эталоном
+        std::map<int, double> row;
+        manager.forEachOutgoingConnection(source, [&row, source](const WeightedConnection& connection) {
+            assert(connection.sourceNeuronId == source);
+            assert(row.emplace(connection.targetNeuronId, connection.weight).second);
+        });
+        auto first = reference.lower_bound(std::make_pair(source, 0));
+        auto last = reference.lower_bound(std::make_pair(source + 1, 0));
+        assert(row.size() == static_cast<size_t>(std::distance(first, last)));
+        for (auto it = first; it != last; ++it) {
+            assert(row[it->first.second] == it->second);
+        }
+        assert(manager.connectionExists(source, target) == (reference.count(key) == 1));
+    }
+
+    for (int source = 0; source < 128; ++source) {
+        for (int target = 0; target < 32; ++target) {
+            auto it = reference.find(std::make_pair(source, target));
+            assert(manager.getConnectionWeight(source, target) == (it == reference.end() ? 0.0 : it->second));
+        }
+    }
+
+    std::cout << "Read-optimized structural change test passed!" << std::endl;
+}
+
+void testConcurrentReaders() {
+    std::cout << "Testing concurrent readers with an active writer..." << std::endl;
+
+    WeightedConnectionManager manager;
+    assert(manager.initialize(ConnectionConcurrencyMode::READ_OPTIMIZED));
+    for (int source = 0; source < 32; ++source) {
+        for (int target = 0; target < 8; ++target) {
+            assert(manager.createConnection(source, target, 1.0));
+        }
+    }
+
+    // Письменник змінює ваги та структуру; читачі бачать лише коректні значення
+    // The writer changes weights and structure; readers only see valid values
+    // Писатель меняет веса и структуру; читатели видят только корректные значения
+    std::atomic<bool> done(false);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&manager, &done, r]() {
+            int source = r;
+            while (!done.load()) {
+                double weight = manager.getConnectionWeight(source, 3);
+                assert(weight >= 1.0 && weight <= 2.0);
+                size_t count = 0;
+                manager.forEachOutgoingConnection(source, [&count, source](const WeightedConnection& connection) {
+                    assert(connection.sourceNeuronId == source);
+                    assert(connection.weight >= 0.0 && connection.weight <= 2.0);
+                    count++;
+                });
+                assert(count >= 8 && count <= 9);
+                source = (source + 1) % 32;
+            }
+        });
+    }
+
+    for (int round = 0; round < 200; ++round) {
+        for (int source = 0; source < 32; ++source) {
+            assert(manager.updateConnectionWeight(source, 3, 1.0 + (round % 2)));
+        }
+        int source = round % 32;
+        assert(manager.createConnection(source, 100, 0.0));
+        assert(manager.removeConnection(source, 100));
+    }
+    done = true;
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    assert(manager.getConnectionCount() == 32 * 8);
+    assert(manager.getConnectionWeight(0, 3) == 2.0);
+
+    std::cout << "Concurrent reader test passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running weighted connection manager tests..." << std::endl;
+
+    testBasicOperations();
+    testOutgoingSlice();
+    testAgainstReference();
+    testInterleavedAdjacency();
+    testStatisticsAndRankings();
+    testReadOptimizedMode();
+    testReadOptimizedStructuralChanges();
+    testConcurrentReaders();
+
+    std::cout << "All weighted connection manager tests passed!" << std::endl;
+    return 0;
+}
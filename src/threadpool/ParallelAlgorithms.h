@@ -0,0 +1,303 @@
+#ifndef PARALLEL_ALGORITHMS_H
+#define PARALLEL_ALGORITHMS_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ThreadPool.h"
+#include "TaskStatePool.h"
+#include "../core/utils/BoundedMpmcRing.h"
+
+// ParallelAlgorithms.h
+// Паралельні цикли, згортка та перетворення поверх ThreadPool
+// Parallel loops, reduction and transform on top of ThreadPool
+// Параллельные циклы, свертка и преобразование поверх ThreadPool
+
+namespace NeuroSync {
+
+    // Автоматичний вибір розміру порції
+    // Automatic chunk size selection
+    // Автоматический выбор размера порции
+    const size_t AUTO_GRAIN = 0;
+
+    namespace Detail {
+
+        // Порцій на учасника при автоматичному виборі: більше порцій - краще вирівнювання навантаження,
+        // менше - менше накладних витрат на їх захоплення
+        // Chunks per participant with automatic selection: more chunks balance the load better,
+        // fewer cost less to claim
+        // Порций на участника при автоматическом выборе: больше порций - лучше выравнивание нагрузки,
+        // меньше - меньше накладных расходов на их захват
+        const size_t CHUNKS_PER_PARTICIPANT = 4;
+
+        // Стан одного паралельного циклу.
+        // Порції захоплюються атомарним лічильником і викликачем, і помічниками з пулу.
+        // Викликач чекає лише на порції, які вже хтось виконує, тому виклик з робітника того ж пулу
+        // (вкладений паралелізм) не блокується на завданнях-помічниках, що ще стоять у черзі:
+        // такі помічники запускаються пізніше, бачать, що порцій не лишилося, і виходять.
+        // Стан належить спільно викликачу та помічникам, а тіло циклу - лише викликачу.
+        // State of one parallel loop.
+        // Chunks are claimed through an atomic counter by both the caller and helpers from the pool.
+        // The caller waits only for chunks somebody is already running, so a call from a worker of the same pool
+        // (nested parallelism) does not block on helper tasks still sitting in the queue:
+        // such helpers start later, see that no chunks are left and exit.
+        // The state is shared by the caller and the helpers, while the loop body belongs to the caller only.
+        // Состояние одного параллельного цикла.
+        // Порции захватываются атомарным счетчиком и вызывающим, и помощниками из пула.
+        // Вызывающий ждет только порции, которые уже кто-то выполняет, поэтому вызов из рабочего того же пула
+        // (вложенный параллелизм) не блокируется на задачах-помощниках, которые еще стоят в очереди:
+        // такие помощники запускаются позже, видят, что порций не осталось, и выходят.
+        // Состояние принадлежит совместно вызывающему и помощникам, а тело цикла - только вызывающему.
+        class ParallelLoopState {
+        public:
+            ParallelLoopState(size_t size, size_t grain)
+                : size(size), grain(grain), chunkCount((size + grain - 1) / grain),
+                  nextChunk(0), finishedChunks(0), body(nullptr), context(nullptr) {}
+
+            // Виконання порцій, доки вони є; тіло викликається з [begin, end) у межах діапазону
+            // Run chunks while there are any; the body is called with [begin, end) within the range
+            // Выполнение порций, пока они есть; тело вызывается с [begin, end) в пределах диапазона
+            void runChunks() {
+                while (true) {
+                    size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+                    if (chunk >= chunkCount) {
+                        return;
+                    }
+                    size_t begin = chunk * grain;
+                    size_t end = std::min(size, begin + grain);
+                    try {
+                        body(context, chunk, begin, end);
+                    } catch (...) {
+                        recordException(std::current_exception());
+                    }
+                    finishChunk();
+                }
+            }
+
+            // Очікування завершення всіх захоплених порцій та передача першого винятку
+            // Wait for all claimed chunks to finish and rethrow the first exception
+            // Ожидание завершения всех захваченных порций и передача первого исключения
+            void wait() {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this] { return finishedChunks.load() == chunkCount; });
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+
+            size_t getChunkCount() const { return chunkCount; }
+
+            template<typename Body>
+            void setBody(Body& callable) {
+                context = &callable;
+                body = [](void* target, size_t chunk, size_t begin, size_t end) {
+                    (*static_cast<Body*>(target))(chunk, begin, end);
+                };
+            }
+
+        private:
+            // Після винятку решта порцій не виконується, але рахується завершеною
+            // After an exception the remaining chunks are not run but are counted as finished
+            // После исключения остальные порции не выполняются, но считаются завершенными
+            void recordException(std::exception_ptr error) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!exception) {
+                    exception = error;
+                }
+                size_t skipped = nextChunk.exchange(chunkCount);
+                if (skipped < chunkCount) {
+                    finishedChunks.fetch_add(chunkCount - skipped);
+                }
+            }
+
+            void finishChunk() {
+                if (finishedChunks.fetch_add(1) + 1 == chunkCount) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    condition.notify_all();
+                }
+            }
+
+            const size_t size;
+            const size_t grain;
+            const size_t chunkCount;
+            std::atomic<size_t> nextChunk;
+            std::atomic<size_t> finishedChunks;
+
+            void (*body)(void* context, size_t chunk, size_t begin, size_t end);
+            void* context;
+
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::exception_ptr exception;
+        };
+
+        // Розмір порції: заданий або такий, щоб кожному учаснику дісталося CHUNKS_PER_PARTICIPANT порцій
+        // Chunk size: the given one, or one giving every participant CHUNKS_PER_PARTICIPANT chunks
+        // Размер порции: заданный или такой, чтобы каждому участнику досталось CHUNKS_PER_PARTICIPANT порций
+        inline size_t selectGrain(const ThreadPool& pool, size_t size, size_t grain) {
+            if (grain != AUTO_GRAIN) {
+                return grain;
+            }
+            size_t participants = pool.getThreadCount() + 1;
+            size_t chunks = participants * CHUNKS_PER_PARTICIPANT;
+            return std::max<size_t>(1, (size + chunks - 1) / chunks);
+        }
+
+        // Виконання body(chunk, begin, end) для всіх порцій [0, size); викликач бере участь у роботі
+        // Run body(chunk, begin, end) for every chunk of [0, size); the caller takes part in the work
+        // Выполнение body(chunk, begin, end) для всех порций [0, size); вызывающий участвует в работе
+        template<typename Body>
+        void runChunked(ThreadPool& pool, size_t size, size_t grain, Body& body) {
+            if (size == 0) {
+                return;
+            }
+            if (size <= grain) {
+                body(size_t(0), size_t(0), size);
+                return;
+            }
+
+            std::shared_ptr<ParallelLoopState> state = std::allocate_shared<ParallelLoopState>(
+                PooledAllocator<ParallelLoopState>(), size, grain);
+            state->setBody(body);
+
+            // Помічників не більше, ніж потоків пулу та порцій понад ту, що візьме викликач.
+            // Зупинений пул відхиляє завдання - тоді решту порцій виконує викликач.
+            // No more helpers than pool threads and chunks beyond the one the caller takes.
+            // A stopped pool rejects tasks - then the caller runs the remaining chunks itself.
+            // Помощников не больше, чем потоков пула и порций сверх той, что возьмет вызывающий.
+            // Остановленный пул отклоняет задачи - тогда остальные порции выполняет вызывающий.
+            size_t helpers = std::min(pool.getThreadCount(), state->getChunkCount() - 1);
+            for (size_t i = 0; i < helpers; ++i) {
+                try {
+                    pool.post([state]() { state->runChunks(); });
+                } catch (const std::runtime_error&) {
+                    break;
+                }
+            }
+
+            state->runChunks();
+            state->wait();
+        }
+
+        // Результат однієї порції згортки в окремій кеш-лінії: порції пишуться з різних потоків,
+        // а std::vector<bool> пакує сусідні значення в одне слово (гонка) і навіть звичайні T ділили б лінії
+        // One chunk's reduction result on a cache line of its own: chunks are written from different threads,
+        // while std::vector<bool> packs neighbouring values into one word (a race) and even plain T would share lines
+        // Результат одной порции свертки в отдельной кеш-линии: порции пишутся из разных потоков,
+        // а std::vector<bool> пакует соседние значения в одно слово (гонка) и даже обычные T делили бы линии
+        template<typename T>
+        struct alignas(Core::Utils::CACHE_LINE_SIZE) ReducePartial {
+            T value;
+
+            explicit ReducePartial(const T& initial) : value(initial) {}
+        };
+
+    } // namespace Detail
+
+    // Паралельний цикл за порціями: body(begin, end) для підряд [begin, end) діапазону [first, last).
+    // grain - розмір порції (AUTO_GRAIN - автоматично). Повертається, коли виконано всі порції;
+    // перший виняток з тіла передається викликачу, а невиконані порції після нього пропускаються.
+    // Можна викликати з робітника того ж пулу.
+    // Chunked parallel loop: body(begin, end) for consecutive sub-ranges [begin, end) of [first, last).
+    // grain is the chunk size (AUTO_GRAIN - automatic). Returns once every chunk has run;
+    // the first exception from the body is passed to the caller, and chunks not yet run after it are skipped.
+    // May be called from a worker of the same pool.
+    // Параллельный цикл по порциям: body(begin, end) для подряд [begin, end) диапазона [first, last).
+    // grain - размер порции (AUTO_GRAIN - автоматически). Возвращается, когда выполнены все порции;
+    // первое исключение из тела передается вызывающему, а невыполненные порции после него пропускаются.
+    // Можно вызывать из рабочего того же пула.
+    template<typename Index, typename Body>
+    void parallelForRange(ThreadPool& pool, Index first, Index last, Body&& body, size_t grain = AUTO_GRAIN) {
+        static_assert(std::is_integral<Index>::value, "parallelForRange requires an integral index");
+        if (last <= first) {
+            return;
+        }
+        size_t size = static_cast<size_t>(last - first);
+        auto chunkBody = [&body, first](size_t, size_t begin, size_t end) {
+            body(static_cast<Index>(first + static_cast<Index>(begin)), static_cast<Index>(first + static_cast<Index>(end)));
+        };
+        Detail::runChunked(pool, size, Detail::selectGrain(pool, size, grain), chunkBody);
+    }
+
+    // Паралельний цикл: body(i) для кожного i з [first, last)
+    // Parallel loop: body(i) for every i in [first, last)
+    // Параллельный цикл: body(i) для каждого i из [first, last)
+    template<typename Index, typename Body>
+    void parallelFor(ThreadPool& pool, Index first, Index last, Body&& body, size_t grain = AUTO_GRAIN) {
+        parallelForRange(pool, first, last, [&body](Index begin, Index end) {
+            for (Index i = begin; i < end; ++i) {
+                body(i);
+            }
+        }, grain);
+    }
+
+    // Паралельна згортка діапазону [first, last).
+    // rangeReduce(begin, end, init) згортає порцію, починаючи з init (identity), combine(a, b) об'єднує
+    // результати порцій. Результати порцій об'єднуються зліва направо в порядку порцій, тому при тому самому
+    // розмірі порції результат відтворюваний і для неасоціативних на практиці операцій (додавання double).
+    // Parallel reduction of [first, last).
+    // rangeReduce(begin, end, init) reduces a chunk starting from init (identity), combine(a, b) merges
+    // chunk results. Chunk results are merged left to right in chunk order, so with the same chunk size
+    // the result is reproducible even for operations that are not associative in practice (double addition).
+    // Параллельная свертка диапазона [first, last).
+    // rangeReduce(begin, end, init) сворачивает порцию, начиная с init (identity), combine(a, b) объединяет
+    // результаты порций. Результаты порций объединяются слева направо в порядке порций, поэтому при том же
+    // размере порции результат воспроизводим и для неассоциативных на практике операций (сложение double).
+    template<typename Index, typename T, typename RangeReduce, typename Combine>
+    T parallelReduce(ThreadPool& pool, Index first, Index last, T identity,
+                     RangeReduce&& rangeReduce, Combine&& combine, size_t grain = AUTO_GRAIN) {
+        static_assert(std::is_integral<Index>::value, "parallelReduce requires an integral index");
+        if (last <= first) {
+            return identity;
+        }
+        size_t size = static_cast<size_t>(last - first);
+        grain = Detail::selectGrain(pool, size, grain);
+
+        std::vector<Detail::ReducePartial<T>> partials((size + grain - 1) / grain, Detail::ReducePartial<T>(identity));
+        auto chunkBody = [&](size_t chunk, size_t begin, size_t end) {
+            partials[chunk].value = rangeReduce(static_cast<Index>(first + static_cast<Index>(begin)),
+                                          static_cast<Index>(first + static_cast<Index>(end)), identity);
+        };
+        Detail::runChunked(pool, size, grain, chunkBody);
+
+        T result = std::move(identity);
+        for (Detail::ReducePartial<T>& partial : partials) {
+            result = combine(std::move(result), std::move(partial.value));
+        }
+        return result;
+    }
+
+    // Паралельне перетворення: *(output + i) = transform(*(first + i)) для кожного елемента [first, last).
+    // Ітератори довільного доступу; вихідний діапазон має вміщати всі елементи.
+    // Parallel transform: *(output + i) = transform(*(first + i)) for every element of [first, last).
+    // Random access iterators; the output range must hold every element.
+    // Параллельное преобразование: *(output + i) = transform(*(first + i)) для каждого элемента [first, last).
+    // Итераторы произвольного доступа; выходной диапазон должен вмещать все элементы.
+    template<typename InputIterator, typename OutputIterator, typename Transform>
+    OutputIterator parallelTransform(ThreadPool& pool, InputIterator first, InputIterator last,
+                                     OutputIterator output, Transform&& transform, size_t grain = AUTO_GRAIN) {
+        static_assert(std::is_base_of<std::random_access_iterator_tag,
+                          typename std::iterator_traits<InputIterator>::iterator_category>::value &&
+                      std::is_base_of<std::random_access_iterator_tag,
+                          typename std::iterator_traits<OutputIterator>::iterator_category>::value,
+                      "parallelTransform requires random access iterators");
+        typedef typename std::iterator_traits<InputIterator>::difference_type Difference;
+        Difference count = last - first;
+        parallelForRange(pool, Difference(0), count, [&](Difference begin, Difference end) {
+            std::transform(first + begin, first + end, output + begin, transform);
+        }, grain);
+        return output + count;
+    }
+
+} // namespace NeuroSync
+
+#endif // PARALLEL_ALGORITHMS_H
@@ -0,0 +1,254 @@
+#ifndef TASK_FUNCTION_H
+#define TASK_FUNCTION_H
+
+#include <cstddef>
+#include <future>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "TaskStatePool.h"
+
+// TaskFunction.h
+// Переміщуване завдання пулу потоків з вбудованим буфером
+// Move-only thread pool task with an inline buffer
+// Перемещаемая задача пула потоков со встроенным буфером
+
+namespace NeuroSync {
+
+    // Переміщуваний виклик void() з вбудованим буфером на INLINE_SIZE байт.
+    // На відміну від std::function не вимагає копіювання (тому може тримати std::promise),
+    // а об'єкти, що не влізли в буфер, розміщуються в TaskStatePool, а не в глобальній купі.
+    // Move-only void() callable with an inline buffer of INLINE_SIZE bytes.
+    // Unlike std::function it does not require copyability (so it can hold a std::promise),
+    // and objects that do not fit the buffer are placed in TaskStatePool rather than the global heap.
+    // Перемещаемый вызов void() со встроенным буфером на INLINE_SIZE байт.
+    // В отличие от std::function не требует копируемости (поэтому может держать std::promise),
+    // а объекты, не поместившиеся в буфер, размещаются в TaskStatePool, а не в глобальной куче.
+    class TaskFunction {
+    public:
+        static const size_t INLINE_SIZE = 48;
+
+        TaskFunction() noexcept : ops(nullptr) {}
+
+        template<typename F,
+                 typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, TaskFunction>::value>::type>
+        TaskFunction(F&& function) : ops(nullptr) {
+            typedef typename std::decay<F>::type Callable;
+            construct<Callable>(std::forward<F>(function), std::integral_constant<bool, fitsInline<Callable>()>());
+        }
+
+        TaskFunction(TaskFunction&& other) noexcept : ops(nullptr) {
+            moveFrom(other);
+        }
+
+        TaskFunction& operator=(TaskFunction&& other) noexcept {
+            if (this != &other) {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        TaskFunction(const TaskFunction&) = delete;
+        TaskFunction& operator=(const TaskFunction&) = delete;
+
+        ~TaskFunction() {
+            reset();
+        }
+
+        void operator()() {
+            ops->invoke(storage);
+        }
+
+        explicit operator bool() const noexcept {
+            return ops != nullptr;
+        }
+
+    private:
+        // Таблиця операцій над збереженим викликом
+        // Operation table for the stored callable
+        // Таблица операций над сохраненным вызовом
+        struct Ops {
+            void (*invoke)(void* storage);
+            void (*relocate)(void* destination, void* source);
+            void (*destroy)(void* storage);
+        };
+
+        template<typename Callable>
+        static constexpr bool fitsInline() {
+            return sizeof(Callable) <= INLINE_SIZE &&
+                   alignof(Callable) <= alignof(std::max_align_t) &&
+                   std::is_nothrow_move_constructible<Callable>::value;
+        }
+
+        // Виклик у вбудованому буфері
+        // Callable in the inline buffer
+        // Вызов во встроенном буфере
+        template<typename Callable>
+        struct InlineOps {
+            static void invoke(void* storage) {
+                (*static_cast<Callable*>(storage))();
+            }
+            static void relocate(void* destination, void* source) noexcept {
+                Callable* from = static_cast<Callable*>(source);
+                new (destination) Callable(std::move(*from));
+                from->~Callable();
+            }
+            static void destroy(void* storage) noexcept {
+                static_cast<Callable*>(storage)->~Callable();
+            }
+            static const Ops table;
+        };
+
+        // Виклик у блоці пулу; у буфері лежить лише вказівник
+        // Callable in a pool block; the buffer holds only a pointer
+        // Вызов в блоке пула; в буфере лежит только указатель
+        template<typename Callable>
+        struct PooledOps {
+            static Callable* get(void* storage) {
+                return *static_cast<Callable**>(storage);
+            }
+            static void invoke(void* storage) {
+                (*get(storage))();
+            }
+            static void relocate(void* destination, void* source) noexcept {
+                new (destination) Callable*(get(source));
+            }
+            static void destroy(void* storage) noexcept {
+                Callable* callable = get(storage);
+                callable->~Callable();
+                PooledAllocator<Callable>().deallocate(callable, 1);
+            }
+            static const Ops table;
+        };
+
+        template<typename Callable, typename F>
+        void construct(F&& function, std::true_type) {
+            new (storage) Callable(std::forward<F>(function));
+            ops = &InlineOps<Callable>::table;
+        }
+
+        template<typename Callable, typename F>
+        void construct(F&& function, std::false_type) {
+            // Розміщення через PooledAllocator враховує вирівнювання Callable
+            // Allocation through PooledAllocator honours the alignment of Callable
+            // Размещение через PooledAllocator учитывает выравнивание Callable
+            Callable* block = PooledAllocator<Callable>().allocate(1);
+            try {
+                new (block) Callable(std::forward<F>(function));
+            } catch (...) {
+                PooledAllocator<Callable>().deallocate(block, 1);
+                throw;
+            }
+            new (storage) Callable*(block);
+            ops = &PooledOps<Callable>::table;
+        }
+
+        void moveFrom(TaskFunction& other) noexcept {
+            if (other.ops != nullptr) {
+                other.ops->relocate(storage, other.storage);
+                ops = other.ops;
+                other.ops = nullptr;
+            }
+        }
+
+        void reset() noexcept {
+            if (ops != nullptr) {
+                ops->destroy(storage);
+                ops = nullptr;
+            }
+        }
+
+        const Ops* ops;
+        alignas(std::max_align_t) unsigned char storage[INLINE_SIZE];
+    };
+
+    template<typename Callable>
+    const TaskFunction::Ops TaskFunction::InlineOps<Callable>::table = {
+        &TaskFunction::InlineOps<Callable>::invoke,
+        &TaskFunction::InlineOps<Callable>::relocate,
+        &TaskFunction::InlineOps<Callable>::destroy
+    };
+
+    template<typename Callable>
+    const TaskFunction::Ops TaskFunction::PooledOps<Callable>::table = {
+        &TaskFunction::PooledOps<Callable>::invoke,
+        &TaskFunction::PooledOps<Callable>::relocate,
+        &TaskFunction::PooledOps<Callable>::destroy
+    };
+
+    // Функція з прив'язаними аргументами без std::bind. Завдання виконується один раз, тому функція
+    // та аргументи передаються як rvalue - це точно відповідає std::result_of<F(Args...)> і дозволяє
+    // переміщувані аргументи.
+    // A function with bound arguments without std::bind. A task runs once, so the function and the
+    // arguments are passed as rvalues - this matches std::result_of<F(Args...)> exactly and allows
+    // move-only arguments.
+    // Функция с привязанными аргументами без std::bind. Задача выполняется один раз, поэтому функция
+    // и аргументы передаются как rvalue - это точно соответствует std::result_of<F(Args...)> и позволяет
+    // перемещаемые аргументы.
+    template<typename F, typename... Args>
+    class BoundTaskCall {
+    public:
+        template<typename G, typename... CallArgs>
+        explicit BoundTaskCall(G&& function, CallArgs&&... args)
+            : function(std::forward<G>(function)), arguments(std::forward<CallArgs>(args)...) {}
+
+        auto operator()() -> decltype(std::declval<F>()(std::declval<Args>()...)) {
+            return call(std::index_sequence_for<Args...>());
+        }
+
+    private:
+        template<size_t... Indices>
+        auto call(std::index_sequence<Indices...>) -> decltype(std::declval<F>()(std::declval<Args>()...)) {
+            return std::move(function)(std::move(std::get<Indices>(arguments))...);
+        }
+
+        F function;
+        std::tuple<Args...> arguments;
+    };
+
+    // Виклик, результат або виняток якого передається в std::promise
+    // A call whose result or exception is delivered to a std::promise
+    // Вызов, результат или исключение которого передается в std::promise
+    template<typename Result, typename Call>
+    class PromiseTaskCall {
+    public:
+        PromiseTaskCall(std::promise<Result>&& promise, Call&& call)
+            : promise(std::move(promise)), call(std::move(call)) {}
+
+        void operator()() {
+            try {
+                promise.set_value(call());
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        }
+
+    private:
+        std::promise<Result> promise;
+        Call call;
+    };
+
+    template<typename Call>
+    class PromiseTaskCall<void, Call> {
+    public:
+        PromiseTaskCall(std::promise<void>&& promise, Call&& call)
+            : promise(std::move(promise)), call(std::move(call)) {}
+
+        void operator()() {
+            try {
+                call();
+                promise.set_value();
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        }
+
+    private:
+        std::promise<void> promise;
+        Call call;
+    };
+
+} // namespace NeuroSync
+
+#endif // TASK_FUNCTION_H
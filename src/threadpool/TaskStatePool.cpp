@@ -0,0 +1,170 @@
+#include "TaskStatePool.h"
+#include <mutex>
+#include <vector>
+
+// TaskStatePool.cpp
+// Реалізація пулу блоків для станів завдань
+// Task state block pool implementation
+// Реализация пула блоков для состояний задач
+
+namespace NeuroSync {
+
+    namespace {
+
+        const size_t SIZE_CLASS_COUNT = 4;
+        const size_t MIN_BLOCK_SIZE = 64;
+
+        // Розмір пачки, якою кеш обмінюється зі складом, та межа кешу
+        // Batch size exchanged between a cache and the depot, and the cache limit
+        // Размер пачки, которой кэш обменивается со складом, и предел кэша
+        const size_t BATCH_SIZE = 32;
+        const size_t CACHE_LIMIT = BATCH_SIZE * 2;
+
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        size_t sizeClassFor(size_t bytes) {
+            size_t sizeClass = 0;
+            size_t blockSize = MIN_BLOCK_SIZE;
+            while (blockSize < bytes) {
+                blockSize *= 2;
+                sizeClass++;
+            }
+            return sizeClass;
+        }
+
+        size_t blockSizeFor(size_t sizeClass) {
+            return MIN_BLOCK_SIZE << sizeClass;
+        }
+
+        // Спільний склад пачок вільних блоків
+        // Shared depot of free block batches
+        // Общий склад пачек свободных блоков
+        struct Depot {
+            std::mutex mutex;
+            std::vector<FreeBlock*> batches[SIZE_CLASS_COUNT];
+        };
+
+        Depot& depot() {
+            // Склад ніколи не знищується, щоб кеші потоків могли повертати блоки при завершенні програми
+            // The depot is never destroyed so thread caches can return blocks during program exit
+            // Склад никогда не уничтожается, чтобы кэши потоков могли возвращать блоки при завершении программы
+            static Depot* instance = new Depot();
+            return *instance;
+        }
+
+        // Ознака того, що кеш потоку вже знищено (звільнення з деструкторів thread_local після нього)
+        // Marks that the thread cache is already destroyed (frees from thread_local destructors after it)
+        // Признак того, что кэш потока уже уничтожен (освобождения из деструкторов thread_local после него)
+        thread_local bool threadCacheDestroyed = false;
+
+        // Кеш вільних блоків потоку
+        // Per-thread free block cache
+        // Кэш свободных блоков потока
+        struct ThreadCache {
+            FreeBlock* heads[SIZE_CLASS_COUNT];
+            size_t counts[SIZE_CLASS_COUNT];
+
+            ThreadCache() {
+                for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i) {
+                    heads[i] = nullptr;
+                    counts[i] = 0;
+                }
+            }
+
+            // Блоки потоку, що завершується, переходять на склад
+            // Blocks of an exiting thread move to the depot
+            // Блоки завершающегося потока переходят на склад
+            ~ThreadCache() {
+                threadCacheDestroyed = true;
+                Depot& shared = depot();
+                std::lock_guard<std::mutex> lock(shared.mutex);
+                for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i) {
+                    if (heads[i] != nullptr) {
+                        shared.batches[i].push_back(heads[i]);
+                    }
+                }
+            }
+        };
+
+        ThreadCache& threadCache() {
+            thread_local ThreadCache cache;
+            return cache;
+        }
+
+    } // namespace
+
+    void* TaskStatePool::allocate(size_t bytes) {
+        if (bytes > MAX_POOLED_SIZE) {
+            return ::operator new(bytes);
+        }
+
+        size_t sizeClass = sizeClassFor(bytes);
+        if (threadCacheDestroyed) {
+            return ::operator new(blockSizeFor(sizeClass));
+        }
+        ThreadCache& cache = threadCache();
+        if (cache.heads[sizeClass] == nullptr) {
+            // Поповнення кешу цілою пачкою зі складу
+            // Refill the cache with a whole batch from the depot
+            // Пополнение кэша целой пачкой со склада
+            Depot& shared = depot();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            std::vector<FreeBlock*>& batches = shared.batches[sizeClass];
+            if (!batches.empty()) {
+                cache.heads[sizeClass] = batches.back();
+                batches.pop_back();
+                size_t count = 0;
+                for (FreeBlock* block = cache.heads[sizeClass]; block != nullptr; block = block->next) {
+                    count++;
+                }
+                cache.counts[sizeClass] = count;
+            }
+        }
+
+        FreeBlock* block = cache.heads[sizeClass];
+        if (block == nullptr) {
+            return ::operator new(blockSizeFor(sizeClass));
+        }
+        cache.heads[sizeClass] = block->next;
+        cache.counts[sizeClass]--;
+        return block;
+    }
+
+    void TaskStatePool::deallocate(void* pointer, size_t bytes) {
+        if (pointer == nullptr) {
+            return;
+        }
+        if (bytes > MAX_POOLED_SIZE || threadCacheDestroyed) {
+            ::operator delete(pointer);
+            return;
+        }
+
+        size_t sizeClass = sizeClassFor(bytes);
+        ThreadCache& cache = threadCache();
+        FreeBlock* block = static_cast<FreeBlock*>(pointer);
+        block->next = cache.heads[sizeClass];
+        cache.heads[sizeClass] = block;
+        cache.counts[sizeClass]++;
+
+        if (cache.counts[sizeClass] >= CACHE_LIMIT) {
+            // Відокремлення пачки BATCH_SIZE блоків з голови списку і передача на склад
+            // Detach a batch of BATCH_SIZE blocks from the head of the list and hand it to the depot
+            // Отделение пачки из BATCH_SIZE блоков с головы списка и передача на склад
+            FreeBlock* batch = cache.heads[sizeClass];
+            FreeBlock* last = batch;
+            for (size_t i = 1; i < BATCH_SIZE; ++i) {
+                last = last->next;
+            }
+            cache.heads[sizeClass] = last->next;
+            cache.counts[sizeClass] -= BATCH_SIZE;
+            last->next = nullptr;
+
+            Depot& shared = depot();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            shared.batches[sizeClass].push_back(batch);
+        }
+    }
+
+} // namespace NeuroSync
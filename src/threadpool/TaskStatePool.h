@@ -0,0 +1,83 @@
+#ifndef TASK_STATE_POOL_H
+#define TASK_STATE_POOL_H
+
+#include <cstddef>
+#include <new>
+
+// TaskStatePool.h
+// Пул блоків для станів завдань пулу потоків (спільні стани future, вузли деків)
+// Block pool for thread pool task state (future shared states, deque nodes)
+// Пул блоков для состояний задач пула потоков (общие состояния future, узлы деков)
+
+namespace NeuroSync {
+
+    // Пул блоків фіксованих класів розміру (64/128/256/512 байт).
+    // Кожен потік тримає власний кеш вільних блоків без блокувань; надлишок кешу віддається
+    // пачками до спільного складу під м'ютексом, а порожній кеш забирає звідти цілу пачку.
+    // Так блок, виділений потоком-відправником і звільнений робітником, повертається в обіг
+    // без звернення до глобальної купи. Більші блоки йдуть напряму в operator new.
+    // Block pool with fixed size classes (64/128/256/512 bytes).
+    // Every thread keeps its own lock-free cache of free blocks; cache overflow is handed
+    // in batches to a shared depot under a mutex, and an empty cache takes a whole batch from it.
+    // This way a block allocated by the submitting thread and freed by a worker returns to
+    // circulation without touching the global heap. Larger blocks go straight to operator new.
+    // Пул блоков фиксированных классов размера (64/128/256/512 байт).
+    // Каждый поток держит собственный кэш свободных блоков без блокировок; излишек кэша отдается
+    // пачками в общий склад под мьютексом, а пустой кэш забирает оттуда целую пачку.
+    // Так блок, выделенный потоком-отправителем и освобожденный рабочим, возвращается в оборот
+    // без обращения к глобальной куче. Большие блоки идут напрямую в operator new.
+    class TaskStatePool {
+    public:
+        static void* allocate(size_t bytes);
+        static void deallocate(void* block, size_t bytes);
+
+        // Найбільший розмір, що обслуговується пулом
+        // Largest size served by the pool
+        // Наибольший размер, обслуживаемый пулом
+        static const size_t MAX_POOLED_SIZE = 512;
+    };
+
+    // Алокатор для std::promise та інших контейнерів стану завдання
+    // Allocator for std::promise and other task state holders
+    // Аллокатор для std::promise и других контейнеров состояния задачи
+    template<typename T>
+    class PooledAllocator {
+    public:
+        typedef T value_type;
+
+        PooledAllocator() noexcept {}
+
+        template<typename U>
+        PooledAllocator(const PooledAllocator<U>&) noexcept {}
+
+        // Блоки пулу вирівняні лише до __STDCPP_DEFAULT_NEW_ALIGNMENT__, тому типи з більшим
+        // вирівнюванням обходять пул і йдуть у вирівнюючий operator new
+        // Pool blocks are only aligned to __STDCPP_DEFAULT_NEW_ALIGNMENT__, so types with a larger
+        // alignment bypass the pool and go to the aligning operator new
+        // Блоки пула выровнены лишь до __STDCPP_DEFAULT_NEW_ALIGNMENT__, поэтому типы с большим
+        // выравниванием обходят пул и идут в выравнивающий operator new
+        T* allocate(size_t count) {
+            if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+            }
+            return static_cast<T*>(TaskStatePool::allocate(count * sizeof(T)));
+        }
+
+        void deallocate(T* pointer, size_t count) noexcept {
+            if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                ::operator delete(pointer, count * sizeof(T), std::align_val_t(alignof(T)));
+                return;
+            }
+            TaskStatePool::deallocate(pointer, count * sizeof(T));
+        }
+
+        template<typename U>
+        bool operator==(const PooledAllocator<U>&) const noexcept { return true; }
+
+        template<typename U>
+        bool operator!=(const PooledAllocator<U>&) const noexcept { return false; }
+    };
+
+} // namespace NeuroSync
+
+#endif // TASK_STATE_POOL_H
@@ -1,6 +1,10 @@
 #include "ThreadPool.h"
 #include <algorithm>
 #include <iostream>
+#include <cstdint>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#endif
 
 // ThreadPool.cpp
 // Реалізація пулу потоків для NeuroSync OS Sparky
@@ -9,77 +13,129 @@
 
 namespace NeuroSync {
 
+    namespace {
+
+        // Контекст поточного робітника: за ним submit визначає, чи можна покласти завдання у власний дек
+        // Current worker context: submit uses it to decide whether a task can go to the worker's own deque
+        // Контекст текущего рабочего: по нему submit определяет, можно ли положить задачу в собственный дек
+        struct WorkerContext {
+            const ThreadPool* pool;
+            size_t index;
+            uint32_t randomState;
+        };
+
+        thread_local WorkerContext currentWorker = {nullptr, 0, 0};
+
+        // Генератор xorshift для вибору жертви крадіжки
+        // Xorshift generator for choosing a steal victim
+        // Генератор xorshift для выбора жертвы кражи
+        uint32_t nextRandom(uint32_t& state) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+
+        // Усталена кількість ітерацій спіну: на одному ядрі спін лише заважає відправнику
+        // Default spin iteration count: on a single core spinning only gets in the submitter's way
+        // Количество итераций спина по умолчанию: на одном ядре спин только мешает отправителю
+        const size_t DEFAULT_SPIN_COUNT = 256;
+
+        size_t defaultSpinCount() {
+            return std::thread::hardware_concurrency() > 1 ? DEFAULT_SPIN_COUNT : 0;
+        }
+
+        // Підказка процесору в циклі очікування
+        // Processor hint inside a busy-wait loop
+        // Подсказка процессору в цикле ожидания
+        inline void cpuRelax() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield");
+#else
+            std::this_thread::yield();
+#endif
+        }
+
+        // Час очікування та виконання міряється для кожного TIMING_SAMPLE_INTERVAL-го завдання потоку-відправника:
+        // читання годинника коштує десятки наносекунд, що порівнянно з усім шляхом дрібного завдання.
+        // Суми в статистиці масштабуються на частку виміряних завдань.
+        // Wait and run time are measured for every TIMING_SAMPLE_INTERVAL-th task of a submitting thread:
+        // a clock read costs tens of nanoseconds, comparable to the whole path of a small task.
+        // The statistics totals are scaled by the share of measured tasks.
+        // Время ожидания и выполнения измеряется для каждой TIMING_SAMPLE_INTERVAL-й задачи потока-отправителя:
+        // чтение часов стоит десятки наносекунд, что сравнимо со всем путем мелкой задачи.
+        // Суммы в статистике масштабируются на долю измеренных задач.
+        const uint32_t TIMING_SAMPLE_INTERVAL = 64;
+
+        thread_local uint32_t submitSequence = 0;
+
+        // Монотонний час у наносекундах
+        // Monotonic time in nanoseconds
+        // Монотонное время в наносекундах
+        int64_t nowNanoseconds() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        // Кошик гістограми глибини черги
+        // Queue depth histogram bucket
+        // Корзина гистограммы глубины очереди
+        size_t depthBucket(size_t depth) {
+            size_t bucket = 0;
+            while (depth > 0 && bucket < ThreadPoolStatistics::QUEUE_DEPTH_BUCKETS - 1) {
+                depth >>= 1;
+                ++bucket;
+            }
+            return bucket;
+        }
+
+        // Збільшення лічильника, який пише лише один потік
+        // Increment a counter written by a single thread only
+        // Увеличение счетчика, который пишет только один поток
+        inline void addCounter(std::atomic<uint64_t>& counter, uint64_t value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        // Вузли деків розміщуються в TaskStatePool
+        // Deque nodes are placed in TaskStatePool
+        // Узлы деков размещаются в TaskStatePool
+        TaskFunction* newTaskNode(TaskFunction&& task) {
+            void* block = TaskStatePool::allocate(sizeof(TaskFunction));
+            return new (block) TaskFunction(std::move(task));
+        }
+
+        void deleteTaskNode(TaskFunction* node) {
+            node->~TaskFunction();
+            TaskStatePool::deallocate(node, sizeof(TaskFunction));
+        }
+
+    } // namespace
+
+    ThreadPool::WorkerCounters::WorkerCounters()
+        : tasksExecuted(0), stealCount(0), spinWakeups(0), parkCount(0), timedTasks(0), waitNanoseconds(0),
+          runNanoseconds(0) {
+        for (std::atomic<uint64_t>& bucket : queueDepthHistogram) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
     // Конструктор
     // Constructor
     // Конструктор
-    ThreadPool::ThreadPool(size_t threads)
-        : stopFlag(false), activeThreads(0) {
-        // Створення робочих потоків
-        // Creating worker threads
-        // Создание рабочих потоков
-        for (size_t i = 0; i < threads; ++i) {
-            workers.emplace_back(
-                [this] {
-                    // Основний цикл робочого потоку
-                    // Main worker thread loop
-                    // Основной цикл рабочего потока
-                    while (true) {
-                        std::function<void()> task;
-
-                        {
-                            std::unique_lock<std::mutex> lock(this->queueMutex);
-                            
-                            // Очікування на нове завдання або сигнал зупинки
-                            // Waiting for new task or stop signal
-                            // Ожидание новой задачи или сигнала остановки
-                            this->condition.wait(lock,
-                                [this] { 
-                                    return this->stopFlag.load() || !this->tasks.empty(); 
-                                });
-
-                            // Вихід, якщо пул зупинено і немає завдань
-                            // Exit if pool is stopped and no tasks
-                            // Выход, если пул остановлен и нет задач
-                            if (this->stopFlag.load() && this->tasks.empty()) {
-                                return;
-                            }
-
-                            // Отримання завдання з черги
-                            // Getting task from queue
-                            // Получение задачи из очереди
-                            if (!this->tasks.empty()) {
-                                task = std::move(this->tasks.front());
-                                this->tasks.pop();
-                                
-                                // Збільшення лічильника активних потоків
-                                // Increment active threads counter
-                                // Увеличение счетчика активных потоков
-                                this->activeThreads.fetch_add(1);
-                            }
-                        }
-
-                        // Виконання завдання
-                        // Executing task
-                        // Выполнение задачи
-                        if (task) {
-                            try {
-                                task();
-                            } catch (...) {
-                                // Обробка винятків
-                                // Exception handling
-                                // Обработка исключений
-                                std::cerr << "Exception in thread pool task" << std::endl;
-                            }
-                            
-                            // Зменшення лічильника активних потоків
-                            // Decrement active threads counter
-                            // Уменьшение счетчика активных потоков
-                            this->activeThreads.fetch_sub(1);
-                        }
-                    }
-                }
-            );
+    ThreadPool::ThreadPool(size_t threads, ThreadPoolMode mode)
+        : mode(mode), threadCount(0), slots(MAX_THREAD_COUNT), slotCount(0), pendingTasks(0), injectedTasks(0),
+          sleepingWorkers(0), spinningWorkers(0), spinCount(defaultSpinCount()), stopFlag(false), activeThreads(0),
+          lastResizeTime(nowNanoseconds()), accumulatedThreadNanoseconds(0) {
+        if (threads > MAX_THREAD_COUNT) {
+            throw std::invalid_argument("ThreadPool thread count exceeds MAX_THREAD_COUNT");
         }
+        std::lock_guard<std::mutex> lock(controlMutex);
+        startWorkers(0, threads);
+        threadCount.store(threads);
     }
 
     // Ініціалізація пулу потоків
@@ -97,32 +153,596 @@ namespace NeuroSync {
     // Деструктор
     ThreadPool::~ThreadPool() {
         stop();
-        
+
         // Очікування завершення всіх потоків
         // Waiting for all threads to finish
         // Ожидание завершения всех потоков
-        for (std::thread &worker : workers) {
-            if (worker.joinable()) {
-                worker.join();
+        std::lock_guard<std::mutex> lock(controlMutex);
+        joinWorkers(0, slotCount.load());
+    }
+
+    // Запуск робочих потоків
+    // Start worker threads
+    // Запуск рабочих потоков
+    void ThreadPool::startWorkers(size_t from, size_t to) {
+        // Слоти створюються до запуску потоків, бо будь-який робітник може красти з будь-якого деку
+        // Slots are created before the threads start, since any worker may steal from any deque
+        // Слоты создаются до запуска потоков, так как любой рабочий может красть из любого дека
+        for (size_t i = from; i < to; ++i) {
+            if (!slots[i]) {
+                slots[i].reset(new WorkerSlot());
+            }
+            slots[i]->retiring.store(false);
+        }
+        if (to > slotCount.load()) {
+            slotCount.store(to);
+        }
+
+        // Створення робочих потоків
+        // Creating worker threads
+        // Создание рабочих потоков
+        for (size_t i = from; i < to; ++i) {
+            if (mode == ThreadPoolMode::WORK_STEALING) {
+                slots[i]->thread = std::thread([this, i] { workStealingLoop(i); });
+            } else {
+                slots[i]->thread = std::thread([this, i] { sharedQueueLoop(i); });
+            }
+        }
+    }
+
+    // Зупинка робітників [from, to) з очікуванням їх завершення
+    // Stop workers [from, to) and wait for them to exit
+    // Остановка рабочих [from, to) с ожиданием их завершения
+    void ThreadPool::retireWorkers(size_t from, size_t to) {
+        for (size_t i = from; i < to; ++i) {
+            slots[i]->retiring.store(true);
+        }
+
+        // Прапорці виставлено до м'ютекса, тому сплячий робітник не пропустить сповіщення
+        // The flags are set before taking the mutex, so a sleeping worker cannot miss the notification
+        // Флаги выставлены до мьютекса, поэтому спящий рабочий не пропустит уведомление
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+        }
+        condition.notify_all();
+        joinWorkers(from, to);
+    }
+
+    // Очікування завершення робітників [from, to)
+    // Wait for workers [from, to) to exit
+    // Ожидание завершения рабочих [from, to)
+    void ThreadPool::joinWorkers(size_t from, size_t to) {
+        for (size_t i = from; i < to; ++i) {
+            if (slots[i] && slots[i]->thread.joinable()) {
+                slots[i]->thread.join();
+            }
+        }
+    }
+
+    // Постановка завдання в чергу відповідно до режиму
+    // Queue a task according to the mode
+    // Постановка задачи в очередь в соответствии с режимом
+    void ThreadPool::submit(TaskFunction task) {
+        // Завдання з вибірки загортається в TimedCall (обгортка не влазить у вбудований буфер
+        // і береться з TaskStatePool, тож купа не задіяна)
+        // A sampled task is wrapped in a TimedCall (the wrapper does not fit the inline buffer
+        // and comes from TaskStatePool, so the heap is not involved)
+        // Задача из выборки оборачивается в TimedCall (обертка не помещается во встроенный буфер
+        // и берется из TaskStatePool, так что куча не задействована)
+        if (++submitSequence % TIMING_SAMPLE_INTERVAL == 0) {
+            task = TaskFunction(TimedCall(std::move(task), nowNanoseconds()));
+        }
+
+        // Робітник цього ж пулу кладе завдання у власний дек без блокувань
+        // A worker of this same pool pushes the task onto its own deque without locking
+        // Рабочий этого же пула кладет задачу в собственный дек без блокировок
+        if (mode == ThreadPoolMode::WORK_STEALING && currentWorker.pool == this) {
+            if (stopFlag.load()) {
+                throw std::runtime_error("enqueue on stopped ThreadPool");
+            }
+
+            // Лічильник збільшується до публікації, тому робітник, що засинає, не пропустить завдання
+            // The counter is raised before publishing, so a worker going to sleep cannot miss the task
+            // Счетчик увеличивается до публикации, поэтому засыпающий рабочий не пропустит задачу
+            pendingTasks.fetch_add(1);
+            slots[currentWorker.index]->queue.push(newTaskNode(std::move(task)));
+
+            // М'ютекс береться лише коли хтось спить: так сповіщення не загубиться між перевіркою та wait
+            // The mutex is taken only when someone sleeps: this way the wakeup is not lost between the check and wait
+            // Мьютекс берется только когда кто-то спит: так уведомление не потеряется между проверкой и wait
+            if (sleepingWorkers.load() > 0) {
+                {
+                    std::lock_guard<std::mutex> lock(queueMutex);
+                }
+                condition.notify_one();
+            }
+            return;
+        }
+
+        bool wakeWorker = false;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+
+            // Не додаємо завдання, якщо пул зупинено
+            // Don't add task if pool is stopped
+            // Не добавляем задачу, если пул остановлен
+            if (stopFlag.load()) {
+                throw std::runtime_error("enqueue on stopped ThreadPool");
+            }
+
+            tasks.emplace(std::move(task));
+            if (mode == ThreadPoolMode::WORK_STEALING) {
+                pendingTasks.fetch_add(1);
+                injectedTasks.fetch_add(1);
+            } else {
+                // У режимі спільної черги лічильник змінюється лише під м'ютексом; без м'ютекса його читає тільки спін
+                // In shared-queue mode the counter changes only under the mutex; only the spin reads it without the mutex
+                // В режиме общей очереди счетчик меняется только под мьютексом; без мьютекса его читает только спин
+                pendingTasks.store(tasks.size(), std::memory_order_relaxed);
+            }
+
+            // Робітники рахуються сплячими під цим же м'ютексом, тож якщо сплячих немає,
+            // завдання підхопить активний або той, що крутиться, і futex не потрібен
+            // Workers are counted as sleeping under this same mutex, so if nobody sleeps
+            // the task is picked up by an active or spinning worker and no futex is needed
+            // Рабочие считаются спящими под этим же мьютексом, так что если спящих нет,
+            // задачу подхватит активный или крутящийся рабочий, и futex не нужен
+            wakeWorker = sleepingWorkers.load() > 0;
+        }
+        if (wakeWorker) {
+            condition.notify_one();
+        }
+    }
+
+    // Виконання завдання з обліком активних потоків
+    // Run a task, tracking active threads
+    // Выполнение задачи с учетом активных потоков
+    void ThreadPool::runTask(TaskFunction& task, WorkerCounters& counters, size_t queueDepth) {
+        try {
+            task();
+        } catch (...) {
+            // Обробка винятків
+            // Exception handling
+            // Обработка исключений
+            std::cerr << "Exception in thread pool task" << std::endl;
+        }
+
+        // Зменшення лічильника активних потоків
+        // Decrement active threads counter
+        // Уменьшение счетчика активных потоков
+        activeThreads.fetch_sub(1);
+
+        addCounter(counters.tasksExecuted, 1);
+        addCounter(counters.queueDepthHistogram[depthBucket(queueDepth)], 1);
+    }
+
+    // Виконання завдання з вибірки з вимірюванням часу
+    // Run a sampled task, measuring its time
+    // Выполнение задачи из выборки с измерением времени
+    void ThreadPool::TimedCall::operator()() {
+        int64_t startTime = nowNanoseconds();
+        WorkerCounters& counters = currentWorker.pool->slots[currentWorker.index]->counters;
+        struct Recorder {
+            WorkerCounters& counters;
+            int64_t enqueueTime;
+            int64_t startTime;
+
+            // Час записується й тоді, коли завдання кидає виняток
+            // The time is recorded even when the task throws
+            // Время записывается и тогда, когда задача бросает исключение
+            ~Recorder() {
+                int64_t endTime = nowNanoseconds();
+                addCounter(counters.timedTasks, 1);
+                addCounter(counters.waitNanoseconds, static_cast<uint64_t>(std::max<int64_t>(0, startTime - enqueueTime)));
+                addCounter(counters.runNanoseconds, static_cast<uint64_t>(endTime - startTime));
+            }
+        } recorder = {counters, enqueueTime, startTime};
+        task();
+    }
+
+    // Спін перед засинанням
+    // Spin before parking
+    // Спин перед засыпанием
+    bool ThreadPool::spinForWork(const WorkerSlot& slot) {
+        size_t iterations = spinCount.load(std::memory_order_relaxed);
+        if (iterations == 0) {
+            return false;
+        }
+
+        // Крутиться не більше половини робітників: решті вистачить пробудження
+        // At most half of the workers spin: the rest can be woken up
+        // Крутится не более половины рабочих: остальным хватит пробуждения
+        size_t spinLimit = std::max<size_t>(1, threadCount.load(std::memory_order_relaxed) / 2);
+        if (spinningWorkers.fetch_add(1, std::memory_order_relaxed) >= spinLimit) {
+            spinningWorkers.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        bool found = false;
+        for (size_t i = 0; i < iterations; ++i) {
+            if (pendingTasks.load(std::memory_order_relaxed) > 0 || slot.retiring.load(std::memory_order_relaxed)) {
+                found = true;
+                break;
+            }
+            cpuRelax();
+        }
+        spinningWorkers.fetch_sub(1, std::memory_order_relaxed);
+        return found;
+    }
+
+    // Передача пробудження іншому робітнику
+    // Pass a wake-up on to another worker
+    // Передача пробуждения другому рабочему
+    void ThreadPool::handOffWakeup() {
+        if (pendingTasks.load() > 0 && sleepingWorkers.load() > 0) {
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+            }
+            condition.notify_one();
+        }
+    }
+
+    // Основний цикл робочого потоку зі спільною чергою
+    // Main worker thread loop with a shared queue
+    // Основной цикл рабочего потока с общей очередью
+    void ThreadPool::sharedQueueLoop(size_t index) {
+        currentWorker.pool = this;
+        currentWorker.index = index;
+
+        WorkerSlot& slot = *slots[index];
+        WorkerCounters& counters = slot.counters;
+        while (true) {
+            TaskFunction task;
+            size_t queueDepth = 0;
+            bool spun = pendingTasks.load(std::memory_order_relaxed) == 0 && spinForWork(slot);
+
+            {
+                std::unique_lock<std::mutex> lock(queueMutex);
+
+                // Очікування на нове завдання або сигнал зупинки
+                // Waiting for new task or stop signal
+                // Ожидание новой задачи или сигнала остановки
+                if (!stopFlag.load() && tasks.empty() && !slot.retiring.load()) {
+                    sleepingWorkers.fetch_add(1);
+                    addCounter(counters.parkCount, 1);
+                    condition.wait(lock,
+                        [this, &slot] {
+                            return stopFlag.load() || !tasks.empty() || slot.retiring.load();
+                        });
+                    sleepingWorkers.fetch_sub(1);
+                    spun = false;
+                }
+
+                // Зменшений робітник виходить одразу: спільну чергу доробить решта
+                // A resized-away worker exits at once: the rest will finish the shared queue
+                // Сокращенный рабочий выходит сразу: общую очередь доделают остальные
+                if (slot.retiring.load()) {
+                    if (!tasks.empty()) {
+                        condition.notify_one();
+                    }
+                    return;
+                }
+
+                // Вихід, якщо пул зупинено і немає завдань
+                // Exit if pool is stopped and no tasks
+                // Выход, если пул остановлен и нет задач
+                if (stopFlag.load() && tasks.empty()) {
+                    return;
+                }
+
+                // Отримання завдання з черги
+                // Getting task from queue
+                // Получение задачи из очереди
+                task = std::move(tasks.front());
+                tasks.pop();
+                queueDepth = tasks.size();
+                pendingTasks.store(queueDepth, std::memory_order_relaxed);
+
+                // Збільшення лічильника активних потоків
+                // Increment active threads counter
+                // Увеличение счетчика активных потоков
+                activeThreads.fetch_add(1);
             }
+
+            if (spun) {
+                addCounter(counters.spinWakeups, 1);
+            }
+
+            // Виконання завдання
+            // Executing task
+            // Выполнение задачи
+            runTask(task, counters, queueDepth);
         }
     }
 
+    // Основний цикл робочого потоку з крадіжкою роботи
+    // Main worker thread loop with work stealing
+    // Основной цикл рабочего потока с кражей работы
+    void ThreadPool::workStealingLoop(size_t index) {
+        currentWorker.pool = this;
+        currentWorker.index = index;
+        currentWorker.randomState = static_cast<uint32_t>(index * 2654435761u) | 1u;
+
+        WorkerSlot& slot = *slots[index];
+        LocalQueue& localQueue = slot.queue;
+        WorkerCounters& counters = slot.counters;
+        bool spun = false;
+        while (true) {
+            // 1. Власний дек (LIFO: щойно породжене завдання ще гаряче в кеші)
+            // 1. Own deque (LIFO: a freshly spawned task is still hot in cache)
+            // 1. Собственный дек (LIFO: только что порожденная задача еще горячая в кэше)
+            TaskFunction* localTask = nullptr;
+            if (localQueue.pop(localTask)) {
+                activeThreads.fetch_add(1);
+                size_t queueDepth = pendingTasks.fetch_sub(1) - 1;
+                runTask(*localTask, counters, queueDepth);
+                deleteTaskNode(localTask);
+                continue;
+            }
+
+            // Зменшений робітник виходить лише з порожнім деком: у нього ніхто, крім злодіїв, не заглядає
+            // A resized-away worker exits only with an empty deque: nobody but thieves looks into it
+            // Сокращенный рабочий выходит только с пустым деком: в него никто, кроме воров, не заглядывает
+            if (slot.retiring.load()) {
+                handOffWakeup();
+                return;
+            }
+
+            // 2. Черга впровадження від зовнішніх потоків
+            // 2. Injection queue from external threads
+            // 2. Очередь внедрения от внешних потоков
+            TaskFunction injectedTask;
+            if (injectedTasks.load() > 0) {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                if (!tasks.empty()) {
+                    injectedTask = std::move(tasks.front());
+                    tasks.pop();
+                    injectedTasks.fetch_sub(1);
+                }
+            }
+            if (injectedTask) {
+                activeThreads.fetch_add(1);
+                size_t queueDepth = pendingTasks.fetch_sub(1) - 1;
+                if (spun) {
+                    addCounter(counters.spinWakeups, 1);
+                    spun = false;
+                }
+                runTask(injectedTask, counters, queueDepth);
+                continue;
+            }
+
+            // 3. Крадіжка з верхнього (найстарішого) кінця чужого деку
+            // 3. Steal from the top (oldest) end of another worker's deque
+            // 3. Кража с верхнего (самого старого) конца чужого дека
+            if (stealTask(index, localTask)) {
+                activeThreads.fetch_add(1);
+                size_t queueDepth = pendingTasks.fetch_sub(1) - 1;
+                addCounter(counters.stealCount, 1);
+                if (spun) {
+                    addCounter(counters.spinWakeups, 1);
+                    spun = false;
+                }
+                runTask(*localTask, counters, queueDepth);
+                deleteTaskNode(localTask);
+                continue;
+            }
+
+            // 4. Роботи немає ніде: короткий спін, щоб підхопити завдання без пробудження через futex
+            // 4. No work anywhere: a short spin to pick up a task without a futex wake-up
+            // 4. Работы нет нигде: короткий спин, чтобы подхватить задачу без пробуждения через futex
+            if (!spun && spinForWork(slot)) {
+                spun = true;
+                continue;
+            }
+            spun = false;
+
+            // 5. Засинаємо, доки не з'явиться завдання або сигнал зупинки
+            // 5. Sleep until a task appears or stop is signalled
+            // 5. Засыпаем, пока не появится задача или сигнал остановки
+            std::unique_lock<std::mutex> lock(queueMutex);
+            sleepingWorkers.fetch_add(1);
+            if (!stopFlag.load() && pendingTasks.load() == 0 && !slot.retiring.load()) {
+                addCounter(counters.parkCount, 1);
+            }
+            condition.wait(lock,
+                [this, &slot] {
+                    return stopFlag.load() || pendingTasks.load() > 0 || slot.retiring.load();
+                });
+            sleepingWorkers.fetch_sub(1);
+
+            // Вихід лише після того, як усі завдання (включно з деками) виконано
+            // Exit only once every task (including the deques) has run
+            // Выход только после того, как все задачи (включая деки) выполнены
+            if (stopFlag.load() && pendingTasks.load() == 0) {
+                return;
+            }
+        }
+    }
+
+    // Крадіжка завдання у випадкової жертви
+    // Steal a task from a random victim
+    // Кража задачи у случайной жертвы
+    bool ThreadPool::stealTask(size_t thiefIndex, TaskFunction*& task) {
+        size_t victimCount = slotCount.load();
+        if (victimCount < 2) {
+            return false;
+        }
+
+        // Обхід усіх деків, починаючи з випадкового, щоб злодії не сходилися на одній жертві
+        // (зокрема деків зменшених робітників: вони порожні, але перевірка дешева)
+        // Walk all deques starting from a random one so thieves do not converge on one victim
+        // (including the deques of resized-away workers: they are empty, but the check is cheap)
+        // Обход всех деков, начиная со случайного, чтобы воры не сходились на одной жертве
+        // (в том числе деков сокращенных рабочих: они пусты, но проверка дешева)
+        size_t start = nextRandom(currentWorker.randomState) % victimCount;
+        for (size_t i = 0; i < victimCount; ++i) {
+            size_t victim = (start + i) % victimCount;
+            if (victim != thiefIndex && slots[victim]->queue.steal(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     // Отримання кількості потоків
     // Get thread count
     // Получение количества потоков
     size_t ThreadPool::getThreadCount() const {
-        return workers.size();
+        return threadCount.load();
     }
 
     // Отримання кількості завдань у черзі
     // Get queue size
     // Получение количества задач в очереди
     size_t ThreadPool::getQueueSize() {
+        if (mode == ThreadPoolMode::WORK_STEALING) {
+            return pendingTasks.load();
+        }
         std::lock_guard<std::mutex> lock(queueMutex);
         return tasks.size();
     }
 
+    // Отримання режиму черги
+    // Get queue mode
+    // Получение режима очереди
+    ThreadPoolMode ThreadPool::getMode() const {
+        return mode;
+    }
+
+    // Зміна кількості робочих потоків
+    // Change the number of worker threads
+    // Изменение количества рабочих потоков
+    void ThreadPool::resize(size_t threads) {
+        if (threads == 0 || threads > MAX_THREAD_COUNT) {
+            throw std::invalid_argument("ThreadPool size must be between 1 and MAX_THREAD_COUNT");
+        }
+
+        // Робітник не може чекати на власне завершення
+        // A worker cannot wait for its own exit
+        // Рабочий не может ждать собственного завершения
+        if (currentWorker.pool == this) {
+            throw std::runtime_error("resize from inside a ThreadPool worker");
+        }
+
+        std::lock_guard<std::mutex> lock(controlMutex);
+        if (stopFlag.load()) {
+            throw std::runtime_error("resize on stopped ThreadPool");
+        }
+
+        size_t current = threadCount.load();
+        if (threads == current) {
+            return;
+        }
+
+        // Час потоків до зміни розміру додається до вікна статистики за старою кількістю
+        // Thread time before the resize is added to the statistics window at the old count
+        // Время потоков до изменения размера добавляется к окну статистики по старому количеству
+        int64_t now = nowNanoseconds();
+        accumulatedThreadNanoseconds = windowThreadNanoseconds(now);
+        lastResizeTime = now;
+
+        if (threads > current) {
+            startWorkers(current, threads);
+        } else {
+            retireWorkers(threads, current);
+        }
+        threadCount.store(threads);
+    }
+
+    // Встановлення кількості ітерацій спіну
+    // Set the spin iteration count
+    // Установка количества итераций спина
+    void ThreadPool::setSpinCount(size_t iterations) {
+        spinCount.store(iterations);
+    }
+
+    size_t ThreadPool::getSpinCount() const {
+        return spinCount.load();
+    }
+
+    // Сума лічильників усіх слотів
+    // Sum of all slot counters
+    // Сумма счетчиков всех слотов
+    ThreadPoolStatistics ThreadPool::collectCounters() const {
+        ThreadPoolStatistics totals;
+        uint64_t waitNanoseconds = 0;
+        uint64_t runNanoseconds = 0;
+        size_t count = slotCount.load();
+        for (size_t i = 0; i < count; ++i) {
+            const WorkerCounters& counters = slots[i]->counters;
+            totals.tasksExecuted += counters.tasksExecuted.load(std::memory_order_relaxed);
+            totals.stealCount += counters.stealCount.load(std::memory_order_relaxed);
+            totals.spinWakeups += counters.spinWakeups.load(std::memory_order_relaxed);
+            totals.parkCount += counters.parkCount.load(std::memory_order_relaxed);
+            totals.timedTasks += counters.timedTasks.load(std::memory_order_relaxed);
+            waitNanoseconds += counters.waitNanoseconds.load(std::memory_order_relaxed);
+            runNanoseconds += counters.runNanoseconds.load(std::memory_order_relaxed);
+            for (size_t bucket = 0; bucket < ThreadPoolStatistics::QUEUE_DEPTH_BUCKETS; ++bucket) {
+                totals.queueDepthHistogram[bucket] += counters.queueDepthHistogram[bucket].load(std::memory_order_relaxed);
+            }
+        }
+        totals.totalWaitTime = std::chrono::nanoseconds(waitNanoseconds);
+        totals.totalRunTime = std::chrono::nanoseconds(runNanoseconds);
+        return totals;
+    }
+
+    // Час потоків за поточне вікно статистики
+    // Thread time in the current statistics window
+    // Время потоков за текущее окно статистики
+    int64_t ThreadPool::windowThreadNanoseconds(int64_t now) const {
+        return accumulatedThreadNanoseconds + static_cast<int64_t>(threadCount.load()) * (now - lastResizeTime);
+    }
+
+    // Отримання статистики
+    // Get statistics
+    // Получение статистики
+    ThreadPoolStatistics ThreadPool::getStatistics() const {
+        std::lock_guard<std::mutex> lock(controlMutex);
+        ThreadPoolStatistics stats = collectCounters();
+        stats.tasksExecuted -= statisticsBaseline.tasksExecuted;
+        stats.stealCount -= statisticsBaseline.stealCount;
+        stats.spinWakeups -= statisticsBaseline.spinWakeups;
+        stats.parkCount -= statisticsBaseline.parkCount;
+        stats.timedTasks -= statisticsBaseline.timedTasks;
+        stats.totalWaitTime -= statisticsBaseline.totalWaitTime;
+        stats.totalRunTime -= statisticsBaseline.totalRunTime;
+
+        // Оцінка сумарного часу всіх завдань за виміряною вибіркою
+        // Estimate the total time of all tasks from the measured sample
+        // Оценка суммарного времени всех задач по измеренной выборке
+        if (stats.timedTasks > 0 && stats.tasksExecuted > stats.timedTasks) {
+            double scale = static_cast<double>(stats.tasksExecuted) / stats.timedTasks;
+            stats.totalWaitTime = std::chrono::nanoseconds(static_cast<int64_t>(stats.totalWaitTime.count() * scale));
+            stats.totalRunTime = std::chrono::nanoseconds(static_cast<int64_t>(stats.totalRunTime.count() * scale));
+        }
+        for (size_t bucket = 0; bucket < ThreadPoolStatistics::QUEUE_DEPTH_BUCKETS; ++bucket) {
+            stats.queueDepthHistogram[bucket] -= statisticsBaseline.queueDepthHistogram[bucket];
+        }
+
+        stats.threadCount = threadCount.load();
+        stats.activeThreads = activeThreads.load();
+        stats.queueSize = pendingTasks.load();
+
+        // Завантаженість: (оцінений) час виконання завершених завдань до часу потоків у вікні
+        // Utilization: (estimated) run time of finished tasks over thread time in the window
+        // Загруженность: (оцененное) время выполнения завершенных задач к времени потоков в окне
+        int64_t threadNanoseconds = windowThreadNanoseconds(nowNanoseconds());
+        if (threadNanoseconds > 0) {
+            stats.utilization = std::min(1.0, static_cast<double>(stats.totalRunTime.count()) / threadNanoseconds);
+        }
+        return stats;
+    }
+
+    // Скидання статистики
+    // Reset statistics
+    // Сброс статистики
+    void ThreadPool::resetStatistics() {
+        std::lock_guard<std::mutex> lock(controlMutex);
+        statisticsBaseline = collectCounters();
+        lastResizeTime = nowNanoseconds();
+        accumulatedThreadNanoseconds = 0;
+    }
+
     // Зупинка пулу потоків
     // Stop thread pool
     // Остановка пула потоков
@@ -142,72 +762,35 @@ namespace NeuroSync {
         // Stopping current pool
         // Остановка текущего пула
         stop();
-        
+
         // Очікування завершення всіх потоків
         // Waiting for all threads to finish
         // Ожидание завершения всех потоков
-        for (std::thread &worker : workers) {
-            if (worker.joinable()) {
-                worker.join();
-            }
-        }
-        
+        std::lock_guard<std::mutex> control(controlMutex);
+        joinWorkers(0, slotCount.load());
+
         // Очищення стану
         // Clearing state
         // Очистка состояния
-        workers.clear();
         {
             std::lock_guard<std::mutex> lock(queueMutex);
             while (!tasks.empty()) {
                 tasks.pop();
             }
         }
-        
+
         // Скидання прапорців
         // Resetting flags
         // Сброс флагов
         stopFlag.store(false);
         activeThreads.store(0);
-        
-        // Перестворення потоків
-        // Recreating threads
-        // Пересоздание потоков
-        for (size_t i = 0; i < workers.size(); ++i) {
-            workers.emplace_back(
-                [this] {
-                    while (true) {
-                        std::function<void()> task;
-
-                        {
-                            std::unique_lock<std::mutex> lock(queueMutex);
-                            this->condition.wait(lock,
-                                [this] { 
-                                    return this->stopFlag.load() || !this->tasks.empty(); 
-                                });
-
-                            if (this->stopFlag.load() && this->tasks.empty()) {
-                                return;
-                            }
-
-                            if (!this->tasks.empty()) {
-                                task = std::move(this->tasks.front());
-                                this->tasks.pop();
-                                this->activeThreads.fetch_add(1);
-                            }
-                        }
-
-                        if (task) {
-                            try {
-                                task();
-                            } catch (...) {
-                                std::cerr << "Exception in thread pool task" << std::endl;
-                            }
-                            this->activeThreads.fetch_sub(1);
-                        }
-                    }
-                }
-            );
-        }
+        pendingTasks.store(0);
+        injectedTasks.store(0);
+
+        // Перезапуск робітників у тих самих слотах (їхні деки після зупинки порожні)
+        // Restarting workers in the same slots (their deques are empty after the stop)
+        // Перезапуск рабочих в тех же слотах (их деки после остановки пусты)
+        startWorkers(0, threadCount.load());
     }
 
-} // namespace NeuroSync
\ No newline at end of file
+} // namespace NeuroSync
@@ -11,6 +11,11 @@
 #include <functional>
 #include <stdexcept>
 #include <atomic>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include "WorkStealingDeque.h"
+#include "TaskFunction.h"
 
 // ThreadPool.h
 // Пул потоків для NeuroSync OS Sparky
@@ -19,12 +24,72 @@
 
 namespace NeuroSync {
 
+    // Режим черги завдань пулу
+    // Pool task queue mode
+    // Режим очереди задач пула
+    enum class ThreadPoolMode {
+        SHARED_QUEUE,   // Одна спільна черга / One shared queue / Одна общая очередь
+        WORK_STEALING   // Деки робітників з крадіжкою / Per-worker deques with stealing / Деки рабочих с кражей
+    };
+
+    // Статистика пулу потоків з моменту останнього resetStatistics()
+    // Thread pool statistics since the last resetStatistics()
+    // Статистика пула потоков с момента последнего resetStatistics()
+    struct ThreadPoolStatistics {
+        // Кошики гістограми глибини черги: 0 - порожня черга, i - глибина в [2^(i-1), 2^i), останній - усе більше
+        // Queue depth histogram buckets: 0 - empty queue, i - depth in [2^(i-1), 2^i), the last one - everything above
+        // Корзины гистограммы глубины очереди: 0 - пустая очередь, i - глубина в [2^(i-1), 2^i), последняя - все больше
+        static const size_t QUEUE_DEPTH_BUCKETS = 16;
+
+        size_t threadCount;                      // Робочі потоки / Worker threads / Рабочие потоки
+        size_t activeThreads;                    // Потоки, що виконують завдання / Threads running a task / Потоки, выполняющие задачу
+        size_t queueSize;                        // Завдання в черзі зараз / Tasks queued right now / Задачи в очереди сейчас
+        uint64_t tasksExecuted;                  // Виконані завдання / Executed tasks / Выполненные задачи
+        uint64_t stealCount;                     // Вкрадені завдання / Stolen tasks / Украденные задачи
+        uint64_t spinWakeups;                    // Завдання, знайдені під час спіну / Tasks found while spinning / Задачи, найденные во время спина
+        uint64_t parkCount;                      // Засинання на змінній умови / Parks on the condition variable / Засыпания на переменной условия
+        uint64_t timedTasks;                     // Завдання з виміряним часом / Tasks whose time was measured / Задачи с измеренным временем
+
+        // Сумарний час у черзі та виконання, оцінений за вибіркою з timedTasks завдань
+        // Total time spent queued and running, estimated from the sample of timedTasks tasks
+        // Суммарное время в очереди и выполнения, оцененное по выборке из timedTasks задач
+        std::chrono::nanoseconds totalWaitTime;
+        std::chrono::nanoseconds totalRunTime;
+        double utilization;                      // Частка часу потоків на виконання / Share of thread time spent running / Доля времени потоков на выполнение
+
+        // Глибина черги, яку бачив робітник, забираючи завдання
+        // Queue depth seen by a worker when it took a task
+        // Глубина очереди, которую видел рабочий, забирая задачу
+        std::array<uint64_t, QUEUE_DEPTH_BUCKETS> queueDepthHistogram;
+
+        ThreadPoolStatistics()
+            : threadCount(0), activeThreads(0), queueSize(0), tasksExecuted(0), stealCount(0), spinWakeups(0),
+              parkCount(0), timedTasks(0), totalWaitTime(0), totalRunTime(0), utilization(0.0), queueDepthHistogram() {}
+    };
+
     class ThreadPool {
     public:
-        // Конструктор
-        // Constructor
-        // Конструктор
-        explicit ThreadPool(size_t threads);
+        // Найбільша кількість робочих потоків пулу
+        // Maximum number of pool worker threads
+        // Наибольшее количество рабочих потоков пула
+        static const size_t MAX_THREAD_COUNT = 1024;
+
+        // Конструктор.
+        // У режимі WORK_STEALING кожен робітник має власний дек Чейза-Лева: завдання, додані
+        // зсередини робітника, кладуться в його дек і забираються звідти в порядку LIFO без блокувань;
+        // зовнішні потоки додають завдання до спільної черги впровадження. Робітник без роботи
+        // бере завдання зі своєї деки, потім з черги впровадження, потім краде у випадкової жертви.
+        // Constructor.
+        // In WORK_STEALING mode every worker has its own Chase-Lev deque: tasks submitted from
+        // inside a worker go to its deque and are taken back in LIFO order without locks;
+        // external threads submit to a shared injection queue. An idle worker takes a task from
+        // its own deque, then from the injection queue, then steals from a random victim.
+        // Конструктор.
+        // В режиме WORK_STEALING у каждого рабочего свой дек Чейза-Лева: задачи, добавленные
+        // изнутри рабочего, кладутся в его дек и забираются оттуда в порядке LIFO без блокировок;
+        // внешние потоки добавляют задачи в общую очередь внедрения. Рабочий без работы
+        // берет задачу из своего дека, затем из очереди внедрения, затем крадет у случайной жертвы.
+        explicit ThreadPool(size_t threads, ThreadPoolMode mode = ThreadPoolMode::SHARED_QUEUE);
 
         // Деструктор
         // Destructor
@@ -42,13 +107,25 @@ namespace NeuroSync {
         ThreadPool(const ThreadPool&) = delete;
         ThreadPool& operator=(const ThreadPool&) = delete;
 
-        // Додавання завдання до пулу
-        // Add task to pool
-        // Добавление задачи в пул
+        // Додавання завдання до пулу.
+        // Функція з аргументами та std::promise зберігаються в TaskFunction без std::bind і std::function,
+        // а спільний стан future береться з TaskStatePool, тому в усталеному режимі виклик не звертається до купи.
+        // Add task to pool.
+        // The function, its arguments and a std::promise are stored in a TaskFunction without std::bind or std::function,
+        // and the future's shared state comes from TaskStatePool, so in steady state the call does not touch the heap.
+        // Добавление задачи в пул.
+        // Функция с аргументами и std::promise хранятся в TaskFunction без std::bind и std::function,
+        // а общее состояние future берется из TaskStatePool, поэтому в установившемся режиме вызов не обращается к куче.
         template<class F, class... Args>
         auto enqueue(F&& f, Args&&... args) 
             -> std::future<typename std::result_of<F(Args...)>::type>;
 
+        // Додавання завдання без результату (без future; винятки лише записуються в журнал)
+        // Add a task without a result (no future; exceptions are only logged)
+        // Добавление задачи без результата (без future; исключения только записываются в журнал)
+        template<class F, class... Args>
+        void post(F&& f, Args&&... args);
+
         // Отримання кількості потоків
         // Get thread count
         // Получение количества потоков
@@ -59,6 +136,47 @@ namespace NeuroSync {
         // Получение количества задач в очереди
         size_t getQueueSize();
 
+        // Зміна кількості робочих потоків під час роботи.
+        // Нові робітники стартують одразу; зайві завершують поточне завдання (а в режимі WORK_STEALING
+        // ще й власний дек) і виходять, завдання у спільній черзі підхоплюють ті, що лишилися.
+        // Повертається після того, як зайві потоки завершилися. Не можна викликати з робітника цього пулу.
+        // Change the number of worker threads at runtime.
+        // New workers start immediately; surplus ones finish their current task (and in WORK_STEALING mode
+        // their own deque as well) and exit, while tasks in the shared queue are picked up by the rest.
+        // Returns once the surplus threads have exited. Must not be called from a worker of this pool.
+        // Изменение количества рабочих потоков во время работы.
+        // Новые рабочие стартуют сразу; лишние завершают текущую задачу (а в режиме WORK_STEALING
+        // еще и собственный дек) и выходят, задачи в общей очереди подхватывают оставшиеся.
+        // Возвращается после того, как лишние потоки завершились. Нельзя вызывать из рабочего этого пула.
+        void resize(size_t threads);
+
+        // Кількість перевірок черги робітником без роботи перед засинанням на змінній умови.
+        // Спін дозволяє підхопити завдання без пробудження через futex; на одноядерній машині
+        // він лише забирає процесор у відправника, тому там усталене значення - 0.
+        // Number of queue checks an idle worker makes before parking on the condition variable.
+        // Spinning lets it pick up a task without a futex wake-up; on a single-core machine
+        // it only takes the CPU away from the submitter, so the default there is 0.
+        // Количество проверок очереди рабочим без работы перед засыпанием на переменной условия.
+        // Спин позволяет подхватить задачу без пробуждения через futex; на одноядерной машине
+        // он лишь отбирает процессор у отправителя, поэтому там значение по умолчанию - 0.
+        void setSpinCount(size_t iterations);
+        size_t getSpinCount() const;
+
+        // Статистика з моменту останнього скидання
+        // Statistics since the last reset
+        // Статистика с момента последнего сброса
+        ThreadPoolStatistics getStatistics() const;
+
+        // Скидання статистики (почати нове вікно вимірювання)
+        // Reset statistics (start a new measurement window)
+        // Сброс статистики (начать новое окно измерения)
+        void resetStatistics();
+
+        // Отримання режиму черги
+        // Get queue mode
+        // Получение режима очереди
+        ThreadPoolMode getMode() const;
+
         // Зупинка пулу потоків
         // Stop thread pool
         // Остановка пула потоков
@@ -70,15 +188,145 @@ namespace NeuroSync {
         void restart();
 
     private:
-        // Вектор робочих потоків
-        // Vector of worker threads
-        // Вектор рабочих потоков
-        std::vector<std::thread> workers;
+        // Дек завдань робітника
+        // Worker task deque
+        // Дек задач рабочего
+        typedef WorkStealingDeque<TaskFunction*> LocalQueue;
+
+        // Обгортка завдання з вибірки для вимірювання часу: пам'ятає момент постановки
+        // і при виконанні записує час очікування та виконання в лічильники поточного робітника.
+        // Решта завдань іде в чергу без обгортки і не читає годинник.
+        // Wrapper for a task in the timing sample: remembers the submission time
+        // and on execution records the wait and run time into the current worker's counters.
+        // All other tasks are queued unwrapped and never read the clock.
+        // Обертка задачи из выборки для измерения времени: помнит момент постановки
+        // и при выполнении записывает время ожидания и выполнения в счетчики текущего рабочего.
+        // Остальные задачи идут в очередь без обертки и не читают часы.
+        class TimedCall {
+        public:
+            TimedCall(TaskFunction&& task, int64_t enqueueTime)
+                : task(std::move(task)), enqueueTime(enqueueTime) {}
+
+            void operator()();
+
+        private:
+            TaskFunction task;
+            int64_t enqueueTime;
+        };
+
+        // Лічильники робітника. Пише в них лише сам робітник, тому оновлення - звичайні load/store
+        // без атомарних RMW і без спільної кеш-лінії між робітниками; getStatistics лише читає їх.
+        // Worker counters. Only the worker itself writes them, so updates are plain load/store
+        // without atomic RMW and without a cache line shared between workers; getStatistics only reads them.
+        // Счетчики рабочего. Пишет в них только сам рабочий, поэтому обновления - обычные load/store
+        // без атомарных RMW и без общей кэш-линии между рабочими; getStatistics только читает их.
+        struct WorkerCounters {
+            std::atomic<uint64_t> tasksExecuted;
+            std::atomic<uint64_t> stealCount;
+            std::atomic<uint64_t> spinWakeups;
+            std::atomic<uint64_t> parkCount;
+            std::atomic<uint64_t> timedTasks;
+            std::atomic<uint64_t> waitNanoseconds;
+            std::atomic<uint64_t> runNanoseconds;
+            std::atomic<uint64_t> queueDepthHistogram[ThreadPoolStatistics::QUEUE_DEPTH_BUCKETS];
+
+            WorkerCounters();
+        };
 
-        // Черга завдань
-        // Task queue
-        // Очередь задач
-        std::queue<std::function<void()>> tasks;
+        // Слот робітника: дек, потік, прапорець виходу та лічильники.
+        // Слоти створюються при першому запуску робітника з таким індексом і живуть до деструктора пулу,
+        // бо злодії та getStatistics звертаються й до слотів робітників, яких уже зменшено.
+        // Worker slot: deque, thread, retire flag and counters.
+        // Slots are created when a worker with that index first starts and live until the pool is destroyed,
+        // since thieves and getStatistics also access the slots of workers that have been resized away.
+        // Слот рабочего: дек, поток, флаг выхода и счетчики.
+        // Слоты создаются при первом запуске рабочего с таким индексом и живут до деструктора пула,
+        // так как воры и getStatistics обращаются и к слотам рабочих, которых уже сократили.
+        struct WorkerSlot {
+            LocalQueue queue;
+            std::thread thread;
+            std::atomic<bool> retiring;
+            WorkerCounters counters;
+
+            WorkerSlot() : retiring(false) {}
+        };
+
+        // Постановка завдання в чергу відповідно до режиму
+        // Queue a task according to the mode
+        // Постановка задачи в очередь в соответствии с режимом
+        void submit(TaskFunction task);
+
+        // Запуск робітників [from, to) та зупинка з очікуванням робітників [from, to) (під controlMutex)
+        // Start workers [from, to) and stop and join workers [from, to) (under controlMutex)
+        // Запуск рабочих [from, to) и остановка с ожиданием рабочих [from, to) (под controlMutex)
+        void startWorkers(size_t from, size_t to);
+        void retireWorkers(size_t from, size_t to);
+        void joinWorkers(size_t from, size_t to);
+
+        // Цикли робочих потоків для кожного режиму
+        // Worker thread loops for each mode
+        // Циклы рабочих потоков для каждого режима
+        void sharedQueueLoop(size_t index);
+        void workStealingLoop(size_t index);
+
+        // Крадіжка завдання у випадкової жертви
+        // Steal a task from a random victim
+        // Кража задачи у случайной жертвы
+        bool stealTask(size_t thiefIndex, TaskFunction*& task);
+
+        // Спін перед засинанням: true, якщо за цей час з'явилася робота або сигнал виходу
+        // Spin before parking: true if work or an exit signal appeared meanwhile
+        // Спин перед засыпанием: true, если за это время появилась работа или сигнал выхода
+        bool spinForWork(const WorkerSlot& slot);
+
+        // Передача пробудження іншому робітнику, якщо зупинений робітник забрав сповіщення
+        // Pass a wake-up on to another worker if a retiring worker consumed the notification
+        // Передача пробуждения другому рабочему, если уходящий рабочий забрал уведомление
+        void handOffWakeup();
+
+        // Виконання завдання з обліком активних потоків і часу
+        // Run a task, tracking active threads and time
+        // Выполнение задачи с учетом активных потоков и времени
+        void runTask(TaskFunction& task, WorkerCounters& counters, size_t queueDepth);
+
+        // Сума лічильників усіх слотів (під controlMutex)
+        // Sum of all slot counters (under controlMutex)
+        // Сумма счетчиков всех слотов (под controlMutex)
+        ThreadPoolStatistics collectCounters() const;
+
+        // Час потоків за поточне вікно статистики в наносекундах (під controlMutex)
+        // Thread time in the current statistics window in nanoseconds (under controlMutex)
+        // Время потоков за текущее окно статистики в наносекундах (под controlMutex)
+        int64_t windowThreadNanoseconds(int64_t now) const;
+
+        // Режим черги та кількість потоків
+        // Queue mode and thread count
+        // Режим очереди и количество потоков
+        ThreadPoolMode mode;
+        std::atomic<size_t> threadCount;
+
+        // Слоти робітників (MAX_THREAD_COUNT елементів, вектор ніколи не перерозподіляється)
+        // та кількість створених слотів, серед яких злодії шукають жертву
+        // Worker slots (MAX_THREAD_COUNT entries, the vector is never reallocated)
+        // and the number of created slots among which thieves look for a victim
+        // Слоты рабочих (MAX_THREAD_COUNT элементов, вектор никогда не перераспределяется)
+        // и количество созданных слотов, среди которых воры ищут жертву
+        std::vector<std::unique_ptr<WorkerSlot>> slots;
+        std::atomic<size_t> slotCount;
+
+        // Лічильники черг та робітників без роботи
+        // Queue and idle worker counters
+        // Счетчики очередей и рабочих без работы
+        std::atomic<size_t> pendingTasks;
+        std::atomic<size_t> injectedTasks;
+        std::atomic<size_t> sleepingWorkers;
+        std::atomic<size_t> spinningWorkers;
+        std::atomic<size_t> spinCount;
+
+        // Черга завдань (у режимі WORK_STEALING - черга впровадження для зовнішніх потоків)
+        // Task queue (in WORK_STEALING mode - the injection queue for external threads)
+        // Очередь задач (в режиме WORK_STEALING - очередь внедрения для внешних потоков)
+        std::queue<TaskFunction> tasks;
 
         // Мутекс для синхронізації доступу до черги
         // Mutex for synchronizing access to queue
@@ -99,6 +347,17 @@ namespace NeuroSync {
         // Atomic counter of active threads
         // Атомарный счетчик активных потоков
         std::atomic<size_t> activeThreads;
+
+        // М'ютекс керування (resize, restart, статистика) та вікно статистики:
+        // лічильники на момент скидання, його час і час потоків до останньої зміни розміру
+        // Control mutex (resize, restart, statistics) and the statistics window:
+        // counters at the reset, its time and the thread time up to the last resize
+        // Мьютекс управления (resize, restart, статистика) и окно статистики:
+        // счетчики на момент сброса, его время и время потоков до последнего изменения размера
+        mutable std::mutex controlMutex;
+        ThreadPoolStatistics statisticsBaseline;
+        int64_t lastResizeTime;
+        int64_t accumulatedThreadNanoseconds;
     };
 
     // Реалізація шаблонної функції enqueue
@@ -108,28 +367,24 @@ namespace NeuroSync {
     auto ThreadPool::enqueue(F&& f, Args&&... args) 
         -> std::future<typename std::result_of<F(Args...)>::type> {
         using returnType = typename std::result_of<F(Args...)>::type;
+        using callType = BoundTaskCall<typename std::decay<F>::type, typename std::decay<Args>::type...>;
 
-        auto task = std::make_shared<std::packaged_task<returnType()>>(
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-        );
-
-        std::future<returnType> res = task->get_future();
-        {
-            std::unique_lock<std::mutex> lock(queueMutex);
-
-            // Не додаємо завдання, якщо пул зупинено
-            // Don't add task if pool is stopped
-            // Не добавляем задачу, если пул остановлен
-            if (stopFlag.load()) {
-                throw std::runtime_error("enqueue on stopped ThreadPool");
-            }
-
-            tasks.emplace([task]() { (*task)(); });
-        }
-        condition.notify_one();
+        std::promise<returnType> promise(std::allocator_arg, PooledAllocator<returnType>());
+        std::future<returnType> res = promise.get_future();
+        submit(PromiseTaskCall<returnType, callType>(
+            std::move(promise), callType(std::forward<F>(f), std::forward<Args>(args)...)));
         return res;
     }
 
+    // Реалізація шаблонної функції post
+    // Implementation of post template function
+    // Реализация шаблонной функции post
+    template<class F, class... Args>
+    void ThreadPool::post(F&& f, Args&&... args) {
+        using callType = BoundTaskCall<typename std::decay<F>::type, typename std::decay<Args>::type...>;
+        submit(callType(std::forward<F>(f), std::forward<Args>(args)...));
+    }
+
 } // namespace NeuroSync
 
 #endif // THREAD_POOL_H
\ No newline at end of file
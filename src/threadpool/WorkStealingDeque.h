@@ -0,0 +1,166 @@
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// WorkStealingDeque.h
+// Дек Чейза-Лева для пулу потоків з крадіжкою роботи
+// Chase-Lev deque for the work-stealing thread pool
+// Дек Чейза-Лева для пула потоков с кражей работы
+
+namespace NeuroSync {
+
+    // Дек Чейза-Лева (у формулюванні Ле та ін. для моделі пам'яті C11).
+    // Власник кладе та забирає елементи з нижнього кінця (LIFO, без CAS, окрім останнього елемента),
+    // інші потоки крадуть з верхнього кінця (FIFO, один CAS). Масив росте вдвічі при заповненні;
+    // старі масиви живуть до знищення деку, бо злодій може ще читати з них.
+    // T має бути тривіально копійованим (зазвичай вказівник).
+    // Chase-Lev deque (in the formulation of Le et al. for the C11 memory model).
+    // The owner pushes and pops at the bottom end (LIFO, no CAS except for the last element),
+    // other threads steal from the top end (FIFO, one CAS). The array doubles when full;
+    // old arrays live until the deque is destroyed, since a thief may still be reading them.
+    // T must be trivially copyable (usually a pointer).
+    // Дек Чейза-Лева (в формулировке Ле и др. для модели памяти C11).
+    // Владелец кладет и забирает элементы с нижнего конца (LIFO, без CAS, кроме последнего элемента),
+    // другие потоки крадут с верхнего конца (FIFO, один CAS). Массив растет вдвое при заполнении;
+    // старые массивы живут до уничтожения дека, потому что вор может еще читать из них.
+    // T должен быть тривиально копируемым (обычно указатель).
+    template<typename T>
+    class WorkStealingDeque {
+    public:
+        explicit WorkStealingDeque(size_t initialCapacity = 256)
+            : top(0), bottom(0) {
+            size_t capacity = 2;
+            while (capacity < initialCapacity) {
+                capacity *= 2;
+            }
+            arrays.emplace_back(new Array(capacity));
+            array.store(arrays.back().get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        // Додавання елемента власником
+        // Push an element (owner only)
+        // Добавление элемента владельцем
+        void push(T value) {
+            int64_t b = bottom.load(std::memory_order_relaxed);
+            int64_t t = top.load(std::memory_order_acquire);
+            Array* a = array.load(std::memory_order_relaxed);
+            if (b - t > static_cast<int64_t>(a->capacity) - 1) {
+                a = grow(a, t, b);
+            }
+            a->put(b, value);
+            bottom.store(b + 1, std::memory_order_release);
+        }
+
+        // Вилучення останнього доданого елемента власником
+        // Pop the most recently pushed element (owner only)
+        // Извлечение последнего добавленного элемента владельцем
+        bool pop(T& value) {
+            int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+            Array* a = array.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top.load(std::memory_order_relaxed);
+
+            if (t > b) {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            value = a->get(b);
+            if (t == b) {
+                // Останній елемент: змагання зі злодіями через CAS на top
+                // Last element: race against thieves with a CAS on top
+                // Последний элемент: гонка с ворами через CAS на top
+                bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return won;
+            }
+            return true;
+        }
+
+        // Крадіжка найстарішого елемента іншим потоком (false, якщо порожньо або програно гонку)
+        // Steal the oldest element from another thread (false if empty or the race was lost)
+        // Кража самого старого элемента другим потоком (false, если пусто или гонка проиграна)
+        bool steal(T& value) {
+            int64_t t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t b = bottom.load(std::memory_order_acquire);
+            if (t >= b) {
+                return false;
+            }
+
+            Array* a = array.load(std::memory_order_acquire);
+            T candidate = a->get(t);
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return false;
+            }
+            value = candidate;
+            return true;
+        }
+
+        // Приблизна кількість елементів
+        // Approximate number of elements
+        // Приблизительное количество элементов
+        size_t size() const {
+            int64_t b = bottom.load(std::memory_order_relaxed);
+            int64_t t = top.load(std::memory_order_relaxed);
+            return b > t ? static_cast<size_t>(b - t) : 0;
+        }
+
+        bool empty() const { return size() == 0; }
+
+    private:
+        struct Array {
+            explicit Array(size_t capacity)
+                : capacity(capacity), mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+
+            T get(int64_t index) const {
+                return slots[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+            }
+
+            void put(int64_t index, T value) {
+                slots[static_cast<size_t>(index) & mask].store(value, std::memory_order_relaxed);
+            }
+
+            size_t capacity;
+            size_t mask;
+            std::unique_ptr<std::atomic<T>[]> slots;
+        };
+
+        // Подвоєння масиву (лише власник)
+        // Double the array (owner only)
+        // Удвоение массива (только владелец)
+        Array* grow(Array* old, int64_t t, int64_t b) {
+            arrays.emplace_back(new Array(old->capacity * 2));
+            Array* bigger = arrays.back().get();
+            for (int64_t i = t; i < b; ++i) {
+                bigger->put(i, old->get(i));
+            }
+            array.store(bigger, std::memory_order_release);
+            return bigger;
+        }
+
+        // top, bottom та array лежать на окремих рядках кешу (C++17 виділяє такий дек із вирівнюванням)
+        // top, bottom and array live on separate cache lines (C++17 allocates such a deque with that alignment)
+        // top, bottom и array лежат на отдельных строках кэша (C++17 выделяет такой дек с этим выравниванием)
+        alignas(64) std::atomic<int64_t> top;
+        alignas(64) std::atomic<int64_t> bottom;
+        alignas(64) std::atomic<Array*> array;
+
+        // Усі виділені масиви (змінюється лише власником)
+        // All allocated arrays (modified by the owner only)
+        // Все выделенные массивы (изменяется только владельцем)
+        std::vector<std::unique_ptr<Array>> arrays;
+    };
+
+} // namespace NeuroSync
+
+#endif // WORK_STEALING_DEQUE_H